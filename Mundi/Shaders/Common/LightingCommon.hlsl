@@ -55,12 +55,20 @@ uint CalculateTileIndex(float4 screenPos, float viewportStartX, float viewportSt
     return tileY * TileCountX + tileX;
 }
 
-// 타일별 라이트 인덱스 데이터의 시작 오프셋 계산
-uint GetTileDataOffset(uint tileIndex)
+// 클러스터 인덱스 계산 (픽셀 위치 + 뷰 공간 깊이, 로그 분포 슬라이스)
+uint CalculateClusterIndex(float4 screenPos, float viewDepth)
 {
-    // MaxLightsPerTile = 256 (TileLightCuller.h와 일치)
-    const uint MaxLightsPerTile = 256;
-    return tileIndex * MaxLightsPerTile;
+    uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
+    int slice = (int) floor(log(max(viewDepth, 1e-4f)) * ClusterDepthScale + ClusterDepthBias);
+    uint sliceIndex = (uint) clamp(slice, 0, (int) ClusterSliceCount - 1);
+    return sliceIndex * TileCountX * TileCountY + tileIndex;
+}
+
+// 클러스터의 라이트 인덱스 범위 (g_TileLightIndices[lightOffset ~ lightOffset + lightCount))
+void GetClusterLightRange(uint clusterIndex, out uint lightOffset, out uint lightCount)
+{
+    lightOffset = g_TileLightIndices[clusterIndex * 2];
+    lightCount = g_TileLightIndices[clusterIndex * 2 + 1];
 }
 
 //================================================================================================
@@ -856,16 +864,16 @@ float3 CalculateAllLights(
         ShadowMap2D, ShadowSampler
     );
 
-    // Point + Spot with 타일 컬링
+    // Point + Spot with 클러스터 컬링
     if (bUseTileCulling)
     {
-        uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        uint clusterIndex = CalculateClusterIndex(screenPos, viewPos.z);
+        uint lightOffset, lightCount;
+        GetClusterLightRange(clusterIndex, lightOffset, lightCount);
 
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightOffset + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;
             uint lightIdx = packedIndex & 0xFFFF;
 
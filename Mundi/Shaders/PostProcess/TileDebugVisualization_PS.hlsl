@@ -1,7 +1,7 @@
 //================================================================================================
 // Filename:      TileDebugVisualization_PS.hlsl
-// Description:   타일 기반 라이트 컬링 디버그 시각화 픽셀 셰이더
-//                각 타일의 라이트 개수를 히트맵으로 표시
+// Description:   클러스터 기반 라이트 컬링 디버그 시각화 픽셀 셰이더
+//                각 타일의 (깊이 슬라이스 중 최대) 라이트 개수를 히트맵으로 표시
 //================================================================================================
 
 // b11: 타일 컬링 설정 상수 버퍼
@@ -13,16 +13,20 @@ cbuffer TileCullingBuffer : register(b11)
     uint bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint ViewportStartX;    // 뷰포트 시작 X 좌표
     uint ViewportStartY;    // 뷰포트 시작 Y 좌표
-    uint2 Padding;          // 16바이트 정렬을 위한 패딩
+    uint ClusterSliceCount; // 깊이 슬라이스 개수
+    uint Padding;           // 16바이트 정렬을 위한 패딩
+    float ClusterDepthScale; // Slice = floor(log(ViewZ) * Scale + Bias)
+    float ClusterDepthBias;
+    float2 Padding2;
 };
 
 // t0: 원본 씬 텍스처
 Texture2D g_SceneTexture : register(t0);
 SamplerState g_SamplerLinear : register(s0);
 
-// t2: 타일별 라이트 인덱스 Structured Buffer
-// 구조: [TileIndex * MaxLightsPerTile] = LightCount
-//       [TileIndex * MaxLightsPerTile + 1 ~ ...] = LightIndices
+// t2: 클러스터별 라이트 인덱스 Structured Buffer
+// 구조: [ClusterIndex * 2] = Offset, [ClusterIndex * 2 + 1] = LightCount
+//       [Offset ~ Offset + LightCount) = LightIndices
 StructuredBuffer<uint> g_TileLightIndices : register(t2);
 
 // 타일 인덱스 계산
@@ -38,11 +42,20 @@ uint CalculateTileIndex(float2 screenPos)
     return tileY * TileCountX + tileX;
 }
 
-// 타일별 라이트 인덱스 데이터의 시작 오프셋 계산
-uint GetTileDataOffset(uint tileIndex)
+// 타일의 깊이 슬라이스 중 최대 라이트 개수 (씬 깊이 없이 타일 단위로 표시)
+uint GetMaxClusterLightCount(uint tileIndex)
 {
-    const uint MaxLightsPerTile = 256;
-    return tileIndex * MaxLightsPerTile;
+    uint tileCount = TileCountX * TileCountY;
+    uint maxCount = 0;
+
+    [loop]
+    for (uint slice = 0; slice < ClusterSliceCount; slice++)
+    {
+        uint clusterIndex = slice * tileCount + tileIndex;
+        maxCount = max(maxCount, g_TileLightIndices[clusterIndex * 2 + 1]);
+    }
+
+    return maxCount;
 }
 
 // 라이트 개수를 색상으로 변환 (히트맵)
@@ -98,10 +111,9 @@ float4 mainPS(float4 Pos : SV_Position, float2 TexCoord : TEXCOORD0) : SV_Target
 
     // 현재 픽셀이 속한 타일 계산
     uint tileIndex = CalculateTileIndex(Pos.xy);
-    uint tileDataOffset = GetTileDataOffset(tileIndex);
 
-    // 타일의 라이트 개수
-    uint lightCount = g_TileLightIndices[tileDataOffset];
+    // 타일의 라이트 개수 (슬라이스 중 최대)
+    uint lightCount = GetMaxClusterLightCount(tileIndex);
 
     // 히트맵 색상 계산
     float3 heatmapColor = LightCountToHeatmap(lightCount);
@@ -0,0 +1,23 @@
+// 섀도우 아틀라스 영역 초기화 (FullScreenTriangle_VS와 함께 사용, 뷰포트 = 다시 그릴 영역)
+// 캐시된 다른 영역은 유지하고 이 영역만 ClearDepthStencilView / VSM ClearRenderTargetView와 같은 값으로 채웁니다.
+// 깊이 상태는 GreaterEqual + Write (1.0은 어떤 깊이보다 크거나 같으므로 항상 기록됨)
+
+struct PS_INPUT
+{
+    float4 Position : SV_POSITION;
+    float2 TexCoord : TEXCOORD0;
+};
+
+struct PS_OUTPUT
+{
+    float4 Moments : SV_Target0;   // VSM 아틀라스 (PCF는 RTV가 없으므로 무시됨)
+    float Depth : SV_Depth;
+};
+
+PS_OUTPUT mainPS(PS_INPUT Input)
+{
+    PS_OUTPUT Output;
+    Output.Moments = float4(1.0f, 1.0f, 0.0f, 0.0f);
+    Output.Depth = 1.0f;
+    return Output;
+}
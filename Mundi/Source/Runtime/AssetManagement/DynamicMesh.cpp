@@ -106,6 +106,7 @@ bool UDynamicMesh::UpdateData(FMeshData* InData, ID3D11DeviceContext* InContext)
     // Add other vertex types as needed
 
     InContext->Unmap(VertexBuffer, 0);
+    FRHIStatManager::GetInstance().RecordMap(vertexCount * vertexSize);
 
     // Update index buffer
     D3D11_MAPPED_SUBRESOURCE mappedIndex;
@@ -117,6 +118,7 @@ bool UDynamicMesh::UpdateData(FMeshData* InData, ID3D11DeviceContext* InContext)
     memcpy(indices, InData->Indices.data(), indexCount * sizeof(uint32));
 
     InContext->Unmap(IndexBuffer, 0);
+    FRHIStatManager::GetInstance().RecordMap(indexCount * sizeof(uint32));
 
     return true;
 }
@@ -94,6 +94,7 @@ bool ULineDynamicMesh::UpdateData(FMeshData* InData, ID3D11DeviceContext* InCont
         dstVertices[i].Color = (i < InData->Color.size()) ? InData->Color[i] : FVector4(1, 1, 1, 1);
     }
     InContext->Unmap(VertexBuffer, 0);
+    FRHIStatManager::GetInstance().RecordMap(vertexCount * sizeof(FVertexSimple));
 
     D3D11_MAPPED_SUBRESOURCE mappedIndex;
     hr = InContext->Map(IndexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedIndex);
@@ -103,6 +104,7 @@ bool ULineDynamicMesh::UpdateData(FMeshData* InData, ID3D11DeviceContext* InCont
     uint32* indices = static_cast<uint32*>(mappedIndex.pData);
     memcpy(indices, InData->Indices.data(), indexCount * sizeof(uint32));
     InContext->Unmap(IndexBuffer, 0);
+    FRHIStatManager::GetInstance().RecordMap(indexCount * sizeof(uint32));
 
     return true;
 }
@@ -132,6 +134,7 @@ bool ULineDynamicMesh::UpdateDataInterleaved(const TArray<FVertexSimple>& Vertic
 
     memcpy(mappedVertex.pData, Vertices.data(), vertexCount * sizeof(FVertexSimple));
     InContext->Unmap(VertexBuffer, 0);
+    FRHIStatManager::GetInstance().RecordMap(vertexCount * sizeof(FVertexSimple));
 
     // 인덱스 버퍼 업데이트 (memcpy 사용)
     D3D11_MAPPED_SUBRESOURCE mappedIndex;
@@ -141,6 +144,7 @@ bool ULineDynamicMesh::UpdateDataInterleaved(const TArray<FVertexSimple>& Vertic
 
     memcpy(mappedIndex.pData, Indices.data(), indexCount * sizeof(uint32));
     InContext->Unmap(IndexBuffer, 0);
+    FRHIStatManager::GetInstance().RecordMap(indexCount * sizeof(uint32));
 
     return true;
 }
@@ -48,6 +48,10 @@ void UResourceManager::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* I
     CreateTextBillboardMesh();//"TextBillboard"
     CreateBillboardMesh(); // Billboard
     CreateTextBillboardTexture();
+
+    // 지난 실행에서 쓴 셰이더 Variant를 병렬로 미리 컴파일 (디스크 바이트코드 캐시 적중 시 읽기만 함)
+    FShaderCache::GetInstance().PrecompileManifest();
+
     CreateDefaultShader();
     CreateDefaultMaterial();
 }
@@ -700,6 +704,7 @@ void UResourceManager::UpdateDynamicVertexBuffer(const FString& Name, TArray<FBi
     Context->Map(Mesh->GetVertexBuffer(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
     memcpy(mappedResource.pData, vertices.data(), sizeof(FBillboardVertexInfo_GPU) * vertices.size()); //vertices.size()만큼의 Character info를 vertices에서 pData로 복사해가라
     Context->Unmap(Mesh->GetVertexBuffer(), 0);
+    FRHIStatManager::GetInstance().RecordMap(sizeof(FBillboardVertexInfo_GPU) * vertices.size());
 }
 
 UMaterial* UResourceManager::GetDefaultMaterial()
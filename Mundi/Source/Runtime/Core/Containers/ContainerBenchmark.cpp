@@ -0,0 +1,192 @@
+﻿#include "pch.h"
+#include "ContainerBenchmark.h"
+#include "PlatformTime.h"
+#include "AABB.h"
+#include "Hash.h"
+
+class UPrimitiveComponent;
+
+namespace
+{
+	// 재현 가능한 의사 난수 (xorshift)
+	struct FBenchRandom
+	{
+		uint64 State = 0x9E3779B97F4A7C15ull;
+
+		uint32 Next()
+		{
+			State ^= State << 13;
+			State ^= State >> 7;
+			State ^= State << 17;
+			return static_cast<uint32>(State >> 32);
+		}
+	};
+
+	// 실제 객체 대신 주소만 쓰는 가짜 포인터 (힙 객체처럼 16바이트 정렬)
+	void* FakePointer(uint32 Index)
+	{
+		return reinterpret_cast<void*>(static_cast<uintptr_t>(0x10000000ull + static_cast<uint64>(Index) * 176));
+	}
+
+	// 최적화로 결과가 사라지지 않도록 누적
+	volatile uint64 GBenchSink = 0;
+
+	template<typename FuncType>
+	double MeasureMs(FuncType&& Func)
+	{
+		const uint64 Start = FPlatformTime::Cycles64();
+		Func();
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+	}
+
+	template<typename MapType>
+	void ObjectRegistryWorkload(int32 NumObjects, int32 NumLookups)
+	{
+		MapType Map;
+		FBenchRandom Random;
+		uint64 Sum = 0;
+
+		for (int32 i = 1; i <= NumObjects; ++i)
+		{
+			Map[static_cast<uint32>(i)] = static_cast<UObject*>(FakePointer(i));
+		}
+
+		for (int32 i = 0; i < NumLookups; ++i)
+		{
+			const uint32 Index = Random.Next() % static_cast<uint32>(NumObjects * 2) + 1;
+			auto It = Map.find(Index);
+			if (It != Map.end())
+			{
+				Sum += reinterpret_cast<uintptr_t>(It->second);
+			}
+
+			// 가끔 객체 삭제 + 새 객체 생성 (인덱스는 계속 증가)
+			if ((i & 15) == 0)
+			{
+				Map.erase(Index);
+				Map[static_cast<uint32>(NumObjects + i + 1)] = static_cast<UObject*>(FakePointer(i));
+			}
+		}
+
+		GBenchSink = GBenchSink + Sum + Map.size();
+	}
+
+	template<typename SetType>
+	void DirtySetWorkload(int32 NumComponents, int32 NumFrames)
+	{
+		SetType Set;
+		TArray<void*> Queue;
+		FBenchRandom Random;
+		uint64 Sum = 0;
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			// 이번 프레임에 움직인 컴포넌트 (중복 포함)
+			const int32 NumDirty = NumComponents / 8;
+			for (int32 i = 0; i < NumDirty; ++i)
+			{
+				void* Component = FakePointer(Random.Next() % static_cast<uint32>(NumComponents));
+				if (Set.insert(Component).second)
+				{
+					Queue.Add(Component);
+				}
+			}
+
+			for (void* Component : Queue)
+			{
+				Sum += Set.erase(Component);
+			}
+			Queue.clear();
+		}
+
+		GBenchSink = GBenchSink + Sum;
+	}
+
+	template<typename MapType>
+	void BoundsLookupWorkload(int32 NumComponents, int32 NumPasses)
+	{
+		MapType Map;
+		for (int32 i = 0; i < NumComponents; ++i)
+		{
+			const float Offset = static_cast<float>(i);
+			Map[static_cast<UPrimitiveComponent*>(FakePointer(i))] = FAABB(FVector(Offset, 0.0f, 0.0f), FVector(Offset + 1.0f, 1.0f, 1.0f));
+		}
+
+		FBenchRandom Random;
+		float Sum = 0.0f;
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			// 컬링 결과 컴포넌트의 캐시된 바운드 조회
+			for (int32 i = 0; i < NumComponents; ++i)
+			{
+				const auto It = Map.find(static_cast<UPrimitiveComponent*>(FakePointer(Random.Next() % static_cast<uint32>(NumComponents))));
+				if (It != Map.end())
+				{
+					Sum += It->second.Min.X;
+				}
+			}
+
+			// 전체 바운드 재계산용 순회
+			for (const auto& Pair : Map)
+			{
+				Sum += Pair.second.Max.Y;
+			}
+		}
+
+		GBenchSink = GBenchSink + static_cast<uint64>(Sum);
+	}
+
+	template<typename SetType>
+	void OverlapPairsWorkload(int32 NumPairs, int32 NumFrames)
+	{
+		SetType Set;
+		FBenchRandom Random;
+		uint64 Sum = 0;
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Set.clear();
+			for (int32 i = 0; i < NumPairs; ++i)
+			{
+				// 양쪽 콜백에서 같은 쌍이 한 번씩 더 들어오도록 키 범위를 절반으로
+				const uint64 Key = HashCombine(reinterpret_cast<uintptr_t>(FakePointer(Random.Next() % static_cast<uint32>(NumPairs / 2))),
+					reinterpret_cast<uintptr_t>(FakePointer(Frame)));
+				if (!Set.Contains(Key))
+				{
+					Set.Add(Key);
+					++Sum;
+				}
+			}
+		}
+
+		GBenchSink = GBenchSink + Sum;
+	}
+}
+
+TArray<FContainerBenchmarkResult> FContainerBenchmark::Run(int32 Scale)
+{
+	Scale = FMath::Max(1, Scale);
+	TArray<FContainerBenchmarkResult> Results;
+
+	FContainerBenchmarkResult& Registry = Results.emplace_back();
+	Registry.Name = "ObjectRegistry";
+	Registry.StdMs = MeasureMs([&]() { ObjectRegistryWorkload<TMap<uint32, UObject*>>(50000 * Scale, 1000000 * Scale); });
+	Registry.FlatMs = MeasureMs([&]() { ObjectRegistryWorkload<TFlatMap<uint32, UObject*>>(50000 * Scale, 1000000 * Scale); });
+
+	FContainerBenchmarkResult& Dirty = Results.emplace_back();
+	Dirty.Name = "DirtySet";
+	Dirty.StdMs = MeasureMs([&]() { DirtySetWorkload<TSet<void*>>(20000 * Scale, 200); });
+	Dirty.FlatMs = MeasureMs([&]() { DirtySetWorkload<TFlatSet<void*>>(20000 * Scale, 200); });
+
+	FContainerBenchmarkResult& BoundsResult = Results.emplace_back();
+	BoundsResult.Name = "BoundsLookup";
+	BoundsResult.StdMs = MeasureMs([&]() { BoundsLookupWorkload<TMap<UPrimitiveComponent*, FAABB>>(20000 * Scale, 50); });
+	BoundsResult.FlatMs = MeasureMs([&]() { BoundsLookupWorkload<TFlatMap<UPrimitiveComponent*, FAABB>>(20000 * Scale, 50); });
+
+	FContainerBenchmarkResult& Overlap = Results.emplace_back();
+	Overlap.Name = "OverlapPairs";
+	Overlap.StdMs = MeasureMs([&]() { OverlapPairsWorkload<TSet<uint64>>(2000 * Scale, 1000); });
+	Overlap.FlatMs = MeasureMs([&]() { OverlapPairsWorkload<TFlatSet<uint64>>(2000 * Scale, 1000); });
+
+	return Results;
+}
@@ -0,0 +1,27 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 한 워크로드의 std 기반(TMap/TSet) vs 오픈 어드레싱(TFlatMap/TFlatSet) 측정 결과
+struct FContainerBenchmarkResult
+{
+	const char* Name = "";
+	double StdMs = 0.0;
+	double FlatMs = 0.0;
+};
+
+/**
+ * FContainerBenchmark
+ * 엔진에서 해시 컨테이너를 쓰는 방식을 흉내 낸 워크로드로 TMap/TSet과 TFlatMap/TFlatSet을 비교합니다.
+ * (콘솔: BENCH CONTAINERS)
+ *
+ * - ObjectRegistry : uint32 → UObject* 등록 / 무작위 조회(WeakPtr Get) / 일부 삭제 (GUObjectArray)
+ * - DirtySet       : 포인터 집합에 중복 삽입 방지 후 FIFO 순서로 제거 (ComponentDirtySet)
+ * - BoundsLookup   : 포인터 → AABB 조회와 전체 순회 (BVH StaticMeshComponentBounds)
+ * - OverlapPairs   : 매 프레임 비우고 uint64 쌍 키를 Contains + Add (FrameOverlapPairs)
+ */
+class FContainerBenchmark
+{
+public:
+	// Scale = 요소 수 배율 (1 = 워크로드당 약 수만 개)
+	static TArray<FContainerBenchmarkResult> Run(int32 Scale = 1);
+};
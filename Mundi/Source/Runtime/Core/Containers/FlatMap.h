@@ -0,0 +1,435 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/**
+ * TFlatHashTable
+ * Robin Hood 오픈 어드레싱 해시 테이블입니다. TFlatMap / TFlatSet의 공통 구현.
+ *
+ * - 요소는 TArray 하나에 빽빽하게 저장하고, 버킷 배열에는 (탐색 거리 + 해시 지문, 요소 인덱스)만 저장
+ *   → 삽입당 노드 할당 없음, 순회는 배열 순회와 같음
+ * - 버킷 위치는 해시 상위 비트, 지문은 하위 8비트. 거리가 같은 버킷에서 지문이 맞을 때만 키를 비교
+ * - 삭제는 버킷을 뒤에서 앞으로 당기고(backward shift), 요소 배열의 마지막 요소를 빈 자리로 옮김
+ *
+ * 순회 순서: 삽입 순서. 단, Remove/erase는 마지막 요소를 지운 자리로 옮기므로 그 이후로는 순서를 보장하지 않음.
+ * 무효화: 삽입은 모든 반복자/포인터/참조를, 삭제는 지운 요소와 마지막 요소를 가리키던 것을 무효화함.
+ *         (std::unordered_map과 달리 참조가 안정적이지 않으므로 Find 결과를 삽입 너머로 들고 있지 말 것)
+ * 순회 중 삭제는 It = erase(It) 패턴으로만 (같은 위치에 아직 방문하지 않은 마지막 요소가 들어옴)
+ */
+template<typename ElementType, typename KeyType, typename KeyFuncs>
+class TFlatHashTable
+{
+public:
+    using iterator = typename TArray<ElementType>::iterator;
+    using const_iterator = typename TArray<ElementType>::const_iterator;
+
+    TFlatHashTable() = default;
+
+    iterator begin() { return Elements.begin(); }
+    iterator end() { return Elements.end(); }
+    const_iterator begin() const { return Elements.begin(); }
+    const_iterator end() const { return Elements.end(); }
+
+    size_t size() const { return Elements.size(); }
+    bool empty() const { return Elements.empty(); }
+
+    int32 Num() const { return static_cast<int32>(Elements.size()); }
+    bool IsEmpty() const { return Elements.empty(); }
+
+    /** 요소를 모두 지우되 버킷/요소 메모리는 유지 (매 프레임 비우는 집합용) */
+    void clear()
+    {
+        Elements.clear();
+        std::fill(Buckets.begin(), Buckets.end(), FBucket{});
+    }
+
+    void Empty() { clear(); }
+
+    /** 최소 Count개를 재할당 없이 담을 수 있도록 확보 */
+    void Reserve(int32 Count)
+    {
+        Elements.reserve(Count);
+        if (static_cast<uint64>(Count) > MaxLoad())
+        {
+            Rehash(BucketCountFor(Count));
+        }
+    }
+
+    iterator find(const KeyType& Key)
+    {
+        const uint32 BucketIndex = FindBucket(Key);
+        return BucketIndex == InvalidBucket ? end() : begin() + Buckets[BucketIndex].ElementIndex;
+    }
+
+    const_iterator find(const KeyType& Key) const
+    {
+        const uint32 BucketIndex = FindBucket(Key);
+        return BucketIndex == InvalidBucket ? end() : begin() + Buckets[BucketIndex].ElementIndex;
+    }
+
+    bool Contains(const KeyType& Key) const
+    {
+        return FindBucket(Key) != InvalidBucket;
+    }
+
+    size_t count(const KeyType& Key) const
+    {
+        return Contains(Key) ? 1 : 0;
+    }
+
+    size_t erase(const KeyType& Key)
+    {
+        const uint32 BucketIndex = FindBucket(Key);
+        if (BucketIndex == InvalidBucket)
+        {
+            return 0;
+        }
+        EraseBucket(BucketIndex);
+        return 1;
+    }
+
+    /** 지운 위치를 반환 (마지막 요소가 옮겨 오므로 같은 위치부터 계속 순회) */
+    iterator erase(const_iterator It)
+    {
+        const uint32 ElementIndex = static_cast<uint32>(It - Elements.cbegin());
+        EraseBucket(FindBucketOfElement(ElementIndex));
+        return begin() + ElementIndex;
+    }
+
+    iterator erase(iterator It)
+    {
+        return erase(const_iterator(It));
+    }
+
+protected:
+    /** 키가 있으면 해당 요소, 없으면 MakeElement()로 만든 요소를 추가. second = 새로 추가했는지 */
+    template<typename FactoryType>
+    std::pair<iterator, bool> FindOrInsert(const KeyType& Key, FactoryType&& MakeElement)
+    {
+        if (static_cast<uint64>(Elements.size()) + 1 > MaxLoad())
+        {
+            Rehash(Buckets.empty() ? MinBucketCount : static_cast<uint32>(Buckets.size()) * 2);
+        }
+
+        const uint64 Hash = HashKey(Key);
+        uint32 DistAndFingerprint = DistIncrement | static_cast<uint32>(Hash & FingerprintMask);
+        uint32 BucketIndex = static_cast<uint32>(Hash >> Shift);
+
+        while (true)
+        {
+            const FBucket& Bucket = Buckets[BucketIndex];
+            if (Bucket.DistAndFingerprint == DistAndFingerprint
+                && KeyFuncs::GetKey(Elements[Bucket.ElementIndex]) == Key)
+            {
+                return { begin() + Bucket.ElementIndex, false };
+            }
+            if (DistAndFingerprint > Bucket.DistAndFingerprint)
+            {
+                break;
+            }
+            DistAndFingerprint += DistIncrement;
+            BucketIndex = NextBucket(BucketIndex);
+        }
+
+        const uint32 ElementIndex = static_cast<uint32>(Elements.size());
+        Elements.push_back(MakeElement());
+        PlaceAndShiftUp({ DistAndFingerprint, ElementIndex }, BucketIndex);
+        return { begin() + ElementIndex, true };
+    }
+
+    TArray<ElementType> Elements;
+
+private:
+    struct FBucket
+    {
+        uint32 DistAndFingerprint = 0;   // 0 = 빈 버킷, 상위 24비트 = 탐색 거리 + 1, 하위 8비트 = 해시 지문
+        uint32 ElementIndex = 0;
+    };
+
+    static constexpr uint32 DistIncrement = 1u << 8;
+    static constexpr uint64 FingerprintMask = 0xFF;
+    static constexpr uint32 MinBucketCount = 16;
+    static constexpr uint32 InvalidBucket = ~0u;
+
+    // 포인터/정수 키는 std::hash가 그대로 값을 돌려주므로(하위 비트가 0) 한 번 섞어서 사용
+    static uint64 HashKey(const KeyType& Key)
+    {
+        uint64 Hash = static_cast<uint64>(std::hash<KeyType>{}(Key));
+        Hash ^= Hash >> 33;
+        Hash *= 0xff51afd7ed558ccdull;
+        Hash ^= Hash >> 33;
+        return Hash;
+    }
+
+    // 최대 적재율 80%
+    uint64 MaxLoad() const
+    {
+        return static_cast<uint64>(Buckets.size()) * 4 / 5;
+    }
+
+    static uint32 BucketCountFor(int32 Count)
+    {
+        uint32 BucketCount = MinBucketCount;
+        while (static_cast<uint64>(BucketCount) * 4 / 5 < static_cast<uint64>(Count))
+        {
+            BucketCount *= 2;
+        }
+        return BucketCount;
+    }
+
+    uint32 NextBucket(uint32 BucketIndex) const
+    {
+        return (BucketIndex + 1) & (static_cast<uint32>(Buckets.size()) - 1);
+    }
+
+    uint32 FindBucket(const KeyType& Key) const
+    {
+        if (Elements.empty())
+        {
+            return InvalidBucket;
+        }
+
+        const uint64 Hash = HashKey(Key);
+        uint32 DistAndFingerprint = DistIncrement | static_cast<uint32>(Hash & FingerprintMask);
+        uint32 BucketIndex = static_cast<uint32>(Hash >> Shift);
+
+        while (true)
+        {
+            const FBucket& Bucket = Buckets[BucketIndex];
+            if (Bucket.DistAndFingerprint == DistAndFingerprint
+                && KeyFuncs::GetKey(Elements[Bucket.ElementIndex]) == Key)
+            {
+                return BucketIndex;
+            }
+            // Robin Hood 불변식: 더 가까운 요소를 만나면 찾는 키는 없음 (빈 버킷 포함)
+            if (DistAndFingerprint > Bucket.DistAndFingerprint)
+            {
+                return InvalidBucket;
+            }
+            DistAndFingerprint += DistIncrement;
+            BucketIndex = NextBucket(BucketIndex);
+        }
+    }
+
+    // 요소 인덱스를 가리키는 버킷 (요소의 키로 탐색)
+    uint32 FindBucketOfElement(uint32 ElementIndex) const
+    {
+        const uint64 Hash = HashKey(KeyFuncs::GetKey(Elements[ElementIndex]));
+        uint32 BucketIndex = static_cast<uint32>(Hash >> Shift);
+        while (Buckets[BucketIndex].ElementIndex != ElementIndex || Buckets[BucketIndex].DistAndFingerprint == 0)
+        {
+            BucketIndex = NextBucket(BucketIndex);
+        }
+        return BucketIndex;
+    }
+
+    // 자리를 차지하고 있던 버킷들을 한 칸씩 뒤로 밀며 삽입
+    void PlaceAndShiftUp(FBucket Bucket, uint32 BucketIndex)
+    {
+        while (Buckets[BucketIndex].DistAndFingerprint != 0)
+        {
+            std::swap(Bucket, Buckets[BucketIndex]);
+            Bucket.DistAndFingerprint += DistIncrement;
+            BucketIndex = NextBucket(BucketIndex);
+        }
+        Buckets[BucketIndex] = Bucket;
+    }
+
+    void EraseBucket(uint32 BucketIndex)
+    {
+        const uint32 ElementIndex = Buckets[BucketIndex].ElementIndex;
+
+        // backward shift: 뒤따르는 버킷 중 제자리가 아닌 것들을 한 칸씩 당김
+        uint32 Next = NextBucket(BucketIndex);
+        while (Buckets[Next].DistAndFingerprint >= DistIncrement * 2)
+        {
+            Buckets[BucketIndex] = { Buckets[Next].DistAndFingerprint - DistIncrement, Buckets[Next].ElementIndex };
+            BucketIndex = Next;
+            Next = NextBucket(Next);
+        }
+        Buckets[BucketIndex] = FBucket{};
+
+        // 마지막 요소를 빈 자리로 옮기고 그 요소의 버킷 인덱스를 갱신
+        const uint32 LastIndex = static_cast<uint32>(Elements.size()) - 1;
+        if (ElementIndex != LastIndex)
+        {
+            Buckets[FindBucketOfElement(LastIndex)].ElementIndex = ElementIndex;
+            Elements[ElementIndex] = std::move(Elements[LastIndex]);
+        }
+        Elements.pop_back();
+    }
+
+    void Rehash(uint32 NewBucketCount)
+    {
+        Buckets.assign(NewBucketCount, FBucket{});
+
+        Shift = 64;
+        for (uint32 Count = NewBucketCount; Count > 1; Count >>= 1)
+        {
+            --Shift;
+        }
+
+        for (uint32 ElementIndex = 0; ElementIndex < static_cast<uint32>(Elements.size()); ++ElementIndex)
+        {
+            const uint64 Hash = HashKey(KeyFuncs::GetKey(Elements[ElementIndex]));
+            uint32 DistAndFingerprint = DistIncrement | static_cast<uint32>(Hash & FingerprintMask);
+            uint32 BucketIndex = static_cast<uint32>(Hash >> Shift);
+            while (DistAndFingerprint < Buckets[BucketIndex].DistAndFingerprint)
+            {
+                DistAndFingerprint += DistIncrement;
+                BucketIndex = NextBucket(BucketIndex);
+            }
+            PlaceAndShiftUp({ DistAndFingerprint, ElementIndex }, BucketIndex);
+        }
+    }
+
+    TArray<FBucket> Buckets;
+    uint32 Shift = 64;
+};
+
+template<typename KeyType, typename ValueType>
+struct TFlatMapKeyFuncs
+{
+    static const KeyType& GetKey(const std::pair<KeyType, ValueType>& Element) { return Element.first; }
+};
+
+template<typename T>
+struct TFlatSetKeyFuncs
+{
+    static const T& GetKey(const T& Element) { return Element; }
+};
+
+/**
+ * TFlatMap - 오픈 어드레싱 해시 맵 (TMap과 같은 API)
+ * 포인터/정수 키로 매 프레임 조회·삽입·삭제가 잦은 곳에 사용합니다.
+ * 요소는 std::pair<KeyType, ValueType>이며 first(키)를 직접 수정하면 안 됩니다.
+ * 참조 안정성과 순회 순서는 TFlatHashTable 주석 참고.
+ */
+template<typename KeyType, typename ValueType>
+class TFlatMap : public TFlatHashTable<std::pair<KeyType, ValueType>, KeyType, TFlatMapKeyFuncs<KeyType, ValueType>>
+{
+    using Super = TFlatHashTable<std::pair<KeyType, ValueType>, KeyType, TFlatMapKeyFuncs<KeyType, ValueType>>;
+
+public:
+    using typename Super::iterator;
+    using value_type = std::pair<KeyType, ValueType>;
+
+    /** 요소 추가/수정 */
+    void Add(const KeyType& Key, const ValueType& Value)
+    {
+        (*this)[Key] = Value;
+    }
+
+    /** 키가 없을 때만 추가 */
+    template<typename... Args>
+    void Emplace(const KeyType& Key, Args&&... args)
+    {
+        this->FindOrInsert(Key, [&]() { return value_type(Key, ValueType(std::forward<Args>(args)...)); });
+    }
+
+    ValueType& FindOrAdd(const KeyType& Key)
+    {
+        return this->FindOrInsert(Key, [&]() { return value_type(Key, ValueType{}); }).first->second;
+    }
+
+    ValueType& operator[](const KeyType& Key)
+    {
+        return FindOrAdd(Key);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& Pair)
+    {
+        return this->FindOrInsert(Pair.first, [&]() { return Pair; });
+    }
+
+    /** 제거 */
+    bool Remove(const KeyType& Key)
+    {
+        return this->erase(Key) > 0;
+    }
+
+    /** 검색 */
+    ValueType* Find(const KeyType& Key)
+    {
+        auto it = this->find(Key);
+        return (it != this->end()) ? &it->second : nullptr;
+    }
+
+    const ValueType* Find(const KeyType& Key) const
+    {
+        auto it = this->find(Key);
+        return (it != this->end()) ? &it->second : nullptr;
+    }
+
+    /** 찾거나 기본값 반환 */
+    ValueType FindRef(const KeyType& Key) const
+    {
+        auto it = this->find(Key);
+        return (it != this->end()) ? it->second : ValueType{};
+    }
+
+    /** 키/값 배열 반환 */
+    TArray<KeyType> GetKeys() const
+    {
+        TArray<KeyType> Keys;
+        Keys.Reserve(this->Num());
+        for (const auto& Pair : this->Elements)
+        {
+            Keys.Add(Pair.first);
+        }
+        return Keys;
+    }
+
+    TArray<ValueType> GetValues() const
+    {
+        TArray<ValueType> Values;
+        Values.Reserve(this->Num());
+        for (const auto& Pair : this->Elements)
+        {
+            Values.Add(Pair.second);
+        }
+        return Values;
+    }
+};
+
+/**
+ * TFlatSet - 오픈 어드레싱 해시 집합 (TSet과 같은 API)
+ * 순회는 const 요소만 허용합니다 (요소가 곧 키).
+ */
+template<typename T>
+class TFlatSet : public TFlatHashTable<T, T, TFlatSetKeyFuncs<T>>
+{
+    using Super = TFlatHashTable<T, T, TFlatSetKeyFuncs<T>>;
+
+public:
+    using typename Super::const_iterator;
+    using iterator = const_iterator;
+
+    const_iterator begin() const { return Super::begin(); }
+    const_iterator end() const { return Super::end(); }
+
+    const_iterator find(const T& Item) const { return Super::find(Item); }
+
+    /** 요소 추가 */
+    void Add(const T& Item)
+    {
+        insert(Item);
+    }
+
+    std::pair<const_iterator, bool> insert(const T& Item)
+    {
+        auto Result = this->FindOrInsert(Item, [&]() { return Item; });
+        return { Result.first, Result.second };
+    }
+
+    /** 제거 */
+    bool Remove(const T& Item)
+    {
+        return this->erase(Item) > 0;
+    }
+
+    /** 배열로 변환 */
+    TArray<T> Array() const
+    {
+        return this->Elements;
+    }
+};
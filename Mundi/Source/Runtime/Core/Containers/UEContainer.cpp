@@ -1 +1,4 @@
 ﻿#include "pch.h"
+
+std::atomic<uint64> FInlineAllocatorStats::InlineAllocations{ 0 };
+std::atomic<uint64> FInlineAllocatorStats::HeapAllocations{ 0 };
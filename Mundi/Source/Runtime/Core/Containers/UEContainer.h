@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <atomic>
 
 /** UE5 스타일 기본 타입 정의 */
 typedef int int32;
@@ -33,12 +34,191 @@ using TPair = std::pair<T1, T2>;
 template<typename T, SIZE_T N>
 using TStaticArray = std::array<T, N>;
 
+/**
+ * TArray 할당 정책
+ * ForElementType<T>가 표준 allocator 요구사항을 만족하면 됩니다. (예: FFrameArenaAllocator)
+ */
+struct FDefaultAllocator
+{
+    template<typename T>
+    using ForElementType = std::allocator<T>;
+};
+
+/** 인라인 할당 통계 (MEMREPORT) */
+struct FInlineAllocatorStats
+{
+    // 인라인 버퍼로 처리한 할당 (이전에는 모두 힙 할당)
+    static std::atomic<uint64> InlineAllocations;
+    // 인라인 용량을 넘어 힙으로 간 할당
+    static std::atomic<uint64> HeapAllocations;
+};
+
+/**
+ * TArray 할당 정책: 처음 NumInlineElements개는 배열 객체 안의 버퍼에 저장하고, 넘치면 힙으로 이동
+ * 쿼리 스택, 오버랩 목록, 본 자식 목록처럼 대부분 몇 개 안 되는 배열에 사용합니다.
+ *
+ * - 버퍼는 TArray가 갖고(TArrayAllocatorStorage), 할당기는 그 주소만 가짐
+ * - 이동은 포인터를 훔치지 않고 요소 단위로 옮김 (버퍼가 원본 객체 안에 있으므로)
+ * - 멤버 swap()은 쓰지 말 것 (std::swap은 이동으로 처리되어 안전)
+ * - 상속된 생성자(개수/범위 지정 등)로 만든 배열은 힙만 사용. 기본 생성 후 Append/Add를 쓸 것
+ */
+template<uint32 NumInlineElements>
+struct TInlineAllocator
+{
+    template<typename T>
+    struct FStorage
+    {
+        alignas(T) uint8 Bytes[sizeof(T) * NumInlineElements];
+        bool bInUse = false;
+    };
+
+    template<typename T>
+    class ForElementType
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+        using is_always_equal = std::false_type;
+
+        template<typename U>
+        struct rebind { using other = ForElementType<U>; };
+
+        ForElementType() noexcept = default;
+        explicit ForElementType(FStorage<T>* InStorage) noexcept : Storage(InStorage) {}
+
+        // 다른 요소 타입으로 rebind된 할당기(디버그 컨테이너 프록시 등)는 힙만 사용
+        template<typename U>
+        ForElementType(const ForElementType<U>&) noexcept {}
+
+        // 복사된 배열이 원본의 버퍼를 가리키지 않도록
+        ForElementType select_on_container_copy_construction() const noexcept { return ForElementType(); }
+
+        T* allocate(SIZE_T Count)
+        {
+            if (Storage && !Storage->bInUse && Count <= NumInlineElements)
+            {
+                Storage->bInUse = true;
+                FInlineAllocatorStats::InlineAllocations.fetch_add(1, std::memory_order_relaxed);
+                return reinterpret_cast<T*>(Storage->Bytes);
+            }
+            FInlineAllocatorStats::HeapAllocations.fetch_add(1, std::memory_order_relaxed);
+            return std::allocator<T>().allocate(Count);
+        }
+
+        void deallocate(T* Ptr, SIZE_T Count) noexcept
+        {
+            if (Storage && Ptr == reinterpret_cast<T*>(Storage->Bytes))
+            {
+                Storage->bInUse = false;
+                return;
+            }
+            std::allocator<T>().deallocate(Ptr, Count);
+        }
+
+        // 같은 버퍼를 쓰는 할당기끼리만 같음 (둘 다 힙 전용이면 같음)
+        bool operator==(const ForElementType& Other) const noexcept { return Storage == Other.Storage; }
+        bool operator!=(const ForElementType& Other) const noexcept { return Storage != Other.Storage; }
+
+    private:
+        FStorage<T>* Storage = nullptr;
+    };
+};
+
+/** 할당 정책이 배열 객체 안에 두는 저장소 (기본: 없음) */
+template<typename AllocatorType, typename T>
+struct TArrayAllocatorStorage
+{
+    static constexpr bool bHasInlineStorage = false;
+    static constexpr SIZE_T NumInlineElements = 0;
+
+    typename AllocatorType::template ForElementType<T> MakeAllocator() noexcept { return {}; }
+};
+
+template<uint32 N, typename T>
+struct TArrayAllocatorStorage<TInlineAllocator<N>, T>
+{
+    static constexpr bool bHasInlineStorage = true;
+    static constexpr SIZE_T NumInlineElements = N;
+
+    typename TInlineAllocator<N>::template ForElementType<T> MakeAllocator() noexcept
+    {
+        return typename TInlineAllocator<N>::template ForElementType<T>(&InlineStorage);
+    }
+
+    typename TInlineAllocator<N>::template FStorage<T> InlineStorage;
+};
+
 /** TArray 구현 */
-template<typename T>
-class TArray : public std::vector<T>
+template<typename T, typename AllocatorType = FDefaultAllocator>
+class TArray : private TArrayAllocatorStorage<AllocatorType, T>,
+               public std::vector<T, typename AllocatorType::template ForElementType<T>>
 {
+    using StorageType = TArrayAllocatorStorage<AllocatorType, T>;
+    using Super = std::vector<T, typename AllocatorType::template ForElementType<T>>;
+
 public:
-    using std::vector<T>::vector; /** 생성자 상속 */
+    using Super::Super; /** 생성자 상속 */
+
+    // 저장소(인라인 버퍼)는 배열마다 따로 가지므로 복사/이동 시 할당기를 넘겨받지 않음
+    TArray() noexcept
+        : StorageType(), Super(StorageType::MakeAllocator())
+    {
+        ReserveInline();
+    }
+
+    TArray(std::initializer_list<T> InitList)
+        : StorageType(), Super(StorageType::MakeAllocator())
+    {
+        ReserveInline();
+        this->insert(this->end(), InitList);
+    }
+
+    TArray(const TArray& Other)
+        : StorageType(), Super(StorageType::MakeAllocator())
+    {
+        ReserveInline();
+        this->insert(this->end(), Other.begin(), Other.end());
+    }
+
+    TArray(TArray&& Other) noexcept
+        : StorageType(), Super(StorageType::MakeAllocator())
+    {
+        if constexpr (StorageType::bHasInlineStorage)
+        {
+            ReserveInline();
+            Super::operator=(std::move(Other));
+            Other.clear();
+        }
+        else
+        {
+            Super::swap(Other);
+        }
+    }
+
+    TArray& operator=(const TArray& Other)
+    {
+        Super::operator=(Other);
+        return *this;
+    }
+
+    TArray& operator=(TArray&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            // 인라인 정책이면 할당기가 달라 요소 단위로 이동됨
+            Super::operator=(std::move(Other));
+            Other.clear();
+        }
+        return *this;
+    }
+
+    TArray& operator=(std::initializer_list<T> InitList)
+    {
+        Super::operator=(InitList);
+        return *this;
+    }
 
     /** 요소 추가 */
     int32 Add(const T& Item)
@@ -65,8 +245,9 @@ public:
         return static_cast<int32>(std::distance(this->begin(), it));
     }
 
-    /** 배열 병합 */
-    void Append(const TArray<T>& Other)
+    /** 배열 병합 (할당 정책이 달라도 됨) */
+    template<typename OtherAllocatorType>
+    void Append(const TArray<T, OtherAllocatorType>& Other)
     {
         this->insert(this->end(), Other.begin(), Other.end());
     }
@@ -110,7 +291,7 @@ public:
 
         if (bAllowShrinking)
         {
-            this->shrink_to_fit();
+            Shrink();
         }
     }
 
@@ -151,6 +332,22 @@ public:
     // 보유 용량(capacity)을 실제 크기(Num)에 맞춰 축소
     void Shrink()
     {
+        if constexpr (StorageType::bHasInlineStorage)
+        {
+            // 인라인 용량 이하면 힙에 있던 요소를 인라인 버퍼로 되돌림 (shrink_to_fit은 힙에 새로 할당하므로 사용 X)
+            if (this->size() <= StorageType::NumInlineElements)
+            {
+                if (this->capacity() > StorageType::NumInlineElements)
+                {
+                    std::vector<T> Temp(std::make_move_iterator(this->begin()), std::make_move_iterator(this->end()));
+                    this->clear();
+                    this->shrink_to_fit();
+                    ReserveInline();
+                    this->insert(this->end(), std::make_move_iterator(Temp.begin()), std::make_move_iterator(Temp.end()));
+                }
+                return;
+            }
+        }
         this->shrink_to_fit();
     }
 
@@ -236,6 +433,19 @@ public:
             std::swap((*this)[IndexA], (*this)[IndexB]);
         }
     }
+
+private:
+    // 인라인 정책이면 처음부터 인라인 용량만큼 잡아 둠 (std::vector는 1, 2, 4...로 늘리므로)
+    void ReserveInline()
+    {
+        if constexpr (StorageType::bHasInlineStorage)
+        {
+            if (this->capacity() < StorageType::NumInlineElements)
+            {
+                this->reserve(StorageType::NumInlineElements);
+            }
+        }
+    }
 };
 
 /** TSet - 해시 기반 집합 */
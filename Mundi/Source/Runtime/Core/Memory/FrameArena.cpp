@@ -0,0 +1,138 @@
+﻿#include "pch.h"
+#include "FrameArena.h"
+#include "MemoryManager.h"
+#include <mutex>
+
+namespace
+{
+	// 스레드 arena 목록 (EndFrame/GetStats가 순회). arena는 프로세스 종료까지 해제하지 않음
+	std::mutex GArenaRegistryMutex;
+	TArray<FFrameArena*> GArenaRegistry;
+	FFrameArenaStats GLastFrameStats;
+
+	thread_local FFrameArena* GThreadArena = nullptr;
+}
+
+FFrameArena& FFrameArena::Get()
+{
+	if (!GThreadArena)
+	{
+		GThreadArena = new FFrameArena();
+
+		std::lock_guard<std::mutex> Lock(GArenaRegistryMutex);
+		GArenaRegistry.Add(GThreadArena);
+	}
+	return *GThreadArena;
+}
+
+FFrameArena::~FFrameArena()
+{
+	for (FChunk& Chunk : Chunks)
+	{
+		FMemoryManager::Deallocate(Chunk.Data);
+	}
+	Chunks.Empty();
+}
+
+void* FFrameArena::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	if (Size == 0)
+	{
+		Size = 1;
+	}
+
+	uint8* Aligned = reinterpret_cast<uint8*>((reinterpret_cast<uintptr_t>(Cursor) + (Alignment - 1)) & ~(static_cast<uintptr_t>(Alignment) - 1));
+	if (!Cursor || Aligned + Size > End)
+	{
+		AddChunk(Size + Alignment);
+		Aligned = reinterpret_cast<uint8*>((reinterpret_cast<uintptr_t>(Cursor) + (Alignment - 1)) & ~(static_cast<uintptr_t>(Alignment) - 1));
+	}
+
+	UsedBytes += static_cast<SIZE_T>(Aligned + Size - Cursor);
+	++NumAllocations;
+	Cursor = Aligned + Size;
+	return Aligned;
+}
+
+void FFrameArena::AddChunk(SIZE_T MinSize)
+{
+	// 직전 청크의 두 배씩 키워서 한 프레임에 추가되는 청크 수를 log로 제한
+	SIZE_T ChunkSize = Chunks.IsEmpty() ? DefaultChunkSize : Chunks.Last().Size * 2;
+	while (ChunkSize < MinSize)
+	{
+		ChunkSize *= 2;
+	}
+
+	FChunk Chunk;
+	Chunk.Data = static_cast<uint8*>(FMemoryManager::Allocate(ChunkSize, 64, EMemoryTag::FrameArena));
+	Chunk.Size = ChunkSize;
+	Chunks.Add(Chunk);
+
+	Cursor = Chunk.Data;
+	End = Chunk.Data + ChunkSize;
+}
+
+void FFrameArena::Reset()
+{
+	HighWaterBytes = FMath::Max(HighWaterBytes, UsedBytes);
+
+	// 한 프레임에 청크가 여러 개 필요했으면 최대 사용량을 담는 청크 하나로 합침
+	if (Chunks.Num() > 1)
+	{
+		for (FChunk& Chunk : Chunks)
+		{
+			FMemoryManager::Deallocate(Chunk.Data);
+		}
+		Chunks.Empty();
+		Cursor = nullptr;
+		End = nullptr;
+
+		SIZE_T ChunkSize = DefaultChunkSize;
+		while (ChunkSize < HighWaterBytes)
+		{
+			ChunkSize *= 2;
+		}
+		AddChunk(ChunkSize);
+	}
+	else if (!Chunks.IsEmpty())
+	{
+#ifdef _DEBUG
+		memset(Chunks[0].Data, 0xDD, static_cast<SIZE_T>(Cursor - Chunks[0].Data));
+#endif
+		Cursor = Chunks[0].Data;
+		End = Chunks[0].Data + Chunks[0].Size;
+	}
+
+	UsedBytes = 0;
+	NumAllocations = 0;
+}
+
+void FFrameArena::EndFrame()
+{
+	std::lock_guard<std::mutex> Lock(GArenaRegistryMutex);
+
+	FFrameArenaStats Stats;
+	Stats.HighWaterBytes = GLastFrameStats.HighWaterBytes;
+	Stats.NumArenas = static_cast<uint32>(GArenaRegistry.Num());
+	for (FFrameArena* Arena : GArenaRegistry)
+	{
+		Stats.UsedBytes += Arena->UsedBytes;
+		Stats.Allocations += Arena->NumAllocations;
+
+		Arena->Reset();
+
+		for (const FChunk& Chunk : Arena->Chunks)
+		{
+			Stats.ReservedBytes += Chunk.Size;
+		}
+	}
+	Stats.HighWaterBytes = FMath::Max(Stats.HighWaterBytes, Stats.UsedBytes);
+
+	GLastFrameStats = Stats;
+}
+
+FFrameArenaStats FFrameArena::GetStats()
+{
+	std::lock_guard<std::mutex> Lock(GArenaRegistryMutex);
+	return GLastFrameStats;
+}
@@ -0,0 +1,113 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 프레임 arena 통계 (직전 프레임 기준, 모든 스레드 합)
+struct FFrameArenaStats
+{
+	// 직전 프레임에 할당된 바이트 / 할당 횟수
+	uint64 UsedBytes = 0;
+	uint32 Allocations = 0;
+
+	// 실행 이후 한 프레임 최대 사용량 (모든 스레드 합)
+	uint64 HighWaterBytes = 0;
+
+	// 청크로 확보해 둔 메모리 (다음 프레임에 재사용)
+	uint64 ReservedBytes = 0;
+
+	// arena를 만든 스레드 수 (게임 스레드 + 워커)
+	uint32 NumArenas = 0;
+};
+
+/**
+ * FFrameArena
+ * 프레임 단위 선형(bump) 할당기입니다. 스레드마다 하나씩 있고, 게임 스레드가 프레임 끝에 모두 비웁니다.
+ *
+ * - Allocate는 포인터만 밀고, 개별 해제는 없음 (EndFrame에서 한꺼번에 리셋)
+ * - 청크가 모자라면 두 배 크기의 청크를 이어 붙이고, 리셋 때 최대 사용량 크기의 청크 하나로 합침
+ *   → 워밍업 후에는 프레임당 malloc/free 없음
+ * - 할당한 메모리는 EndFrame 이후 무효. 프레임을 넘겨 살아남는 멤버/캐시에는 쓰지 말 것
+ *   (디버그 빌드는 리셋 시 0xDD로 채워 잘못된 접근을 드러냄)
+ *
+ * 컨테이너에서는 TArray<T, FFrameArenaAllocator> (= TFrameArray<T>)로 사용합니다.
+ */
+class FFrameArena
+{
+public:
+	// 현재 스레드의 arena (처음 호출 시 생성되어 프로세스 종료까지 유지)
+	static FFrameArena& Get();
+
+	// 모든 스레드의 arena를 리셋하고 통계를 확정 (엔진 메인 루프의 프레임 끝, 워커가 쉬는 시점에 게임 스레드에서 호출)
+	static void EndFrame();
+
+	static FFrameArenaStats GetStats();
+
+	void* Allocate(SIZE_T Size, SIZE_T Alignment);
+
+	~FFrameArena();
+	FFrameArena(const FFrameArena&) = delete;
+	FFrameArena& operator=(const FFrameArena&) = delete;
+
+private:
+	FFrameArena() = default;
+
+	struct FChunk
+	{
+		uint8* Data = nullptr;
+		SIZE_T Size = 0;
+	};
+
+	void AddChunk(SIZE_T MinSize);
+	void Reset();
+
+	static constexpr SIZE_T DefaultChunkSize = 256 * 1024;
+
+	TArray<FChunk> Chunks;
+	uint8* Cursor = nullptr;
+	uint8* End = nullptr;
+
+	// 이번 프레임 사용량 (이전 청크에서 쓴 양 포함)
+	SIZE_T UsedBytes = 0;
+	uint32 NumAllocations = 0;
+
+	// 이 스레드의 한 프레임 최대 사용량 (리셋 시 청크 크기 결정)
+	SIZE_T HighWaterBytes = 0;
+};
+
+/**
+ * TArray 할당 정책: FFrameArena에서 할당 (해제는 하지 않음)
+ * 할당 시점의 스레드 arena를 쓰므로 워커에서 만든 배열을 게임 스레드가 키워도 안전 (둘 다 프레임 끝까지 유효)
+ */
+struct FFrameArenaAllocator
+{
+	template<typename T>
+	class ForElementType
+	{
+	public:
+		using value_type = T;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal = std::true_type;
+
+		template<typename U>
+		struct rebind { using other = ForElementType<U>; };
+
+		ForElementType() noexcept = default;
+		template<typename U>
+		ForElementType(const ForElementType<U>&) noexcept {}
+
+		T* allocate(SIZE_T Count)
+		{
+			return static_cast<T*>(FFrameArena::Get().Allocate(Count * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T*, SIZE_T) noexcept {}
+
+		template<typename U>
+		bool operator==(const ForElementType<U>&) const noexcept { return true; }
+		template<typename U>
+		bool operator!=(const ForElementType<U>&) const noexcept { return false; }
+	};
+};
+
+// 프레임 끝까지만 유효한 임시 배열 (렌더 패스 배치 목록, 쿼리 결과 등)
+template<typename T>
+using TFrameArray = TArray<T, FFrameArenaAllocator>;
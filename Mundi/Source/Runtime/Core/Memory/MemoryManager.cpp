@@ -2,29 +2,460 @@
 #include "MemoryManager.h"
 #include <cstddef>
 #include <malloc.h>
-#include <algorithm>
+#include <mutex>
+#include <new>
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
+thread_local EMemoryTag FMemoryManager::CurrentTag = EMemoryTag::Default;
+
+namespace
+{
+	// 모든 할당 앞에 붙는 헤더 (사용자 포인터 바로 앞, 16바이트 정렬 유지)
+	struct alignas(16) FAllocationHeader
+	{
+		uint64 Size;		// 요청 크기
+		uint32 Offset;		// 큰 할당: 원본 포인터 → 사용자 포인터 거리
+		uint8 Tag;
+		uint8 SizeClass;	// LargeSizeClass면 풀을 거치지 않은 할당
+		uint16 Padding;
+	};
+	static_assert(sizeof(FAllocationHeader) == 16, "FAllocationHeader must be 16 bytes");
+
+	constexpr SIZE_T HeaderSize = sizeof(FAllocationHeader);
+	constexpr SIZE_T PoolAlignment = 16;
+	constexpr uint8 LargeSizeClass = 0xFF;
+
+	// 블록 크기 (헤더 포함, 16의 배수)
+	constexpr uint32 SizeClassBytes[] = { 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512 };
+	constexpr int32 NumSizeClasses = static_cast<int32>(sizeof(SizeClassBytes) / sizeof(SizeClassBytes[0]));
+	constexpr SIZE_T MaxPooledBlock = 512;
+
+	constexpr SIZE_T PoolPageSize = 64 * 1024;
+
+	// 스레드 캐시 ↔ 전역 창고 교환 단위, 스레드 캐시 상한
+	constexpr int32 TransferBatch = 32;
+	constexpr int32 MaxCachedBlocks = TransferBatch * 2;
+
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	// 크기 클래스별 전역 창고 (스레드 캐시가 비거나 넘칠 때만 잠금)
+	struct FPoolDepot
+	{
+		std::mutex Mutex;
+		FFreeBlock* FreeList = nullptr;
+		int32 NumFree = 0;
+	};
+
+	constexpr int32 NumTags = static_cast<int32>(EMemoryTag::Count);
+
+	// 전역 태그 카운터: 종료된 스레드의 카운터와 스레드 캐시 소멸 이후의 할당/해제가 여기로 모임
+	struct FTagCounters
+	{
+		std::atomic<int64> CurrentBytes{ 0 };
+		std::atomic<int64> PeakBytes{ 0 };
+		std::atomic<int64> LiveCount{ 0 };
+		std::atomic<uint64> TotalCount{ 0 };
+	};
+
+	// 스레드별 태그 카운터 (FThreadCache 소유)
+	// 소유 스레드만 relaxed load + store로 갱신하므로 공유 캐시 라인 경합이나 잠금 접두 RMW가 없음
+	// 다른 스레드는 등록 목록을 잠근 상태에서 읽기만 함 (CollectTagTotals)
+	struct FThreadTagCounters
+	{
+		std::atomic<int64> CurrentBytes[NumTags]{};
+		std::atomic<int64> LiveCount[NumTags]{};
+		std::atomic<uint64> TotalCount[NumTags]{};
+
+		FThreadTagCounters* Prev = nullptr;
+		FThreadTagCounters* Next = nullptr;
+
+		void Add(int32 Tag, int64 Bytes, int64 Count)
+		{
+			CurrentBytes[Tag].store(CurrentBytes[Tag].load(std::memory_order_relaxed) + Bytes, std::memory_order_relaxed);
+			LiveCount[Tag].store(LiveCount[Tag].load(std::memory_order_relaxed) + Count, std::memory_order_relaxed);
+			if (Count > 0)
+			{
+				TotalCount[Tag].store(TotalCount[Tag].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			}
+		}
+	};
+
+	// 합산 결과 (CollectTagTotals)
+	struct FTagTotals
+	{
+		int64 CurrentBytes = 0;
+		int64 LiveCount = 0;
+		uint64 TotalCount = 0;
+	};
+
+	// 프레임 변화량 (게임 스레드에서만 갱신/조회)
+	struct FTagFrameSnapshot
+	{
+		int64 LastBytes = 0;
+		uint64 LastTotalCount = 0;
+		int64 DeltaBytes = 0;
+		uint64 Allocations = 0;
+	};
+
+	// 정적 소멸 이후에도 해제가 들어올 수 있으므로 (PhysX / Lua / 전역 객체 소멸자) 전역 상태는 해제하지 않음
+	struct FMemoryState
+	{
+		FPoolDepot Depots[NumSizeClasses];
+		uint8 SizeClassLookup[MaxPooledBlock / 16 + 1] = {};
+		std::atomic<uint64> PoolReservedBytes{ 0 };
+
+		FTagCounters Tags[NumTags];
+		FTagFrameSnapshot Frames[NumTags];
+
+		// 살아 있는 스레드 캐시의 카운터 목록 (스레드 시작/종료와 합산 때만 잠금)
+		std::mutex ThreadCountersMutex;
+		FThreadTagCounters* ThreadCountersHead = nullptr;
+
+		FMemoryState()
+		{
+			int32 Class = 0;
+			for (SIZE_T Units = 0; Units <= MaxPooledBlock / 16; ++Units)
+			{
+				while (SizeClassBytes[Class] < Units * 16)
+				{
+					++Class;
+				}
+				SizeClassLookup[Units] = static_cast<uint8>(Class);
+			}
+		}
+	};
+
+	FMemoryState& GetState()
+	{
+		// 전역 operator new가 이 함수를 거치므로 힙을 쓰지 않고 정적 저장소에 생성
+		alignas(FMemoryState) static uint8 Storage[sizeof(FMemoryState)];
+		static FMemoryState* State = new (Storage) FMemoryState();
+		return *State;
+	}
+
+	void RegisterThreadCounters(FThreadTagCounters& Counters)
+	{
+		FMemoryState& State = GetState();
+		std::lock_guard<std::mutex> Lock(State.ThreadCountersMutex);
+		Counters.Next = State.ThreadCountersHead;
+		if (State.ThreadCountersHead)
+		{
+			State.ThreadCountersHead->Prev = &Counters;
+		}
+		State.ThreadCountersHead = &Counters;
+	}
+
+	// 스레드 종료: 남은 카운터를 전역 카운터로 합치고 목록에서 제거 (합산과 같은 잠금이라 중복/누락 없음)
+	void UnregisterThreadCounters(FThreadTagCounters& Counters)
+	{
+		FMemoryState& State = GetState();
+		std::lock_guard<std::mutex> Lock(State.ThreadCountersMutex);
+		for (int32 Tag = 0; Tag < NumTags; ++Tag)
+		{
+			State.Tags[Tag].CurrentBytes.fetch_add(Counters.CurrentBytes[Tag].load(std::memory_order_relaxed), std::memory_order_relaxed);
+			State.Tags[Tag].LiveCount.fetch_add(Counters.LiveCount[Tag].load(std::memory_order_relaxed), std::memory_order_relaxed);
+			State.Tags[Tag].TotalCount.fetch_add(Counters.TotalCount[Tag].load(std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+
+		if (Counters.Prev)
+		{
+			Counters.Prev->Next = Counters.Next;
+		}
+		else
+		{
+			State.ThreadCountersHead = Counters.Next;
+		}
+		if (Counters.Next)
+		{
+			Counters.Next->Prev = Counters.Prev;
+		}
+		Counters.Prev = Counters.Next = nullptr;
+	}
+
+	// 전역 카운터 + 살아 있는 스레드 카운터 합산. 최대치는 합산할 때 갱신 (EndFrame / GetTagStats 시점 기준)
+	void CollectTagTotals(FTagTotals (&OutTotals)[NumTags])
+	{
+		FMemoryState& State = GetState();
+		std::lock_guard<std::mutex> Lock(State.ThreadCountersMutex);
+
+		for (int32 Tag = 0; Tag < NumTags; ++Tag)
+		{
+			OutTotals[Tag].CurrentBytes = State.Tags[Tag].CurrentBytes.load(std::memory_order_relaxed);
+			OutTotals[Tag].LiveCount = State.Tags[Tag].LiveCount.load(std::memory_order_relaxed);
+			OutTotals[Tag].TotalCount = State.Tags[Tag].TotalCount.load(std::memory_order_relaxed);
+		}
+
+		for (const FThreadTagCounters* Counters = State.ThreadCountersHead; Counters; Counters = Counters->Next)
+		{
+			for (int32 Tag = 0; Tag < NumTags; ++Tag)
+			{
+				OutTotals[Tag].CurrentBytes += Counters->CurrentBytes[Tag].load(std::memory_order_relaxed);
+				OutTotals[Tag].LiveCount += Counters->LiveCount[Tag].load(std::memory_order_relaxed);
+				OutTotals[Tag].TotalCount += Counters->TotalCount[Tag].load(std::memory_order_relaxed);
+			}
+		}
+
+		for (int32 Tag = 0; Tag < NumTags; ++Tag)
+		{
+			std::atomic<int64>& PeakBytes = State.Tags[Tag].PeakBytes;
+			int64 Peak = PeakBytes.load(std::memory_order_relaxed);
+			while (OutTotals[Tag].CurrentBytes > Peak && !PeakBytes.compare_exchange_weak(Peak, OutTotals[Tag].CurrentBytes, std::memory_order_relaxed))
+			{
+			}
+		}
+	}
+
+	// 창고가 비었으면 새 페이지를 잘라 채움 (Depot.Mutex를 잡은 상태에서 호출)
+	void AddPageToDepot(FPoolDepot& Depot, int32 Class)
+	{
+		uint8* Page = static_cast<uint8*>(_aligned_malloc(PoolPageSize, PoolAlignment));
+		if (!Page)
+		{
+			return;
+		}
+		GetState().PoolReservedBytes.fetch_add(PoolPageSize, std::memory_order_relaxed);
+
+		const SIZE_T BlockSize = SizeClassBytes[Class];
+		const SIZE_T NumBlocks = PoolPageSize / BlockSize;
+		for (SIZE_T i = NumBlocks; i > 0; --i)
+		{
+			FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Page + (i - 1) * BlockSize);
+			Block->Next = Depot.FreeList;
+			Depot.FreeList = Block;
+		}
+		Depot.NumFree += static_cast<int32>(NumBlocks);
+	}
+
+	// 스레드 캐시를 쓸 수 없을 때 (캐시 소멸 이후) 창고와 블록 하나씩 직접 교환
+	void* PopFromDepot(int32 Class)
+	{
+		FPoolDepot& Depot = GetState().Depots[Class];
+		std::lock_guard<std::mutex> Lock(Depot.Mutex);
+		if (!Depot.FreeList)
+		{
+			AddPageToDepot(Depot, Class);
+		}
+
+		FFreeBlock* Block = Depot.FreeList;
+		if (Block)
+		{
+			Depot.FreeList = Block->Next;
+			--Depot.NumFree;
+		}
+		return Block;
+	}
+
+	void PushToDepot(int32 Class, void* Ptr)
+	{
+		FPoolDepot& Depot = GetState().Depots[Class];
+		std::lock_guard<std::mutex> Lock(Depot.Mutex);
+		FFreeBlock* Block = static_cast<FFreeBlock*>(Ptr);
+		Block->Next = Depot.FreeList;
+		Depot.FreeList = Block;
+		++Depot.NumFree;
+	}
+
+	// 스레드 캐시 소멸 여부. 소멸자가 없는 thread_local이라 스레드가 끝날 때까지 읽을 수 있음
+	thread_local bool GThreadCacheDestroyed = false;
+
+	// 스레드별 크기 클래스 캐시와 태그 카운터 (잠금 없음). 스레드 종료 시 남은 블록은 전역 창고로, 카운터는 전역 카운터로
+	struct FThreadCache
+	{
+		FFreeBlock* FreeLists[NumSizeClasses] = {};
+		int32 NumFree[NumSizeClasses] = {};
+		FThreadTagCounters Counters;
+
+		FThreadCache()
+		{
+			RegisterThreadCounters(Counters);
+		}
+
+		~FThreadCache()
+		{
+			for (int32 Class = 0; Class < NumSizeClasses; ++Class)
+			{
+				ReleaseToDepot(Class, NumFree[Class]);
+			}
+			UnregisterThreadCounters(Counters);
+
+			// 이후의 할당/해제 (다른 thread_local / 정적 객체 소멸자)는 전역 창고로 직접 보냄
+			GThreadCacheDestroyed = true;
+		}
+
+		void* Pop(int32 Class)
+		{
+			if (!FreeLists[Class])
+			{
+				Refill(Class);
+			}
+
+			FFreeBlock* Block = FreeLists[Class];
+			if (Block)
+			{
+				FreeLists[Class] = Block->Next;
+				--NumFree[Class];
+			}
+			return Block;
+		}
+
+		void Push(int32 Class, void* Ptr)
+		{
+			FFreeBlock* Block = static_cast<FFreeBlock*>(Ptr);
+			Block->Next = FreeLists[Class];
+			FreeLists[Class] = Block;
+
+			if (++NumFree[Class] > MaxCachedBlocks)
+			{
+				ReleaseToDepot(Class, TransferBatch);
+			}
+		}
+
+		// 창고에서 배치만큼 가져오고, 창고도 비었으면 새 페이지를 잘라 채움
+		void Refill(int32 Class)
+		{
+			FPoolDepot& Depot = GetState().Depots[Class];
+			std::lock_guard<std::mutex> Lock(Depot.Mutex);
+
+			if (!Depot.FreeList)
+			{
+				AddPageToDepot(Depot, Class);
+			}
+
+			for (int32 i = 0; i < TransferBatch && Depot.FreeList; ++i)
+			{
+				FFreeBlock* Block = Depot.FreeList;
+				Depot.FreeList = Block->Next;
+				--Depot.NumFree;
+
+				Block->Next = FreeLists[Class];
+				FreeLists[Class] = Block;
+				++NumFree[Class];
+			}
+		}
+
+		void ReleaseToDepot(int32 Class, int32 Count)
+		{
+			if (Count <= 0)
+			{
+				return;
+			}
+
+			FPoolDepot& Depot = GetState().Depots[Class];
+			std::lock_guard<std::mutex> Lock(Depot.Mutex);
+			for (int32 i = 0; i < Count && FreeLists[Class]; ++i)
+			{
+				FFreeBlock* Block = FreeLists[Class];
+				FreeLists[Class] = Block->Next;
+				--NumFree[Class];
+
+				Block->Next = Depot.FreeList;
+				Depot.FreeList = Block;
+				++Depot.NumFree;
+			}
+		}
+	};
+
+	thread_local FThreadCache GThreadCache;
+
+	void* PopBlock(int32 Class)
+	{
+		return GThreadCacheDestroyed ? PopFromDepot(Class) : GThreadCache.Pop(Class);
+	}
+
+	void PushBlock(int32 Class, void* Ptr)
+	{
+		if (GThreadCacheDestroyed)
+		{
+			PushToDepot(Class, Ptr);
+		}
+		else
+		{
+			GThreadCache.Push(Class, Ptr);
+		}
+	}
+
+	void RecordAllocation(EMemoryTag Tag, SIZE_T Size)
+	{
+		const int32 Index = static_cast<int32>(Tag);
+		if (!GThreadCacheDestroyed)
+		{
+			GThreadCache.Counters.Add(Index, static_cast<int64>(Size), 1);
+			return;
+		}
+
+		FTagCounters& Counters = GetState().Tags[Index];
+		Counters.CurrentBytes.fetch_add(static_cast<int64>(Size), std::memory_order_relaxed);
+		Counters.LiveCount.fetch_add(1, std::memory_order_relaxed);
+		Counters.TotalCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void RecordDeallocation(EMemoryTag Tag, SIZE_T Size)
+	{
+		// 다른 스레드가 할당한 메모리면 이 스레드 카운터는 음수가 될 수 있음 (합산하면 맞음)
+		const int32 Index = static_cast<int32>(Tag);
+		if (!GThreadCacheDestroyed)
+		{
+			GThreadCache.Counters.Add(Index, -static_cast<int64>(Size), -1);
+			return;
+		}
+
+		FTagCounters& Counters = GetState().Tags[Index];
+		Counters.CurrentBytes.fetch_sub(static_cast<int64>(Size), std::memory_order_relaxed);
+		Counters.LiveCount.fetch_sub(1, std::memory_order_relaxed);
+	}
+}
 
 void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	return Allocate(Size, Alignment, CurrentTag);
+}
+
+void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment, EMemoryTag Tag)
+{
+	FMemoryState& State = GetState();
+
+	uint8* User = nullptr;
+	FAllocationHeader Header = {};
+	Header.Size = Size;
+	Header.Tag = static_cast<uint8>(Tag);
+
+	// 1. 소형: 크기 클래스 풀 (블록 = 헤더 + 데이터, 16바이트 정렬)
+	const SIZE_T BlockSize = Size + HeaderSize;
+	if (Alignment <= PoolAlignment && BlockSize <= MaxPooledBlock)
+	{
+		const int32 Class = State.SizeClassLookup[(BlockSize + 15) / 16];
+		uint8* Block = static_cast<uint8*>(PopBlock(Class));
+		if (!Block)
+			return nullptr;
+
+		Header.SizeClass = static_cast<uint8>(Class);
+		User = Block + HeaderSize;
+	}
+	// 2. 대형: 정렬을 맞춘 헤더 영역을 앞에 두고 직접 할당
+	else
+	{
+		const SIZE_T HeaderOffset = FMath::Max(HeaderSize, Alignment);
+		const SIZE_T FinalAlignment = FMath::Max(Alignment, PoolAlignment);
 
 #if defined(_MSC_VER) && defined(_DEBUG)
-	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
+		uint8* Raw = static_cast<uint8*>(_aligned_malloc_dbg(Size + HeaderOffset, FinalAlignment, nullptr, 0));
 #else
-	void* Raw = _aligned_malloc(TotalSize, FinalAlignment);
+		uint8* Raw = static_cast<uint8*>(_aligned_malloc(Size + HeaderOffset, FinalAlignment));
 #endif
-	if (!Raw)
-		return nullptr;
+		if (!Raw)
+			return nullptr;
+
+		Header.SizeClass = LargeSizeClass;
+		Header.Offset = static_cast<uint32>(HeaderOffset);
+		User = Raw + HeaderOffset;
+	}
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+	*reinterpret_cast<FAllocationHeader*>(User - HeaderSize) = Header;
+	RecordAllocation(Tag, Size);
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
+	return User;
 }
 
 void FMemoryManager::Deallocate(void* Ptr)
@@ -32,16 +463,164 @@ void FMemoryManager::Deallocate(void* Ptr)
 	if (!Ptr)
 		return;
 
-	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
+	uint8* User = static_cast<uint8*>(Ptr);
+	const FAllocationHeader Header = *reinterpret_cast<FAllocationHeader*>(User - HeaderSize);
+
+	RecordDeallocation(static_cast<EMemoryTag>(Header.Tag), static_cast<SIZE_T>(Header.Size));
 
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+	if (Header.SizeClass != LargeSizeClass)
+	{
+		// 다른 스레드가 할당한 블록이어도 같은 크기 클래스라 현재 스레드 캐시로 돌려도 됨
+		PushBlock(Header.SizeClass, User - HeaderSize);
+		return;
+	}
 
 #if defined(_MSC_VER) && defined(_DEBUG)
-	_aligned_free_dbg(Raw);
+	_aligned_free_dbg(User - Header.Offset);
 #else
-	_aligned_free(Raw);
+	_aligned_free(User - Header.Offset);
 #endif
-}
\ No newline at end of file
+}
+
+void* FMemoryManager::LuaAllocate(void* UserData, void* Ptr, SIZE_T OldSize, SIZE_T NewSize)
+{
+	if (NewSize == 0)
+	{
+		Deallocate(Ptr);
+		return nullptr;
+	}
+
+	// Ptr이 null이면 OldSize는 Lua 타입 코드이므로 무시
+	void* NewPtr = Allocate(NewSize, PoolAlignment, EMemoryTag::Lua);
+	if (NewPtr && Ptr)
+	{
+		memcpy(NewPtr, Ptr, FMath::Min(OldSize, NewSize));
+		Deallocate(Ptr);
+	}
+	return NewPtr;
+}
+
+const char* FMemoryManager::GetTagName(EMemoryTag Tag)
+{
+	switch (Tag)
+	{
+	case EMemoryTag::Default:		return "Default";
+	case EMemoryTag::Rendering:		return "Rendering";
+	case EMemoryTag::Animation:		return "Animation";
+	case EMemoryTag::Particles:		return "Particles";
+	case EMemoryTag::Physics:		return "Physics";
+	case EMemoryTag::Lua:			return "Lua";
+	case EMemoryTag::FrameArena:	return "FrameArena";
+	default:						return "Unknown";
+	}
+}
+
+FMemoryTagStats FMemoryManager::GetTagStats(EMemoryTag Tag)
+{
+	FTagTotals Totals[NumTags];
+	CollectTagTotals(Totals);
+
+	const int32 Index = static_cast<int32>(Tag);
+	const FTagFrameSnapshot& Frame = GetState().Frames[Index];
+
+	FMemoryTagStats Stats;
+	Stats.CurrentBytes = Totals[Index].CurrentBytes;
+	Stats.PeakBytes = GetState().Tags[Index].PeakBytes.load(std::memory_order_relaxed);
+	Stats.LiveCount = Totals[Index].LiveCount;
+	Stats.TotalCount = Totals[Index].TotalCount;
+	Stats.FrameDeltaBytes = Frame.DeltaBytes;
+	Stats.FrameAllocations = Frame.Allocations;
+	return Stats;
+}
+
+uint64 FMemoryManager::GetTotalAllocationBytes()
+{
+	FTagTotals Totals[NumTags];
+	CollectTagTotals(Totals);
+
+	int64 Bytes = 0;
+	for (const FTagTotals& Total : Totals)
+	{
+		Bytes += Total.CurrentBytes;
+	}
+	return static_cast<uint64>(FMath::Max<int64>(Bytes, 0));
+}
+
+uint64 FMemoryManager::GetTotalAllocationCount()
+{
+	FTagTotals Totals[NumTags];
+	CollectTagTotals(Totals);
+
+	int64 Count = 0;
+	for (const FTagTotals& Total : Totals)
+	{
+		Count += Total.LiveCount;
+	}
+	return static_cast<uint64>(FMath::Max<int64>(Count, 0));
+}
+
+uint64 FMemoryManager::GetPoolReservedBytes()
+{
+	return GetState().PoolReservedBytes.load(std::memory_order_relaxed);
+}
+
+void FMemoryManager::EndFrame()
+{
+	FTagTotals Totals[NumTags];
+	CollectTagTotals(Totals);
+
+	FMemoryState& State = GetState();
+	for (int32 Index = 0; Index < NumTags; ++Index)
+	{
+		const int64 Bytes = Totals[Index].CurrentBytes;
+		const uint64 TotalCount = Totals[Index].TotalCount;
+
+		FTagFrameSnapshot& Frame = State.Frames[Index];
+		Frame.DeltaBytes = Bytes - Frame.LastBytes;
+		Frame.Allocations = TotalCount - Frame.LastTotalCount;
+		Frame.LastBytes = Bytes;
+		Frame.LastTotalCount = TotalCount;
+	}
+}
+
+// ============================================================
+// 전역 operator new / delete
+// TArray / std 컨테이너 / 일반 new도 FMemoryManager를 거치게 해서
+// FMemoryTagScope 태그(Rendering / Animation / Particles 등)가 실제 할당에 적용되도록 함
+// ============================================================
+
+namespace
+{
+	void* AllocateOrThrow(SIZE_T Size, SIZE_T Alignment)
+	{
+		void* Ptr = FMemoryManager::Allocate(Size, Alignment);
+		if (!Ptr)
+		{
+			throw std::bad_alloc();
+		}
+		return Ptr;
+	}
+}
+
+void* operator new(SIZE_T Size) { return AllocateOrThrow(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](SIZE_T Size) { return AllocateOrThrow(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(SIZE_T Size, std::align_val_t Alignment) { return AllocateOrThrow(Size, static_cast<SIZE_T>(Alignment)); }
+void* operator new[](SIZE_T Size, std::align_val_t Alignment) { return AllocateOrThrow(Size, static_cast<SIZE_T>(Alignment)); }
+
+void* operator new(SIZE_T Size, const std::nothrow_t&) noexcept { return FMemoryManager::Allocate(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](SIZE_T Size, const std::nothrow_t&) noexcept { return FMemoryManager::Allocate(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(SIZE_T Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return FMemoryManager::Allocate(Size, static_cast<SIZE_T>(Alignment)); }
+void* operator new[](SIZE_T Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return FMemoryManager::Allocate(Size, static_cast<SIZE_T>(Alignment)); }
+
+void operator delete(void* Ptr) noexcept { FMemoryManager::Deallocate(Ptr); }
+void operator delete[](void* Ptr) noexcept { FMemoryManager::Deallocate(Ptr); }
+void operator delete(void* Ptr, SIZE_T) noexcept { FMemoryManager::Deallocate(Ptr); }
+void operator delete[](void* Ptr, SIZE_T) noexcept { FMemoryManager::Deallocate(Ptr); }
+void operator delete(void* Ptr, std::align_val_t) noexcept { FMemoryManager::Deallocate(Ptr); }
+void operator delete[](void* Ptr, std::align_val_t) noexcept { FMemoryManager::Deallocate(Ptr); }
+void operator delete(void* Ptr, SIZE_T, std::align_val_t) noexcept { FMemoryManager::Deallocate(Ptr); }
+void operator delete[](void* Ptr, SIZE_T, std::align_val_t) noexcept { FMemoryManager::Deallocate(Ptr); }
+void operator delete(void* Ptr, const std::nothrow_t&) noexcept { FMemoryManager::Deallocate(Ptr); }
+void operator delete[](void* Ptr, const std::nothrow_t&) noexcept { FMemoryManager::Deallocate(Ptr); }
+void operator delete(void* Ptr, std::align_val_t, const std::nothrow_t&) noexcept { FMemoryManager::Deallocate(Ptr); }
+void operator delete[](void* Ptr, std::align_val_t, const std::nothrow_t&) noexcept { FMemoryManager::Deallocate(Ptr); }
@@ -1,15 +1,98 @@
 ﻿#pragma once
 #include <cstddef>
+#include <atomic>
 #include "UEContainer.h"
 
+// 할당을 하위 시스템별로 집계하기 위한 태그
+enum class EMemoryTag : uint8
+{
+	Default,
+	Rendering,
+	Animation,
+	Particles,
+	Physics,
+	Lua,
+	FrameArena,
+
+	Count
+};
+
+// 태그별 통계 (GetTagStats 시점 스냅샷)
+struct FMemoryTagStats
+{
+	int64 CurrentBytes = 0;
+	int64 PeakBytes = 0;
+	int64 LiveCount = 0;		// 해제되지 않은 할당 수
+	uint64 TotalCount = 0;		// 누적 할당 횟수
+
+	// 직전 프레임 변화량 (EndFrame 기준): 계속 양수면 누수, 할당 수가 크면 churn
+	int64 FrameDeltaBytes = 0;
+	uint64 FrameAllocations = 0;
+};
+
+/**
+ * FMemoryManager
+ * 엔진 할당기입니다. 전역 operator new / delete를 대체하므로 TArray / std 컨테이너 / 일반 new와
+ * UObject, Lua, PhysX, 프레임 arena 청크가 모두 여기를 거칩니다.
+ *
+ * - 헤더(16바이트)에 크기 / 태그 / 크기 클래스를 기록
+ * - 태그 통계는 스레드 캐시별 카운터에 쌓고 (공유 atomic 갱신 없음), GetTagStats / EndFrame이 모든 스레드를 합산
+ *   (최대치는 합산 시점 기준이라 프레임 안의 순간 최대는 놓칠 수 있음)
+ * - 512바이트 이하(정렬 16 이하)는 크기 클래스별 풀: 스레드 캐시에서 잠금 없이 꺼내고, 모자라거나 넘치면 전역 창고와 배치로 교환
+ *   (풀 페이지는 OS에 돌려주지 않음)
+ * - 그보다 크면 _aligned_malloc으로 직접 할당
+ * - 태그를 지정하지 않으면 현재 스레드의 FMemoryTagScope 태그를 사용
+ */
 class FMemoryManager
 {
 public:
-	// 인자 변수를 PascalCase로 변경
 	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
+	static void* Allocate(SIZE_T Size, SIZE_T Alignment, EMemoryTag Tag);
 	static void  Deallocate(void* Ptr);
 
+	// lua_Alloc 호환 할당 함수 (Lua 태그)
+	static void* LuaAllocate(void* UserData, void* Ptr, SIZE_T OldSize, SIZE_T NewSize);
+
+	static EMemoryTag GetCurrentTag() { return CurrentTag; }
+	static const char* GetTagName(EMemoryTag Tag);
+	static FMemoryTagStats GetTagStats(EMemoryTag Tag);
+
+	// 모든 태그 합계 (해제되지 않은 바이트 / 할당 수)
+	static uint64 GetTotalAllocationBytes();
+	static uint64 GetTotalAllocationCount();
+
+	// 소형 할당 풀이 확보한 페이지 총량
+	static uint64 GetPoolReservedBytes();
+
+	// 태그별 프레임 변화량 확정 (메인 루프의 프레임 끝에서 호출)
+	static void EndFrame();
+
+private:
+	friend class FMemoryTagScope;
+	static thread_local EMemoryTag CurrentTag;
+};
+
+/**
+ * 스코프 동안 이 스레드의 기본 할당 태그를 바꿉니다. (중첩 가능)
+ *   FMemoryTagScope TagScope(EMemoryTag::Rendering);
+ */
+class FMemoryTagScope
+{
 public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	explicit FMemoryTagScope(EMemoryTag Tag)
+		: PreviousTag(FMemoryManager::CurrentTag)
+	{
+		FMemoryManager::CurrentTag = Tag;
+	}
+
+	~FMemoryTagScope()
+	{
+		FMemoryManager::CurrentTag = PreviousTag;
+	}
+
+	FMemoryTagScope(const FMemoryTagScope&) = delete;
+	FMemoryTagScope& operator=(const FMemoryTagScope&) = delete;
+
+private:
+	EMemoryTag PreviousTag;
+};
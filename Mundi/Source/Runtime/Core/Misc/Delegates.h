@@ -4,107 +4,443 @@
 #include <functional>
 #include <algorithm>
 #include <memory>
+#include <new>
 
 #include "WeakObjectPtr.h"
 
 using FDelegateHandle = size_t;
 
+/**
+ * TDelegateBinding
+ * 핸들러 하나를 std::function 없이 저장합니다.
+ *
+ * - 멤버 함수 바인딩(객체 + 멤버 함수 포인터)과 작은 람다는 내부 버퍼에 그대로 저장 (힙 할당 없음)
+ * - 버퍼보다 큰 호출 객체(예: std::function)만 힙에 복사
+ * - UObject 바인딩은 FWeakObjectPtr로 객체를 찾아 호출하고, 객체가 사라졌으면 false 반환 (별도 검증 함수 없음)
+ */
+template<typename... Args>
+class TDelegateBinding
+{
+public:
+    // 객체 포인터 + 멤버 함수 포인터 (MSVC에서 가상 상속 클래스는 최대 24바이트)
+    static constexpr SIZE_T InlineSize = 4 * sizeof(void*);
+
+    TDelegateBinding() = default;
+
+    template<typename FuncType>
+    static TDelegateBinding CreateLambda(FuncType&& Func)
+    {
+        using FFunc = std::decay_t<FuncType>;
+
+        TDelegateBinding Binding;
+        if constexpr (IsInlineType<FFunc>())
+        {
+            new (Binding.Storage) FFunc(std::forward<FuncType>(Func));
+            Binding.Ops = &TInlineOps<FFunc>::Ops;
+        }
+        else
+        {
+            new (Binding.Storage) FFunc*(new FFunc(std::forward<FuncType>(Func)));
+            Binding.Ops = &THeapOps<FFunc>::Ops;
+        }
+        return Binding;
+    }
+
+    template<typename TObj, typename TClass>
+    static TDelegateBinding CreateRaw(TObj* Instance, void(TClass::* Func)(Args...))
+    {
+        return CreateLambda(TRawMethod<TObj, TClass>{ {}, Instance, Func });
+    }
+
+    // UObject 멤버 함수: 객체 포인터 대신 약한 포인터로 저장
+    template<typename TObj, typename TClass>
+    static TDelegateBinding CreateWeak(TObj* Instance, void(TClass::* Func)(Args...))
+    {
+        static_assert(std::is_base_of_v<UObject, TObj>, "CreateWeak requires a UObject");
+
+        TDelegateBinding Binding = CreateLambda(TWeakMethod<TObj, TClass>{ {}, Func });
+        Binding.WeakObject = FWeakObjectPtr(Instance);
+        Binding.bWeak = true;
+        return Binding;
+    }
+
+    TDelegateBinding(const TDelegateBinding& Other)
+        : Ops(Other.Ops), WeakObject(Other.WeakObject), bWeak(Other.bWeak)
+    {
+        if (Ops)
+        {
+            Ops->Copy(Storage, Other.Storage);
+        }
+    }
+
+    TDelegateBinding(TDelegateBinding&& Other) noexcept
+        : Ops(Other.Ops), WeakObject(Other.WeakObject), bWeak(Other.bWeak)
+    {
+        if (Ops)
+        {
+            Ops->Move(Storage, Other.Storage);
+        }
+    }
+
+    TDelegateBinding& operator=(const TDelegateBinding& Other)
+    {
+        if (this != &Other)
+        {
+            TDelegateBinding Temp(Other);
+            *this = std::move(Temp);
+        }
+        return *this;
+    }
+
+    TDelegateBinding& operator=(TDelegateBinding&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Reset();
+            Ops = Other.Ops;
+            WeakObject = Other.WeakObject;
+            bWeak = Other.bWeak;
+            if (Ops)
+            {
+                Ops->Move(Storage, Other.Storage);
+            }
+        }
+        return *this;
+    }
+
+    ~TDelegateBinding()
+    {
+        Reset();
+    }
+
+    void Reset()
+    {
+        if (Ops)
+        {
+            Ops->Destroy(Storage);
+            Ops = nullptr;
+        }
+        bWeak = false;
+    }
+
+    bool IsBound() const
+    {
+        return Ops != nullptr && (!bWeak || WeakObject.IsValid());
+    }
+
+    /** 호출. 바인딩된 UObject가 소멸했으면 호출하지 않고 false 반환 */
+    bool Execute(Args&... args) const
+    {
+        if (!Ops)
+        {
+            return false;
+        }
+
+        UObject* Object = nullptr;
+        if (bWeak)
+        {
+            Object = WeakObject.Get();
+            if (!Object)
+            {
+                return false;
+            }
+        }
+
+        Ops->Invoke(Storage, Object, args...);
+        return true;
+    }
+
+private:
+    struct FOps
+    {
+        void (*Invoke)(const void* Storage, UObject* Object, Args&... args);
+        void (*Copy)(void* Dest, const void* Source);
+        void (*Move)(void* Dest, void* Source);
+        void (*Destroy)(void* Storage);
+    };
+
+    template<typename FFunc>
+    static constexpr bool IsInlineType()
+    {
+        return sizeof(FFunc) <= InlineSize
+            && alignof(FFunc) <= alignof(void*)
+            && std::is_nothrow_move_constructible_v<FFunc>;
+    }
+
+    // 멤버 함수 바인딩 표시 (첫 인자로 약한 포인터에서 얻은 객체를 받음)
+    struct FMethodBinding {};
+
+    template<typename TObj, typename TClass>
+    struct TRawMethod : FMethodBinding
+    {
+        TObj* Instance;
+        void(TClass::* Func)(Args...);
+
+        void operator()(UObject*, Args&... args) const { (Instance->*Func)(args...); }
+    };
+
+    template<typename TObj, typename TClass>
+    struct TWeakMethod : FMethodBinding
+    {
+        void(TClass::* Func)(Args...);
+
+        void operator()(UObject* Object, Args&... args) const { (static_cast<TObj*>(Object)->*Func)(args...); }
+    };
+
+    // 람다는 (Args...)로, 멤버 바인딩은 (UObject*, Args...)로 호출
+    template<typename FFunc>
+    static void Call(const FFunc& Func, UObject* Object, Args&... args)
+    {
+        if constexpr (std::is_base_of_v<FMethodBinding, FFunc>)
+        {
+            Func(Object, args...);
+        }
+        else
+        {
+            Func(args...);
+        }
+    }
+
+    template<typename FFunc>
+    struct TInlineOps
+    {
+        static void Invoke(const void* Storage, UObject* Object, Args&... args) { Call(*static_cast<const FFunc*>(Storage), Object, args...); }
+        static void Copy(void* Dest, const void* Source) { new (Dest) FFunc(*static_cast<const FFunc*>(Source)); }
+        static void Move(void* Dest, void* Source) { new (Dest) FFunc(std::move(*static_cast<FFunc*>(Source))); }
+        static void Destroy(void* Storage) { static_cast<FFunc*>(Storage)->~FFunc(); }
+
+        static constexpr FOps Ops = { &Invoke, &Copy, &Move, &Destroy };
+    };
+
+    // 이동은 포인터만 옮김 (원본은 nullptr로 두어 Destroy에서 무시)
+    template<typename FFunc>
+    struct THeapOps
+    {
+        static void Invoke(const void* Storage, UObject* Object, Args&... args) { Call(**static_cast<FFunc* const*>(Storage), Object, args...); }
+        static void Copy(void* Dest, const void* Source) { new (Dest) FFunc*(new FFunc(**static_cast<FFunc* const*>(Source))); }
+        static void Move(void* Dest, void* Source) { new (Dest) FFunc*(*static_cast<FFunc**>(Source)); *static_cast<FFunc**>(Source) = nullptr; }
+        static void Destroy(void* Storage) { delete *static_cast<FFunc**>(Storage); }
+
+        static constexpr FOps Ops = { &Invoke, &Copy, &Move, &Destroy };
+    };
+
+    alignas(void*) uint8 Storage[InlineSize];
+    const FOps* Ops = nullptr;
+    FWeakObjectPtr WeakObject;
+    bool bWeak = false;
+};
+
+/**
+ * TDelegate (멀티캐스트)
+ * 바인딩을 TArray 하나에 연속으로 저장하고, Broadcast 때 복사하지 않습니다.
+ *
+ * - Broadcast 도중 Remove/Clear: 해당 바인딩만 비활성화하고, 가장 바깥 Broadcast가 끝날 때 한 번에 압축
+ * - Broadcast 도중 Add: 대기 목록에 넣었다가 Broadcast가 끝나면 합침 (이번 Broadcast에서는 호출되지 않음)
+ * - 소멸한 UObject에 바인딩된 핸들러는 호출 시점에 발견해 같은 방식으로 제거
+ */
 template<typename... Args>
 class TDelegate
 {
 public:
     using HandlerType = std::function<void(Args...)>;
-    using ValidatorType = std::function<bool()>; 
 
     TDelegate() : NextHandle(1) {}
 
-    FDelegateHandle Add(const HandlerType& Handler)
+    // 복사본은 살아 있는 바인딩만 가져감 (진행 중인 Broadcast 상태는 복사하지 않음)
+    TDelegate(const TDelegate& Other)
+        : NextHandle(Other.NextHandle)
     {
-       FDelegateHandle Handle = NextHandle++;
-       Handlers.push_back({ 
-           Handle, 
-           Handler, 
-           [] { return true; }
-       });
-       return Handle;
+        CopyLiveBindings(Other);
+    }
+
+    TDelegate& operator=(const TDelegate& Other)
+    {
+        if (this != &Other)
+        {
+            Clear();
+            NextHandle = (Other.NextHandle > NextHandle) ? Other.NextHandle : NextHandle;
+            CopyLiveBindings(Other);
+        }
+        return *this;
+    }
+
+    template<typename FuncType>
+    FDelegateHandle Add(FuncType&& Handler)
+    {
+        // 비어 있는 std::function은 등록하지 않음
+        if constexpr (std::is_same_v<std::decay_t<FuncType>, HandlerType>)
+        {
+            if (!static_cast<bool>(Handler))
+            {
+                return 0;
+            }
+        }
+
+        return AddBinding(TDelegateBinding<Args...>::CreateLambda(std::forward<FuncType>(Handler)));
     }
 
     template<typename TObj, typename TClass>
     FDelegateHandle AddDynamic(TObj* Instance, void(TClass::* Func)(Args...))
     {
-        FDelegateHandle Handle = NextHandle++;
-
         if constexpr (std::is_base_of_v<UObject, TObj>)
         {
-            TWeakObjectPtr<TObj> WeakInstance(Instance);
-            Handlers.push_back({
-                Handle,
-                [WeakInstance, Func](Args... args) {
-                    if (auto Pinned = WeakInstance.Get()) (Pinned->*Func)(args...);
-                },
-                [WeakInstance] { return WeakInstance.IsValid(); }
-            });
+            return AddBinding(TDelegateBinding<Args...>::CreateWeak(Instance, Func));
         }
         else
         {
-            Handlers.push_back({
-                Handle,
-                [=](Args... args) { (Instance->*Func)(args...); },
-                [] { return true; }
-            });
+            return AddBinding(TDelegateBinding<Args...>::CreateRaw(Instance, Func));
         }
-        return Handle;
     }
 
-    void Broadcast(Args... args) 
+    void Broadcast(Args... args)
     {
-       auto NewEnd = std::remove_if(Handlers.begin(), Handlers.end(),
-           [](const Entry& Entry) {
-               if (!Entry.Validator()) 
-               {
-                   return true; 
-               }
-               return false;
-           });
+        // 도중에 추가된 바인딩은 PendingEntries로 가므로 Entries는 재할당되지 않음
+        ++BroadcastDepth;
+        const int32 NumEntries = Entries.Num();
+        for (int32 i = 0; i < NumEntries; ++i)
+        {
+            FEntry& Entry = Entries[i];
+            if (Entry.Handle == 0)
+            {
+                continue;
+            }
 
-       if (NewEnd != Handlers.end())
-       {
-           Handlers.erase(NewEnd, Handlers.end());
-       }
+            if (!Entry.Binding.Execute(args...))
+            {
+                Entry.Handle = 0;
+                bNeedsCompaction = true;
+            }
+        }
 
-       std::vector<Entry> SafeHandlers = Handlers;
-       for (auto& Entry : SafeHandlers) {
-          if (Entry.Handler)
-          {
-             Entry.Handler(args...);
-          }
-       }
+        if (--BroadcastDepth == 0)
+        {
+            Flush();
+        }
     }
 
     void Remove(FDelegateHandle Handle)
     {
-       auto it = std::remove_if(Handlers.begin(), Handlers.end(),
-       [&](const Entry& e) { return e.Handle == Handle; });
-       Handlers.erase(it, Handlers.end());
+        if (Handle == 0)
+        {
+            return;
+        }
+
+        for (int32 i = 0; i < PendingEntries.Num(); ++i)
+        {
+            if (PendingEntries[i].Handle == Handle)
+            {
+                PendingEntries.RemoveAt(i);
+                return;
+            }
+        }
+
+        for (int32 i = 0; i < Entries.Num(); ++i)
+        {
+            if (Entries[i].Handle == Handle)
+            {
+                if (BroadcastDepth > 0)
+                {
+                    Entries[i].Handle = 0;
+                    bNeedsCompaction = true;
+                }
+                else
+                {
+                    Entries.RemoveAt(i);
+                }
+                return;
+            }
+        }
     }
 
     void Clear()
     {
-       Handlers.clear();
+        PendingEntries.clear();
+        if (BroadcastDepth > 0)
+        {
+            for (FEntry& Entry : Entries)
+            {
+                Entry.Handle = 0;
+            }
+            bNeedsCompaction = true;
+        }
+        else
+        {
+            Entries.clear();
+        }
+    }
+
+    bool IsBound() const
+    {
+        for (const FEntry& Entry : Entries)
+        {
+            if (Entry.Handle != 0 && Entry.Binding.IsBound())
+            {
+                return true;
+            }
+        }
+        return !PendingEntries.IsEmpty();
     }
 
 private:
-    struct Entry
+    struct FEntry
     {
-       FDelegateHandle Handle;
-       HandlerType Handler;
-       ValidatorType Validator; 
+        FDelegateHandle Handle = 0;   // 0 = 제거됨 (압축 대기)
+        TDelegateBinding<Args...> Binding;
     };
 
-    std::vector<Entry> Handlers;
+    FDelegateHandle AddBinding(TDelegateBinding<Args...>&& Binding)
+    {
+        FDelegateHandle Handle = NextHandle++;
+        TArray<FEntry>& Target = (BroadcastDepth > 0) ? PendingEntries : Entries;
+        Target.push_back({ Handle, std::move(Binding) });
+        return Handle;
+    }
+
+    void Flush()
+    {
+        if (bNeedsCompaction)
+        {
+            Entries.erase(std::remove_if(Entries.begin(), Entries.end(),
+                [](const FEntry& Entry) { return Entry.Handle == 0; }), Entries.end());
+            bNeedsCompaction = false;
+        }
+
+        if (!PendingEntries.IsEmpty())
+        {
+            for (FEntry& Entry : PendingEntries)
+            {
+                Entries.push_back(std::move(Entry));
+            }
+            PendingEntries.clear();
+        }
+    }
+
+    void CopyLiveBindings(const TDelegate& Other)
+    {
+        TArray<FEntry>& Target = (BroadcastDepth > 0) ? PendingEntries : Entries;
+        for (const FEntry& Entry : Other.Entries)
+        {
+            if (Entry.Handle != 0)
+            {
+                Target.push_back(Entry);
+            }
+        }
+        for (const FEntry& Entry : Other.PendingEntries)
+        {
+            Target.push_back(Entry);
+        }
+    }
+
+    TArray<FEntry> Entries;
+    TArray<FEntry> PendingEntries;
     FDelegateHandle NextHandle;
+    int32 BroadcastDepth = 0;
+    bool bNeedsCompaction = false;
 };
 
+template<typename... Args>
+using TMulticastDelegate = TDelegate<Args...>;
+
 // 델리게이트 인스턴스 생성용 매크로 (실제 멤버 변수 선언)
 #define DECLARE_DELEGATE(Name, ...)				TDelegate<__VA_ARGS__> Name
 #define DECLARE_DELEGATE_OneParam(Name, T1)		TDelegate<T1> Name
@@ -192,9 +192,11 @@ enum class EEngineShowFlags : uint64
 
     SF_Ragdoll = 1ull << 24,  // Show/hide ragdoll physics debug visualization
 
+    SF_OcclusionCulling = 1ull << 25,  // CPU software occlusion culling (bUseAsOccluder static meshes as occluders)
+
     // Default enabled flags
     SF_DefaultEnabled = SF_Primitives | SF_StaticMeshes | SF_SkeletalMeshes | SF_Grid | SF_Lighting | SF_Decals |
-    SF_DOF | SF_Fog | SF_FXAA | SF_Billboard | SF_EditorIcon | SF_Shadows | SF_ShadowAntiAliasing | SF_GPUSkinning | SF_Particles,
+    SF_DOF | SF_Fog | SF_FXAA | SF_Billboard | SF_EditorIcon | SF_Shadows | SF_ShadowAntiAliasing | SF_GPUSkinning | SF_Particles | SF_OcclusionCulling,
 
     // All flags (for initialization/reset)
     SF_All = 0xFFFFFFFFFFFFFFFFull
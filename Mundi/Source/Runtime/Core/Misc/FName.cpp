@@ -1,62 +1,258 @@
 ﻿#include "pch.h"
 #include "Name.h"
+#include <atomic>
+#include <mutex>
 
 namespace
 {
-    // NameMap을 안전하게 가져오는 getter
-    static TMap<FString, uint32>& GetNameMap()
+    constexpr uint32 NumShardBits = 4;
+    constexpr uint32 NumShards = 1u << NumShardBits;
+
+    // 항목 청크: 인덱스 상위 비트 = 청크, 하위 비트 = 청크 내 위치
+    constexpr uint32 EntriesPerChunkBits = 14;
+    constexpr uint32 EntriesPerChunk = 1u << EntriesPerChunkBits;
+    constexpr uint32 MaxChunks = 1024;
+
+    constexpr SIZE_T StringBlockSize = 64 * 1024;
+    constexpr uint32 InitialSlotsPerShard = 256;
+
+    inline char ToLowerAscii(char C)
+    {
+        return (C >= 'A' && C <= 'Z') ? static_cast<char>(C - 'A' + 'a') : C;
+    }
+
+    // 대소문자 무시 FNV-1a (원문에서 바로 계산)
+    uint32 HashNameCaseInsensitive(std::string_view Str)
+    {
+        uint32 Hash = 2166136261u;
+        for (char C : Str)
+        {
+            Hash ^= static_cast<uint8>(ToLowerAscii(C));
+            Hash *= 16777619u;
+        }
+        return Hash;
+    }
+
+    bool EqualsCaseInsensitive(std::string_view A, std::string_view B)
+    {
+        if (A.size() != B.size())
+        {
+            return false;
+        }
+        for (SIZE_T i = 0; i < A.size(); ++i)
+        {
+            if (ToLowerAscii(A[i]) != ToLowerAscii(B[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 슬롯 = (해시 << 32) | (항목 인덱스 + 1), 0이면 빈 슬롯
+    struct FNameSlotTable
+    {
+        uint32 Capacity = 0;
+        std::atomic<uint64>* Slots = nullptr;
+    };
+
+    struct FNameShard
+    {
+        // 새 이름 등록 / 테이블 확장 / 문자열 복사는 잠금 안에서만
+        std::mutex Mutex;
+        std::atomic<FNameSlotTable*> Table{ nullptr };
+        uint32 NumUsed = 0;
+
+        char* StringCursor = nullptr;
+        char* StringEnd = nullptr;
+    };
+
+    // 정적 소멸 중에도 FName을 쓸 수 있도록 테이블은 해제하지 않음
+    struct FNameTable
+    {
+        FNameShard Shards[NumShards];
+        std::atomic<FNameEntry*> Chunks[MaxChunks] = {};
+        std::atomic<uint32> NumEntries{ 0 };
+    };
+
+    FNameTable& GetNameTable()
     {
         // 함수 내의 static 변수는 처음 호출될 때 스레드에 안전하게
         // 단 한 번만 초기화됩니다.
-        static TMap<FString, uint32> GNameMap;
-        return GNameMap;
+        static FNameTable* GTable = new FNameTable();
+        return *GTable;
+    }
+
+    FNameSlotTable* CreateSlotTable(uint32 Capacity)
+    {
+        FNameSlotTable* Table = new FNameSlotTable();
+        Table->Capacity = Capacity;
+        Table->Slots = new std::atomic<uint64>[Capacity];
+        for (uint32 i = 0; i < Capacity; ++i)
+        {
+            Table->Slots[i].store(0, std::memory_order_relaxed);
+        }
+        return Table;
     }
 
-    // Entries를 안전하게 가져오는 getter
-    static TArray<FNameEntry>& GetEntries()
+    // 없으면 -1
+    int64 FindInSlotTable(const FNameSlotTable* Table, uint32 Hash, std::string_view Str)
     {
-        static TArray<FNameEntry> GEntries;
-        return GEntries;
+        if (!Table)
+        {
+            return -1;
+        }
+
+        const uint32 Mask = Table->Capacity - 1;
+        for (uint32 Pos = (Hash >> NumShardBits) & Mask; ; Pos = (Pos + 1) & Mask)
+        {
+            const uint64 Slot = Table->Slots[Pos].load(std::memory_order_acquire);
+            if (Slot == 0)
+            {
+                return -1;
+            }
+
+            if (static_cast<uint32>(Slot >> 32) == Hash)
+            {
+                const uint32 Index = static_cast<uint32>(Slot) - 1;
+                if (EqualsCaseInsensitive(FNamePool::Get(Index).GetView(), Str))
+                {
+                    return Index;
+                }
+            }
+        }
     }
 
-    // FString을 소문자로 변환하는 헬퍼 함수
-    static FString ToLower(const FString& InStr)
+    void InsertSlot(FNameSlotTable* Table, uint64 Slot)
     {
-        FString Result = InStr;
-        std::transform(Result.begin(), Result.end(), Result.begin(),
-            [](unsigned char c) { return std::tolower(c); });
-        return Result;
+        const uint32 Mask = Table->Capacity - 1;
+        uint32 Pos = (static_cast<uint32>(Slot >> 32) >> NumShardBits) & Mask;
+        while (Table->Slots[Pos].load(std::memory_order_relaxed) != 0)
+        {
+            Pos = (Pos + 1) & Mask;
+        }
+        Table->Slots[Pos].store(Slot, std::memory_order_release);
+    }
+
+    // 샤드 문자열 블록에 복사 (null 종료). 큰 문자열은 별도 할당
+    const char* CopyString(FNameShard& Shard, std::string_view Str)
+    {
+        const SIZE_T Size = Str.size() + 1;
+        char* Dest = nullptr;
+        if (Size > StringBlockSize / 4)
+        {
+            Dest = new char[Size];
+        }
+        else
+        {
+            if (!Shard.StringCursor || Shard.StringCursor + Size > Shard.StringEnd)
+            {
+                Shard.StringCursor = new char[StringBlockSize];
+                Shard.StringEnd = Shard.StringCursor + StringBlockSize;
+            }
+            Dest = Shard.StringCursor;
+            Shard.StringCursor += Size;
+        }
+
+        memcpy(Dest, Str.data(), Str.size());
+        Dest[Str.size()] = '\0';
+        return Dest;
+    }
+
+    FNameEntry& AllocateEntry(FNameTable& NameTable, uint32& OutIndex)
+    {
+        OutIndex = NameTable.NumEntries.fetch_add(1, std::memory_order_relaxed);
+        const uint32 ChunkIndex = OutIndex >> EntriesPerChunkBits;
+        assert(ChunkIndex < MaxChunks && "FNamePool: too many names");
+
+        FNameEntry* Chunk = NameTable.Chunks[ChunkIndex].load(std::memory_order_acquire);
+        if (!Chunk)
+        {
+            // 여러 샤드가 동시에 새 청크를 만들 수 있으므로 먼저 등록한 쪽을 사용
+            FNameEntry* NewChunk = new FNameEntry[EntriesPerChunk];
+            if (NameTable.Chunks[ChunkIndex].compare_exchange_strong(Chunk, NewChunk, std::memory_order_acq_rel))
+            {
+                Chunk = NewChunk;
+            }
+            else
+            {
+                delete[] NewChunk;
+            }
+        }
+        return Chunk[OutIndex & (EntriesPerChunk - 1)];
     }
 }
 
-uint32 FNamePool::Add(const FString& InStr)
+uint32 FNamePool::Add(std::string_view InStr)
 {
-    FString Lower = ToLower(InStr);
+    FNameTable& NameTable = GetNameTable();
+    const uint32 Hash = HashNameCaseInsensitive(InStr);
+    FNameShard& Shard = NameTable.Shards[Hash & (NumShards - 1)];
 
-    // 전역 변수 대신 getter를 통해 접근
-    TMap<FString, uint32>& NameMap = GetNameMap();
-    TArray<FNameEntry>& Entries = GetEntries();
+    // 1. 잠금 없는 조회 (대부분 여기서 끝남)
+    int64 Found = FindInSlotTable(Shard.Table.load(std::memory_order_acquire), Hash, InStr);
+    if (Found >= 0)
+    {
+        return static_cast<uint32>(Found);
+    }
 
-    auto it = NameMap.find(Lower);
-    if (it != NameMap.end())
-        return it->second;
+    // 2. 샤드 잠금 후 다시 확인하고 등록
+    std::lock_guard<std::mutex> Lock(Shard.Mutex);
+
+    FNameSlotTable* Table = Shard.Table.load(std::memory_order_relaxed);
+    Found = FindInSlotTable(Table, Hash, InStr);
+    if (Found >= 0)
+    {
+        return static_cast<uint32>(Found);
+    }
+
+    // 사용률 50%를 넘으면 두 배 테이블로 옮겨 게시 (이전 테이블은 읽는 중인 스레드를 위해 남겨둠)
+    if (!Table || (Shard.NumUsed + 1) * 2 > Table->Capacity)
+    {
+        FNameSlotTable* NewTable = CreateSlotTable(Table ? Table->Capacity * 2 : InitialSlotsPerShard);
+        if (Table)
+        {
+            for (uint32 i = 0; i < Table->Capacity; ++i)
+            {
+                const uint64 Slot = Table->Slots[i].load(std::memory_order_relaxed);
+                if (Slot != 0)
+                {
+                    InsertSlot(NewTable, Slot);
+                }
+            }
+        }
+        Shard.Table.store(NewTable, std::memory_order_release);
+        Table = NewTable;
+    }
+
+    uint32 NewIndex = 0;
+    FNameEntry& Entry = AllocateEntry(NameTable, NewIndex);
+    Entry.Data = CopyString(Shard, InStr);
+    Entry.Length = static_cast<uint32>(InStr.size());
+    Entry.Hash = Hash;
+
+    // 슬롯 게시(release) 이후 다른 스레드의 조회가 항목을 읽음
+    InsertSlot(Table, (static_cast<uint64>(Hash) << 32) | (static_cast<uint64>(NewIndex) + 1));
+    ++Shard.NumUsed;
 
-    uint32 NewIndex = (uint32)Entries.size();
-    Entries.push_back({ InStr, Lower });
-    NameMap[Lower] = NewIndex;
     return NewIndex;
 }
 
 const FNameEntry& FNamePool::Get(uint32 Index)
 {
-    // 전역 변수 대신 getter를 통해 접근
-    TArray<FNameEntry>& Entries = GetEntries();
+    static const FNameEntry InvalidEntry = { "Invalid", 7, 0 };
 
     // (안전성 강화) 경계 검사 추가
-    if (Index >= Entries.size())
+    const uint32 ChunkIndex = Index >> EntriesPerChunkBits;
+    if (ChunkIndex >= MaxChunks)
     {
-        static FNameEntry InvalidEntry = { "Invalid", "invalid" };
         return InvalidEntry;
     }
-    return Entries[Index];
-}
\ No newline at end of file
+
+    const FNameEntry* Chunk = GetNameTable().Chunks[ChunkIndex].load(std::memory_order_acquire);
+    if (!Chunk || !Chunk[Index & (EntriesPerChunk - 1)].Data)
+    {
+        return InvalidEntry;
+    }
+    return Chunk[Index & (EntriesPerChunk - 1)];
+}
@@ -2,6 +2,7 @@
 // Name.h
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
@@ -9,16 +10,28 @@
 // ──────────────────────────────
 // FNameEntry & Pool
 // ──────────────────────────────
+// 이름 테이블 항목. 청크 단위로 저장되어 한 번 등록되면 주소가 바뀌지 않음
 struct FNameEntry
 {
-    FString Display;    // 원문
-    FString Comparison; // lower-case
+    const char* Data = nullptr;     // 처음 등록된 원문 (null 종료)
+    uint32 Length = 0;
+    uint32 Hash = 0;                // 대소문자 무시 해시
+
+    std::string_view GetView() const { return std::string_view(Data, Length); }
 };
 
+/**
+ * FNamePool
+ * 대소문자를 무시하는 전역 이름 테이블입니다.
+ *
+ * - 해시/비교는 원문에서 바로 소문자로 계산 (소문자 사본 할당 없음)
+ * - 해시 상위 비트로 16개 샤드에 나눠, 조회는 잠금 없이 하고 새 이름 등록만 해당 샤드를 잠금
+ * - 항목과 문자열은 해제하지 않는 청크에 저장되므로 Get이 반환한 참조는 계속 유효
+ */
 class FNamePool
 {
 public:
-    static uint32 Add(const FString& InStr);
+    static uint32 Add(std::string_view InStr);
     static const FNameEntry& Get(uint32 Index);
 };
 
@@ -31,36 +44,46 @@ struct FName
     uint32 ComparisonIndex = -1;
 
     FName() = default;
-    FName(const char* InStr) { Init(FString(InStr)); }
+    FName(const char* InStr) { Init(InStr ? std::string_view(InStr) : std::string_view()); }
     FName(const FString& InStr) { Init(InStr); }
+    FName(std::string_view InStr) { Init(InStr); }
 
-    void Init(const FString& InStr)
+    void Init(std::string_view InStr)
     {
-        int32_t Index = FNamePool::Add(InStr);
+        uint32 Index = FNamePool::Add(InStr);
         DisplayIndex = Index;
         ComparisonIndex = Index; // 필요시 다른 규칙 적용 가능
     }
 
     bool operator==(const FName& Other) const { return ComparisonIndex == Other.ComparisonIndex; }
     // C++20: operator!= is auto-generated from operator==
-    FString ToString() const { return FNamePool::Get(DisplayIndex).Display; }
+    FString ToString() const { return FString(ToStringView()); }
+
+    // 복사 없이 원문 참조 (이름 테이블에 영구 저장되므로 계속 유효, null 종료 보장)
+    std::string_view ToStringView() const { return FNamePool::Get(DisplayIndex).GetView(); }
 
     // Check if this FName is "None" (empty or default)
-    bool IsNone() const { return ToString().empty(); }
+    bool IsNone() const { return DisplayIndex == static_cast<uint32>(-1) || FNamePool::Get(DisplayIndex).Length == 0; }
 
     friend FName operator+(const FName& A, const FName& B)
     {
-        return FName(A.ToString() + B.ToString());
+        FString Combined(A.ToStringView());
+        Combined.append(B.ToStringView());
+        return FName(Combined);
     }
 
     friend FName operator+(const FName& A, const FString& B)
     {
-        return FName(A.ToString() + B);
+        FString Combined(A.ToStringView());
+        Combined.append(B);
+        return FName(Combined);
     }
 
     friend FName operator+(const FString& A, const FName& B)
     {
-        return FName(A + B.ToString());
+        FString Combined(A);
+        Combined.append(B.ToStringView());
+        return FName(Combined);
     }
 };
 
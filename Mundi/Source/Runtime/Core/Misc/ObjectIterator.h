@@ -69,5 +69,5 @@ private:
 	}
 
 private:
-	typename TMap<uint32, UObject*>::iterator MapIterator;
+	typename TFlatMap<uint32, UObject*>::iterator MapIterator;
 };
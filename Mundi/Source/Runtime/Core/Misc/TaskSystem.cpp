@@ -0,0 +1,159 @@
+#include "pch.h"
+#include "TaskSystem.h"
+
+namespace
+{
+	thread_local bool GIsWorkerThread = false;
+
+	// ParallelFor 한 번의 호출이 공유하는 상태
+	// 큐에 남아 있는 헬퍼 작업이 호출 반환 이후에 실행될 수 있으므로 shared_ptr로 수명 관리
+	struct FParallelForContext
+	{
+		std::function<void(int32)> Body;
+		int32 Num = 0;
+		int32 BatchSize = 1;
+		EMemoryTag MemoryTag = EMemoryTag::Default;	// 호출 스레드의 할당 태그 (워커에서도 같은 태그로 집계)
+		std::atomic<int32> NextIndex{ 0 };
+		std::atomic<int32> Completed{ 0 };
+		std::mutex DoneMutex;
+		std::condition_variable DoneCondition;
+
+		// 남은 배치를 가져가서 실행. 마지막 배치를 끝낸 스레드가 대기자를 깨움
+		void Drain()
+		{
+			FMemoryTagScope TagScope(MemoryTag);
+
+			for (;;)
+			{
+				const int32 Start = NextIndex.fetch_add(BatchSize);
+				if (Start >= Num)
+				{
+					return;
+				}
+
+				const int32 End = FMath::Min(Start + BatchSize, Num);
+				for (int32 Index = Start; Index < End; ++Index)
+				{
+					Body(Index);
+				}
+
+				if (Completed.fetch_add(End - Start) + (End - Start) == Num)
+				{
+					std::lock_guard<std::mutex> Lock(DoneMutex);
+					DoneCondition.notify_all();
+				}
+			}
+		}
+	};
+}
+
+FTaskSystem::FTaskSystem()
+{
+	// 호출 스레드(게임 스레드)도 작업에 참여하므로 코어 수 - 1개만 생성
+	const uint32 LogicalCores = std::thread::hardware_concurrency();
+	const int32 NumWorkers = FMath::Clamp(static_cast<int32>(LogicalCores) - 1, 1, 15);
+
+	Workers.reserve(NumWorkers);
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		Workers.emplace_back([this]() { WorkerLoop(); });
+	}
+}
+
+FTaskSystem::~FTaskSystem()
+{
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		bStopping = true;
+	}
+	QueueCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.clear();
+}
+
+bool FTaskSystem::IsInWorkerThread()
+{
+	return GIsWorkerThread;
+}
+
+void FTaskSystem::WorkerLoop()
+{
+	GIsWorkerThread = true;
+
+	for (;;)
+	{
+		std::function<void()> Task;
+		{
+			std::unique_lock<std::mutex> Lock(QueueMutex);
+			QueueCondition.wait(Lock, [this]() { return bStopping || !TaskQueue.IsEmpty(); });
+
+			if (bStopping && TaskQueue.IsEmpty())
+			{
+				return;
+			}
+
+			TaskQueue.Dequeue(Task);
+		}
+
+		if (Task)
+		{
+			Task();
+		}
+	}
+}
+
+void FTaskSystem::EnqueueTask(std::function<void()> Task)
+{
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		TaskQueue.Enqueue(std::move(Task));
+	}
+	QueueCondition.notify_one();
+}
+
+void FTaskSystem::ParallelFor(int32 Num, const std::function<void(int32)>& Body, int32 BatchSize)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	BatchSize = FMath::Max(BatchSize, 1);
+
+	// 작업량이 한 배치 이하이거나 병렬이 꺼져 있으면 호출 스레드에서 바로 실행
+	if (!bEnableParallel || Workers.empty() || Num <= BatchSize)
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Body(Index);
+		}
+		return;
+	}
+
+	std::shared_ptr<FParallelForContext> Context = std::make_shared<FParallelForContext>();
+	Context->Body = Body;
+	Context->Num = Num;
+	Context->BatchSize = BatchSize;
+	Context->MemoryTag = FMemoryManager::GetCurrentTag();
+
+	// 배치 수만큼(최대 워커 수) 헬퍼 작업 투입
+	const int32 NumBatches = (Num + BatchSize - 1) / BatchSize;
+	const int32 NumHelpers = FMath::Min(NumBatches - 1, GetNumWorkers());
+	for (int32 i = 0; i < NumHelpers; ++i)
+	{
+		EnqueueTask([Context]() { Context->Drain(); });
+	}
+
+	// 호출 스레드도 참여 (워커가 모두 바쁘거나 중첩 호출이어도 진행 보장)
+	Context->Drain();
+
+	std::unique_lock<std::mutex> Lock(Context->DoneMutex);
+	Context->DoneCondition.wait(Lock, [&Context]() { return Context->Completed.load() >= Context->Num; });
+}
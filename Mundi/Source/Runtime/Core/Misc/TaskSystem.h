@@ -0,0 +1,56 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include "UEContainer.h"
+
+/**
+ * FTaskSystem
+ * 엔진 전역 워커 스레드 풀입니다.
+ *
+ * 사용법:
+ * - ParallelFor(Num, Body): [0, Num) 범위를 워커에 나눠 실행하고, 호출 스레드도 작업에 참여한 뒤
+ *   모든 인덱스가 끝날 때까지 블록합니다. 워커 안에서 중첩 호출해도 교착되지 않습니다.
+ *
+ * 주의: Body는 서로 다른 인덱스끼리 공유 상태를 쓰지 않아야 합니다.
+ *       결과 병합은 ParallelFor 반환 후 호출 스레드에서 순서대로 수행하세요.
+ */
+class FTaskSystem
+{
+public:
+	static FTaskSystem& GetInstance()
+	{
+		static FTaskSystem Instance;
+		return Instance;
+	}
+
+	// [0, Num) 범위를 BatchSize 단위로 분배하여 Body(Index) 실행 (완료까지 블록)
+	void ParallelFor(int32 Num, const std::function<void(int32)>& Body, int32 BatchSize = 1);
+
+	// 워커 스레드 수 (호출 스레드 제외)
+	int32 GetNumWorkers() const { return static_cast<int32>(Workers.size()); }
+
+	// 현재 스레드가 워커 스레드인지
+	static bool IsInWorkerThread();
+
+	// 병렬 실행 on/off (디버깅용: false면 모든 ParallelFor가 호출 스레드에서 순차 실행)
+	bool bEnableParallel = true;
+
+private:
+	FTaskSystem();
+	~FTaskSystem();
+	FTaskSystem(const FTaskSystem&) = delete;
+	FTaskSystem& operator=(const FTaskSystem&) = delete;
+
+	void WorkerLoop();
+	void EnqueueTask(std::function<void()> Task);
+
+	std::vector<std::thread> Workers;
+	TQueue<std::function<void()>> TaskQueue;
+	std::mutex QueueMutex;
+	std::condition_variable QueueCondition;
+	bool bStopping = false;
+};
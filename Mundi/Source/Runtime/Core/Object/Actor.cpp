@@ -258,7 +258,8 @@ void AActor::RemoveOwnedComponent(UActorComponent* Component)
 	{
 		// 자식 컴포넌트들을 먼저 재귀적으로 삭제
 		// (자식을 먼저 삭제하면 부모의 AttachChildren이 변경되므로 복사본으로 순회)
-		TArray<USceneComponent*> ChildrenCopy = SceneComponent->GetAttachChildren();
+		TArray<USceneComponent*, TInlineAllocator<8>> ChildrenCopy;
+		ChildrenCopy.Append(SceneComponent->GetAttachChildren());
 		for (USceneComponent* Child : ChildrenCopy)
 		{
 			RemoveOwnedComponent(Child); // 재귀 호출로 자식들 먼저 삭제
@@ -308,7 +309,7 @@ void AActor::RegisterAllComponents(UWorld* InWorld)
 // 소유 중인 Component 전체 삭제
 void AActor::DestroyAllComponents()
 {
-	TArray<UActorComponent*> Temp;
+	TArray<UActorComponent*, TInlineAllocator<16>> Temp;
 	Temp.reserve(OwnedComponents.size());
 
 	for (UActorComponent* C : OwnedComponents) 
@@ -1,7 +1,7 @@
 ﻿#include "pch.h"
 #include "ObjectFactory.h"
 // 전역 오브젝트 맵 정의 (O(1) 삭제를 위해 TMap 사용)
-TMap<uint32, UObject*> GUObjectArray;
+TFlatMap<uint32, UObject*> GUObjectArray;
 uint32 GUObjectIndexCounter = 0;
 
 namespace ObjectFactory
@@ -38,14 +38,10 @@ namespace ObjectFactory
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
 
-        const std::string base = Class->Name; // FName -> string
-        std::string unique;
-        unique.reserve(base.size() + 1 + 12);            // "_" + 최대 10~12자리 여유
-        unique.append(base);
-        unique.push_back('_');
-        unique.append(std::to_string(Count));
-
-        Obj->ObjectName = FName(unique);
+        // "ClassName_Count"를 스택 버퍼에 만들어 바로 이름 테이블에 등록 (임시 문자열 할당 없음)
+        char unique[256];
+        const int len = snprintf(unique, sizeof(unique), "%s_%d", Class->Name, Count);
+        Obj->ObjectName = FName(std::string_view(unique, FMath::Clamp(len, 0, static_cast<int>(sizeof(unique)) - 1)));
 
         return Obj;
     }
@@ -1,11 +1,11 @@
 ﻿#pragma once
-#include "UEContainer.h"
+#include "FlatMap.h"
 
 
 // ── 외부 심볼 ─────────────────────────────────────────────
 class UObject;
 struct UClass;
-extern TMap<uint32, UObject*> GUObjectArray;
+extern TFlatMap<uint32, UObject*> GUObjectArray;
 extern uint32 GUObjectIndexCounter;
 
 // ── ObjectFactory 네임스페이스 ─────────────────────────────
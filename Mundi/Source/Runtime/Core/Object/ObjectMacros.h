@@ -521,5 +521,6 @@ struct TPropertyTypeTraits<FDistributionColor>
 	InVariableName->SetupAttachment(this, EAttachmentRule::KeepRelative);\
 	this->GetOwner()->AddOwnedComponent(InVariableName);\
 	InVariableName->SetEditability(false);\
-	InVariableName->SetHiddenInGame(true);
+	InVariableName->SetHiddenInGame(true);\
+	InVariableName->AddToRenderScene(this->GetWorld());
 
@@ -150,15 +150,14 @@ void FAnimationRuntime::NormalizeRotations(TArray<FTransform>& InComponentPose)
     }
 }
 
-void FAnimationRuntime::BlendMultiplePoses(const FSkeleton& Skeleton,
-    const TArray<TArray<FTransform>>& ComponentPoses,
-    const TArray<float>& Weights,
+void FAnimationRuntime::BlendPoses(const FSkeleton& Skeleton,
+    const TArray<FTransform>* const* ComponentPoses, int32 NumPoses,
+    const float* Weights, int32 NumWeights,
     TArray<FTransform>& OutComponentPose)
 {
     const int32 NumBones = Skeleton.Bones.Num();
     OutComponentPose.SetNum(NumBones);
 
-    const int32 NumPoses = static_cast<int32>(ComponentPoses.Num());
     if (NumPoses == 0 || NumBones == 0)
     {
         OutComponentPose.Empty();
@@ -168,13 +167,12 @@ void FAnimationRuntime::BlendMultiplePoses(const FSkeleton& Skeleton,
     // Early cases
     if (NumPoses == 1)
     {
-        OutComponentPose = ComponentPoses[0];
+        OutComponentPose = *ComponentPoses[0];
         return;
     }
 
     // Compute total weight and guard against degenerate input
     float TotalW = 0.f;
-    const int32 NumWeights = static_cast<int32>(Weights.Num());
     for (int32 i = 0; i < NumWeights && i < NumPoses; ++i)
     {
         TotalW += std::max(0.f, Weights[i]);
@@ -182,12 +180,12 @@ void FAnimationRuntime::BlendMultiplePoses(const FSkeleton& Skeleton,
     if (TotalW <= 1e-6f)
     {
         // Fallback: copy first
-        OutComponentPose = ComponentPoses[0];
+        OutComponentPose = *ComponentPoses[0];
         return;
     }
 
-    // Normalize weights to sum to 1
-    TArray<float> NormW; NormW.SetNum(NumPoses);
+    // Normalize weights to sum to 1 (프레임 arena 임시 배열)
+    TFrameArray<float> NormW; NormW.SetNum(NumPoses);
     for (int32 i = 0; i < NumPoses; ++i)
     {
         const float W = (i < NumWeights) ? std::max(0.f, Weights[i]) : 0.f;
@@ -203,7 +201,7 @@ void FAnimationRuntime::BlendMultiplePoses(const FSkeleton& Skeleton,
             if (NormW[i] > 0.f) { RefIdx = i; break; }
         }
 
-        const FQuat& Qref = ComponentPoses[RefIdx][BoneIndex].Rotation;
+        const FQuat& Qref = (*ComponentPoses[RefIdx])[BoneIndex].Rotation;
 
         // Weighted quaternion sum with antipodal correction
         float AccX = 0.f, AccY = 0.f, AccZ = 0.f, AccW = 0.f;
@@ -215,7 +213,7 @@ void FAnimationRuntime::BlendMultiplePoses(const FSkeleton& Skeleton,
             const float w = NormW[i];
             if (w <= 0.f) continue;
 
-            const FTransform& Ti = ComponentPoses[i][BoneIndex];
+            const FTransform& Ti = (*ComponentPoses[i])[BoneIndex];
             FQuat Qi = Ti.Rotation;
             // Flip sign if needed to avoid averaging antipodal quaternions
             if (FQuat::Dot(Qi, Qref) < 0.f)
@@ -236,6 +234,20 @@ void FAnimationRuntime::BlendMultiplePoses(const FSkeleton& Skeleton,
     }
 }
 
+void FAnimationRuntime::BlendMultiplePoses(const FSkeleton& Skeleton,
+    const TArray<TArray<FTransform>>& ComponentPoses,
+    const TArray<float>& Weights,
+    TArray<FTransform>& OutComponentPose)
+{
+    TFrameArray<const TArray<FTransform>*> PosePtrs;
+    PosePtrs.Reserve(ComponentPoses.Num());
+    for (const TArray<FTransform>& Pose : ComponentPoses)
+    {
+        PosePtrs.Add(&Pose);
+    }
+    BlendPoses(Skeleton, PosePtrs.GetData(), PosePtrs.Num(), Weights.GetData(), Weights.Num(), OutComponentPose);
+}
+
 void FAnimationRuntime::BlendThreePoses(const FSkeleton& Skeleton,
     const TArray<FTransform>& A,
     const TArray<FTransform>& B,
@@ -243,10 +255,8 @@ void FAnimationRuntime::BlendThreePoses(const FSkeleton& Skeleton,
     float WA, float WB, float WC,
     TArray<FTransform>& OutComponentPose)
 {
-    TArray<TArray<FTransform>> Poses;
-    Poses.SetNum(3);
-    Poses[0] = A; Poses[1] = B; Poses[2] = C;
-    TArray<float> Weights; Weights.SetNum(3);
-    Weights[0] = WA; Weights[1] = WB; Weights[2] = WC;
-    BlendMultiplePoses(Skeleton, Poses, Weights, OutComponentPose);
+    // 포즈를 복사하지 않고 포인터로 전달
+    const TArray<FTransform>* Poses[3] = { &A, &B, &C };
+    const float Weights[3] = { WA, WB, WC };
+    BlendPoses(Skeleton, Poses, 3, Weights, 3, OutComponentPose);
 }
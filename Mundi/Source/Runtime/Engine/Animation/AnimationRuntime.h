@@ -38,4 +38,11 @@ public:
         const TArray<FTransform>& C,
         float WA, float WB, float WC,
         TArray<FTransform>& OutComponentPose);
+
+private:
+    // BlendMultiplePoses / BlendThreePoses 공통 구현 (포즈는 포인터로 받아 복사하지 않음)
+    static void BlendPoses(const FSkeleton& Skeleton,
+        const TArray<FTransform>* const* ComponentPoses, int32 NumPoses,
+        const float* Weights, int32 NumWeights,
+        TArray<FTransform>& OutComponentPose);
 };
@@ -2,6 +2,7 @@
 #include <NvCloth/Cloth.h>
 #include <foundation/PxAllocatorCallback.h>
 #include <foundation/PxErrorCallback.h>
+#include "MemoryManager.h"
 
 // Allocator - PhysX의 PxAllocatorCallback 상속
 class NvClothAllocator : public physx::PxAllocatorCallback
@@ -9,12 +10,12 @@ class NvClothAllocator : public physx::PxAllocatorCallback
 public:
     virtual void* allocate(size_t size, const char* typeName, const char* filename, int line) override
     {
-        return malloc(size);
+        return FMemoryManager::Allocate(size, 16, EMemoryTag::Physics);
     }
 
     virtual void deallocate(void* ptr) override
     {
-        free(ptr);
+        FMemoryManager::Deallocate(ptr);
     }
 };
 
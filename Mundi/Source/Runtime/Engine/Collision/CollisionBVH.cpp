@@ -148,8 +148,8 @@ TArray<UShapeComponent*> FCollisionBVH::QueryIntersectedComponents(const FAABB&
 		return Result;
 	}
 
-	// DFS 스택 기반 순회
-	TArray<int32> IdxStack;
+	// DFS 스택 기반 순회 (깊이는 log2(N) 수준이므로 인라인 버퍼로 충분)
+	TArray<int32, TInlineAllocator<64>> IdxStack;
 	IdxStack.push_back(0);
 
 	while (!IdxStack.empty())
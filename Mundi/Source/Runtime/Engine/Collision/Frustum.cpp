@@ -220,6 +220,58 @@ bool IsAABBIntersects(const FFrustum& F, const FAABB& B)
     return !fullyInside;
 }
 
+// ------------------------------------------------------------
+// VP(=View*Proj)에서 평면 추출 (Gribb-Hartmann)
+//  - row-vector 규약(p' = p * M)이므로 클립 좌표 x' = dot(p, M의 0번 열) → "열"을 조합
+//  - D3D 깊이 범위(0 ≤ z' ≤ w')이므로 Near는 2번 열 단독, Far는 3번 열 - 2번 열
+//  - 원근/직교 투영 모두 동일하게 동작 (FSceneView가 행렬만 알아도 절두체를 만들 수 있음)
+// ------------------------------------------------------------
+namespace
+{
+    // a*x + b*y + c*z + d >= 0 (클립 내부) → dot(N, X) - D >= 0 (N = (a,b,c)/Len, D = -d/Len)
+    FPlane MakePlaneFromClipColumns(const FMatrix& M, int32 Column, float Sign)
+    {
+        const float A = M.M[0][3] + Sign * M.M[0][Column];
+        const float B = M.M[1][3] + Sign * M.M[1][Column];
+        const float C = M.M[2][3] + Sign * M.M[2][Column];
+        const float D = M.M[3][3] + Sign * M.M[3][Column];
+
+        const float Len = std::sqrt(A * A + B * B + C * C);
+        if (Len <= 0.0f)
+        {
+            return FPlane{};
+        }
+        return FPlane{ FVector4(A / Len, B / Len, C / Len, 0.0f), -D / Len };
+    }
+
+    FPlane MakePlaneFromClipColumn(const FMatrix& M, int32 Column)
+    {
+        const float A = M.M[0][Column];
+        const float B = M.M[1][Column];
+        const float C = M.M[2][Column];
+        const float D = M.M[3][Column];
+
+        const float Len = std::sqrt(A * A + B * B + C * C);
+        if (Len <= 0.0f)
+        {
+            return FPlane{};
+        }
+        return FPlane{ FVector4(A / Len, B / Len, C / Len, 0.0f), -D / Len };
+    }
+}
+
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection)
+{
+    FFrustum Result;
+    Result.LeftFace = MakePlaneFromClipColumns(ViewProjection, 0, +1.0f);
+    Result.RightFace = MakePlaneFromClipColumns(ViewProjection, 0, -1.0f);
+    Result.BottomFace = MakePlaneFromClipColumns(ViewProjection, 1, +1.0f);
+    Result.TopFace = MakePlaneFromClipColumns(ViewProjection, 1, -1.0f);
+    Result.NearFace = MakePlaneFromClipColumn(ViewProjection, 2);
+    Result.FarFace = MakePlaneFromClipColumns(ViewProjection, 2, -1.0f);
+    return Result;
+}
+
 
 // 추후에 절두체를 VP 행렬에서 바로 추출하는 방법도 필요하다면 아래를 참고.
 // ---------- VP(=View*Proj)에서 평면 추출 ----------
@@ -26,6 +26,8 @@ struct FFrustum
 };
 
 FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideAspect = -1.0f);
+// row-vector 규약의 View * Proj 행렬에서 6평면 추출 (원근/직교 공통, D3D 깊이 0~1)
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection);
 bool IsAABBVisible(const FFrustum& Frustum, const FAABB& Bound);
 bool IsAABBIntersects(const FFrustum& Frustum, const FAABB& Bound);
 
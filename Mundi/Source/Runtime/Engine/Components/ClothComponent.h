@@ -17,7 +17,7 @@ public:
 	void BeginPlay() override;
 	void TickComponent(float DeltaSeconds) override;
 	void EndPlay() override;
-	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
 	void DuplicateSubObjects() override;
 
@@ -75,6 +75,7 @@ void UMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
              MaterialSlots[i] = LoadedMaterial;
           }
        }
+       MarkRenderStateDirty();
     }
     else // --- 저장 ---
     {
@@ -238,6 +239,9 @@ void UMeshComponent::SetMaterial(uint32 InElementIndex, UMaterialInterface* InNe
 
 	// 6. 새 머티리얼을 슬롯에 할당합니다.
 	MaterialSlots[InElementIndex] = InNewMaterial;
+
+	// 7. 캐시된 드로우 커맨드가 이전 머티리얼을 가리키지 않도록 무효화합니다.
+	MarkRenderStateDirty();
 }
 
 UMaterialInstanceDynamic* UMeshComponent::CreateAndSetMaterialInstanceDynamic(uint32 ElementIndex)
@@ -314,4 +318,5 @@ void UMeshComponent::ClearDynamicMaterials()
 	// (이 배열이 MID 포인터를 가리키고 있었을 수 있으므로
 	//  delete 이후에 비워야 안전합니다.)
 	MaterialSlots.Empty();
+	MarkRenderStateDirty();
 }
@@ -26,6 +26,8 @@
 #include "World.h"
 #include "ObjectFactory.h"
 #include "ParticleEventManager.h"
+#include "ParticleTickManager.h"
+#include "TaskSystem.h"
 
 // Quad 버텍스 구조체 (UV만 포함)
 struct FSpriteQuadVertex
@@ -553,6 +555,15 @@ void UParticleSystemComponent::CreateDebugRibbonParticleSystem()
 
 void UParticleSystemComponent::OnUnregister()
 {
+	// 이번 프레임 병렬 틱 예약 취소
+	if (UWorld* World = GetWorld())
+	{
+		if (FParticleTickManager* TickManager = World->GetParticleTickManager())
+		{
+			TickManager->RemoveComponent(this);
+		}
+	}
+
 	// 이미터 인스턴스 정리
 	DeactivateSystem();
 
@@ -612,6 +623,9 @@ void UParticleSystemComponent::OnUnregister()
 	}
 	AllocatedRibbonIndexCount = 0;
 
+	BeamBufferVersion = 0;
+	RibbonBufferVersion = 0;
+
 	// 캐싱된 파티클용 Material 정리
 	ClearCachedMaterials();
 
@@ -622,6 +636,8 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
 {
 	USceneComponent::TickComponent(DeltaTime);
 
+	FMemoryTagScope TagScope(EMemoryTag::Particles);
+
 	// === 테스트: 디버그 파티클 자동 이동 ===
 	// PIE에서도 동작하도록 Template과 EmitterInstances로 체크
 	if (Template && EmitterInstances.Num() > 0)
@@ -643,8 +659,9 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
 			SetVectorParameter("BeamTarget", GetWorldTransform().TransformPosition(TargetOffset));*/
 
 			// 타겟을 월드 원점에 고정 (시작점은 기즈모로 직접 이동 가능)
+			static const FName BeamTargetName("BeamTarget");
 			FVector WorldOrigin(0.0f, 0.0f, 0.0f);
-			SetVectorParameter("BeamTarget", WorldOrigin);
+			SetVectorParameter(BeamTargetName, WorldOrigin);
 		}
 		else if (DebugParticleType == EDebugParticleType::Ribbon)
 		{
@@ -671,10 +688,55 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
 	// 시뮬레이션 속도 적용 (에디터 타임스케일)
 	DeltaTime *= CustomTimeScale;
 
-	// 이벤트 클리어 (매 프레임 시작 시)
-	ClearEvents();
+	// 워밍업 중이면 이번 프레임에 진행할 스텝 수 결정 (이미터 틱 전에 게임 스레드에서)
+	BeginWarmupFrame();
+
+	// 월드 틱 중이면 파티클 틱 매니저에 예약 (모든 컴포넌트의 이미터가 액터 틱 이후 병렬로 시뮬레이션됨)
+	UWorld* World = GetWorld();
+	FParticleTickManager* TickManager = World ? World->GetParticleTickManager() : nullptr;
+	if (TickManager && TickManager->IsCollecting())
+	{
+		TickManager->QueueComponent(this, DeltaTime);
+		return;
+	}
+
+	// 월드 틱 밖에서 직접 호출된 경우 즉시 처리
+	TickEmitters(DeltaTime);
+	FinishEmitterTick();
+}
+
+void UParticleSystemComponent::TickEmitters(float DeltaTime)
+{
+	if (CanTickEmittersInParallel())
+	{
+		// 이미터 간 공유 쓰기 없음 (이벤트는 이미터별 EventBuffer에 기록)
+		FTaskSystem::GetInstance().ParallelFor(EmitterInstances.Num(), [this, DeltaTime](int32 Index)
+		{
+			if (FParticleEmitterInstance* Instance = EmitterInstances[Index])
+			{
+				TickEmitterInstance(*Instance, DeltaTime);
+			}
+		});
+		return;
+	}
+
+	// 다른 이미터를 참조하는 모듈(TrailSource 등)이 있으면 이미터 순서대로
+	// (워밍업 중이어도 스텝마다 이미터 순서를 지키려면 스텝 루프가 바깥이어야 함)
+	if (FrameWarmupSteps > 0)
+	{
+		for (int32 Step = 0; Step < FrameWarmupSteps; ++Step)
+		{
+			for (FParticleEmitterInstance* Instance : EmitterInstances)
+			{
+				if (Instance)
+				{
+					Instance->Tick(WarmupStepTime, false);
+				}
+			}
+		}
+		return;
+	}
 
-	// 모든 이미터 인스턴스 틱
 	for (FParticleEmitterInstance* Instance : EmitterInstances)
 	{
 		if (Instance)
@@ -682,11 +744,104 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
 			Instance->Tick(DeltaTime, false);
 		}
 	}
+}
+
+void UParticleSystemComponent::TickEmitterInstance(FParticleEmitterInstance& Instance, float DeltaTime) const
+{
+	// 워밍업: 같은 Tick 경로를 고정 스텝으로 반복 (렌더 데이터는 FinishEmitterTick에서 워밍업이 끝난 뒤에만 생성)
+	if (FrameWarmupSteps > 0)
+	{
+		for (int32 Step = 0; Step < FrameWarmupSteps; ++Step)
+		{
+			Instance.Tick(WarmupStepTime, false);
+		}
+		return;
+	}
+
+	Instance.Tick(DeltaTime, false);
+}
+
+void UParticleSystemComponent::StartWarmup()
+{
+	WarmupStepsRemaining = 0;
+	FrameWarmupSteps = 0;
+
+	if (!Template || Template->WarmupTime <= 0.0f || EmitterInstances.IsEmpty())
+	{
+		return;
+	}
+
+	WarmupStepTime = Template->WarmupTickRate > 0.0f ? Template->WarmupTickRate : (1.0f / 30.0f);
+	WarmupStepsRemaining = FMath::Max(1, static_cast<int32>(std::ceil(Template->WarmupTime / WarmupStepTime)));
+}
+
+void UParticleSystemComponent::BeginWarmupFrame()
+{
+	if (WarmupStepsRemaining <= 0 || !Template)
+	{
+		FrameWarmupSteps = 0;
+		return;
+	}
+
+	// 예산: 프레임당 최대 스텝 수 (다음 프레임에 이어서 진행)
+	FrameWarmupSteps = FMath::Min(WarmupStepsRemaining, FMath::Max(1, Template->MaxWarmupStepsPerFrame));
+}
+
+bool UParticleSystemComponent::CanTickEmittersInParallel() const
+{
+	for (FParticleEmitterInstance* Instance : EmitterInstances)
+	{
+		if (!Instance || !Instance->CurrentLODLevel)
+		{
+			continue;
+		}
+
+		for (UParticleModule* Module : Instance->CurrentLODLevel->Modules)
+		{
+			if (Module && Module->bEnabled && !Module->SupportsParallelTick())
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void UParticleSystemComponent::FinishEmitterTick()
+{
+	// 이번 프레임 이벤트 수집 (이미터 순서대로 병합 → 결정적 순서)
+	ClearEvents();
+	GatherEmitterEvents();
+
+	// 워밍업 중: 이번 프레임 스텝을 차감하고, 끝나기 전까지는 이벤트를 버리고 렌더 데이터도 만들지 않음
+	if (FrameWarmupSteps > 0)
+	{
+		WarmupStepsRemaining -= FrameWarmupSteps;
+		FrameWarmupSteps = 0;
+
+		if (WarmupStepsRemaining > 0)
+		{
+			ClearEvents();
+
+			// 재활성화 이전의 렌더 데이터가 남아 있으면 그리지 않도록 제거
+			for (FDynamicEmitterDataBase* RenderData : EmitterRenderData)
+			{
+				delete RenderData;
+			}
+			EmitterRenderData.Empty();
+			bHasParticleBounds = false;
+			return;
+		}
+
+		// 워밍업 중 발생한 이벤트는 버리고 마지막 상태로 렌더 데이터 생성
+		ClearEvents();
+	}
 
 	// 렌더 데이터 업데이트
 	UpdateRenderData();
 
 	// 내부 이벤트 디스패치 (같은 PSC 내의 다른 이미터들에게 이벤트 전달)
+	// 디스패치 중 Receiver가 생성한 이벤트는 이미터 버퍼에 쌓여 다음 프레임에 병합됨
 	DispatchEventsToReceivers();
 
 	// 외부 이벤트 브로드캐스트 (ParticleEventManager를 통해 다른 PSC에도 전달)
@@ -733,6 +888,23 @@ void UParticleSystemComponent::AddDeathEvent(const FParticleEventData& Event)
 	DeathEvents.Add(Event);
 }
 
+void UParticleSystemComponent::GatherEmitterEvents()
+{
+	for (FParticleEmitterInstance* Instance : EmitterInstances)
+	{
+		if (!Instance || Instance->EventBuffer.IsEmpty())
+		{
+			continue;
+		}
+
+		FParticleEventBuffer& Buffer = Instance->EventBuffer;
+		CollisionEvents.Append(Buffer.CollisionEvents);
+		SpawnEvents.Append(Buffer.SpawnEvents);
+		DeathEvents.Append(Buffer.DeathEvents);
+		Buffer.Reset();
+	}
+}
+
 void UParticleSystemComponent::DispatchEventsToReceivers()
 {
 	// 이벤트가 없으면 스킵
@@ -1021,10 +1193,14 @@ void UParticleSystemComponent::InitializeEmitterInstances()
 		if (Emitter)
 		{
 			FParticleEmitterInstance* Instance = new FParticleEmitterInstance();
+			// 이미터마다 다른 시드 (같은 시스템의 이미터끼리 랜덤 값이 겹치지 않도록)
+			Instance->RandomStream.Initialize(EmitterInstances.Num());
 			Instance->Init(this, Emitter);
 			EmitterInstances.Add(Instance);
 		}
 	}
+
+	StartWarmup();
 }
 
 void UParticleSystemComponent::ClearEmitterInstances()
@@ -1037,15 +1213,26 @@ void UParticleSystemComponent::ClearEmitterInstances()
 		}
 	}
 	EmitterInstances.Empty();
+	bHasParticleBounds = false;
+	WarmupStepsRemaining = 0;
+	FrameWarmupSteps = 0;
 }
 
 void UParticleSystemComponent::UpdateRenderData()
 {
-	// 기존 렌더 데이터 제거
+	++RenderDataVersion;
+
+	// 기존 렌더 데이터 제거 (정렬 결과는 이미터에 넘겨 다음 프레임 정렬의 시작 순서로 사용)
 	for (int32 i = 0; i < EmitterRenderData.Num(); i++)
 	{
 		if (EmitterRenderData[i])
 		{
+			const int32 EmitterIndex = EmitterRenderData[i]->EmitterIndex;
+			if (EmitterIndex >= 0 && EmitterIndex < EmitterInstances.Num() && EmitterInstances[EmitterIndex])
+			{
+				EmitterInstances[EmitterIndex]->StoreDrawOrder(EmitterRenderData[i]->GetSource());
+			}
+
 			delete EmitterRenderData[i];
 			EmitterRenderData[i] = nullptr;
 		}
@@ -1069,97 +1256,180 @@ void UParticleSystemComponent::UpdateRenderData()
 			EmitterRenderData.Add(DynamicData);
 		}
 	}
+
+	UpdateParticleBounds();
 }
 
-// 언리얼 엔진 호환: 인스턴스 파라미터 시스템 구현
-void UParticleSystemComponent::SetFloatParameter(const FString& ParameterName, float Value)
+void UParticleSystemComponent::UpdateParticleBounds()
 {
-	// 기존 파라미터 찾기
-	for (FParticleParameter& Param : InstanceParameters)
+	bHasParticleBounds = false;
+
+	// 그릴 것이 없으면 바운드도 없음 (렌더러에서 컬링)
+	if (EmitterRenderData.IsEmpty())
 	{
-		if (Param.Name == ParameterName)
-		{
-			Param.FloatValue = Value;
-			return;
-		}
+		return;
 	}
 
-	// 없으면 새로 추가
-	FParticleParameter NewParam(ParameterName);
-	NewParam.FloatValue = Value;
-	InstanceParameters.Add(NewParam);
-}
-
-void UParticleSystemComponent::SetVectorParameter(const FString& ParameterName, const FVector& Value)
-{
-	// 기존 파라미터 찾기
-	for (FParticleParameter& Param : InstanceParameters)
+	// 고정 바운드: 로컬 박스 8개 꼭짓점을 컴포넌트 트랜스폼으로 변환
+	if (Template && Template->bUseFixedRelativeBoundingBox)
 	{
-		if (Param.Name == ParameterName)
+		const FTransform& ComponentTransform = GetWorldTransform();
+		const FVector& LocalMin = Template->FixedRelativeBoundsMin;
+		const FVector& LocalMax = Template->FixedRelativeBoundsMax;
+
+		FVector Corners[8];
+		for (int32 CornerIndex = 0; CornerIndex < 8; ++CornerIndex)
 		{
-			Param.VectorValue = Value;
-			return;
+			const FVector LocalCorner(
+				(CornerIndex & 1) ? LocalMax.X : LocalMin.X,
+				(CornerIndex & 2) ? LocalMax.Y : LocalMin.Y,
+				(CornerIndex & 4) ? LocalMax.Z : LocalMin.Z);
+			Corners[CornerIndex] = ComponentTransform.TransformPosition(LocalCorner);
 		}
-	}
 
-	// 없으면 새로 추가
-	FParticleParameter NewParam(ParameterName);
-	NewParam.VectorValue = Value;
-	InstanceParameters.Add(NewParam);
-}
+		ParticleBounds = FAABB(Corners, 8);
+		bHasParticleBounds = true;
+		return;
+	}
 
-void UParticleSystemComponent::SetColorParameter(const FString& ParameterName, const FLinearColor& Value)
-{
-	// 기존 파라미터 찾기
-	for (FParticleParameter& Param : InstanceParameters)
+	// 동적 바운드: 이미터가 틱 중에 누적한 위치 바운드 + 타입별 크기 여유분
+	for (FDynamicEmitterDataBase* RenderData : EmitterRenderData)
 	{
-		if (Param.Name == ParameterName)
+		if (!RenderData)
 		{
-			Param.ColorValue = Value;
-			return;
+			continue;
 		}
-	}
 
-	// 없으면 새로 추가
-	FParticleParameter NewParam(ParameterName);
-	NewParam.ColorValue = Value;
-	InstanceParameters.Add(NewParam);
-}
+		const int32 EmitterIndex = RenderData->EmitterIndex;
+		const FParticleEmitterInstance* Instance = (EmitterIndex >= 0 && EmitterIndex < EmitterInstances.Num()) ? EmitterInstances[EmitterIndex] : nullptr;
+		if (!Instance)
+		{
+			continue;
+		}
 
-float UParticleSystemComponent::GetFloatParameter(const FString& ParameterName, float DefaultValue) const
-{
-	for (const FParticleParameter& Param : InstanceParameters)
-	{
-		if (Param.Name == ParameterName)
+		FVector EmitterMin;
+		FVector EmitterMax;
+		float Padding = 0.0f;
+
+		const FDynamicEmitterReplayDataBase& Source = RenderData->GetSource();
+		if (Source.eEmitterType == EDynamicEmitterType::Beam)
+		{
+			// 빔은 파티클 위치가 아니라 소스~타겟 사이 빔 포인트로 그려짐
+			const FDynamicBeamEmitterReplayDataBase& BeamSource = static_cast<const FDynamicBeamEmitterReplayDataBase&>(Source);
+			if (BeamSource.BeamPoints.IsEmpty())
+			{
+				continue;
+			}
+
+			EmitterMin = BeamSource.BeamPoints[0];
+			EmitterMax = BeamSource.BeamPoints[0];
+			for (const FVector& Point : BeamSource.BeamPoints)
+			{
+				EmitterMin = EmitterMin.ComponentMin(Point);
+				EmitterMax = EmitterMax.ComponentMax(Point);
+			}
+			Padding = BeamSource.Width * 0.5f;
+		}
+		else
 		{
-			return Param.FloatValue;
+			if (!Instance->bHasParticleBounds)
+			{
+				continue;
+			}
+
+			EmitterMin = Instance->ParticleBoundsMin;
+			EmitterMax = Instance->ParticleBoundsMax;
+
+			if (Source.eEmitterType == EDynamicEmitterType::Ribbon)
+			{
+				Padding = static_cast<const FDynamicRibbonEmitterReplayDataBase&>(Source).Width * 0.5f;
+			}
+			else if (Source.eEmitterType == EDynamicEmitterType::Mesh)
+			{
+				// 메시 로컬 바운드에서 원점까지 가장 먼 꼭짓점 거리 × 파티클 스케일 (회전 무관)
+				const UStaticMesh* Mesh = static_cast<const FDynamicMeshEmitterReplayDataBase&>(Source).MeshData;
+				float MeshRadius = 1.0f;
+				if (Mesh)
+				{
+					const FAABB MeshBound = Mesh->GetLocalBound();
+					const FVector FarCorner(
+						FMath::Max(FMath::Abs(MeshBound.Min.X), FMath::Abs(MeshBound.Max.X)),
+						FMath::Max(FMath::Abs(MeshBound.Min.Y), FMath::Abs(MeshBound.Max.Y)),
+						FMath::Max(FMath::Abs(MeshBound.Min.Z), FMath::Abs(MeshBound.Max.Z)));
+					MeshRadius = FarCorner.Size();
+				}
+				Padding = Instance->MaxParticleSize * MeshRadius;
+			}
+			else
+			{
+				// 스프라이트: 회전한 쿼드의 대각선 절반(√2/2 × Size)을 덮도록 Size 전체를 여유분으로 (스케일은 확대만 반영)
+				const FVector& Scale = Source.Scale;
+				const float MaxScale = FMath::Max(1.0f, FMath::Max(FMath::Abs(Scale.X), FMath::Max(FMath::Abs(Scale.Y), FMath::Abs(Scale.Z))));
+				Padding = Instance->MaxParticleSize * MaxScale;
+			}
 		}
+
+		const FVector PaddingVector(Padding, Padding, Padding);
+		const FAABB EmitterBounds(EmitterMin - PaddingVector, EmitterMax + PaddingVector);
+		ParticleBounds = bHasParticleBounds ? FAABB::Union(ParticleBounds, EmitterBounds) : EmitterBounds;
+		bHasParticleBounds = true;
 	}
-	return DefaultValue;
 }
 
-FVector UParticleSystemComponent::GetVectorParameter(const FString& ParameterName, const FVector& DefaultValue) const
+// 언리얼 엔진 호환: 인스턴스 파라미터 시스템 구현
+FParticleParameterHandle UParticleSystemComponent::FindOrAddParameter(const FName& ParameterName)
 {
-	for (const FParticleParameter& Param : InstanceParameters)
+	FParticleParameterHandle Handle;
+	if (int32* ExistingIndex = ParameterIndexMap.Find(ParameterName))
 	{
-		if (Param.Name == ParameterName)
-		{
-			return Param.VectorValue;
-		}
+		Handle.Index = *ExistingIndex;
+		return Handle;
 	}
-	return DefaultValue;
+
+	// 없으면 새로 추가 (값은 아직 설정되지 않은 상태)
+	Handle.Index = InstanceParameters.Add(FParticleParameter(ParameterName));
+	ParameterIndexMap.Add(ParameterName, Handle.Index);
+	return Handle;
 }
 
-FLinearColor UParticleSystemComponent::GetColorParameter(const FString& ParameterName, const FLinearColor& DefaultValue) const
+FParticleParameterHandle UParticleSystemComponent::FindParameter(const FName& ParameterName) const
 {
-	for (const FParticleParameter& Param : InstanceParameters)
+	FParticleParameterHandle Handle;
+	if (const int32* ExistingIndex = ParameterIndexMap.Find(ParameterName))
 	{
-		if (Param.Name == ParameterName)
-		{
-			return Param.ColorValue;
-		}
+		Handle.Index = *ExistingIndex;
 	}
-	return DefaultValue;
+	return Handle;
+}
+
+void UParticleSystemComponent::SetFloatParameter(const FName& ParameterName, float Value)
+{
+	SetFloatParameter(FindOrAddParameter(ParameterName), Value);
+}
+
+void UParticleSystemComponent::SetVectorParameter(const FName& ParameterName, const FVector& Value)
+{
+	SetVectorParameter(FindOrAddParameter(ParameterName), Value);
+}
+
+void UParticleSystemComponent::SetColorParameter(const FName& ParameterName, const FLinearColor& Value)
+{
+	SetColorParameter(FindOrAddParameter(ParameterName), Value);
+}
+
+float UParticleSystemComponent::GetFloatParameter(const FName& ParameterName, float DefaultValue) const
+{
+	return GetFloatParameter(FindParameter(ParameterName), DefaultValue);
+}
+
+FVector UParticleSystemComponent::GetVectorParameter(const FName& ParameterName, const FVector& DefaultValue) const
+{
+	return GetVectorParameter(FindParameter(ParameterName), DefaultValue);
+}
+
+FLinearColor UParticleSystemComponent::GetColorParameter(const FName& ParameterName, const FLinearColor& DefaultValue) const
+{
+	return GetColorParameter(FindParameter(ParameterName), DefaultValue);
 }
 
 void UParticleSystemComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -1201,6 +1471,8 @@ void UParticleSystemComponent::DuplicateSubObjects()
 	RibbonIndexBuffer = nullptr;
 	AllocatedRibbonVertexCount = 0;
 	AllocatedRibbonIndexCount = 0;
+	BeamBufferVersion = 0;
+	RibbonBufferVersion = 0;
 
 	// 테스트용 리소스 포인터 초기화 (원본 소유, 복사본에서 삭제하면 안됨)
 	TestTemplate = nullptr;
@@ -1210,7 +1482,7 @@ void UParticleSystemComponent::DuplicateSubObjects()
 	CachedParticleMaterials.Empty();
 }
 
-void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	// 0. 런타임 LOD 업데이트 (카메라 거리 기반)
 	if (View)
@@ -1242,7 +1514,7 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
 			auto* SpriteData = static_cast<FDynamicSpriteEmitterDataBase*>(EmitterData);
 			FVector ViewOrigin = View ? View->ViewLocation : FVector(0.0f, 0.0f, 0.0f);
 			FVector ViewDirection = View ? View->ViewRotation.GetForwardVector() : FVector(1.0f, 0.0f, 0.0f);
-			SpriteData->SortSpriteParticles(Source.SortMode, ViewOrigin, ViewDirection);
+			SpriteData->SortSpriteParticles(Source.SortMode, ViewOrigin, ViewDirection, SpriteSorter);
 		}
 	}
 
@@ -1354,6 +1626,7 @@ void UParticleSystemComponent::FillMeshInstanceBuffer(uint32 TotalInstances)
 		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
 		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 
+		FRHIStatManager::GetInstance().RecordBufferCreate(Desc.ByteWidth);
 		if (SUCCEEDED(Device->CreateBuffer(&Desc, nullptr, &MeshInstanceBuffer)))
 		{
 			AllocatedMeshInstanceCount = NewCount;
@@ -1451,9 +1724,10 @@ void UParticleSystemComponent::FillMeshInstanceBuffer(uint32 TotalInstances)
 	}
 
 	Context->Unmap(MeshInstanceBuffer, 0);
+	FRHIStatManager::GetInstance().RecordMap(InstanceOffset * sizeof(FMeshParticleInstanceVertex));
 }
 
-void UParticleSystemComponent::CreateMeshParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::CreateMeshParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	if (!MeshInstanceBuffer)
 	{
@@ -1647,6 +1921,7 @@ void UParticleSystemComponent::FillSpriteInstanceBuffer(uint32 TotalInstances)
 		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
 		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 
+		FRHIStatManager::GetInstance().RecordBufferCreate(Desc.ByteWidth);
 		if (SUCCEEDED(Device->CreateBuffer(&Desc, nullptr, &SpriteInstanceBuffer)))
 		{
 			AllocatedSpriteInstanceCount = NewCount;
@@ -1734,9 +2009,10 @@ void UParticleSystemComponent::FillSpriteInstanceBuffer(uint32 TotalInstances)
 	}
 
 	Context->Unmap(SpriteInstanceBuffer, 0);
+	FRHIStatManager::GetInstance().RecordMap(InstanceOffset * sizeof(FSpriteParticleInstanceVertex));
 }
 
-void UParticleSystemComponent::CreateSpriteParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements)
+void UParticleSystemComponent::CreateSpriteParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements)
 {
 	if (!SpriteInstanceBuffer)
 	{
@@ -1841,25 +2117,33 @@ void UParticleSystemComponent::FillBeamBuffers(const FSceneView* View)
 		return;
 	}
 
-	// 1. 필요한 총 정점 및 인덱스 수 계산
+	const FVector ViewDirection = View->ViewRotation.GetForwardVector();
+
+	// 같은 렌더 데이터를 같은 방향의 뷰로 이미 채웠으면 재사용 (일시정지/같은 뷰로 여러 번 수집)
+	if (BeamVertexBuffer && BeamIndexBuffer && BeamBufferVersion == RenderDataVersion &&
+		BeamBufferViewDirection.X == ViewDirection.X && BeamBufferViewDirection.Y == ViewDirection.Y && BeamBufferViewDirection.Z == ViewDirection.Z)
+	{
+		return;
+	}
+
+	// 1. 필요한 총 정점 수 / 가장 긴 빔의 세그먼트 수 계산
 	uint32 TotalVertices = 0;
-	uint32 TotalIndices = 0;
+	uint32 MaxSegments = 0;
 	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
 	{
 		if (EmitterData && EmitterData->GetSource().eEmitterType == EDynamicEmitterType::Beam)
 		{
 			const auto& BeamSource = static_cast<const FDynamicBeamEmitterReplayDataBase&>(EmitterData->GetSource());
 			const int32 NumPoints = BeamSource.BeamPoints.Num();
-			if (NumPoints > 1)
+			if (NumPoints > 1 && BeamSource.Strip.Num() == NumPoints)
 			{
-				const int32 SegmentCount = NumPoints - 1;
-				TotalVertices += (SegmentCount + 1) * 2;
-				TotalIndices += SegmentCount * 6;
+				TotalVertices += NumPoints * 2;
+				MaxSegments = FMath::Max(MaxSegments, static_cast<uint32>(NumPoints - 1));
 			}
 		}
 	}
 
-	if (TotalVertices == 0 || TotalIndices == 0)
+	if (TotalVertices == 0)
 	{
 		return;
 	}
@@ -1867,36 +2151,26 @@ void UParticleSystemComponent::FillBeamBuffers(const FSceneView* View)
 	ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
 	ID3D11DeviceContext* Context = GEngine.GetRHIDevice()->GetDeviceContext();
 
-	// 2. 버퍼 생성/리사이즈
+	// 2. 버퍼 생성/리사이즈 (인덱스는 세그먼트 패턴이 고정이므로 부족할 때만 다시 생성)
 	if (TotalVertices > AllocatedBeamVertexCount)
 	{
 		if (BeamVertexBuffer) BeamVertexBuffer->Release();
+		BeamVertexBuffer = nullptr;
+		AllocatedBeamVertexCount = 0;
 		uint32 NewCount = FMath::Max(TotalVertices * 2, 64u);
 		D3D11_BUFFER_DESC Desc = {};
 		Desc.ByteWidth = NewCount * sizeof(FParticleBeamVertex);
 		Desc.Usage = D3D11_USAGE_DYNAMIC;
 		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
 		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		FRHIStatManager::GetInstance().RecordBufferCreate(Desc.ByteWidth);
 		if (SUCCEEDED(Device->CreateBuffer(&Desc, nullptr, &BeamVertexBuffer)))
 		{
 			AllocatedBeamVertexCount = NewCount;
 		}
 	}
 
-	if (TotalIndices > AllocatedBeamIndexCount)
-	{
-		if (BeamIndexBuffer) BeamIndexBuffer->Release();
-		uint32 NewCount = FMath::Max(TotalIndices * 2, 128u);
-		D3D11_BUFFER_DESC Desc = {};
-		Desc.ByteWidth = NewCount * sizeof(uint32);
-		Desc.Usage = D3D11_USAGE_DYNAMIC;
-		Desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-		if (SUCCEEDED(Device->CreateBuffer(&Desc, nullptr, &BeamIndexBuffer)))
-		{
-			AllocatedBeamIndexCount = NewCount;
-		}
-	}
+	EnsureStripIndexBuffer(Device, BeamIndexBuffer, AllocatedBeamIndexCount, MaxSegments);
 
 	if (!BeamVertexBuffer || !BeamIndexBuffer)
 	{
@@ -1904,24 +2178,16 @@ void UParticleSystemComponent::FillBeamBuffers(const FSceneView* View)
 	}
 
 	// 3. 버퍼 매핑
-	D3D11_MAPPED_SUBRESOURCE VBMappedData, IBMappedData;
-	if (FAILED(Context->Map(BeamVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &VBMappedData)) ||
-		FAILED(Context->Map(BeamIndexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &IBMappedData)))
+	D3D11_MAPPED_SUBRESOURCE VBMappedData = {};
+	if (FAILED(Context->Map(BeamVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &VBMappedData)))
 	{
-		if (VBMappedData.pData) Context->Unmap(BeamVertexBuffer, 0);
 		return;
 	}
 
 	auto* Vertices = static_cast<FParticleBeamVertex*>(VBMappedData.pData);
-	auto* Indices = static_cast<uint32*>(IBMappedData.pData);
-
 	uint32 VertexOffset = 0;
-	uint32 IndexOffset = 0;
 
-	FVector ViewDirection = View->ViewRotation.GetForwardVector();
-	FVector ViewOrigin = View->ViewLocation;
-
-	// 4. 이미터 순회하며 버퍼 채우기
+	// 4. 이미터 순회하며 정점 채우기 (카메라 정렬 오프셋만 뷰마다 계산)
 	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
 	{
 		if (!EmitterData || EmitterData->GetSource().eEmitterType != EDynamicEmitterType::Beam)
@@ -1929,60 +2195,39 @@ void UParticleSystemComponent::FillBeamBuffers(const FSceneView* View)
 
 		const auto& BeamSource = static_cast<const FDynamicBeamEmitterReplayDataBase&>(EmitterData->GetSource());
 		const TArray<FVector>& BeamPoints = BeamSource.BeamPoints;
-		const float BeamWidth = BeamSource.Width;
-		const float TileU = BeamSource.TileU;
-		const FLinearColor BeamColor = BeamSource.Color;
+		const FParticleTrailStrip& Strip = BeamSource.Strip;
+		const int32 NumPoints = BeamPoints.Num();
 
-		if (BeamPoints.Num() < 2)
+		if (NumPoints < 2 || Strip.Num() != NumPoints)
 			continue;
 
-		uint32 EmitterBaseVertexIndex = VertexOffset;
-
-		// 1. 모든 정점을 먼저 생성 (Triangle Strip 방식)
-		for (int32 i = 0; i < BeamPoints.Num(); ++i)
-		{
-			const FVector& P = BeamPoints[i];
-			FVector SegmentDir = (i < BeamPoints.Num() - 1) ? (BeamPoints[i + 1] - P) : (P - BeamPoints[i - 1]);
-			SegmentDir.Normalize();
-
-			FVector Up = FVector::Cross(SegmentDir, ViewDirection);
-			Up.Normalize();
-			
-			float HalfWidth = BeamWidth * 0.5f;
+		TrailOffsetX.SetNum(NumPoints);
+		TrailOffsetY.SetNum(NumPoints);
+		TrailOffsetZ.SetNum(NumPoints);
+		Strip.ComputeOffsets(ViewDirection, TrailOffsetX.GetData(), TrailOffsetY.GetData(), TrailOffsetZ.GetData());
 
-			// UV의 V좌표는 빔의 길이에 따라 0에서 1까지 변함
-			float V = (float)i / (float)(BeamPoints.Num() - 1);
-			
-			// 각 포인트마다 2개의 정점(좌, 우) 생성
-			Vertices[VertexOffset++] = { P - Up * HalfWidth, FVector2D(0.0f, V), BeamColor, BeamWidth };
-			Vertices[VertexOffset++] = { P + Up * HalfWidth, FVector2D(1.0f, V), BeamColor, BeamWidth };
-		}
+		const float BeamWidth = BeamSource.Width;
+		const FLinearColor BeamColor = BeamSource.Color;
 
-		// 2. 정점들을 연결하여 인덱스 생성
-		for (int32 i = 0; i < BeamPoints.Num() - 1; ++i)
+		// 각 포인트마다 2개의 정점(좌, 우) 생성, V는 빔의 길이에 따라 0 → 1
+		for (int32 i = 0; i < NumPoints; ++i)
 		{
-			uint32 V0 = EmitterBaseVertexIndex + i * 2;     // 현재 세그먼트의 좌측 정점
-			uint32 V1 = EmitterBaseVertexIndex + i * 2 + 1; // 현재 세그먼트의 우측 정점
-			uint32 V2 = EmitterBaseVertexIndex + (i + 1) * 2;     // 다음 세그먼트의 좌측 정점
-			uint32 V3 = EmitterBaseVertexIndex + (i + 1) * 2 + 1; // 다음 세그먼트의 우측 정점
-
-			// 첫 번째 삼각형 (V0, V2, V1)
-			Indices[IndexOffset++] = V0;
-			Indices[IndexOffset++] = V2;
-			Indices[IndexOffset++] = V1;
+			const FVector& P = BeamPoints[i];
+			const FVector Offset(TrailOffsetX[i], TrailOffsetY[i], TrailOffsetZ[i]);
 
-			// 두 번째 삼각형 (V1, V2, V3)
-			Indices[IndexOffset++] = V1;
-			Indices[IndexOffset++] = V2;
-			Indices[IndexOffset++] = V3;
+			Vertices[VertexOffset++] = { P - Offset, FVector2D(0.0f, Strip.V[i]), BeamColor, BeamWidth };
+			Vertices[VertexOffset++] = { P + Offset, FVector2D(1.0f, Strip.V[i]), BeamColor, BeamWidth };
 		}
 	}
 
 	Context->Unmap(BeamVertexBuffer, 0);
-	Context->Unmap(BeamIndexBuffer, 0);
+	FRHIStatManager::GetInstance().RecordMap(VertexOffset * sizeof(FParticleBeamVertex));
+
+	BeamBufferVersion = RenderDataVersion;
+	BeamBufferViewDirection = ViewDirection;
 }
 
-void UParticleSystemComponent::CreateBeamParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements)
+void UParticleSystemComponent::CreateBeamParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements)
 {
 	if (!BeamVertexBuffer || !BeamIndexBuffer)
 	{
@@ -1990,7 +2235,6 @@ void UParticleSystemComponent::CreateBeamParticleBatch(TArray<FMeshBatchElement>
 	}
 
 	uint32 VertexOffset = 0;
-	uint32 IndexOffset = 0;
 
 	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
 	{
@@ -1998,7 +2242,8 @@ void UParticleSystemComponent::CreateBeamParticleBatch(TArray<FMeshBatchElement>
 			continue;
 
 		const auto& BeamSource = static_cast<const FDynamicBeamEmitterReplayDataBase&>(EmitterData->GetSource());
-		if (BeamSource.BeamPoints.Num() < 2)
+		// FillBeamBuffers와 같은 조건으로 건너뛰어야 정점 오프셋이 일치
+		if (BeamSource.BeamPoints.Num() < 2 || BeamSource.Strip.Num() != BeamSource.BeamPoints.Num())
 			continue;
 
 		UMaterialInterface* Material = BeamSource.Material;
@@ -2033,8 +2278,9 @@ void UParticleSystemComponent::CreateBeamParticleBatch(TArray<FMeshBatchElement>
 		BatchElement.InstanceBuffer = nullptr;
 		BatchElement.InstanceStride = 0;
 
+		// 인덱스는 스트립 시작 기준 상대 패턴 (EnsureStripIndexBuffer)
 		BatchElement.IndexCount = NumIndices;
-		BatchElement.StartIndex = IndexOffset;
+		BatchElement.StartIndex = 0;
 		BatchElement.BaseVertexIndex = VertexOffset;
 
 		BatchElement.WorldMatrix = FMatrix::Identity();
@@ -2048,7 +2294,6 @@ void UParticleSystemComponent::CreateBeamParticleBatch(TArray<FMeshBatchElement>
 
 		// Update offsets for the next beam
 		VertexOffset += NumVertices;
-		IndexOffset += NumIndices;
 	}
 }
 
@@ -2059,24 +2304,33 @@ void UParticleSystemComponent::FillRibbonBuffers(const FSceneView* View)
 		return;
 	}
 
-	// 1. 필요한 총 정점 및 인덱스 수 계산
+	const FVector ViewDirection = View->ViewRotation.GetForwardVector();
+
+	// 같은 렌더 데이터를 같은 방향의 뷰로 이미 채웠으면 재사용 (일시정지/같은 뷰로 여러 번 수집)
+	if (RibbonVertexBuffer && RibbonIndexBuffer && RibbonBufferVersion == RenderDataVersion &&
+		RibbonBufferViewDirection.X == ViewDirection.X && RibbonBufferViewDirection.Y == ViewDirection.Y && RibbonBufferViewDirection.Z == ViewDirection.Z)
+	{
+		return;
+	}
+
+	// 1. 필요한 총 정점 수 / 가장 긴 리본의 세그먼트 수 계산
 	uint32 TotalVertices = 0;
-	uint32 TotalIndices = 0;
+	uint32 MaxSegments = 0;
 	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
 	{
 		if (EmitterData && EmitterData->GetSource().eEmitterType == EDynamicEmitterType::Ribbon)
 		{
 			const auto& RibbonSource = static_cast<const FDynamicRibbonEmitterReplayDataBase&>(EmitterData->GetSource());
 			const int32 NumPoints = RibbonSource.RibbonPoints.Num();
-			if (NumPoints > 1)
+			if (NumPoints > 1 && RibbonSource.Strip.Num() == NumPoints && RibbonSource.RibbonColors.Num() == NumPoints)
 			{
 				TotalVertices += NumPoints * 2;
-				TotalIndices += (NumPoints - 1) * 6;
+				MaxSegments = FMath::Max(MaxSegments, static_cast<uint32>(NumPoints - 1));
 			}
 		}
 	}
 
-	if (TotalVertices == 0 || TotalIndices == 0)
+	if (TotalVertices == 0)
 	{
 		return;
 	}
@@ -2084,36 +2338,26 @@ void UParticleSystemComponent::FillRibbonBuffers(const FSceneView* View)
 	ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
 	ID3D11DeviceContext* Context = GEngine.GetRHIDevice()->GetDeviceContext();
 
-	// 2. 버퍼 생성/리사이즈
+	// 2. 버퍼 생성/리사이즈 (인덱스는 세그먼트 패턴이 고정이므로 부족할 때만 다시 생성)
 	if (TotalVertices > AllocatedRibbonVertexCount)
 	{
 		if (RibbonVertexBuffer) RibbonVertexBuffer->Release();
+		RibbonVertexBuffer = nullptr;
+		AllocatedRibbonVertexCount = 0;
 		uint32 NewCount = FMath::Max(TotalVertices * 2, 128u);
 		D3D11_BUFFER_DESC Desc = {};
 		Desc.ByteWidth = NewCount * sizeof(FParticleRibbonVertex);
 		Desc.Usage = D3D11_USAGE_DYNAMIC;
 		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
 		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		FRHIStatManager::GetInstance().RecordBufferCreate(Desc.ByteWidth);
 		if (SUCCEEDED(Device->CreateBuffer(&Desc, nullptr, &RibbonVertexBuffer)))
 		{
 			AllocatedRibbonVertexCount = NewCount;
 		}
 	}
 
-	if (TotalIndices > AllocatedRibbonIndexCount)
-	{
-		if (RibbonIndexBuffer) RibbonIndexBuffer->Release();
-		uint32 NewCount = FMath::Max(TotalIndices * 2, 256u);
-		D3D11_BUFFER_DESC Desc = {};
-		Desc.ByteWidth = NewCount * sizeof(uint32);
-		Desc.Usage = D3D11_USAGE_DYNAMIC;
-		Desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-		if (SUCCEEDED(Device->CreateBuffer(&Desc, nullptr, &RibbonIndexBuffer)))
-		{
-			AllocatedRibbonIndexCount = NewCount;
-		}
-	}
+	EnsureStripIndexBuffer(Device, RibbonIndexBuffer, AllocatedRibbonIndexCount, MaxSegments);
 
 	if (!RibbonVertexBuffer || !RibbonIndexBuffer)
 	{
@@ -2121,108 +2365,119 @@ void UParticleSystemComponent::FillRibbonBuffers(const FSceneView* View)
 	}
 
 	// 3. 버퍼 매핑
-	D3D11_MAPPED_SUBRESOURCE VBMappedData, IBMappedData;
-	if (FAILED(Context->Map(RibbonVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &VBMappedData)) ||
-		FAILED(Context->Map(RibbonIndexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &IBMappedData)))
+	D3D11_MAPPED_SUBRESOURCE VBMappedData = {};
+	if (FAILED(Context->Map(RibbonVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &VBMappedData)))
 	{
-		if (VBMappedData.pData) Context->Unmap(RibbonVertexBuffer, 0);
-		if (IBMappedData.pData) Context->Unmap(RibbonIndexBuffer, 0);
 		return;
 	}
 
 	auto* Vertices = static_cast<FParticleRibbonVertex*>(VBMappedData.pData);
-	auto* Indices = static_cast<uint32*>(IBMappedData.pData);
-
 	uint32 VertexOffset = 0;
-	uint32 IndexOffset = 0;
 
-	FVector ViewDirection = View->ViewRotation.GetForwardVector();
-	
-	// 4. 이미터 순회하며 버퍼 채우기
+	// 4. 이미터 순회하며 정점 채우기 (접선/테이퍼 폭/V는 빌드 시 계산됨, 카메라 정렬 오프셋만 뷰마다 계산)
 	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
 	{
 		if (!EmitterData || EmitterData->GetSource().eEmitterType != EDynamicEmitterType::Ribbon)
 			continue;
-	
+
 		const auto& RibbonSource = static_cast<const FDynamicRibbonEmitterReplayDataBase&>(EmitterData->GetSource());
 		const TArray<FVector>& RibbonPoints = RibbonSource.RibbonPoints;
 		const TArray<FLinearColor>& RibbonColors = RibbonSource.RibbonColors;
-		const float RibbonWidth = RibbonSource.Width;
+		const FParticleTrailStrip& Strip = RibbonSource.Strip;
 		const int32 NumPoints = RibbonPoints.Num();
 
-		if (NumPoints < 2 || RibbonColors.Num() != NumPoints)
+		if (NumPoints < 2 || RibbonColors.Num() != NumPoints || Strip.Num() != NumPoints)
 			continue;
 
-		uint32 EmitterBaseVertexIndex = VertexOffset;
+		TrailOffsetX.SetNum(NumPoints);
+		TrailOffsetY.SetNum(NumPoints);
+		TrailOffsetZ.SetNum(NumPoints);
+		Strip.ComputeOffsets(ViewDirection, TrailOffsetX.GetData(), TrailOffsetY.GetData(), TrailOffsetZ.GetData());
 
-		// 1. 모든 정점을 먼저 생성 (Triangle Strip 방식)
+		// 각 포인트마다 2개의 정점(좌, 우) 생성
 		for (int32 i = 0; i < NumPoints; ++i)
 		{
 			const FVector& P = RibbonPoints[i];
+			const FVector Offset(TrailOffsetX[i], TrailOffsetY[i], TrailOffsetZ[i]);
+			const FVector Tangent(Strip.TangentX[i], Strip.TangentY[i], Strip.TangentZ[i]);
 			const FLinearColor& Color = RibbonColors[i];  // 파티클 색상 (페이드 아웃 포함)
 
-			FVector SegmentDir;
-			if (i < NumPoints - 1)
-			{
-				SegmentDir = RibbonPoints[i + 1] - P;
-			}
-			else
-			{
-				SegmentDir = P - RibbonPoints[i - 1];
-			}
-			SegmentDir.Normalize();
-
-			FVector Up = FVector::Cross(SegmentDir, ViewDirection);
-			Up.Normalize();
-
-			// UV의 V좌표는 리본의 길이에 따라 0에서 1까지 변함
-			float V = (float)i / (float)(NumPoints - 1);
-
-			// 테이퍼링: 끝으로 갈수록 너비 감소 (뾰족한 끝 방지)
-			// V=0 (오래된 파티클, 트레일 끝) → 너비 0
-			// V=1 (새로운 파티클, 트레일 시작) → 너비 100%
-			float WidthScale = V;  // 선형 테이퍼링 (V*V or sqrt(V))
-			float HalfWidth = (RibbonWidth * 0.5f) * WidthScale;
-
-			// 각 포인트마다 2개의 정점(좌, 우) 생성
 			Vertices[VertexOffset++] = {
-				P - Up * HalfWidth,		// Position
-				P,						// ControlPoint
-				SegmentDir,				// Tangent
-				Color,					// Color (페이드 아웃 알파 포함)
-				FVector2D(0.0f, V)		// UV
+				P - Offset,					// Position
+				P,							// ControlPoint
+				Tangent,					// Tangent
+				Color,						// Color (페이드 아웃 알파 포함)
+				FVector2D(0.0f, Strip.V[i])	// UV
 			};
 			Vertices[VertexOffset++] = {
-				P + Up * HalfWidth,		// Position
-				P,						// ControlPoint
-				SegmentDir,				// Tangent
-				Color,					// Color (페이드 아웃 알파 포함)
-				FVector2D(1.0f, V)		// UV
+				P + Offset,					// Position
+				P,							// ControlPoint
+				Tangent,					// Tangent
+				Color,						// Color (페이드 아웃 알파 포함)
+				FVector2D(1.0f, Strip.V[i])	// UV
 			};
-		}		
-		// 2. 정점들을 연결하여 인덱스 생성
-		for (int32 i = 0; i < NumPoints - 1; ++i)
-		{
-			uint32 V0 = EmitterBaseVertexIndex + i * 2;
-			uint32 V1 = V0 + 1;
-			uint32 V2 = EmitterBaseVertexIndex + (i + 1) * 2;
-			uint32 V3 = V2 + 1;
-
-			Indices[IndexOffset++] = V0;
-			Indices[IndexOffset++] = V2;
-			Indices[IndexOffset++] = V1;
-
-			Indices[IndexOffset++] = V1;
-			Indices[IndexOffset++] = V2;
-			Indices[IndexOffset++] = V3;
 		}
 	}
 
 	Context->Unmap(RibbonVertexBuffer, 0);
-	Context->Unmap(RibbonIndexBuffer, 0);
+	FRHIStatManager::GetInstance().RecordMap(VertexOffset * sizeof(FParticleRibbonVertex));
+
+	RibbonBufferVersion = RenderDataVersion;
+	RibbonBufferViewDirection = ViewDirection;
+}
+
+void UParticleSystemComponent::EnsureStripIndexBuffer(ID3D11Device* Device, ID3D11Buffer*& IndexBuffer, uint32& AllocatedIndexCount, uint32 SegmentCount)
+{
+	// 스트립 인덱스는 이미터 시작 정점 기준 상대 인덱스라 (BaseVertexIndex로 오프셋) 모든 빔/리본이 같은 패턴을 공유
+	// 가장 긴 스트립이 들어가면 다시 쓸 필요 없음
+	const uint32 RequiredIndices = SegmentCount * 6;
+	if (IndexBuffer && RequiredIndices <= AllocatedIndexCount)
+	{
+		return;
+	}
+
+	if (IndexBuffer)
+	{
+		IndexBuffer->Release();
+		IndexBuffer = nullptr;
+	}
+	AllocatedIndexCount = 0;
+
+	const uint32 NewSegmentCount = FMath::Max(SegmentCount * 2, 32u);
+	TArray<uint32> Pattern;
+	Pattern.SetNum(NewSegmentCount * 6);
+	for (uint32 Segment = 0; Segment < NewSegmentCount; ++Segment)
+	{
+		const uint32 V0 = Segment * 2;	// 현재 포인트의 좌측 정점
+		const uint32 V1 = V0 + 1;		// 현재 포인트의 우측 정점
+		const uint32 V2 = V0 + 2;		// 다음 포인트의 좌측 정점
+		const uint32 V3 = V0 + 3;		// 다음 포인트의 우측 정점
+
+		uint32* Indices = Pattern.GetData() + Segment * 6;
+		Indices[0] = V0;
+		Indices[1] = V2;
+		Indices[2] = V1;
+		Indices[3] = V1;
+		Indices[4] = V2;
+		Indices[5] = V3;
+	}
+
+	D3D11_BUFFER_DESC Desc = {};
+	Desc.ByteWidth = Pattern.Num() * sizeof(uint32);
+	Desc.Usage = D3D11_USAGE_IMMUTABLE;
+	Desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+
+	D3D11_SUBRESOURCE_DATA InitData = {};
+	InitData.pSysMem = Pattern.GetData();
+
+	FRHIStatManager::GetInstance().RecordBufferCreate(Desc.ByteWidth);
+	if (SUCCEEDED(Device->CreateBuffer(&Desc, &InitData, &IndexBuffer)))
+	{
+		AllocatedIndexCount = Pattern.Num();
+	}
 }
 
-void UParticleSystemComponent::CreateRibbonParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements)
+void UParticleSystemComponent::CreateRibbonParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements)
 {
 	if (!RibbonVertexBuffer || !RibbonIndexBuffer)
 	{
@@ -2230,7 +2485,6 @@ void UParticleSystemComponent::CreateRibbonParticleBatch(TArray<FMeshBatchElemen
 	}
 
 	uint32 VertexOffset = 0;
-	uint32 IndexOffset = 0;
 
 	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
 	{
@@ -2240,7 +2494,8 @@ void UParticleSystemComponent::CreateRibbonParticleBatch(TArray<FMeshBatchElemen
 		const auto& RibbonSource = static_cast<const FDynamicRibbonEmitterReplayDataBase&>(EmitterData->GetSource());
 		const int32 NumPoints = RibbonSource.RibbonPoints.Num();
 
-		if (NumPoints < 2)
+		// FillRibbonBuffers와 같은 조건으로 건너뛰어야 정점 오프셋이 일치
+		if (NumPoints < 2 || RibbonSource.RibbonColors.Num() != NumPoints || RibbonSource.Strip.Num() != NumPoints)
 			continue;
 
 		UMaterialInterface* Material = RibbonSource.Material;
@@ -2275,8 +2530,9 @@ void UParticleSystemComponent::CreateRibbonParticleBatch(TArray<FMeshBatchElemen
 		BatchElement.InstanceBuffer = nullptr;
 		BatchElement.InstanceStride = 0;
 
+		// 인덱스는 스트립 시작 기준 상대 패턴 (EnsureStripIndexBuffer)
 		BatchElement.IndexCount = NumIndicesForThisRibbon;
-		BatchElement.StartIndex = IndexOffset;
+		BatchElement.StartIndex = 0;
 		BatchElement.BaseVertexIndex = VertexOffset;
 
 		BatchElement.WorldMatrix = FMatrix::Identity();
@@ -2290,6 +2546,5 @@ void UParticleSystemComponent::CreateRibbonParticleBatch(TArray<FMeshBatchElemen
 
 		// Update offsets for the next ribbon emitter
 		VertexOffset += NumVerticesForThisRibbon;
-		IndexOffset += NumIndicesForThisRibbon;
 	}
 }
\ No newline at end of file
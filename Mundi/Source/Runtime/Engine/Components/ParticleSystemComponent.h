@@ -5,6 +5,7 @@
 #include "Source/Runtime/Engine/Particles/ParticleSystem.h"
 #include "Source/Runtime/Engine/Particles/ParticleEmitterInstance.h"
 #include "Source/Runtime/Engine/Particles/ParticleEventTypes.h"
+#include "Source/Runtime/Engine/Particles/ParticleParameterHandle.h"
 #include "UParticleSystemComponent.generated.h"
 
 struct FMeshBatchElement;
@@ -46,25 +47,41 @@ public:
 	// 렌더 데이터 (렌더링 스레드용)
 	TArray<FDynamicEmitterDataBase*> EmitterRenderData;
 
+	// 스프라이트 정렬기 (키/기수 정렬 버퍼를 프레임 간 재사용)
+	FParticleSorter SpriteSorter;
+
+	// 렌더 데이터 기준 월드 바운드 (UpdateRenderData에서 갱신, 렌더러 절두체 컬링용)
+	// BVH 등록용 GetWorldAABB()와 분리: 파티클 바운드는 매 틱 바뀌므로 공간 분할 갱신을 유발하지 않도록 함
+	const FAABB& GetParticleBounds() const { return ParticleBounds; }
+	bool HasParticleBounds() const { return bHasParticleBounds; }
+
 	// 언리얼 엔진 호환: 인스턴스 파라미터 시스템
 	// 게임플레이에서 파티클 속성을 동적으로 제어 가능
 	struct FParticleParameter
 	{
-		FString Name;
+		FName Name;
 		float FloatValue = 0.0f;
 		FVector VectorValue = FVector(0.0f, 0.0f, 0.0f);
 		FLinearColor ColorValue = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f);
 
+		// 타입별로 값이 설정되었는지 (핸들만 먼저 만들어진 경우 읽기 시 호출자의 기본값 사용)
+		bool bHasFloatValue = false;
+		bool bHasVectorValue = false;
+		bool bHasColorValue = false;
+
 		FParticleParameter() = default;
-		explicit FParticleParameter(const FString& InName)
+		explicit FParticleParameter(const FName& InName)
 			: Name(InName)
 		{
 		}
 	};
 
+	// 추가만 됨 (인덱스 = FParticleParameterHandle::Index)
 	TArray<FParticleParameter> InstanceParameters;
+	TMap<FName, int32> ParameterIndexMap;	// 이름 → InstanceParameters 인덱스
 
 	// 파티클 이벤트 배열 (이번 프레임에 발생한 이벤트들)
+	// 이미터는 틱 중에 자기 EventBuffer에만 기록하고, GatherEmitterEvents()에서 이미터 순서대로 병합됨
 	TArray<FParticleEventCollideData> CollisionEvents;  // 충돌 이벤트
 	TArray<FParticleEventData> SpawnEvents;             // 스폰 이벤트
 	TArray<FParticleEventData> DeathEvents;             // 사망 이벤트
@@ -74,6 +91,7 @@ public:
 	void AddCollisionEvent(const FParticleEventCollideData& Event);
 	void AddSpawnEvent(const FParticleEventData& Event);
 	void AddDeathEvent(const FParticleEventData& Event);
+	void GatherEmitterEvents();        // 이미터별 EventBuffer를 이미터 순서대로 병합 후 비움
 	void DispatchEventsToReceivers();  // EventReceiver 모듈에 이벤트 전달
 
 	// Dynamic Instance Buffer (메시 파티클 인스턴싱용)
@@ -96,6 +114,18 @@ public:
 	uint32 AllocatedRibbonVertexCount = 0;
 	uint32 AllocatedRibbonIndexCount = 0;
 
+	// 빔/리본 버퍼 재사용 판단 (UpdateRenderData마다 버전 증가, 같은 버전 + 같은 뷰 방향이면 다시 채우지 않음)
+	uint32 RenderDataVersion = 0;
+	uint32 BeamBufferVersion = 0;
+	uint32 RibbonBufferVersion = 0;
+	FVector BeamBufferViewDirection;
+	FVector RibbonBufferViewDirection;
+
+	// 스트립 카메라 정렬 오프셋 스크래치 (SoA)
+	TArray<float> TrailOffsetX;
+	TArray<float> TrailOffsetY;
+	TArray<float> TrailOffsetZ;
+
 	// Shared Quad Mesh (스프라이트 인스턴싱용)
 	// ComPtr + static inline: 프로그램 종료 시 자동 해제, cpp 정의 불필요
 	static inline Microsoft::WRL::ComPtr<ID3D11Buffer> SpriteQuadVertexBuffer;
@@ -111,8 +141,25 @@ public:
 	virtual void OnUnregister() override;                 // 에디터/PIE 모두에서 호출
 
 	// 틱
+	// 월드 틱 중에는 이미터 시뮬레이션을 FParticleTickManager에 예약하여 다른 컴포넌트와 함께 병렬 처리
 	virtual void TickComponent(float DeltaTime) override;
 
+	// 이미터 시뮬레이션 (병렬 가능하면 이 컴포넌트의 이미터들을 병렬로, 아니면 순서대로)
+	void TickEmitters(float DeltaTime);
+
+	// 이미터 하나의 이번 프레임 틱: 워밍업 중이면 이번 프레임 몫의 고정 스텝, 아니면 DeltaTime 한 번
+	// FParticleTickManager의 워커 스레드에서 호출됨 (컴포넌트 상태는 읽기만 함)
+	void TickEmitterInstance(FParticleEmitterInstance& Instance, float DeltaTime) const;
+
+	// 워밍업 진행 중인지 (진행 중에는 렌더 데이터/이벤트를 만들지 않음)
+	bool IsWarmingUp() const { return WarmupStepsRemaining > 0; }
+
+	// 시뮬레이션 후처리 (게임 스레드): 이벤트 병합 → 렌더 데이터 갱신 → 이벤트 디스패치/브로드캐스트
+	void FinishEmitterTick();
+
+	// 모든 이미터의 현재 LOD 모듈이 병렬 틱을 지원하는지
+	bool CanTickEmittersInParallel() const;
+
 	// 활성화/비활성화
 	void ActivateSystem();
 	void DeactivateSystem();
@@ -141,13 +188,61 @@ public:
 	void UpdateLODLevels(const FVector& CameraPosition);
 
 	// 언리얼 엔진 호환: 인스턴스 파라미터 제어
-	void SetFloatParameter(const FString& ParameterName, float Value);
-	void SetVectorParameter(const FString& ParameterName, const FVector& Value);
-	void SetColorParameter(const FString& ParameterName, const FLinearColor& Value);
+	// 매 프레임 갱신하는 파라미터는 FindOrAddParameter()로 핸들을 한 번 얻어 핸들 버전을 사용하세요.
+	// (이름 버전은 FName 해시 조회, 문자열 리터럴을 넘기면 매번 FName 변환 비용이 추가됨)
+	FParticleParameterHandle FindOrAddParameter(const FName& ParameterName);
+	FParticleParameterHandle FindParameter(const FName& ParameterName) const;
 
-	float GetFloatParameter(const FString& ParameterName, float DefaultValue = 0.0f) const;
-	FVector GetVectorParameter(const FString& ParameterName, const FVector& DefaultValue = FVector(0.0f, 0.0f, 0.0f)) const;
-	FLinearColor GetColorParameter(const FString& ParameterName, const FLinearColor& DefaultValue = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f)) const;
+	void SetFloatParameter(const FName& ParameterName, float Value);
+	void SetVectorParameter(const FName& ParameterName, const FVector& Value);
+	void SetColorParameter(const FName& ParameterName, const FLinearColor& Value);
+
+	float GetFloatParameter(const FName& ParameterName, float DefaultValue = 0.0f) const;
+	FVector GetVectorParameter(const FName& ParameterName, const FVector& DefaultValue = FVector(0.0f, 0.0f, 0.0f)) const;
+	FLinearColor GetColorParameter(const FName& ParameterName, const FLinearColor& DefaultValue = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f)) const;
+
+	// 핸들 버전 (O(1), 파티클별 경로에서 사용)
+	void SetFloatParameter(FParticleParameterHandle Handle, float Value)
+	{
+		FParticleParameter& Param = InstanceParameters[Handle.Index];
+		Param.FloatValue = Value;
+		Param.bHasFloatValue = true;
+	}
+
+	void SetVectorParameter(FParticleParameterHandle Handle, const FVector& Value)
+	{
+		FParticleParameter& Param = InstanceParameters[Handle.Index];
+		Param.VectorValue = Value;
+		Param.bHasVectorValue = true;
+	}
+
+	void SetColorParameter(FParticleParameterHandle Handle, const FLinearColor& Value)
+	{
+		FParticleParameter& Param = InstanceParameters[Handle.Index];
+		Param.ColorValue = Value;
+		Param.bHasColorValue = true;
+	}
+
+	float GetFloatParameter(FParticleParameterHandle Handle, float DefaultValue = 0.0f) const
+	{
+		if (!Handle.IsValid()) return DefaultValue;
+		const FParticleParameter& Param = InstanceParameters[Handle.Index];
+		return Param.bHasFloatValue ? Param.FloatValue : DefaultValue;
+	}
+
+	FVector GetVectorParameter(FParticleParameterHandle Handle, const FVector& DefaultValue = FVector(0.0f, 0.0f, 0.0f)) const
+	{
+		if (!Handle.IsValid()) return DefaultValue;
+		const FParticleParameter& Param = InstanceParameters[Handle.Index];
+		return Param.bHasVectorValue ? Param.VectorValue : DefaultValue;
+	}
+
+	FLinearColor GetColorParameter(FParticleParameterHandle Handle, const FLinearColor& DefaultValue = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f)) const
+	{
+		if (!Handle.IsValid()) return DefaultValue;
+		const FParticleParameter& Param = InstanceParameters[Handle.Index];
+		return Param.bHasColorValue ? Param.ColorValue : DefaultValue;
+	}
 
 	// 직렬화
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
@@ -155,29 +250,45 @@ public:
 	// PIE 복사 시 포인터 배열 초기화
 	virtual void DuplicateSubObjects() override;
 
-	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
 	// 메시 파티클 인스턴싱
 	void FillMeshInstanceBuffer(uint32 TotalInstances);
-	void CreateMeshParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
+	void CreateMeshParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
 
 	// 스프라이트 파티클 인스턴싱
 	void FillSpriteInstanceBuffer(uint32 TotalInstances);
-	void CreateSpriteParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements);
+	void CreateSpriteParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements);
 
 	// 빔 파티클 렌더링
 	void FillBeamBuffers(const FSceneView* View);
-	void CreateBeamParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements);
+	void CreateBeamParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements);
 
 	// 리본 파티클 렌더링
 	void FillRibbonBuffers(const FSceneView* View);
-	void CreateRibbonParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements);
+	void CreateRibbonParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements);
+
+	// 빔/리본 공용 상대 인덱스 패턴 버퍼 (SegmentCount 이상 담을 수 있을 때까지 재생성)
+	static void EnsureStripIndexBuffer(ID3D11Device* Device, ID3D11Buffer*& IndexBuffer, uint32& AllocatedIndexCount, uint32 SegmentCount);
 
 private:
 	void InitializeEmitterInstances();
 	void ClearEmitterInstances();
 	void UpdateRenderData();
 
+	// 워밍업: 이미터 인스턴스 생성 시 Template->WarmupTime을 스텝 수로 환산
+	// 게임 스레드에서 틱 예약 전에 이번 프레임 스텝 수(예산 이내)를 정하고, FinishEmitterTick에서 차감
+	void StartWarmup();
+	void BeginWarmupFrame();
+	int32 WarmupStepsRemaining = 0;
+	int32 FrameWarmupSteps = 0;
+	float WarmupStepTime = 0.0f;
+
+	// 렌더 데이터가 있는 이미터들의 바운드 합집합 (고정 바운드면 로컬 박스를 월드로 변환)
+	void UpdateParticleBounds();
+	FAABB ParticleBounds;
+	bool bHasParticleBounds = false;
+
 	// === 테스트용 리소스 (디버그 함수에서 생성, Component가 소유) ===
 	float TestTime = 0.0f;
 	UParticleSystem* TestTemplate = nullptr;
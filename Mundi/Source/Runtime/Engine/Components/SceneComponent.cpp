@@ -6,6 +6,7 @@
 #include "PrimitiveComponent.h"
 #include "WorldPartitionManager.h"
 #include "BillboardComponent.h"
+#include "Scene.h"
 // IMPLEMENT_CLASS is now auto-generated in .generated.cpp
 // USceneComponent.cpp
 TMap<uint32, USceneComponent*> USceneComponent::SceneIdMap;
@@ -22,6 +23,9 @@ USceneComponent::USceneComponent()
 
 USceneComponent::~USceneComponent()
 {
+    // 등록 해제 없이 삭제되는 컴포넌트 (에디터 보조 컴포넌트 등)
+    RemoveFromRenderScene();
+
     // 자식 메모리 해제
     // 복사본을 만들어 부모 리스트 무효화 문제를 피함
     TArray<USceneComponent*> ChildrenCopy = AttachChildren;
@@ -354,6 +358,7 @@ void USceneComponent::DuplicateSubObjects()
     AttachParent = nullptr; // 부모 컴포넌트가 이 객체의 SetupAttachment를 호출할 경우, 불필요한 로직(기존 부모에서 제거) 수행 방지
     SpriteComponent = nullptr;
     AttachChildren.clear(); // Actor에서 할당해줌
+    RenderScene = nullptr; // 복제본은 등록 시 다시 추가됨
 }
 
 // ──────────────────────────────
@@ -413,6 +418,11 @@ void USceneComponent::OnPropertyChanged(const FProperty& Prop)
         UpdateRelativeTransform();
         OnUpdateTransform(EUpdateTransformFlags::None, ETeleportType::None);
     }
+    else
+    {
+        // 메시/머티리얼 등 캐시된 렌더 데이터에 영향을 주는 프로퍼티일 수 있음
+        MarkRenderStateDirty();
+    }
 }
 
 void USceneComponent::OnRegister(UWorld* InWorld)
@@ -425,12 +435,55 @@ void USceneComponent::OnRegister(UWorld* InWorld)
         SpriteComponent->SetTexture(GDataDir + "/UI/Icons/EmptyActor.dds");
     }
 
+    AddToRenderScene(InWorld);
+
     OnUpdateTransform(EUpdateTransformFlags::None, ETeleportType::None);
 }
 
+void USceneComponent::OnUnregister()
+{
+    RemoveFromRenderScene();
+
+    Super::OnUnregister();
+}
+
+void USceneComponent::AddToRenderScene(UWorld* InWorld)
+{
+    if (RenderScene || !InWorld || !InWorld->GetScene())
+    {
+        return;
+    }
+    InWorld->GetScene()->AddComponent(this);
+}
+
+void USceneComponent::RemoveFromRenderScene()
+{
+    if (RenderScene)
+    {
+        RenderScene->RemoveComponent(this);
+    }
+}
+
+void USceneComponent::MarkRenderProxyDirty()
+{
+    if (RenderScene)
+    {
+        RenderScene->MarkProxyDirty(this);
+    }
+}
+
+void USceneComponent::MarkRenderStateDirty()
+{
+    if (RenderScene)
+    {
+        RenderScene->MarkRenderStateDirty(this);
+    }
+}
+
 void USceneComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
 {
     bIsTransformDirty = true;
+    MarkRenderProxyDirty();
     for (USceneComponent* Child : GetAttachChildren())
     {
         Child->OnUpdateTransform(UpdateTransformFlags, Teleport);
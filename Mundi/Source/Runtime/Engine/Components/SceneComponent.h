@@ -37,6 +37,7 @@ enum class ETeleportType : uint8
 };
 
 class URenderer;
+class FScene;
 UCLASS(DisplayName="씬 컴포넌트", Description="트랜스폼을 가진 기본 컴포넌트입니다")
 class USceneComponent : public UActorComponent
 {
@@ -141,8 +142,17 @@ public:
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
     void OnRegister(UWorld* InWorld) override;
+    void OnUnregister() override;
     void OnPropertyChanged(const FProperty& Prop) override;
 
+    // 렌더 씬(FScene) 등록. OnRegister/OnUnregister에서 호출되며, 등록 절차를 거치지 않는 에디터 보조 컴포넌트는 직접 호출
+    void AddToRenderScene(UWorld* InWorld);
+    void RemoveFromRenderScene();
+    // 렌더 씬에 캐시된 트랜스폼/바운드 무효화
+    void MarkRenderProxyDirty();
+    // 렌더 씬에 캐시된 바운드와 드로우 커맨드 무효화 (메시/머티리얼 변경)
+    void MarkRenderStateDirty();
+
     // SceneId
     uint32 GetSceneId() const { return SceneId; }
     void SetSceneId(uint32 InId) { SceneId = InId; }
@@ -205,4 +215,8 @@ protected:
     uint32 SceneId; // Scene파일에서 불러온 Id. 컴포넌트끼리 자식부모관계 연결하기 위해 저장. Scene에 저장할 때는 UUID를 저장
     uint32 ParentId;
     static TMap<uint32, USceneComponent*> SceneIdMap; // 부모를 찾기 위한 Map
+
+    // 등록된 렌더 씬 (FScene이 관리)
+    friend class FScene;
+    FScene* RenderScene = nullptr;
 };
@@ -68,8 +68,9 @@ public:
  
 protected:
 	mutable FAABB WorldAABB; //브로드 페이즈 용
-	TSet<UShapeComponent*> OverlapNow; // 이번 프레임에서 overlap 된 Shap Comps
-	TSet<UShapeComponent*> OverlapPrev; // 지난 프레임에서 overlap 됐으면 Cache
+	// 겹치는 상대는 보통 몇 개뿐이므로 노드 할당이 있는 TSet 대신 인라인 배열 (Contains는 선형 검색)
+	TArray<UShapeComponent*, TInlineAllocator<4>> OverlapNow; // 이번 프레임에서 overlap 된 Shap Comps
+	TArray<UShapeComponent*, TInlineAllocator<4>> OverlapPrev; // 지난 프레임에서 overlap 됐으면 Cache
 
 	bool bIsOverlapping = false;  // 충돌 상태 플래그 (Week09 호환)
 	 
@@ -44,6 +44,8 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
 
     if (!SkeletalMesh) { return; }
 
+    FMemoryTagScope TagScope(EMemoryTag::Animation);
+
     switch (PhysicsMode)
     {
     case EPhysicsMode::Animation:
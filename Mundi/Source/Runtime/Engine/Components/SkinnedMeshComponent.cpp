@@ -90,7 +90,7 @@ void USkinnedMeshComponent::DuplicateSubObjects()
    bSkinningMatricesDirty = true;
 }
 
-void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void USkinnedMeshComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
     if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData()) { return; }
 
@@ -598,6 +598,7 @@ void USkinnedMeshComponent::UpdateBoneMatrixBuffer()
       ZeroMemory(&InitData, sizeof(InitData));
       InitData.pSysMem = BufferData.GetData();
 
+      FRHIStatManager::GetInstance().RecordBufferCreate(BufferDesc.ByteWidth);
       HRESULT hr = Device->CreateBuffer(&BufferDesc, &InitData, &BoneMatricesBuffer);
       if (FAILED(hr))
       {
@@ -618,6 +619,7 @@ void USkinnedMeshComponent::UpdateBoneMatrixBuffer()
          // 전체 버퍼 크기만큼 복사 (MAX_BONES * sizeof(FMatrix))
          memcpy(MappedResource.pData, BufferData.GetData(), AlignedBufferSize);
          Context->Unmap(BoneMatricesBuffer, 0);
+         FRHIStatManager::GetInstance().RecordMap(AlignedBufferSize);
       }
       else
       {
@@ -32,9 +32,10 @@ void UStaticMeshComponent::OnStaticMeshReleased(UStaticMesh* ReleasedMesh)
 	}
 
 	StaticMesh = nullptr;
+	MarkRenderStateDirty();
 }
 
-void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UStaticMeshComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	if (!StaticMesh || !StaticMesh->GetStaticMeshAsset())
 	{
@@ -165,6 +166,8 @@ void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
 		// (슬롯은 이미 위에서 비워졌습니다.)
 		StaticMesh = nullptr;
 	}
+
+	MarkRenderStateDirty();
 }
 
 FAABB UStaticMeshComponent::GetWorldAABB() const
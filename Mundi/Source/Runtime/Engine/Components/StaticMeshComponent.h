@@ -29,9 +29,13 @@ public:
 
 	UPROPERTY(EditAnywhere, Category="Static Mesh", Tooltip="Static mesh asset to render")
 	UStaticMesh* StaticMesh = nullptr;
+
+	UPROPERTY(EditAnywhere, Category="Rendering", Tooltip="소프트웨어 오클루전 컬링의 가림막으로 메시 삼각형을 래스터화합니다 (벽, 건물 등 크고 단순한 메시에 사용)")
+	bool bUseAsOccluder = false;
+
 	void OnStaticMeshReleased(UStaticMesh* ReleasedMesh);
 
-	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
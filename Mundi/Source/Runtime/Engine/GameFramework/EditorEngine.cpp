@@ -373,6 +373,10 @@ void UEditorEngine::MainLoop()
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        // 이번 프레임의 임시 배열(TFrameArray) 메모리 일괄 회수, 태그별 할당 변화량 확정
+        FFrameArena::EndFrame();
+        FMemoryManager::EndFrame();
     }
 }
 
@@ -49,6 +49,75 @@ static void SaveIniFile()
         outfile << pair.first << " = " << pair.second << std::endl;
 }
 
+FHeadlessOptions FHeadlessOptions::Parse(const char* CommandLine)
+{
+    FHeadlessOptions Options;
+    if (!CommandLine)
+        return Options;
+
+    // 공백으로 토큰 분리 (큰따옴표로 감싼 경로 허용)
+    TArray<FString> Tokens;
+    FString Current;
+    bool bInQuotes = false;
+    for (const char* C = CommandLine; *C; ++C)
+    {
+        if (*C == '"')
+        {
+            bInQuotes = !bInQuotes;
+        }
+        else if ((*C == ' ' || *C == '\t') && !bInQuotes)
+        {
+            if (!Current.empty()) { Tokens.Add(Current); Current.clear(); }
+        }
+        else
+        {
+            Current += *C;
+        }
+    }
+    if (!Current.empty()) Tokens.Add(Current);
+
+    auto ReadValue = [](const FString& Token, const char* Key, FString& OutValue)
+    {
+        const size_t KeyLength = strlen(Key);
+        if (Token.compare(0, KeyLength, Key) != 0)
+            return false;
+        OutValue = Token.substr(KeyLength);
+        return true;
+    };
+
+    for (const FString& Token : Tokens)
+    {
+        FString Value;
+        if (Token == "-headless")
+            Options.bEnabled = true;
+        else if (Token == "-warp")
+            Options.bUseWarp = true;
+        else if (Token == "-norenderthread")
+            Options.bRenderThread = false;
+        else if (ReadValue(Token, "-frames=", Value))
+        {
+            try { Options.NumFrames = FMath::Max(1, stoi(Value)); }
+            catch (...) {}
+        }
+        else if (ReadValue(Token, "-width=", Value))
+        {
+            try { Options.Width = static_cast<uint32>(FMath::Max(1, stoi(Value))); }
+            catch (...) {}
+        }
+        else if (ReadValue(Token, "-height=", Value))
+        {
+            try { Options.Height = static_cast<uint32>(FMath::Max(1, stoi(Value))); }
+            catch (...) {}
+        }
+        else if (ReadValue(Token, "-scene=", Value))
+            Options.ScenePath = Value;
+        else if (ReadValue(Token, "-out=", Value))
+            Options.OutputPath = Value;
+    }
+
+    return Options;
+}
+
 UGameEngine::UGameEngine()
 {
 
@@ -184,6 +253,50 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
 
     // 디바이스 리소스 및 렌더러 생성
     RHIDevice.Initialize(HWnd);
+
+    // 렌더 스레드 (editor.ini에서 RenderThread = 0이면 단일 스레드)
+    // 런타임 초기화 전에 켜야 클로스 매니저 등 컨텍스트를 캐시하는 시스템이 지연 컨텍스트를 받음
+    if (EditorINI.count("RenderThread") == 0 || EditorINI["RenderThread"] != "0")
+    {
+        RHIDevice.EnableRenderThread();
+    }
+
+    return InitializeRuntime(GDataDir + "/Scenes/PlayScene.scene");
+}
+
+bool UGameEngine::StartupHeadless(const FHeadlessOptions& Options)
+{
+    bHeadless = true;
+    HeadlessOptions = Options;
+
+    // 윈도우 없이 옵션 해상도를 클라이언트 크기로 사용
+    ClientWidth = static_cast<float>(Options.Width);
+    ClientHeight = static_cast<float>(Options.Height);
+
+    //레거시
+    extern float CLIENTWIDTH;
+    extern float CLIENTHEIGHT;
+
+    CLIENTWIDTH = ClientWidth;
+    CLIENTHEIGHT = ClientHeight;
+
+    // 스왑체인 없는 디바이스 (NULL 드라이버, -warp면 WARP)
+    if (!RHIDevice.InitializeHeadless(Options.Width, Options.Height, Options.bUseWarp))
+    {
+        UE_LOG("[Headless] D3D11 디바이스를 만들 수 없어 종료합니다");
+        return false;
+    }
+    if (Options.bRenderThread)
+    {
+        RHIDevice.EnableRenderThread();
+    }
+
+    const FString StartupScenePath = Options.ScenePath.empty() ? GDataDir + "/Scenes/PlayScene.scene" : Options.ScenePath;
+    return InitializeRuntime(StartupScenePath);
+}
+
+bool UGameEngine::InitializeRuntime(const FString& StartupScenePath)
+{
     Renderer = std::make_unique<URenderer>(&RHIDevice);
 
     // Initialize audio device for game runtime
@@ -197,7 +310,7 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
         return false;
     }
 
-    // 매니저 초기화
+    // 매니저 초기화 (헤드리스면 HWnd가 없으므로 입력 없음)
     INPUT.Initialize(HWnd);
 
     // PhysX 초기화 (StaticMesh Convex 생성에 필요하므로 Preload 전에 초기화)
@@ -226,7 +339,6 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     ///////////////////////////////////
 
     // 시작 scene(level)을 직접 로드
-    const FString StartupScenePath = GDataDir + "/Scenes/PlayScene.scene";
     if (!GWorld->LoadLevelFromFile(UTF8ToWide(StartupScenePath)))
     {
         // 씬 로드 실패 시 경고만 표시하고 빈 월드로 계속 진행
@@ -357,11 +469,147 @@ void UGameEngine::MainLoop()
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        // 이번 프레임의 임시 배열(TFrameArray) 메모리 일괄 회수, 태그별 할당 변화량 확정
+        FFrameArena::EndFrame();
+        FMemoryManager::EndFrame();
+    }
+}
+
+void UGameEngine::RunHeadless()
+{
+    // 고정 DeltaSeconds: 실행마다 같은 시뮬레이션 → 측정값 비교 가능
+    const float DeltaSeconds = 1.0f / 60.0f;
+    const int32 NumFrames = HeadlessOptions.NumFrames;
+
+    TArray<double> TickTimesMS;
+    TArray<double> RenderTimesMS;
+    TArray<double> EnqueueWaitTimesMS;
+    TArray<double> SubmitTimesMS;
+    TickTimesMS.Reserve(NumFrames);
+    RenderTimesMS.Reserve(NumFrames);
+
+    const FRenderThread* RenderThread = RHIDevice.GetRenderThread();
+    if (RenderThread)
+    {
+        EnqueueWaitTimesMS.Reserve(NumFrames);
+        SubmitTimesMS.Reserve(NumFrames);
+    }
+
+    // 로딩 중 버퍼 생성/업로드는 제외하고 프레임 루프만 집계
+    FRHIStatManager::GetInstance().EndFrameStats();
+    FRHIStatManager::GetInstance().ResetTotals();
+
+    LARGE_INTEGER Frequency;
+    QueryPerformanceFrequency(&Frequency);
+    const double TicksToMS = 1000.0 / static_cast<double>(Frequency.QuadPart);
+
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        LARGE_INTEGER TickStart, RenderStart, RenderEnd;
+        QueryPerformanceCounter(&TickStart);
+
+        ClothManager->Tick(DeltaSeconds);
+        Tick(DeltaSeconds);
+
+        QueryPerformanceCounter(&RenderStart);
+        Render();
+        QueryPerformanceCounter(&RenderEnd);
+
+        TickTimesMS.Add((RenderStart.QuadPart - TickStart.QuadPart) * TicksToMS);
+        RenderTimesMS.Add((RenderEnd.QuadPart - RenderStart.QuadPart) * TicksToMS);
+
+        FFrameArena::EndFrame();
+        FMemoryManager::EndFrame();
+
+        // Render 시간에는 큐 대기가 포함됨. 제출 시간은 렌더 스레드가 마지막으로 끝낸 프레임 기준
+        if (RenderThread)
+        {
+            EnqueueWaitTimesMS.Add(RenderThread->GetLastEnqueueWaitMS());
+            SubmitTimesMS.Add(RenderThread->GetLastSubmitTimeMS());
+        }
+    }
+
+    // 큐에 남은 프레임까지 제출한 뒤 집계
+    RHIDevice.FlushRenderThread();
+
+    WriteHeadlessReport(TickTimesMS, RenderTimesMS, EnqueueWaitTimesMS, SubmitTimesMS);
+}
+
+void UGameEngine::WriteHeadlessReport(TArray<double>& TickTimesMS, TArray<double>& RenderTimesMS,
+                                      TArray<double>& EnqueueWaitTimesMS, TArray<double>& SubmitTimesMS) const
+{
+    const FRHIStatManager& RHIStats = FRHIStatManager::GetInstance();
+    const FRHIStats& Total = RHIStats.GetTotalStats();
+    const double NumFrames = static_cast<double>(FMath::Max<uint64>(1, RHIStats.GetNumFrames()));
+
+    // 평균/중앙값/p95/최대 (정렬하므로 입력 배열은 변경됨)
+    auto Summarize = [](TArray<double>& TimesMS, const char* Label, std::ostream& Out)
+    {
+        if (TimesMS.IsEmpty())
+            return;
+
+        double Sum = 0.0;
+        for (double Time : TimesMS) Sum += Time;
+        std::sort(TimesMS.begin(), TimesMS.end());
+
+        const int32 Count = TimesMS.Num();
+        char Line[256];
+        sprintf_s(Line, "%-8s avg %.3f ms | p50 %.3f ms | p95 %.3f ms | max %.3f ms",
+            Label, Sum / Count, TimesMS[Count / 2], TimesMS[FMath::Min(Count - 1, Count * 95 / 100)], TimesMS.Last());
+        Out << Line << std::endl;
+    };
+
+    std::ostringstream Report;
+    Report << "Scene    " << (HeadlessOptions.ScenePath.empty() ? "PlayScene" : HeadlessOptions.ScenePath) << std::endl;
+    Report << "Frames   " << TickTimesMS.Num() << " (" << HeadlessOptions.Width << "x" << HeadlessOptions.Height
+           << (RHIDevice.GetDriverType() == D3D_DRIVER_TYPE_NULL ? ", NULL" : ", WARP") << ")" << std::endl;
+    Summarize(TickTimesMS, "Tick", Report);
+    Summarize(RenderTimesMS, "Render", Report);
+    if (const FRenderThread* RenderThread = RHIDevice.GetRenderThread())
+    {
+        Report << "RThread  on (queue " << RenderThread->GetMaxQueuedFrames() << ")" << std::endl;
+        Summarize(EnqueueWaitTimesMS, "Wait", Report);
+        Summarize(SubmitTimesMS, "Submit", Report);
+    }
+    else
+    {
+        Report << "RThread  off" << std::endl;
+    }
+
+    char Line[256];
+    sprintf_s(Line, "Draws    %.1f / frame (%.1f instances)", Total.DrawCalls / NumFrames, Total.DrawInstances / NumFrames);
+    Report << Line << std::endl;
+    sprintf_s(Line, "Maps     %.1f / frame (%.1f KB)", Total.BufferMaps / NumFrames, Total.BufferMapBytes / NumFrames / 1024.0);
+    Report << Line << std::endl;
+    sprintf_s(Line, "CB       %.1f / frame (%.1f KB)", Total.ConstantBufferUpdates / NumFrames, Total.ConstantBufferBytes / NumFrames / 1024.0);
+    Report << Line << std::endl;
+    sprintf_s(Line, "Creates  %.1f / frame (%.1f KB)", Total.BufferCreates / NumFrames, Total.BufferCreateBytes / NumFrames / 1024.0);
+    Report << Line << std::endl;
+
+    const FFrameArenaStats ArenaStats = FFrameArena::GetStats();
+    sprintf_s(Line, "Arena    peak %.1f KB (reserved %.1f KB, %u arenas)", ArenaStats.HighWaterBytes / 1024.0, ArenaStats.ReservedBytes / 1024.0, ArenaStats.NumArenas);
+    Report << Line << std::endl;
+
+    const FString ReportText = Report.str();
+    UE_LOG("[Headless]\n%s", ReportText.c_str());
+
+    std::ofstream OutFile(HeadlessOptions.OutputPath);
+    if (OutFile.is_open())
+    {
+        OutFile << ReportText;
+    }
+    else
+    {
+        UE_LOG("[Headless] Failed to write report: %s", HeadlessOptions.OutputPath.c_str());
     }
 }
 
 void UGameEngine::Shutdown()
 {
+    // 렌더 스레드가 남은 프레임을 제출하고 종료한 뒤 오브젝트 정리 (이후 렌더링은 즉시 컨텍스트)
+    RHIDevice.DisableRenderThread();
+
     // GameInstance 삭제
     if (GameInstance)
     {
@@ -407,5 +655,7 @@ void UGameEngine::Shutdown()
     // Explicitly release D3D11RHI resources before global destruction
     RHIDevice.Release();
 
-    SaveIniFile();
+    // 헤드리스는 editor.ini를 읽지 않았으므로 덮어쓰지 않음
+    if (!bHeadless)
+        SaveIniFile();
 }
@@ -8,6 +8,25 @@ class FViewport;
 class UClothManager;
 class UGameInstance;
 
+/**
+ * 헤드리스 실행 옵션 (게임 빌드 명령줄)
+ * -headless [-frames=N] [-scene=Path] [-width=W] [-height=H] [-warp] [-out=Path]
+ * 윈도우 없이 씬을 로드해 고정 DeltaSeconds로 N 프레임을 틱/렌더하고, 프레임 CPU 시간과 RHI 통계를 파일로 기록합니다.
+ */
+struct FHeadlessOptions
+{
+    bool bEnabled = false;
+    int32 NumFrames = 300;
+    FString ScenePath;                          // 비어 있으면 기본 시작 씬
+    uint32 Width = 1280;
+    uint32 Height = 720;
+    bool bUseWarp = false;                      // NULL 드라이버 대신 WARP (픽셀 결과가 필요할 때)
+    bool bRenderThread = true;                  // -norenderthread면 단일 스레드 (비교 측정용)
+    FString OutputPath = "HeadlessStats.txt";
+
+    static FHeadlessOptions Parse(const char* CommandLine);
+};
+
 class UGameEngine final
 {
 public:
@@ -18,6 +37,10 @@ public:
     void MainLoop();
     void Shutdown();
 
+    // 헤드리스 실행 (-headless): Startup/MainLoop 대신 사용, 끝나면 Shutdown
+    bool StartupHeadless(const FHeadlessOptions& Options);
+    void RunHeadless();
+
     bool IsPlayActive() const { return bPlayActive; }
     bool IsPIEActive() const { return bPlayActive; }
 
@@ -38,6 +61,9 @@ public:
 
 private:
     bool CreateMainWindow(HINSTANCE hInstance);
+    bool InitializeRuntime(const FString& StartupScenePath);
+    void WriteHeadlessReport(TArray<double>& TickTimesMS, TArray<double>& RenderTimesMS,
+                             TArray<double>& EnqueueWaitTimesMS, TArray<double>& SubmitTimesMS) const;
     static LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
     static void GetViewportSize(HWND hWnd);
 
@@ -70,6 +96,8 @@ private:
     bool bRunning = false;
     bool bUVScrollPaused = true;
     bool bPlayActive = false;
+    bool bHeadless = false;
+    FHeadlessOptions HeadlessOptions;
     float UVScrollTime = 0.0f;
     FVector2D UVScrollSpeed = FVector2D(0.5f, 0.5f);
 
@@ -454,8 +454,8 @@ void ASkeletalMeshActor::UpdateBoneSubtreeTransforms(int32 BoneIndex)
         return;
     }
 
-    TArray<int32> Stack; Stack.Add(BoneIndex);
-    TArray<int32> ToUpdate;
+    TArray<int32, TInlineAllocator<32>> Stack; Stack.Add(BoneIndex);
+    TFrameArray<int32> ToUpdate;
     while (!Stack.IsEmpty())
     {
         int32 b = Stack.Last(); Stack.Pop();
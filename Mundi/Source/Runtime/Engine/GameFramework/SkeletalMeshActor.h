@@ -73,7 +73,7 @@ protected:
     int32 CachedSegments = 4;
     int32 CachedSelected = -1;
     TArray<FBoneDebugLines> BoneLinesCache; // size == BoneCount
-    TArray<TArray<int32>> BoneChildren;     // adjacency for subtree updates
+    TArray<TArray<int32, TInlineAllocator<4>>> BoneChildren;     // adjacency for subtree updates (대부분 자식 4개 이하)
 
     float BoneJointRadius = 0.01f;
     float BoneBaseRadius = 0.02f;
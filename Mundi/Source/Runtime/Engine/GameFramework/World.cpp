@@ -27,6 +27,7 @@
 #include "Frustum.h"
 #include "Level.h"
 #include "LightManager.h"
+#include "Scene.h"
 #include "LuaManager.h"
 #include "InputManager.h"
 #include "LevelTransitionManager.h"
@@ -36,6 +37,7 @@
 #include "PlayerCameraManager.h"
 #include "Hash.h"
 #include "ParticleEventManager.h"
+#include "ParticleTickManager.h"
 #include "GameModeBase.h"
 #include "GameStateBase.h"
 #include "PlayerController.h"
@@ -51,7 +53,9 @@ UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based
 	Level = std::make_unique<ULevel>();
 	LightManager = std::make_unique<FLightManager>();
 	LightManager->SetOwningWorld(this);  // Set owning world for optimization decisions
+	Scene = std::make_unique<FScene>();
 	LuaManager = std::make_unique<FLuaManager>();
+	ParticleTickManager = std::make_unique<FParticleTickManager>();
 
 	UnscaledDelta = 0;
 	SlomoOnlyDelta = 0;
@@ -283,12 +287,11 @@ void UWorld::Tick(float DeltaSeconds)
 	// Actor 별로 Dilation의 Duration을 처리하는 부분
 	if (!ActorTimingMap.IsEmpty())
 	{
-		TArray<TWeakObjectPtr<AActor>> ToRemove;
-
-		for (auto& Pair : ActorTimingMap)
+		// 순회 중 바로 제거 (키 해시가 Actor 포인터라 소멸 후에는 Remove(Key)로 찾을 수 없음)
+		for (auto It = ActorTimingMap.begin(); It != ActorTimingMap.end();)
 		{
-			TWeakObjectPtr<AActor> Key = Pair.first;
-			FActorTimeState& State = Pair.second;
+			const TWeakObjectPtr<AActor>& Key = It->first;
+			FActorTimeState& State = It->second;
 
 			State.Durtaion -= GetDeltaTime(EDeltaTime::Unscaled);
 		
@@ -298,14 +301,13 @@ void UWorld::Tick(float DeltaSeconds)
 				{
 					Actor->SetCustomTimeDillation(0.0, 1.0f);
 				}*/
-				ToRemove.Add(Key);
+				It = ActorTimingMap.erase(It);
+			}
+			else
+			{
+				++It;
 			}
 		} 
-		
-        for (auto& Key : ToRemove)
-        {
-            ActorTimingMap.Remove(Key);
-        }
 	} 
 	 
 	// 중복충돌 방지 pair clear
@@ -317,6 +319,9 @@ void UWorld::Tick(float DeltaSeconds)
         Partition->Update(DeltaSeconds, /*budget*/256);
     }
 
+	// 파티클 이미터 틱은 액터 틱 동안 예약만 하고, 액터 틱이 끝난 뒤 한꺼번에 병렬 처리
+	ParticleTickManager->BeginCollect();
+
 	if (Level)
 	{
 		// Tick 중에 새로운 actor가 추가될 수도 있어서 복사 후 호출
@@ -346,6 +351,9 @@ void UWorld::Tick(float DeltaSeconds)
 		}
     }
 
+	// 예약된 파티클 이미터 병렬 시뮬레이션 + 이벤트 병합/디스패치
+	ParticleTickManager->Flush();
+
 	// Lua 코루틴 전용 Tick
 	if (LuaManager && bPie)
 	{
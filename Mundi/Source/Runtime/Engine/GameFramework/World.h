@@ -8,6 +8,7 @@
 #include "WeakObjectPtr.h"
 
 class FPhysScene;
+class FScene;
 // Forward Declarations
 class UResourceManager;
 class UUIManager;
@@ -30,6 +31,7 @@ class UStaticMesh;
 class FOcclusionCullingManagerCPU;
 class APlayerCameraManager;
 class AParticleEventManager;
+class FParticleTickManager;
 class UCollisionManager;
 class AGameModeBase;
 class ALevelTransitionManager;
@@ -149,6 +151,7 @@ public:
     void SetLevel(std::unique_ptr<ULevel> InLevel);
     ULevel* GetLevel() const { return Level.get(); }
     FLightManager* GetLightManager() const { return LightManager.get(); }
+    FScene* GetScene() const { return Scene.get(); }
     FLuaManager* GetLuaManager() const { return LuaManager.get(); }
 
     ACameraActor* GetEditorCameraActor() { return MainEditorCameraActor; }
@@ -172,7 +175,7 @@ public:
     // Overlap pair de-duplication (per-frame)
     bool TryMarkOverlapPair(const AActor* A, const AActor* B);
 
-    TMap<TWeakObjectPtr<AActor>, FActorTimeState> ActorTimingMap;
+    TFlatMap<TWeakObjectPtr<AActor>, FActorTimeState> ActorTimingMap;
 
     /** === 필요한 엑터 게터 === */
     const TArray<AActor*>& GetActors() { static TArray<AActor*> Empty; return Level ? Level->GetActors() : Empty; }
@@ -181,6 +184,7 @@ public:
     AGridActor* GetGridActor() { return GridActor; }
     UWorldPartitionManager* GetPartitionManager() { return Partition.get(); }
     AParticleEventManager* GetParticleEventManager() { return ParticleEventManager; }
+    FParticleTickManager* GetParticleTickManager() const { return ParticleTickManager.get(); }
     UCollisionManager* GetCollisionManager() { return CollisionManager.get(); }
     FPhysScene* GetPhysicsScene() { return PhysScene.get(); }
 
@@ -219,11 +223,17 @@ private:
     /** === 라이트 매니저 ===*/
     std::unique_ptr<FLightManager> LightManager;
 
+    /** === 렌더 씬 (등록된 렌더링 대상 컴포넌트 목록) ===*/
+    std::unique_ptr<FScene> Scene;
+
     /** === 루아 매니저 ===*/
     std::unique_ptr<FLuaManager> LuaManager;
     
     /** === PhysX Scene ===*/
     std::unique_ptr<FPhysScene> PhysScene;
+
+    /** === 파티클 틱 매니저 (이미터 병렬 시뮬레이션) ===*/
+    std::unique_ptr<FParticleTickManager> ParticleTickManager;
     
     // Object naming system
     TMap<FString, int32> ObjectTypeCounts;
@@ -241,7 +251,7 @@ private:
     std::unique_ptr<USelectionManager> SelectionMgr;
 
     // Per-frame processed overlap pairs (A,B) keyed canonically
-    TSet<uint64> FrameOverlapPairs;
+    TFlatSet<uint64> FrameOverlapPairs;
 
 public:
     // Debug triangle batch (for constraint visualization etc.)
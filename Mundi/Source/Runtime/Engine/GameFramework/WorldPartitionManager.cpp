@@ -194,6 +194,15 @@ void UWorldPartitionManager::FrustumQuery(FFrustum InFrustum)
 	}
 }
 
+void UWorldPartitionManager::FrustumQuery(const FFrustum& InFrustum, TFrameArray<UPrimitiveComponent*>& OutComponents) const
+{
+	OutComponents.clear();
+	if (BVH)
+	{
+		BVH->QueryFrustum(InFrustum, OutComponents);
+	}
+}
+
 void UWorldPartitionManager::ClearSceneOctree()
 {
 	if (SceneOctree)
@@ -2,6 +2,82 @@
 #include "Distribution.h"
 #include "Source/Runtime/Engine/Components/ParticleSystemComponent.h"
 
+namespace
+{
+	// 오차 측정 시 LUT 구간 하나당 비교할 내부 지점 수
+	constexpr int32 LUTErrorSubSamples = 4;
+
+	// 커브 키 시간 범위를 누적 (UniformCurve는 Min/Max 커브의 합집합)
+	template<typename CurveType>
+	void AccumulateCurveTimeRange(const CurveType& Curve, float& InOutStart, float& InOutEnd, bool& bInOutHasKeys)
+	{
+		if (Curve.Points.IsEmpty())
+		{
+			return;
+		}
+
+		const float CurveStart = Curve.Points[0].InVal;
+		const float CurveEnd = Curve.Points[Curve.Points.Num() - 1].InVal;
+		if (!bInOutHasKeys)
+		{
+			InOutStart = CurveStart;
+			InOutEnd = CurveEnd;
+			bInOutHasKeys = true;
+		}
+		else
+		{
+			InOutStart = FMath::Min(InOutStart, CurveStart);
+			InOutEnd = FMath::Max(InOutEnd, CurveEnd);
+		}
+	}
+
+	// Evaluate(Time, OutChannels)로 [StartTime, EndTime]을 균등 샘플링하고 원본 대비 최대 오차 측정
+	template<typename EvaluateFunc>
+	void BakeLookupTable(FDistributionLookupTable& LUT, int32 Resolution, int32 NumChannels,
+		float StartTime, float EndTime, const EvaluateFunc& Evaluate)
+	{
+		Resolution = FMath::Clamp(Resolution, MinDistributionLUTResolution, MaxDistributionLUTResolution);
+
+		// 키가 하나뿐이면 범위 밖 클램프로 상수가 되므로 임의의 폭을 사용
+		if (EndTime - StartTime <= KINDA_SMALL_NUMBER)
+		{
+			EndTime = StartTime + 1.0f;
+		}
+
+		LUT.Reset();
+		LUT.NumChannels = NumChannels;
+		LUT.NumSamples = Resolution;
+		LUT.StartTime = StartTime;
+		LUT.TimeScale = static_cast<float>(Resolution - 1) / (EndTime - StartTime);
+		LUT.Values.SetNum(Resolution * NumChannels);
+
+		const float SampleSpacing = (EndTime - StartTime) / static_cast<float>(Resolution - 1);
+		for (int32 SampleIndex = 0; SampleIndex < Resolution; ++SampleIndex)
+		{
+			Evaluate(StartTime + SampleSpacing * SampleIndex, LUT.Values.GetData() + SampleIndex * NumChannels);
+		}
+
+		// 샘플 사이 지점에서 원본 커브와 비교 (Constant 보간 키의 계단은 여기서 큰 오차로 드러남)
+		float SourceValues[6];
+		float BakedValues[6];
+		float MaxError = 0.0f;
+		for (int32 SampleIndex = 0; SampleIndex < Resolution - 1; ++SampleIndex)
+		{
+			for (int32 SubSample = 1; SubSample < LUTErrorSubSamples; ++SubSample)
+			{
+				const float Time = StartTime + SampleSpacing * (SampleIndex + static_cast<float>(SubSample) / LUTErrorSubSamples);
+				Evaluate(Time, SourceValues);
+				LUT.Sample(Time, BakedValues);
+				for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				{
+					MaxError = FMath::Max(MaxError, std::fabs(SourceValues[Channel] - BakedValues[Channel]));
+				}
+			}
+		}
+		LUT.MaxError = MaxError;
+	}
+}
+
 // ============================================================
 // FDistributionFloat::GetValue() 구현
 // ============================================================
@@ -23,13 +99,13 @@ float FDistributionFloat::GetValue(
 
 	case EDistributionType::ConstantCurve:
 		// 시간에 따른 커브 값 (모든 파티클 동일)
-		return ConstantCurve.Eval(Time);
+		return EvalCurve(Time);
 
 	case EDistributionType::UniformCurve:
 	{
 		// 시간에 따른 Min/Max 커브 계산 후 그 범위 내 랜덤
-		float MinAtTime = MinCurve.Eval(Time);
-		float MaxAtTime = MaxCurve.Eval(Time);
+		float MinAtTime, MaxAtTime;
+		EvalMinMaxCurve(Time, MinAtTime, MaxAtTime);
 		return RandomStream.GetRangeFloat(MinAtTime, MaxAtTime);
 	}
 
@@ -37,7 +113,7 @@ float FDistributionFloat::GetValue(
 		// 런타임 파라미터에서 값 가져오기
 		if (Owner && !ParameterName.empty())
 		{
-			return Owner->GetFloatParameter(ParameterName, ParameterDefaultValue);
+			return Owner->GetFloatParameter(ParameterKey, ParameterDefaultValue);
 		}
 		return ParameterDefaultValue;
 
@@ -67,13 +143,13 @@ FVector FDistributionVector::GetValue(
 
 	case EDistributionType::ConstantCurve:
 		// 시간에 따른 커브 값
-		return ConstantCurve.Eval(Time);
+		return EvalCurve(Time);
 
 	case EDistributionType::UniformCurve:
 	{
 		// 시간에 따른 Min/Max 커브 계산 후 그 범위 내 랜덤
-		FVector MinAtTime = MinCurve.Eval(Time);
-		FVector MaxAtTime = MaxCurve.Eval(Time);
+		FVector MinAtTime, MaxAtTime;
+		EvalMinMaxCurve(Time, MinAtTime, MaxAtTime);
 		return RandomStream.GetRangeVector(MinAtTime, MaxAtTime);
 	}
 
@@ -81,7 +157,7 @@ FVector FDistributionVector::GetValue(
 		// 런타임 파라미터에서 값 가져오기
 		if (Owner && !ParameterName.empty())
 		{
-			return Owner->GetVectorParameter(ParameterName, ParameterDefaultValue);
+			return Owner->GetVectorParameter(ParameterKey, ParameterDefaultValue);
 		}
 		return ParameterDefaultValue;
 
@@ -90,6 +166,99 @@ FVector FDistributionVector::GetValue(
 	}
 }
 
+// ============================================================
+// FDistributionFloat::Bake() 구현
+// ============================================================
+void FDistributionFloat::Bake()
+{
+	bLUTDirty = false;
+	LUT.Reset();
+	if (!bBakeToLUT)
+	{
+		return;
+	}
+
+	float StartTime = 0.0f;
+	float EndTime = 0.0f;
+	bool bHasKeys = false;
+
+	if (Type == EDistributionType::ConstantCurve)
+	{
+		AccumulateCurveTimeRange(ConstantCurve, StartTime, EndTime, bHasKeys);
+		if (bHasKeys)
+		{
+			BakeLookupTable(LUT, LUTResolution, 1, StartTime, EndTime, [this](float Time, float* OutValues)
+			{
+				OutValues[0] = ConstantCurve.Eval(Time);
+			});
+		}
+	}
+	else if (Type == EDistributionType::UniformCurve)
+	{
+		AccumulateCurveTimeRange(MinCurve, StartTime, EndTime, bHasKeys);
+		AccumulateCurveTimeRange(MaxCurve, StartTime, EndTime, bHasKeys);
+		if (bHasKeys)
+		{
+			BakeLookupTable(LUT, LUTResolution, 2, StartTime, EndTime, [this](float Time, float* OutValues)
+			{
+				OutValues[0] = MinCurve.Eval(Time);
+				OutValues[1] = MaxCurve.Eval(Time);
+			});
+		}
+	}
+}
+
+// ============================================================
+// FDistributionVector::Bake() 구현
+// ============================================================
+void FDistributionVector::Bake()
+{
+	bLUTDirty = false;
+	LUT.Reset();
+	if (!bBakeToLUT)
+	{
+		return;
+	}
+
+	float StartTime = 0.0f;
+	float EndTime = 0.0f;
+	bool bHasKeys = false;
+
+	if (Type == EDistributionType::ConstantCurve)
+	{
+		AccumulateCurveTimeRange(ConstantCurve, StartTime, EndTime, bHasKeys);
+		if (bHasKeys)
+		{
+			BakeLookupTable(LUT, LUTResolution, 3, StartTime, EndTime, [this](float Time, float* OutValues)
+			{
+				const FVector Value = ConstantCurve.Eval(Time);
+				OutValues[0] = Value.X;
+				OutValues[1] = Value.Y;
+				OutValues[2] = Value.Z;
+			});
+		}
+	}
+	else if (Type == EDistributionType::UniformCurve)
+	{
+		AccumulateCurveTimeRange(MinCurve, StartTime, EndTime, bHasKeys);
+		AccumulateCurveTimeRange(MaxCurve, StartTime, EndTime, bHasKeys);
+		if (bHasKeys)
+		{
+			BakeLookupTable(LUT, LUTResolution, 6, StartTime, EndTime, [this](float Time, float* OutValues)
+			{
+				const FVector MinValue = MinCurve.Eval(Time);
+				const FVector MaxValue = MaxCurve.Eval(Time);
+				OutValues[0] = MinValue.X;
+				OutValues[1] = MinValue.Y;
+				OutValues[2] = MinValue.Z;
+				OutValues[3] = MaxValue.X;
+				OutValues[4] = MaxValue.Y;
+				OutValues[5] = MaxValue.Z;
+			});
+		}
+	}
+}
+
 // ============================================================
 // FInterpCurvePointFloat::Serialize() 구현
 // ============================================================
@@ -233,6 +402,7 @@ void FDistributionFloat::Serialize(bool bIsLoading, JSON& InOutHandle)
 		FJsonSerializer::ReadFloat(InOutHandle, "MinValue", MinValue);
 		FJsonSerializer::ReadFloat(InOutHandle, "MaxValue", MaxValue);
 		FJsonSerializer::ReadString(InOutHandle, "ParameterName", ParameterName);
+		SetParameterName(ParameterName);
 		FJsonSerializer::ReadFloat(InOutHandle, "ParameterDefaultValue", ParameterDefaultValue);
 
 		JSON CurveJson;
@@ -242,6 +412,11 @@ void FDistributionFloat::Serialize(bool bIsLoading, JSON& InOutHandle)
 			MinCurve.Serialize(true, CurveJson);
 		if (FJsonSerializer::ReadObject(InOutHandle, "MaxCurve", CurveJson))
 			MaxCurve.Serialize(true, CurveJson);
+
+		// 이전 에셋에는 없는 키이므로 기본값으로 조용히 처리
+		FJsonSerializer::ReadBool(InOutHandle, "bBakeToLUT", bBakeToLUT, false, false);
+		FJsonSerializer::ReadInt32(InOutHandle, "LUTResolution", LUTResolution, DefaultDistributionLUTResolution, false);
+		Bake();
 	}
 	else
 	{
@@ -263,6 +438,9 @@ void FDistributionFloat::Serialize(bool bIsLoading, JSON& InOutHandle)
 		CurveJson = JSON::Make(JSON::Class::Object);
 		MaxCurve.Serialize(false, CurveJson);
 		InOutHandle["MaxCurve"] = CurveJson;
+
+		InOutHandle["bBakeToLUT"] = bBakeToLUT;
+		InOutHandle["LUTResolution"] = LUTResolution;
 	}
 }
 
@@ -281,6 +459,7 @@ void FDistributionVector::Serialize(bool bIsLoading, JSON& InOutHandle)
 		FJsonSerializer::ReadVector(InOutHandle, "MinValue", MinValue);
 		FJsonSerializer::ReadVector(InOutHandle, "MaxValue", MaxValue);
 		FJsonSerializer::ReadString(InOutHandle, "ParameterName", ParameterName);
+		SetParameterName(ParameterName);
 		FJsonSerializer::ReadVector(InOutHandle, "ParameterDefaultValue", ParameterDefaultValue);
 
 		JSON CurveJson;
@@ -290,6 +469,11 @@ void FDistributionVector::Serialize(bool bIsLoading, JSON& InOutHandle)
 			MinCurve.Serialize(true, CurveJson);
 		if (FJsonSerializer::ReadObject(InOutHandle, "MaxCurve", CurveJson))
 			MaxCurve.Serialize(true, CurveJson);
+
+		// 이전 에셋에는 없는 키이므로 기본값으로 조용히 처리
+		FJsonSerializer::ReadBool(InOutHandle, "bBakeToLUT", bBakeToLUT, false, false);
+		FJsonSerializer::ReadInt32(InOutHandle, "LUTResolution", LUTResolution, DefaultDistributionLUTResolution, false);
+		Bake();
 	}
 	else
 	{
@@ -311,6 +495,9 @@ void FDistributionVector::Serialize(bool bIsLoading, JSON& InOutHandle)
 		CurveJson = JSON::Make(JSON::Class::Object);
 		MaxCurve.Serialize(false, CurveJson);
 		InOutHandle["MaxCurve"] = CurveJson;
+
+		InOutHandle["bBakeToLUT"] = bBakeToLUT;
+		InOutHandle["LUTResolution"] = LUTResolution;
 	}
 }
 
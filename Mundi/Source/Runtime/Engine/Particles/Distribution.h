@@ -3,6 +3,7 @@
 #include "Vector.h"
 #include "Color.h"
 #include "ParticleRandomStream.h"
+#include "Name.h"
 
 // Forward declarations
 class UParticleSystemComponent;
@@ -455,6 +456,64 @@ struct FInterpCurveVector
 	void Serialize(bool bIsLoading, JSON& InOutHandle);
 };
 
+// ============================================================
+// 베이크된 커브 LUT
+// 커브를 고정 해상도로 샘플링해 두고, 런타임에는 인접 샘플 2개를 선형 보간 1회로 조회
+// ============================================================
+struct FDistributionLookupTable
+{
+	// 샘플 우선 배치: [Sample0: Ch0, Ch1, ...][Sample1: Ch0, Ch1, ...]...
+	// UniformCurve는 Min 채널 뒤에 Max 채널이 이어짐 (Float: 2채널, Vector: 6채널)
+	TArray<float> Values;
+	int32 NumChannels = 0;
+	int32 NumSamples = 0;
+
+	float StartTime = 0.0f;
+	float TimeScale = 0.0f;   // (NumSamples - 1) / (EndTime - StartTime)
+
+	// 베이크 시 측정한 원본 커브 대비 최대 오차 (에디터 표시용)
+	float MaxError = 0.0f;
+
+	// 채널 수까지 확인 (베이크 후 Type만 바뀐 경우 잘못된 LUT를 읽지 않도록)
+	bool IsValid(int32 InNumChannels) const { return NumSamples >= 2 && NumChannels == InNumChannels; }
+
+	void Reset()
+	{
+		Values.Empty();
+		NumChannels = 0;
+		NumSamples = 0;
+		StartTime = 0.0f;
+		TimeScale = 0.0f;
+		MaxError = 0.0f;
+	}
+
+	// Time 위치의 NumChannels개 값을 OutValues에 기록 (범위 밖은 양 끝 값으로 클램프 - Eval과 동일)
+	void Sample(float Time, float* OutValues) const
+	{
+		float Position = (Time - StartTime) * TimeScale;
+		Position = FMath::Clamp(Position, 0.0f, static_cast<float>(NumSamples - 1));
+
+		int32 Index = static_cast<int32>(Position);
+		if (Index > NumSamples - 2)
+		{
+			Index = NumSamples - 2;
+		}
+		const float Alpha = Position - static_cast<float>(Index);
+
+		const float* A = Values.GetData() + Index * NumChannels;
+		const float* B = A + NumChannels;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			OutValues[Channel] = A[Channel] + (B[Channel] - A[Channel]) * Alpha;
+		}
+	}
+};
+
+// 베이크 해상도 기본값/범위
+static constexpr int32 DefaultDistributionLUTResolution = 64;
+static constexpr int32 MinDistributionLUTResolution = 2;
+static constexpr int32 MaxDistributionLUTResolution = 1024;
+
 // ============================================================
 // Distribution 타입
 // ============================================================
@@ -490,8 +549,15 @@ struct FDistributionFloat
 
 	// ParticleParameter 모드 (런타임 제어)
 	FString ParameterName = "";        // 파라미터 이름 (예: "SpawnRate")
+	FName ParameterKey;                 // ParameterName의 FName 캐시 (SetParameterName/로드 시 갱신, 파티클별 조회에 사용)
 	float ParameterDefaultValue = 0.0f; // 파라미터가 없을 때 기본값
 
+	// 커브 모드 LUT 베이크 (true면 커브 평가 대신 LUT 선형 보간 1회)
+	bool bBakeToLUT = false;
+	int32 LUTResolution = DefaultDistributionLUTResolution;
+	FDistributionLookupTable LUT;	// Bake()로 갱신 (직렬화하지 않음)
+	bool bLUTDirty = false;			// 키/모드가 바뀌어 다시 베이크해야 함 (Bake()가 해제)
+
 	// 생성자
 	FDistributionFloat()
 		: Type(EDistributionType::Constant)
@@ -527,6 +593,53 @@ struct FDistributionFloat
 		UParticleSystemComponent* Owner = nullptr  // 파라미터 조회용 (nullable)
 	) const;
 
+	// ConstantCurve 평가 (베이크되어 있으면 LUT 사용)
+	float EvalCurve(float Time) const
+	{
+		if (LUT.IsValid(1))
+		{
+			float Value;
+			LUT.Sample(Time, &Value);
+			return Value;
+		}
+		return ConstantCurve.Eval(Time);
+	}
+
+	// UniformCurve의 Min/Max 평가 (베이크되어 있으면 LUT 사용)
+	void EvalMinMaxCurve(float Time, float& OutMin, float& OutMax) const
+	{
+		if (LUT.IsValid(2))
+		{
+			float Values[2];
+			LUT.Sample(Time, Values);
+			OutMin = Values[0];
+			OutMax = Values[1];
+			return;
+		}
+		OutMin = MinCurve.Eval(Time);
+		OutMax = MaxCurve.Eval(Time);
+	}
+
+	// 커브를 LUT로 베이크 (로드/편집 후 호출, bBakeToLUT가 꺼져 있거나 커브 모드가 아니면 LUT 해제)
+	void Bake();
+
+	// 편집 지점에서는 표시만 하고, 한 프레임에 모인 변경을 BakeIfDirty()에서 한 번에 반영
+	void MarkLUTDirty() { bLUTDirty = true; }
+	void BakeIfDirty()
+	{
+		if (bLUTDirty)
+		{
+			Bake();
+		}
+	}
+
+	// 파라미터 이름 설정 (FName 캐시도 함께 갱신)
+	void SetParameterName(const FString& InName)
+	{
+		ParameterName = InName;
+		ParameterKey = FName(InName);
+	}
+
 	// 정적 생성 헬퍼
 	static FDistributionFloat MakeConstant(float Value)
 	{
@@ -549,7 +662,7 @@ struct FDistributionFloat
 	{
 		FDistributionFloat Dist;
 		Dist.Type = EDistributionType::ParticleParameter;
-		Dist.ParameterName = ParamName;
+		Dist.SetParameterName(ParamName);
 		Dist.ParameterDefaultValue = DefaultValue;
 		return Dist;
 	}
@@ -578,6 +691,8 @@ struct FDistributionFloat
 		{
 			Point.OutVal *= Multiplier;
 		}
+
+		Bake();
 	}
 };
 
@@ -604,8 +719,15 @@ struct FDistributionVector
 
 	// ParticleParameter 모드
 	FString ParameterName = "";
+	FName ParameterKey;                 // ParameterName의 FName 캐시
 	FVector ParameterDefaultValue = FVector(0.0f, 0.0f, 0.0f);
 
+	// 커브 모드 LUT 베이크 (true면 커브 평가 대신 LUT 선형 보간 1회)
+	bool bBakeToLUT = false;
+	int32 LUTResolution = DefaultDistributionLUTResolution;
+	FDistributionLookupTable LUT;	// Bake()로 갱신 (직렬화하지 않음)
+	bool bLUTDirty = false;			// 키/모드가 바뀌어 다시 베이크해야 함 (Bake()가 해제)
+
 	// 생성자
 	FDistributionVector()
 		: Type(EDistributionType::Constant)
@@ -641,6 +763,53 @@ struct FDistributionVector
 		UParticleSystemComponent* Owner = nullptr
 	) const;
 
+	// ConstantCurve 평가 (베이크되어 있으면 LUT 사용)
+	FVector EvalCurve(float Time) const
+	{
+		if (LUT.IsValid(3))
+		{
+			float Values[3];
+			LUT.Sample(Time, Values);
+			return FVector(Values[0], Values[1], Values[2]);
+		}
+		return ConstantCurve.Eval(Time);
+	}
+
+	// UniformCurve의 Min/Max 평가 (베이크되어 있으면 LUT 사용)
+	void EvalMinMaxCurve(float Time, FVector& OutMin, FVector& OutMax) const
+	{
+		if (LUT.IsValid(6))
+		{
+			float Values[6];
+			LUT.Sample(Time, Values);
+			OutMin = FVector(Values[0], Values[1], Values[2]);
+			OutMax = FVector(Values[3], Values[4], Values[5]);
+			return;
+		}
+		OutMin = MinCurve.Eval(Time);
+		OutMax = MaxCurve.Eval(Time);
+	}
+
+	// 커브를 LUT로 베이크 (로드/편집 후 호출, bBakeToLUT가 꺼져 있거나 커브 모드가 아니면 LUT 해제)
+	void Bake();
+
+	// 편집 지점에서는 표시만 하고, 한 프레임에 모인 변경을 BakeIfDirty()에서 한 번에 반영
+	void MarkLUTDirty() { bLUTDirty = true; }
+	void BakeIfDirty()
+	{
+		if (bLUTDirty)
+		{
+			Bake();
+		}
+	}
+
+	// 파라미터 이름 설정 (FName 캐시도 함께 갱신)
+	void SetParameterName(const FString& InName)
+	{
+		ParameterName = InName;
+		ParameterKey = FName(InName);
+	}
+
 	// 정적 생성 헬퍼
 	static FDistributionVector MakeConstant(const FVector& Value)
 	{
@@ -663,7 +832,7 @@ struct FDistributionVector
 	{
 		FDistributionVector Dist;
 		Dist.Type = EDistributionType::ParticleParameter;
-		Dist.ParameterName = ParamName;
+		Dist.SetParameterName(ParamName);
 		Dist.ParameterDefaultValue = DefaultValue;
 		return Dist;
 	}
@@ -717,6 +886,13 @@ struct FDistributionColor
 		return FLinearColor(RGBValue.X, RGBValue.Y, RGBValue.Z, AlphaValue);
 	}
 
+	// RGB/Alpha 커브 LUT 베이크
+	void Bake()
+	{
+		RGB.Bake();
+		Alpha.Bake();
+	}
+
 	// 정적 생성 헬퍼
 	static FDistributionColor MakeConstant(const FLinearColor& Value)
 	{
@@ -71,4 +71,9 @@ public:
 	// LOD 스케일링: 하위 LOD 생성 시 값들을 Multiplier로 스케일
 	// 파생 클래스에서 오버라이드하여 SpawnRate, BurstCount 등을 조정
 	virtual void ScaleForLOD(float Multiplier) {}
+
+	// 병렬 이미터 틱 지원 여부
+	// 다른 이미터의 파티클을 읽거나 모듈 자체에 런타임 상태를 기록하는 모듈은 false를 반환해야 함
+	// (이 모듈을 가진 컴포넌트의 이미터들은 병렬 페이즈 이후 게임 스레드에서 순서대로 틱됨)
+	virtual bool SupportsParallelTick() const { return true; }
 };
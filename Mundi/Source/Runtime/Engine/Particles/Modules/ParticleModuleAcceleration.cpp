@@ -17,11 +17,7 @@ void UParticleModuleAcceleration::Spawn(FParticleEmitterInstance* Owner, int32 O
 	PARTICLE_ELEMENT(FParticleAccelerationPayload, Payload);
 
 	// UniformCurve용 랜덤 비율 저장
-	Payload.RandomFactor = FVector(
-		Owner->RandomStream.GetFraction(),
-		Owner->RandomStream.GetFraction(),
-		Owner->RandomStream.GetFraction()
-	);
+	Payload.RandomFactor = Owner->RandomStream.GetFractionVector();
 
 	// 중력 Z 성분 저장
 	Payload.GravityZ = bApplyGravity ? (-9.8f * GravityScale) : 0.0f;
@@ -42,13 +38,13 @@ void UParticleModuleAcceleration::Update(FModuleUpdateContext& Context)
 		switch (DistType)
 		{
 		case EDistributionType::ConstantCurve:
-			CurrentAcceleration = AccelerationOverLife.ConstantCurve.Eval(Particle.RelativeTime);
+			CurrentAcceleration = AccelerationOverLife.EvalCurve(Particle.RelativeTime);
 			break;
 
 		case EDistributionType::UniformCurve:
 			{
-				FVector MinAtTime = AccelerationOverLife.MinCurve.Eval(Particle.RelativeTime);
-				FVector MaxAtTime = AccelerationOverLife.MaxCurve.Eval(Particle.RelativeTime);
+				FVector MinAtTime, MaxAtTime;
+				AccelerationOverLife.EvalMinMaxCurve(Particle.RelativeTime, MinAtTime, MaxAtTime);
 				CurrentAcceleration.X = FMath::Lerp(MinAtTime.X, MaxAtTime.X, Payload.RandomFactor.X);
 				CurrentAcceleration.Y = FMath::Lerp(MinAtTime.Y, MaxAtTime.Y, Payload.RandomFactor.Y);
 				CurrentAcceleration.Z = FMath::Lerp(MinAtTime.Z, MaxAtTime.Z, Payload.RandomFactor.Z);
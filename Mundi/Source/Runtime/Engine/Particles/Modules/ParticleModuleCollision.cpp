@@ -36,243 +36,354 @@ void UParticleModuleCollision::Spawn(FParticleEmitterInstance* Owner, int32 Offs
 	CollPayload.UsedDelayAmount = DelayAmount.GetValue(Owner->EmitterTime, Owner->RandomStream, Owner->Component);
 }
 
-void UParticleModuleCollision::Update(FModuleUpdateContext& Context)
+namespace
 {
-	// World와 CollisionManager 가져오기
-	UParticleSystemComponent* PSC = Context.Owner.Component;
-	if (!PSC)
+	struct FParticleCollisionHit
 	{
-		return;
+		FVector Normal = FVector(0.0f, 0.0f, 0.0f);
+		float PushDistance = 0.0f;					// 법선 방향 위치 보정량
+		UPrimitiveComponent* Component = nullptr;	// 평면 충돌이면 nullptr
+	};
+
+	bool OverlapsBounds(const FVector& Center, float Radius, const FVector& BoundsMin, const FVector& BoundsMax)
+	{
+		return Center.X + Radius >= BoundsMin.X && Center.X - Radius <= BoundsMax.X
+			&& Center.Y + Radius >= BoundsMin.Y && Center.Y - Radius <= BoundsMax.Y
+			&& Center.Z + Radius >= BoundsMin.Z && Center.Z - Radius <= BoundsMax.Z;
 	}
 
-	UWorld* World = PSC->GetWorld();
-	if (!World)
+	// 정밀 검사: 캐시된 평탄 배열만 읽음 (UObject 접근 없음)
+	// 한 프레임에 하나의 충돌만 처리하므로 첫 충돌에서 반환
+	bool FindSceneCollision(const FVector& Center, float Radius, const FParticleCollisionCache& Cache, FParticleCollisionHit& OutHit)
 	{
-		return;
+		const float PushDistance = Radius * 0.1f;  // 충돌 위치 보정 (표면에서 약간 띄움)
+
+		for (const FParticleCollisionSphere& Sphere : Cache.Spheres)
+		{
+			if (!OverlapsBounds(Center, Radius, Sphere.BoundsMin, Sphere.BoundsMax))
+			{
+				continue;
+			}
+
+			const FVector Delta = Center - Sphere.Center;
+			const float CombinedRadius = Radius + Sphere.Radius;
+			if (Delta.SizeSquared() < CombinedRadius * CombinedRadius)
+			{
+				OutHit.Normal = Delta.GetSafeNormal();
+				OutHit.PushDistance = PushDistance;
+				OutHit.Component = Sphere.Component;
+				return true;
+			}
+		}
+
+		for (const FParticleCollisionCapsule& Capsule : Cache.Capsules)
+		{
+			if (!OverlapsBounds(Center, Radius, Capsule.BoundsMin, Capsule.BoundsMax))
+			{
+				continue;
+			}
+
+			// 파티클 위치에서 캡슐 중심선까지의 최단 거리
+			const float Projection = FMath::Clamp(FVector::Dot(Center - Capsule.P0, Capsule.Direction), 0.0f, Capsule.Length);
+			const FVector ClosestPoint = Capsule.P0 + Capsule.Direction * Projection;
+			const FVector Delta = Center - ClosestPoint;
+			const float CombinedRadius = Radius + Capsule.Radius;
+			if (Delta.SizeSquared() < CombinedRadius * CombinedRadius)
+			{
+				OutHit.Normal = Delta.GetSafeNormal();
+				OutHit.PushDistance = PushDistance;
+				OutHit.Component = Capsule.Component;
+				return true;
+			}
+		}
+
+		for (const FParticleCollisionBox& Box : Cache.Boxes)
+		{
+			if (!OverlapsBounds(Center, Radius, Box.BoundsMin, Box.BoundsMax))
+			{
+				continue;
+			}
+
+			// 박스 로컬 좌표 (축이 정규직교이므로 역행렬 대신 내적)
+			const FVector ToCenter = Center - Box.Center;
+			float Local[3];
+			float DistSq = 0.0f;
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				Local[Axis] = FVector::Dot(ToCenter, Box.Axes[Axis]);
+				const float Outside = FMath::Abs(Local[Axis]) - Box.HalfExtent[Axis];
+				if (Outside > 0.0f)
+				{
+					DistSq += Outside * Outside;
+				}
+			}
+
+			if (DistSq > Radius * Radius)
+			{
+				continue;
+			}
+
+			// 가장 가까운 면의 법선 (단순화)
+			float MinDist = FLT_MAX;
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				const float Dist = FMath::Abs(FMath::Abs(Local[Axis]) - Box.HalfExtent[Axis]);
+				if (Dist < MinDist)
+				{
+					MinDist = Dist;
+					OutHit.Normal = (Local[Axis] > 0.0f) ? Box.Axes[Axis] : -Box.Axes[Axis];
+				}
+			}
+			OutHit.PushDistance = PushDistance;
+			OutHit.Component = Box.Component;
+			return true;
+		}
+
+		for (const FParticleCollisionAABB& Bounds : Cache.AABBs)
+		{
+			// 파티클 구체와 AABB 충돌 검사
+			FVector ClosestPoint;
+			ClosestPoint.X = FMath::Clamp(Center.X, Bounds.Min.X, Bounds.Max.X);
+			ClosestPoint.Y = FMath::Clamp(Center.Y, Bounds.Min.Y, Bounds.Max.Y);
+			ClosestPoint.Z = FMath::Clamp(Center.Z, Bounds.Min.Z, Bounds.Max.Z);
+
+			const FVector Delta = Center - ClosestPoint;
+			if (Delta.SizeSquared() < Radius * Radius)
+			{
+				// 파티클이 AABB 내부에 있는 경우 - 위쪽으로 밀어냄
+				OutHit.Normal = (Delta.SizeSquared() > KINDA_SMALL_NUMBER) ? Delta.GetSafeNormal() : FVector(0.0f, 0.0f, 1.0f);
+				OutHit.PushDistance = PushDistance;
+				OutHit.Component = Bounds.Component;
+				return true;
+			}
+		}
+
+		return false;
 	}
+}
 
-	UWorldPartitionManager* Partition = World->GetPartitionManager();
-	if (!Partition || !Partition->GetBVH())
+void UParticleModuleCollision::BuildBroadphase(FModuleUpdateContext& Context, FParticleCollisionCache& Cache) const
+{
+	UParticleSystemComponent* PSC = Context.Owner.Component;
+	UWorld* World = PSC ? PSC->GetWorld() : nullptr;
+	UWorldPartitionManager* Partition = World ? World->GetPartitionManager() : nullptr;
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH)
 	{
 		return;
 	}
-	FBVHierarchy* BVH = Partition->GetBVH();
 
-	float DeltaTime = Context.DeltaTime;
-	int32 Offset = Context.Offset;
+	// 1. 이번 프레임에 검사할 파티클들의 이동 경로(OldLocation ~ Location) 합집합
+	FVector QueryMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector QueryMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	bool bAnyParticle = false;
 
 	BEGIN_UPDATE_LOOP
 		PARTICLE_ELEMENT(FParticleCollisionPayload, CollPayload);
 
-		// 딜레이 체크
-		CollPayload.DelayTimer += DeltaTime;
-		if (CollPayload.DelayTimer < CollPayload.UsedDelayAmount)
+		// Update 루프와 같은 조건으로 제외 (딜레이 중이거나 충돌 횟수를 다 쓴 파티클)
+		if (CollPayload.DelayTimer + DeltaTime < CollPayload.UsedDelayAmount
+			|| CollPayload.UsedCollisionCount >= CollPayload.UsedMaxCollisions)
 		{
 			CurrentOffset = Offset;  // continue 전 오프셋 리셋 필수!
 			continue;
 		}
 
-		// MaxCollisions 체크
-		if (CollPayload.UsedCollisionCount >= CollPayload.UsedMaxCollisions)
+		QueryMin = QueryMin.ComponentMin(Particle.OldLocation.ComponentMin(Particle.Location));
+		QueryMax = QueryMax.ComponentMax(Particle.OldLocation.ComponentMax(Particle.Location));
+		bAnyParticle = true;
+	END_UPDATE_LOOP
+
+	if (!bAnyParticle)
+	{
+		return;
+	}
+
+	const FVector RadiusExtent(ParticleRadius, ParticleRadius, ParticleRadius);
+	FAABB QueryBounds(QueryMin - RadiusExtent, QueryMax + RadiusExtent);
+
+	// 2. BVH 쿼리 한 번 (병렬 틱 중에도 안전한 읽기 전용 오버로드, 결과 버퍼 재사용)
+	BVH->QueryIntersectedComponents(QueryBounds, Cache.QueryResults, &Cache.QueryBounds);
+	Cache.LastCandidateCount = Cache.QueryResults.Num();
+
+	// 3. 후보를 월드 공간 도형으로 변환 (컴포넌트당 한 번)
+	// 워커 스레드이므로 GetWorldMatrix / GetWorldAABB처럼 컴포넌트 캐시를 쓰는 getter는 호출하지 않음
+	for (int32 CandidateIndex = 0; CandidateIndex < Cache.QueryResults.Num(); ++CandidateIndex)
+	{
+		UPrimitiveComponent* PrimComp = Cache.QueryResults[CandidateIndex];
+		if (!PrimComp || PrimComp->IsPendingDestroy())
 		{
-			HandleCollisionComplete(Particle, CollPayload);
-			CurrentOffset = Offset;  // continue 전 오프셋 리셋 필수!
 			continue;
 		}
 
-		// 이동 경로 계산 (터널링 방지)
-		FVector Start = Particle.OldLocation;
-		FVector End = Particle.Location;
-
-		// 1. 광역 검사 (CollisionManager AABB 쿼리) - 경로 전체를 포함하는 바운드
-		FAABB PathBounds;
-		// Component-wise min/max
-		PathBounds.Min = FVector(
-			FMath::Min(Start.X, End.X) - ParticleRadius,
-			FMath::Min(Start.Y, End.Y) - ParticleRadius,
-			FMath::Min(Start.Z, End.Z) - ParticleRadius
-		);
-		PathBounds.Max = FVector(
-			FMath::Max(Start.X, End.X) + ParticleRadius,
-			FMath::Max(Start.Y, End.Y) + ParticleRadius,
-			FMath::Max(Start.Z, End.Z) + ParticleRadius
-		);
-
-		// BVH에서 PrimitiveComponent 쿼리 (ShapeComponent + StaticMeshComponent 포함)
-		TArray<UPrimitiveComponent*> Candidates = BVH->QueryIntersectedComponents(PathBounds);
-
-		// 2. 정밀 검사
-		for (UPrimitiveComponent* PrimComp : Candidates)
+		if (UShapeComponent* ShapeComp = Cast<UShapeComponent>(PrimComp))
 		{
-			if (!PrimComp)
-			{
-				continue;
-			}
-
-			// 충돌 검사: 파티클 현재 위치를 구체로 취급
-			FBoundingSphere ParticleSphere;
-			ParticleSphere.Center = Particle.Location;
-			ParticleSphere.Radius = ParticleRadius;
+			FShape Shape;
+			ShapeComp->GetShape(Shape);
+			const FTransform ShapeTransform = ShapeComp->GetWorldTransform();
 
-			// 충돌 여부 검사
-			bool bCollided = false;
-			FVector HitNormal = FVector(0.0f, 0.0f, 0.0f);
-
-			// 1. ShapeComponent인 경우 - 기존 정밀 충돌 검사
-			if (UShapeComponent* ShapeComp = Cast<UShapeComponent>(PrimComp))
+			switch (Shape.Kind)
 			{
-				FShape Shape;
-				ShapeComp->GetShape(Shape);
-				FTransform ShapeTransform = ShapeComp->GetWorldTransform();
-
-				switch (Shape.Kind)
+			case EShapeKind::Box:
 				{
-				case EShapeKind::Box:
+					FOBB BoxOBB;
+					Collision::BuildOBB(Shape, ShapeTransform, BoxOBB);
+
+					FParticleCollisionBox& Box = Cache.Boxes[Cache.Boxes.Emplace()];
+					Box.Center = BoxOBB.Center;
+					Box.HalfExtent = BoxOBB.HalfExtent;
+					FVector BoundsExtent(0.0f, 0.0f, 0.0f);
+					for (int32 Axis = 0; Axis < 3; Axis++)
 					{
-						FOBB BoxOBB;
-						Collision::BuildOBB(Shape, ShapeTransform, BoxOBB);
-						bCollided = Collision::Overlap_Sphere_OBB(ParticleSphere.Center, ParticleSphere.Radius, BoxOBB);
-						if (bCollided)
-						{
-							// 박스의 가장 가까운 표면 법선 계산 (단순화)
-							FMatrix InvMatrix = ShapeTransform.ToMatrix().Inverse();
-							FVector LocalPos = InvMatrix.TransformPosition(Particle.Location);
-							FVector Extent = Shape.Box.BoxExtent;
-
-							// 각 축에서 가장 가까운 면 찾기
-							float MinDist = FLT_MAX;
-							for (int32 Axis = 0; Axis < 3; Axis++)
-							{
-								float Dist = FMath::Abs(FMath::Abs(LocalPos[Axis]) - Extent[Axis]);
-								if (Dist < MinDist)
-								{
-									MinDist = Dist;
-									HitNormal = FVector(0.0f, 0.0f, 0.0f);
-									HitNormal[Axis] = (LocalPos[Axis] > 0) ? 1.0f : -1.0f;
-								}
-							}
-							// 월드 공간으로 변환
-							HitNormal = ShapeTransform.ToMatrix().TransformVector(HitNormal);
-							HitNormal.Normalize();
-						}
+						Box.Axes[Axis] = BoxOBB.Axes[Axis];
+						const FVector AxisExtent = BoxOBB.Axes[Axis] * BoxOBB.HalfExtent[Axis];
+						BoundsExtent += FVector(FMath::Abs(AxisExtent.X), FMath::Abs(AxisExtent.Y), FMath::Abs(AxisExtent.Z));
 					}
-					break;
+					Box.BoundsMin = Box.Center - BoundsExtent;
+					Box.BoundsMax = Box.Center + BoundsExtent;
+					Box.Component = PrimComp;
+				}
+				break;
 
-				case EShapeKind::Sphere:
-					{
-						FVector SphereCenter = ShapeTransform.Translation;
-						float SphereRadius = Shape.Sphere.SphereRadius * Collision::UniformScaleMax(ShapeTransform.Scale3D);
-						float Dist = FVector::Distance(ParticleSphere.Center, SphereCenter);
-						bCollided = (Dist < (ParticleSphere.Radius + SphereRadius));
-						if (bCollided)
-						{
-							HitNormal = (ParticleSphere.Center - SphereCenter);
-							HitNormal.Normalize();
-						}
-					}
-					break;
+			case EShapeKind::Sphere:
+				{
+					FParticleCollisionSphere& Sphere = Cache.Spheres[Cache.Spheres.Emplace()];
+					Sphere.Center = ShapeTransform.Translation;
+					Sphere.Radius = Shape.Sphere.SphereRadius * Collision::UniformScaleMax(ShapeTransform.Scale3D);
+					const FVector Extent(Sphere.Radius, Sphere.Radius, Sphere.Radius);
+					Sphere.BoundsMin = Sphere.Center - Extent;
+					Sphere.BoundsMax = Sphere.Center + Extent;
+					Sphere.Component = PrimComp;
+				}
+				break;
 
-				case EShapeKind::Capsule:
-					{
-						// 캡슐 충돌 검사
-						FVector P0, P1;
-						float CapsuleRadius;
-						Collision::BuildCapsule(Shape, ShapeTransform, P0, P1, CapsuleRadius);
-
-						// 파티클 위치에서 캡슐 중심선까지의 최단 거리
-						FVector CapsuleDir = P1 - P0;
-						float CapsuleLen = CapsuleDir.Size();
-						if (CapsuleLen > KINDA_SMALL_NUMBER)
-						{
-							CapsuleDir /= CapsuleLen;
-						}
-
-						FVector ToParticle = ParticleSphere.Center - P0;
-						float Projection = FMath::Clamp(FVector::Dot(ToParticle, CapsuleDir), 0.0f, CapsuleLen);
-						FVector ClosestPoint = P0 + CapsuleDir * Projection;
-
-						float Dist = FVector::Distance(ParticleSphere.Center, ClosestPoint);
-						bCollided = (Dist < (ParticleSphere.Radius + CapsuleRadius));
-						if (bCollided)
-						{
-							HitNormal = (ParticleSphere.Center - ClosestPoint);
-							HitNormal.Normalize();
-						}
-					}
-					break;
+			case EShapeKind::Capsule:
+				{
+					FVector P0, P1;
+					float CapsuleRadius;
+					Collision::BuildCapsule(Shape, ShapeTransform, P0, P1, CapsuleRadius);
+
+					FParticleCollisionCapsule& Capsule = Cache.Capsules[Cache.Capsules.Emplace()];
+					Capsule.P0 = P0;
+					Capsule.Direction = P1 - P0;
+					Capsule.Length = Capsule.Direction.Size();
+					Capsule.Direction = (Capsule.Length > KINDA_SMALL_NUMBER) ? Capsule.Direction / Capsule.Length : FVector(0.0f, 0.0f, 1.0f);
+					Capsule.Radius = CapsuleRadius;
+					const FVector Extent(CapsuleRadius, CapsuleRadius, CapsuleRadius);
+					Capsule.BoundsMin = P0.ComponentMin(P1) - Extent;
+					Capsule.BoundsMax = P0.ComponentMax(P1) + Extent;
+					Capsule.Component = PrimComp;
 				}
+				break;
 			}
-			// 2. StaticMeshComponent인 경우 - AABB 기반 충돌
-			else if (UStaticMeshComponent* MeshComp = Cast<UStaticMeshComponent>(PrimComp))
-			{
-				FAABB MeshAABB = MeshComp->GetWorldAABB();
+		}
+		else if (Cast<UStaticMeshComponent>(PrimComp))
+		{
+			// BVH가 게임 스레드에서 캐시해 둔 바운드 (GetWorldAABB는 월드 행렬 캐시를 갱신하므로 경쟁 발생)
+			const FAABB& MeshAABB = Cache.QueryBounds[CandidateIndex];
 
-				// 파티클 구체와 AABB 충돌 검사
-				FVector ClosestPoint;
-				ClosestPoint.X = FMath::Clamp(ParticleSphere.Center.X, MeshAABB.Min.X, MeshAABB.Max.X);
-				ClosestPoint.Y = FMath::Clamp(ParticleSphere.Center.Y, MeshAABB.Min.Y, MeshAABB.Max.Y);
-				ClosestPoint.Z = FMath::Clamp(ParticleSphere.Center.Z, MeshAABB.Min.Z, MeshAABB.Max.Z);
+			FParticleCollisionAABB& Bounds = Cache.AABBs[Cache.AABBs.Emplace()];
+			Bounds.Min = MeshAABB.Min;
+			Bounds.Max = MeshAABB.Max;
+			Bounds.Component = PrimComp;
+		}
+	}
+}
 
-				float DistSq = FVector::DistSquared(ParticleSphere.Center, ClosestPoint);
-				bCollided = (DistSq < ParticleSphere.Radius * ParticleSphere.Radius);
+void UParticleModuleCollision::Update(FModuleUpdateContext& Context)
+{
+	UParticleSystemComponent* PSC = Context.Owner.Component;
+	if (!PSC)
+	{
+		return;
+	}
 
-				if (bCollided)
-				{
-					// AABB 표면 법선 계산
-					HitNormal = ParticleSphere.Center - ClosestPoint;
-					if (HitNormal.SizeSquared() > KINDA_SMALL_NUMBER)
-					{
-						HitNormal.Normalize();
-					}
-					else
-					{
-						// 파티클이 AABB 내부에 있는 경우 - 위쪽으로 밀어냄
-						HitNormal = FVector(0.0f, 0.0f, 1.0f);
-					}
-				}
+	// 1. 광역 검사 (이미터 단위, 프레임당 BVH 쿼리 한 번)
+	FParticleCollisionCache& Cache = Context.Owner.CollisionCache;
+	Cache.Reset();
+	if (CollisionMode != EParticleCollisionMode::Plane)
+	{
+		BuildBroadphase(Context, Cache);
+	}
+
+	const bool bUsePlane = (CollisionMode != EParticleCollisionMode::Scene);
+	FVector CollisionPlaneNormal = PlaneNormal.GetSafeNormal();
+	if (CollisionPlaneNormal.SizeSquared() < KINDA_SMALL_NUMBER)
+	{
+		CollisionPlaneNormal = FVector(0.0f, 0.0f, 1.0f);
+	}
+
+	BEGIN_UPDATE_LOOP
+		PARTICLE_ELEMENT(FParticleCollisionPayload, CollPayload);
+
+		// 딜레이 체크
+		CollPayload.DelayTimer += DeltaTime;
+		if (CollPayload.DelayTimer < CollPayload.UsedDelayAmount)
+		{
+			CurrentOffset = Offset;  // continue 전 오프셋 리셋 필수!
+			continue;
+		}
+
+		// MaxCollisions 체크
+		if (CollPayload.UsedCollisionCount >= CollPayload.UsedMaxCollisions)
+		{
+			HandleCollisionComplete(Particle, CollPayload);
+			CurrentOffset = Offset;  // continue 전 오프셋 리셋 필수!
+			continue;
+		}
+
+		// 2. 정밀 검사 (파티클 현재 위치를 구체로 취급)
+		FParticleCollisionHit Hit;
+		bool bCollided = !Cache.IsEmpty() && FindSceneCollision(Particle.Location, ParticleRadius, Cache, Hit);
+
+		if (!bCollided && bUsePlane)
+		{
+			// 평면 아래로 파고든 만큼 표면 위로 밀어냄 (터널링해도 반대편에서 복구됨)
+			const float SignedDistance = FVector::Dot(CollisionPlaneNormal, Particle.Location) - PlaneDistance;
+			if (SignedDistance < ParticleRadius)
+			{
+				bCollided = true;
+				Hit.Normal = CollisionPlaneNormal;
+				Hit.PushDistance = ParticleRadius - SignedDistance;
+				Hit.Component = nullptr;
 			}
+		}
 
-			if (bCollided)
+		if (bCollided)
+		{
+			// 충돌 이벤트 생성
+			if (bGenerateCollisionEvents)
 			{
-				// 충돌 이벤트 생성
-				if (bGenerateCollisionEvents && PSC)
+				// 평면 충돌은 HitComponent / HitActor 없이 보고
+				AActor* Owner = Hit.Component ? Hit.Component->GetOwner() : nullptr;
+				// 파괴 예정인 Actor는 null로 처리
+				if (Owner && Owner->IsPendingDestroy())
 				{
-					// 컴포넌트 유효성 검사 (언리얼 방식)
-					if (PrimComp && !PrimComp->IsPendingDestroy())
-					{
-						AActor* Owner = PrimComp->GetOwner();
-						// 파괴 예정인 Actor는 null로 처리
-						if (Owner && Owner->IsPendingDestroy())
-						{
-							Owner = nullptr;
-						}
-
-						FParticleEventCollideData Event;
-						Event.Type = EParticleEventType::Collision;
-						Event.EventName = CollisionEventName;  // 이벤트 이름 설정
-						Event.Position = Particle.Location;
-						Event.Velocity = Particle.Velocity;
-						Event.Normal = HitNormal;
-						Event.HitComponent = PrimComp;
-						Event.HitActor = Owner;
-						Event.EmitterTime = Context.Owner.EmitterTime;
-
-						PSC->AddCollisionEvent(Event);
-					}
+					Owner = nullptr;
 				}
 
-				// 충돌 위치 보정 (표면에서 약간 띄움)
-				Particle.Location += HitNormal * ParticleRadius * 0.1f;
+				FParticleEventCollideData Event;
+				Event.Type = EParticleEventType::Collision;
+				Event.EventName = CollisionEventName;  // 이벤트 이름 설정
+				Event.Position = Particle.Location;
+				Event.Velocity = Particle.Velocity;
+				Event.Normal = Hit.Normal;
+				Event.HitComponent = Hit.Component;
+				Event.HitActor = Owner;
+				Event.EmitterTime = Context.Owner.EmitterTime;
+
+				Context.Owner.EventBuffer.AddCollisionEvent(Event);
+			}
 
-				// 바운스 처리
-				ApplyDamping(Particle, CollPayload, HitNormal);
-				CollPayload.UsedCollisionCount++;
+			// 충돌 위치 보정
+			Particle.Location += Hit.Normal * Hit.PushDistance;
 
-				// 충돌 발생 플래그 설정
-				Particle.Flags |= STATE_Particle_CollisionHasOccurred;
+			// 바운스 처리
+			ApplyDamping(Particle, CollPayload, Hit.Normal);
+			CollPayload.UsedCollisionCount++;
 
-				break;  // 한 프레임에 하나의 충돌만 처리
-			}
+			// 충돌 발생 플래그 설정
+			Particle.Flags |= STATE_Particle_CollisionHasOccurred;
 		}
 	END_UPDATE_LOOP
 }
@@ -336,6 +447,12 @@ void UParticleModuleCollision::Serialize(const bool bInIsLoading, JSON& InOutHan
 
 		FJsonSerializer::ReadFloat(InOutHandle, "ParticleRadius", ParticleRadius);
 		FJsonSerializer::ReadBool(InOutHandle, "bGenerateCollisionEvents", bGenerateCollisionEvents);
+
+		int32 ModeValue = 0;
+		FJsonSerializer::ReadInt32(InOutHandle, "CollisionMode", ModeValue, 0, false);
+		CollisionMode = static_cast<EParticleCollisionMode>(ModeValue);
+		FJsonSerializer::ReadVector(InOutHandle, "PlaneNormal", PlaneNormal, FVector(0.0f, 0.0f, 1.0f), false);
+		FJsonSerializer::ReadFloat(InOutHandle, "PlaneDistance", PlaneDistance, 0.0f, false);
 	}
 	else
 	{
@@ -354,5 +471,8 @@ void UParticleModuleCollision::Serialize(const bool bInIsLoading, JSON& InOutHan
 		InOutHandle["CollisionCompletionOption"] = static_cast<int32>(CollisionCompletionOption);
 		InOutHandle["ParticleRadius"] = ParticleRadius;
 		InOutHandle["bGenerateCollisionEvents"] = bGenerateCollisionEvents;
+		InOutHandle["CollisionMode"] = static_cast<int32>(CollisionMode);
+		InOutHandle["PlaneNormal"] = FJsonSerializer::VectorToJson(PlaneNormal);
+		InOutHandle["PlaneDistance"] = PlaneDistance;
 	}
 }
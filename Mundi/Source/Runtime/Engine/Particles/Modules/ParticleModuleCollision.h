@@ -5,6 +5,8 @@
 #include "ParticleEventTypes.h"
 #include "UParticleModuleCollision.generated.h"
 
+struct FParticleCollisionCache;
+
 // 충돌 페이로드 (파티클별 충돌 상태)
 struct FParticleCollisionPayload
 {
@@ -46,6 +48,18 @@ public:
 	UPROPERTY(EditAnywhere, Category="Collision", meta=(ClampMin="0.1", ToolTip="파티클 충돌 반지름"))
 	float ParticleRadius = 5.0f;
 
+	// 충돌 대상 (Plane은 BVH 쿼리 없이 평면 하나와만 충돌 - 스파크/파편처럼 바닥에만 튀면 되는 경우)
+	UPROPERTY(EditAnywhere, Category="Collision", meta=(ToolTip="충돌 대상 (Scene: 씬 컴포넌트, Plane: 해석적 평면, SceneAndPlane: 둘 다)"))
+	EParticleCollisionMode CollisionMode = EParticleCollisionMode::Scene;
+
+	// 충돌 평면 법선 (월드 공간, 정규화되지 않아도 됨)
+	UPROPERTY(EditAnywhere, Category="Collision", meta=(ToolTip="충돌 평면 법선 (월드 공간)"))
+	FVector PlaneNormal = FVector(0.0f, 0.0f, 1.0f);
+
+	// 충돌 평면 거리 (Dot(PlaneNormal, P) = PlaneDistance, 법선이 +Z면 바닥 높이)
+	UPROPERTY(EditAnywhere, Category="Collision", meta=(ToolTip="충돌 평면의 원점으로부터 거리 (법선이 +Z면 바닥 높이)"))
+	float PlaneDistance = 0.0f;
+
 	// 충돌 이벤트 생성 여부
 	UPROPERTY(EditAnywhere, Category="Collision", meta=(ToolTip="충돌 시 이벤트를 생성할지 여부"))
 	bool bGenerateCollisionEvents = true;
@@ -78,6 +92,9 @@ public:
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
 private:
+	// 광역 검사: 모든 파티클 이동 경로의 합집합 바운드로 BVH를 한 번 쿼리하고 후보를 월드 공간 도형으로 캐시
+	void BuildBroadphase(FModuleUpdateContext& Context, FParticleCollisionCache& Cache) const;
+
 	// 충돌 완료 처리 (MaxCollisions 도달 시)
 	void HandleCollisionComplete(FBaseParticle& Particle, FParticleCollisionPayload& Payload);
 
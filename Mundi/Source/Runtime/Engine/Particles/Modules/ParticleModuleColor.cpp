@@ -21,13 +21,11 @@ void UParticleModuleColor::Spawn(FParticleEmitterInstance* Owner, int32 Offset,
 	// 언리얼 엔진 호환: PARTICLE_ELEMENT 매크로 (CurrentOffset 자동 증가)
 	PARTICLE_ELEMENT(FParticleColorPayload, ColorPayload);
 
-	// UniformCurve용 랜덤 비율 저장 (0~1)
-	ColorPayload.RGBRandomFactor = FVector(
-		Owner->RandomStream.GetFraction(),
-		Owner->RandomStream.GetFraction(),
-		Owner->RandomStream.GetFraction()
-	);
-	ColorPayload.AlphaRandomFactor = Owner->RandomStream.GetFraction();
+	// UniformCurve용 랜덤 비율 저장 (0~1, RGB + Alpha를 4-lane 한 번에 생성)
+	float RandomFactors[4];
+	Owner->RandomStream.GetFractions(RandomFactors, 4);
+	ColorPayload.RGBRandomFactor = FVector(RandomFactors[0], RandomFactors[1], RandomFactors[2]);
+	ColorPayload.AlphaRandomFactor = RandomFactors[3];
 
 	// 초기 색상 설정 (RelativeTime = 0)
 	FLinearColor InitialColor = ColorOverLife.GetValue(0.0f, Owner->RandomStream, Owner->Component);
@@ -53,7 +51,7 @@ void UParticleModuleColor::Update(FModuleUpdateContext& Context)
 		{
 		case EDistributionType::ConstantCurve:
 			{
-				FVector RGB = ColorOverLife.RGB.ConstantCurve.Eval(Particle.RelativeTime);
+				FVector RGB = ColorOverLife.RGB.EvalCurve(Particle.RelativeTime);
 				CurrentColor.R = RGB.X;
 				CurrentColor.G = RGB.Y;
 				CurrentColor.B = RGB.Z;
@@ -62,8 +60,8 @@ void UParticleModuleColor::Update(FModuleUpdateContext& Context)
 
 		case EDistributionType::UniformCurve:
 			{
-				FVector MinRGB = ColorOverLife.RGB.MinCurve.Eval(Particle.RelativeTime);
-				FVector MaxRGB = ColorOverLife.RGB.MaxCurve.Eval(Particle.RelativeTime);
+				FVector MinRGB, MaxRGB;
+				ColorOverLife.RGB.EvalMinMaxCurve(Particle.RelativeTime, MinRGB, MaxRGB);
 				CurrentColor.R = FMath::Lerp(MinRGB.X, MaxRGB.X, ColorPayload.RGBRandomFactor.X);
 				CurrentColor.G = FMath::Lerp(MinRGB.Y, MaxRGB.Y, ColorPayload.RGBRandomFactor.Y);
 				CurrentColor.B = FMath::Lerp(MinRGB.Z, MaxRGB.Z, ColorPayload.RGBRandomFactor.Z);
@@ -93,13 +91,13 @@ void UParticleModuleColor::Update(FModuleUpdateContext& Context)
 		switch (AlphaDistType)
 		{
 		case EDistributionType::ConstantCurve:
-			CurrentColor.A = ColorOverLife.Alpha.ConstantCurve.Eval(Particle.RelativeTime);
+			CurrentColor.A = ColorOverLife.Alpha.EvalCurve(Particle.RelativeTime);
 			break;
 
 		case EDistributionType::UniformCurve:
 			{
-				float MinA = ColorOverLife.Alpha.MinCurve.Eval(Particle.RelativeTime);
-				float MaxA = ColorOverLife.Alpha.MaxCurve.Eval(Particle.RelativeTime);
+				float MinA, MaxA;
+				ColorOverLife.Alpha.EvalMinMaxCurve(Particle.RelativeTime, MinA, MaxA);
 				CurrentColor.A = FMath::Lerp(MinA, MaxA, ColorPayload.AlphaRandomFactor);
 			}
 			break;
@@ -52,7 +52,7 @@ void UParticleModuleEventGenerator::Spawn(FParticleEmitterInstance* Owner, int32
 	Event.EventName = SpawnEventInfo->EventName;  // 이벤트 이름 설정
 
 	// 이벤트 추가
-	Owner->Component->AddSpawnEvent(Event);
+	Owner->EventBuffer.AddSpawnEvent(Event);
 }
 
 void UParticleModuleEventGenerator::Update(FModuleUpdateContext& Context)
@@ -95,7 +95,7 @@ void UParticleModuleEventGenerator::Update(FModuleUpdateContext& Context)
 
 			FParticleEventData Event = CreateEventData(EParticleEventType::Death, Particle, Context.Owner.EmitterTime);
 			Event.EventName = DeathEventInfo->EventName;  // 이벤트 이름 설정
-			PSC->AddDeathEvent(Event);
+			Context.Owner.EventBuffer.AddDeathEvent(Event);
 		}
 
 		// 충돌 이벤트 체크 (충돌 모듈이 플래그를 설정했는지 확인)
@@ -59,10 +59,11 @@ void UParticleModuleLocation::Spawn(FParticleEmitterInstance* Owner, int32 Offse
 FVector UParticleModuleLocation::GenerateRandomLocationBox(FParticleRandomStream& RandomStream, const FVector& Extent)
 {
 	// 박스 형태: 각 축별로 -Extent ~ +Extent 범위에서 균등 분포
+	const FVector Fractions = RandomStream.GetFractionVector();
 	return FVector(
-		RandomStream.GetSignedFraction() * Extent.X,
-		RandomStream.GetSignedFraction() * Extent.Y,
-		RandomStream.GetSignedFraction() * Extent.Z
+		(2.0f * Fractions.X - 1.0f) * Extent.X,
+		(2.0f * Fractions.Y - 1.0f) * Extent.Y,
+		(2.0f * Fractions.Z - 1.0f) * Extent.Z
 	);
 }
 
@@ -26,11 +26,7 @@ void UParticleModuleMeshRotation::Spawn(FParticleEmitterInstance* Owner, int32 O
 	Payload.TargetRotation = TargetRot;
 
 	// UniformCurve용 랜덤 비율 저장
-	Payload.RotationRandomFactor = FVector(
-		Owner->RandomStream.GetFraction(),
-		Owner->RandomStream.GetFraction(),
-		Owner->RandomStream.GetFraction()
-	);
+	Payload.RotationRandomFactor = Owner->RandomStream.GetFractionVector();
 
 	// Distribution 시스템을 사용하여 회전 속도 계산
 	FVector InitialRotRate = StartRotationRate.GetValue(0.0f, Owner->RandomStream, Owner->Component);
@@ -42,11 +38,7 @@ void UParticleModuleMeshRotation::Spawn(FParticleEmitterInstance* Owner, int32 O
 	Payload.TargetRotationRate = TargetRotRate;
 
 	// RotationRate UniformCurve용 랜덤 비율 저장
-	Payload.RateRandomFactor = FVector(
-		Owner->RandomStream.GetFraction(),
-		Owner->RandomStream.GetFraction(),
-		Owner->RandomStream.GetFraction()
-	);
+	Payload.RateRandomFactor = Owner->RandomStream.GetFractionVector();
 
 	// 기본 Z축 회전도 동기화 (스프라이트 호환)
 	ParticleBase->Rotation = Payload.Rotation.Z;
@@ -71,13 +63,13 @@ void UParticleModuleMeshRotation::Update(FModuleUpdateContext& Context)
 			switch (RotDistType)
 			{
 			case EDistributionType::ConstantCurve:
-				CurrentRotation = StartRotation.ConstantCurve.Eval(Particle.RelativeTime);
+				CurrentRotation = StartRotation.EvalCurve(Particle.RelativeTime);
 				break;
 
 			case EDistributionType::UniformCurve:
 				{
-					FVector MinAtTime = StartRotation.MinCurve.Eval(Particle.RelativeTime);
-					FVector MaxAtTime = StartRotation.MaxCurve.Eval(Particle.RelativeTime);
+					FVector MinAtTime, MaxAtTime;
+					StartRotation.EvalMinMaxCurve(Particle.RelativeTime, MinAtTime, MaxAtTime);
 					CurrentRotation.X = FMath::Lerp(MinAtTime.X, MaxAtTime.X, Payload.RotationRandomFactor.X);
 					CurrentRotation.Y = FMath::Lerp(MinAtTime.Y, MaxAtTime.Y, Payload.RotationRandomFactor.Y);
 					CurrentRotation.Z = FMath::Lerp(MinAtTime.Z, MaxAtTime.Z, Payload.RotationRandomFactor.Z);
@@ -105,13 +97,13 @@ void UParticleModuleMeshRotation::Update(FModuleUpdateContext& Context)
 			switch (RateDistType)
 			{
 			case EDistributionType::ConstantCurve:
-				CurrentRotationRate = StartRotationRate.ConstantCurve.Eval(Particle.RelativeTime);
+				CurrentRotationRate = StartRotationRate.EvalCurve(Particle.RelativeTime);
 				break;
 
 			case EDistributionType::UniformCurve:
 				{
-					FVector MinAtTime = StartRotationRate.MinCurve.Eval(Particle.RelativeTime);
-					FVector MaxAtTime = StartRotationRate.MaxCurve.Eval(Particle.RelativeTime);
+					FVector MinAtTime, MaxAtTime;
+					StartRotationRate.EvalMinMaxCurve(Particle.RelativeTime, MinAtTime, MaxAtTime);
 					CurrentRotationRate.X = FMath::Lerp(MinAtTime.X, MaxAtTime.X, Payload.RateRandomFactor.X);
 					CurrentRotationRate.Y = FMath::Lerp(MinAtTime.Y, MaxAtTime.Y, Payload.RateRandomFactor.Y);
 					CurrentRotationRate.Z = FMath::Lerp(MinAtTime.Z, MaxAtTime.Z, Payload.RateRandomFactor.Z);
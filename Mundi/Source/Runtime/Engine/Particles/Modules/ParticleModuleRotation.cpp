@@ -39,13 +39,13 @@ void UParticleModuleRotation::Update(FModuleUpdateContext& Context)
 		switch (DistType)
 		{
 		case EDistributionType::ConstantCurve:
-			CurrentRotation = RotationOverLife.ConstantCurve.Eval(Particle.RelativeTime);
+			CurrentRotation = RotationOverLife.EvalCurve(Particle.RelativeTime);
 			break;
 
 		case EDistributionType::UniformCurve:
 			{
-				float MinAtTime = RotationOverLife.MinCurve.Eval(Particle.RelativeTime);
-				float MaxAtTime = RotationOverLife.MaxCurve.Eval(Particle.RelativeTime);
+				float MinAtTime, MaxAtTime;
+				RotationOverLife.EvalMinMaxCurve(Particle.RelativeTime, MinAtTime, MaxAtTime);
 				CurrentRotation = FMath::Lerp(MinAtTime, MaxAtTime, Payload.RandomFactor);
 			}
 			break;
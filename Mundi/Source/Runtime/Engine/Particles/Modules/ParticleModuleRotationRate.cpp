@@ -40,13 +40,13 @@ void UParticleModuleRotationRate::Update(FModuleUpdateContext& Context)
 		switch (DistType)
 		{
 		case EDistributionType::ConstantCurve:
-			CurrentRotationRate = RotationRateOverLife.ConstantCurve.Eval(Particle.RelativeTime);
+			CurrentRotationRate = RotationRateOverLife.EvalCurve(Particle.RelativeTime);
 			break;
 
 		case EDistributionType::UniformCurve:
 			{
-				float MinAtTime = RotationRateOverLife.MinCurve.Eval(Particle.RelativeTime);
-				float MaxAtTime = RotationRateOverLife.MaxCurve.Eval(Particle.RelativeTime);
+				float MinAtTime, MaxAtTime;
+				RotationRateOverLife.EvalMinMaxCurve(Particle.RelativeTime, MinAtTime, MaxAtTime);
 				CurrentRotationRate = FMath::Lerp(MinAtTime, MaxAtTime, Payload.RandomFactor);
 			}
 			break;
@@ -23,11 +23,7 @@ void UParticleModuleSize::Spawn(FParticleEmitterInstance* Owner, int32 Offset, f
 	PARTICLE_ELEMENT(FParticleSizePayload, SizePayload);
 
 	// UniformCurve용 랜덤 비율 저장 (0~1, 각 축별)
-	SizePayload.RandomFactor = FVector(
-		Owner->RandomStream.GetFraction(),
-		Owner->RandomStream.GetFraction(),
-		Owner->RandomStream.GetFraction()
-	);
+	SizePayload.RandomFactor = Owner->RandomStream.GetFractionVector();
 
 	// 초기 크기 설정 (RelativeTime = 0)
 	FVector LocalInitialSize = SizeOverLife.GetValue(0.0f, Owner->RandomStream, Owner->Component);
@@ -61,15 +57,15 @@ void UParticleModuleSize::Update(FModuleUpdateContext& Context)
 		{
 		case EDistributionType::ConstantCurve:
 			// ConstantCurve: RelativeTime에 따라 커브 평가
-			CurrentSizeVec = SizeOverLife.ConstantCurve.Eval(Particle.RelativeTime);
+			CurrentSizeVec = SizeOverLife.EvalCurve(Particle.RelativeTime);
 			CurrentSizeVec = CurrentSizeVec * ComponentScaleX;
 			break;
 
 		case EDistributionType::UniformCurve:
 			{
 				// UniformCurve: Min/Max 커브 평가 후 저장된 랜덤 비율로 보간
-				FVector MinAtTime = SizeOverLife.MinCurve.Eval(Particle.RelativeTime);
-				FVector MaxAtTime = SizeOverLife.MaxCurve.Eval(Particle.RelativeTime);
+				FVector MinAtTime, MaxAtTime;
+				SizeOverLife.EvalMinMaxCurve(Particle.RelativeTime, MinAtTime, MaxAtTime);
 				CurrentSizeVec.X = FMath::Lerp(MinAtTime.X, MaxAtTime.X, SizePayload.RandomFactor.X);
 				CurrentSizeVec.Y = FMath::Lerp(MinAtTime.Y, MaxAtTime.Y, SizePayload.RandomFactor.Y);
 				CurrentSizeVec.Z = FMath::Lerp(MinAtTime.Z, MaxAtTime.Z, SizePayload.RandomFactor.Z);
@@ -52,6 +52,9 @@ public:
 	// 표시 우선순위 (Spawn 다음)
 	virtual int32 GetDisplayPriority() const override { return 10; }
 
+	// 소스 이미터의 파티클을 읽고 LastSpawnPositions를 갱신하므로 병렬 틱 불가
+	virtual bool SupportsParallelTick() const override { return false; }
+
 private:
 	// 마지막으로 Trail 파티클을 생성한 위치 (소스 파티클별로 추적)
 	// Key: 소스 파티클 포인터, Value: 마지막 생성 위치
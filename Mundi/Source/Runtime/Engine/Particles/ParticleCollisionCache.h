@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Vector.h"
+
+class UPrimitiveComponent;
+
+/**
+ * 파티클 충돌 광역 검사 캐시 (이미터 인스턴스별)
+ *
+ * UParticleModuleCollision::Update가 프레임당 한 번, 모든 파티클 이동 경로의 합집합 바운드로 BVH를 쿼리하고
+ * 후보 컴포넌트를 월드 공간 도형으로 미리 변환해 평탄 배열에 담아둡니다.
+ * 파티클별 정밀 검사는 이 배열만 읽으므로 Cast / GetShape / GetWorldTransform / OBB 생성이 파티클 수와 무관해집니다.
+ * 모듈은 템플릿에서 공유되므로 캐시는 이미터 인스턴스가 소유합니다 (병렬 틱 안전).
+ */
+struct FParticleCollisionSphere
+{
+	FVector Center;
+	float Radius = 0.0f;
+	FVector BoundsMin;
+	FVector BoundsMax;
+	UPrimitiveComponent* Component = nullptr;
+};
+
+struct FParticleCollisionCapsule
+{
+	FVector P0;				// 하단 반구 중심
+	FVector Direction;		// P0 → P1 단위 벡터
+	float Length = 0.0f;	// P0 ~ P1 거리
+	float Radius = 0.0f;
+	FVector BoundsMin;
+	FVector BoundsMax;
+	UPrimitiveComponent* Component = nullptr;
+};
+
+struct FParticleCollisionBox
+{
+	FVector Center;
+	FVector HalfExtent;		// 월드 단위 (스케일 적용됨)
+	FVector Axes[3];		// 단위 축
+	FVector BoundsMin;
+	FVector BoundsMax;
+	UPrimitiveComponent* Component = nullptr;
+};
+
+// StaticMeshComponent는 월드 AABB로 충돌
+struct FParticleCollisionAABB
+{
+	FVector Min;
+	FVector Max;
+	UPrimitiveComponent* Component = nullptr;
+};
+
+struct FParticleCollisionCache
+{
+	TArray<FParticleCollisionSphere> Spheres;
+	TArray<FParticleCollisionCapsule> Capsules;
+	TArray<FParticleCollisionBox> Boxes;
+	TArray<FParticleCollisionAABB> AABBs;
+
+	// BVH 쿼리 결과와 BVH에 캐시된 월드 AABB (같은 인덱스, 매 프레임 재사용)
+	TArray<UPrimitiveComponent*> QueryResults;
+	TArray<FAABB> QueryBounds;
+
+	// 통계 (마지막 광역 검사 기준)
+	int32 LastCandidateCount = 0;
+
+	void Reset()
+	{
+		Spheres.Empty();
+		Capsules.Empty();
+		Boxes.Empty();
+		AABBs.Empty();
+		LastCandidateCount = 0;
+	}
+
+	bool IsEmpty() const
+	{
+		return Spheres.IsEmpty() && Capsules.IsEmpty() && Boxes.IsEmpty() && AABBs.IsEmpty();
+	}
+};
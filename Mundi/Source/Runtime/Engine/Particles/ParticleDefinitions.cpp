@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "ParticleDefinitions.h"
+#include "ParticleSorter.h"
 
 // 언리얼 엔진 호환: 16바이트 정렬 메모리 할당
 // FMemory::Malloc(Size, 16) 방식과 동일하게 캐시 라인 최적화
@@ -77,3 +78,45 @@ void FParticleDataContainer::Free()
 	ParticleDataNumBytes = 0;
 	ParticleIndicesNumShorts = 0;
 }
+
+void FDynamicSpriteEmitterDataBase::SortSpriteParticles(int32 SortMode, const FVector& ViewOrigin, const FVector& ViewDirection, FParticleSorter& Sorter)
+{
+	const FDynamicEmitterReplayDataBase& SourceData = GetSource();
+	const int32 NumParticles = SourceData.ActiveParticleCount;
+
+	if (SortMode == 0 || NumParticles <= 1)
+	{
+		return;  // 정렬 불필요
+	}
+
+	uint16* Indices = SourceData.DataContainer.ParticleIndices;
+	const uint8* ParticleData = SourceData.DataContainer.ParticleData;
+	const int32 ParticleStride = SourceData.ParticleStride;
+
+	if (!Indices || !ParticleData)
+	{
+		return;
+	}
+
+	// 1. 키 계산 (파티클 인덱스 기준, 그리기 순서 = 키 오름차순)
+	uint32* Keys = Sorter.GetKeyBuffer(NumParticles);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const FBaseParticle* Particle = reinterpret_cast<const FBaseParticle*>(ParticleData + i * ParticleStride);
+
+		if (SortMode == 1)  // Age 정렬 (오래된 것부터)
+		{
+			Keys[i] = FParticleSorter::MakeAgeKey(Particle->Flags, SourceData.SpawnCounter);
+		}
+		else  // Depth 정렬 (먼 것부터 - 투명도 렌더링)
+		{
+			// 뷰 방향에 대한 내적으로 깊이 계산 (유클리드 거리보다 정확), 깊이가 큰 것이 작은 키
+			const float Depth = FVector::Dot(Particle->Location - ViewOrigin, ViewDirection);
+			Keys[i] = FParticleSorter::FloatToSortKey(-Depth);
+		}
+	}
+
+	// 2. 정렬 (같은 데이터를 다른 뷰에서 다시 정렬할 때도 직전 결과에서 출발하므로 증분으로 처리)
+	Sorter.SortIndices(Indices, NumParticles, Keys, SourceData.bCoherentOrder || bIndicesSorted);
+	bIndicesSorted = true;
+}
@@ -3,8 +3,10 @@
 #include "Vector.h"
 #include "Color.h"
 #include "VertexData.h"
+#include "ParticleTrail.h"
 
 class UMaterialInterface;
+class FParticleSorter;
 
 // 언리얼 엔진 호환: 렌더링에 필요한 필수 모듈 데이터
 // 렌더 스레드에서 안전하게 접근할 수 있도록 데이터를 복사
@@ -259,12 +261,21 @@ struct FDynamicEmitterReplayDataBase
 	FVector Scale;
 	int32 SortMode;
 
+	/** 빌드 시점의 이미터 ParticleCounter (Age 정렬 키 기준) */
+	uint32 SpawnCounter;
+	/** 컴팩트 인덱스 → 원본 이미터 파티클 슬롯 (정렬 결과를 다음 프레임으로 넘길 때 사용) */
+	TArray<uint16> ParticleSlots;
+	/** 컴팩트 복사 순서가 지난 프레임 정렬 결과를 이어받았는지 (true면 증분 정렬) */
+	bool bCoherentOrder;
+
 	FDynamicEmitterReplayDataBase()
 		: eEmitterType(EDynamicEmitterType::Unknown)
 		, ActiveParticleCount(0)
 		, ParticleStride(0)
 		, Scale(FVector(1.0f, 1.0f, 1.0f))
 		, SortMode(0)
+		, SpawnCounter(0)
+		, bCoherentOrder(false)
 	{
 	}
 
@@ -316,6 +327,7 @@ struct FDynamicMeshEmitterReplayDataBase : public FDynamicEmitterReplayDataBase
 struct FDynamicBeamEmitterReplayDataBase : public FDynamicEmitterReplayDataBase
 {
 	TArray<FVector> BeamPoints;
+	FParticleTrailStrip Strip;		// BeamPoints의 뷰 무관 테셀레이션 데이터 (빌드 시 계산)
 	float Width;
 	float TileU;
 	FLinearColor Color;
@@ -337,6 +349,7 @@ struct FDynamicRibbonEmitterReplayDataBase : public FDynamicEmitterReplayDataBas
 {
 	TArray<FVector> RibbonPoints;
 	TArray<FLinearColor> RibbonColors;  // 각 포인트의 색상 (알파 페이드 포함)
+	FParticleTrailStrip Strip;			// RibbonPoints의 뷰 무관 테셀레이션 데이터 (빌드 시 계산, 테이퍼 포함)
 	float Width;
 	UMaterialInterface* Material;
 
@@ -368,51 +381,16 @@ struct FDynamicEmitterDataBase
 // 스프라이트 이미터 데이터 베이스
 struct FDynamicSpriteEmitterDataBase : public FDynamicEmitterDataBase
 {
+	// 이미 한 번 정렬된 데이터인지 (다른 뷰에서 다시 정렬할 때 증분으로 처리)
+	bool bIndicesSorted = false;
+
 	virtual ~FDynamicSpriteEmitterDataBase() = default;
 
 	// 언리얼 엔진 호환: 파티클 정렬 (투명 렌더링을 위해 필수)
-	// SortMode: 0 = 정렬 없음, 1 = Age (오래된 것부터), 2 = Distance (먼 것부터)
+	// SortMode: 0 = 정렬 없음, 1 = Age (오래된 것부터, 스폰 카운터 기준), 2 = Distance (먼 것부터)
 	// ViewDirection: 카메라가 바라보는 방향 (forward vector)
-	virtual void SortSpriteParticles(int32 SortMode, const FVector& ViewOrigin, const FVector& ViewDirection)
-	{
-		const FDynamicEmitterReplayDataBase& SourceData = GetSource();
-
-		if (SortMode == 0 || SourceData.ActiveParticleCount <= 1)
-		{
-			return;  // 정렬 불필요
-		}
-
-		uint16* Indices = SourceData.DataContainer.ParticleIndices;
-		const uint8* ParticleData = SourceData.DataContainer.ParticleData;
-		const int32 ParticleStride = SourceData.ParticleStride;
-
-		if (!Indices || !ParticleData)
-		{
-			return;
-		}
-
-		// std::sort 사용 (O(N log N) - 버블 정렬보다 훨씬 빠름)
-		std::sort(Indices, Indices + SourceData.ActiveParticleCount,
-			[&](uint16 IndexA, uint16 IndexB) -> bool
-			{
-				const FBaseParticle* PA = (const FBaseParticle*)(ParticleData + IndexA * ParticleStride);
-				const FBaseParticle* PB = (const FBaseParticle*)(ParticleData + IndexB * ParticleStride);
-
-				if (SortMode == 1)  // Age 정렬 (오래된 것부터)
-				{
-					return PA->RelativeTime > PB->RelativeTime;
-				}
-				else if (SortMode == 2)  // Depth 정렬 (먼 것부터 - 투명도 렌더링)
-				{
-					// 뷰 방향에 대한 내적으로 깊이 계산 (유클리드 거리보다 정확)
-					float DepthA = FVector::Dot(PA->Location - ViewOrigin, ViewDirection);
-					float DepthB = FVector::Dot(PB->Location - ViewOrigin, ViewDirection);
-					return DepthA > DepthB;  // 먼 것(깊이가 큰 것)을 먼저 렌더링
-				}
-
-				return false;
-			});
-	}
+	// 키는 파티클당 한 번만 계산하고, Source.bCoherentOrder면 지난 프레임 순서에서 증분 정렬
+	virtual void SortSpriteParticles(int32 SortMode, const FVector& ViewOrigin, const FVector& ViewDirection, FParticleSorter& Sorter);
 
 	virtual int32 GetDynamicVertexStride() const = 0;
 };
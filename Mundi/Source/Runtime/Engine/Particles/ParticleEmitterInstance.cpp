@@ -29,6 +29,13 @@ FParticleEmitterInstance::FParticleEmitterInstance()
 	, MaxActiveParticles(0)
 	, SpawnFraction(0.0f)
 	// BurstFired는 TArray이므로 기본 초기화됨
+	, ParticleBoundsMin(0.0f, 0.0f, 0.0f)
+	, ParticleBoundsMax(0.0f, 0.0f, 0.0f)
+	, MaxParticleSize(0.0f)
+	, bHasParticleBounds(false)
+	, bComputeParticleBounds(true)
+	, SlotStamp(0)
+	, bTrackTrail(false)
 	, EmitterTime(0.0f)
 	, SecondsSinceCreation(0.0f)
 	, EmitterDurationActual(0.0f)
@@ -217,6 +224,21 @@ void FParticleEmitterInstance::SetupEmitter()
 {
 	if (!CurrentLODLevel)	return;
 
+	// 인스턴스 파라미터 핸들 해석 (이후 틱/렌더 데이터 생성에서는 인덱스로 바로 읽음)
+	BeamTargetParameter.Invalidate();
+	if (Component && Cast<UParticleModuleTypeDataBeam>(CurrentLODLevel->TypeDataModule))
+	{
+		BeamTargetParameter = Component->FindOrAddParameter(FName("BeamTarget"));
+	}
+
+	// 리본이면 스폰 순서 링 버퍼 유지
+	const bool bNewTrackTrail = Cast<UParticleModuleTypeDataRibbon>(CurrentLODLevel->TypeDataModule) != nullptr;
+	if (bNewTrackTrail != bTrackTrail)
+	{
+		TrailRing.Reset();
+		bTrackTrail = bNewTrackTrail;
+	}
+
 	// 언리얼 엔진 호환: 페이로드 크기 계산
 	// 각 모듈이 필요로 하는 추가 데이터 크기를 계산하고 오프셋 할당
 	uint32 TotalPayloadSize = 0;
@@ -534,6 +556,9 @@ void FParticleEmitterInstance::SpawnParticles(int32 Count, float StartTime, floa
 		PreSpawn(Particle, InitialLocation, InitialVelocity);
 		float SpawnTime = StartTime + i * Increment;
 
+		// 파티클 단위 랜덤 스트림: 스폰 모듈이 뽑는 값이 (이미터 시드, ParticleCounter)만으로 결정됨
+		RandomStream.BeginParticle(ParticleCounter);
+
 		// 생성 모듈 적용
 		for (UParticleModule* Module : CurrentLODLevel->SpawnModules)
 		{
@@ -554,6 +579,14 @@ void FParticleEmitterInstance::SpawnParticles(int32 Count, float StartTime, floa
 
 		// 생성 후
 		PostSpawn(Particle, static_cast<float>(i) / Count, SpawnTime);
+		AccumulateParticleBounds(*Particle);
+
+		if (bTrackTrail)
+		{
+			TrailRing.Push(static_cast<uint16>(ParticleSlot), ParticleCounter);
+		}
+
+		RandomStream.EndParticle();
 
 		ParticleCounter++;
 		FrameSpawnedCount++;
@@ -607,11 +640,16 @@ void FParticleEmitterInstance::PostSpawn(FBaseParticle* Particle, float Interpol
 	Particle->Location += Particle->Velocity * SpawnTime;
 
 	// 4. 플래그 설정 - 방금 생성된 파티클임을 표시
+	// 하위 카운터 비트에는 스폰 순서를 기록 (Age 정렬 키, SpawnParticles가 PostSpawn 이후에 ParticleCounter 증가)
 	Particle->Flags |= STATE_Particle_JustSpawned;
+	Particle->Flags |= static_cast<int32>(ParticleCounter & STATE_CounterMask);
 }
 
 void FParticleEmitterInstance::UpdateParticles(float DeltaTime)
 {
+	// 바운드는 이번 틱의 살아있는 파티클로 다시 계산 (Tick에서 UpdateParticles → SpawnParticles 순서)
+	ResetParticleBounds();
+
 	if (!CurrentLODLevel || ActiveParticles <= 0)
 	{
 		return;
@@ -670,7 +708,7 @@ void FParticleEmitterInstance::UpdateParticles(float DeltaTime)
 		}
 	}
 
-	// PHASE 3: 수명이 다한 파티클 제거 (역방향 순회)
+	// PHASE 3: 수명이 다한 파티클 제거 (역방향 순회), 살아남은 파티클은 바운드에 누적
 	for (int32 i = ActiveParticles - 1; i >= 0; i--)
 	{
 		FBaseParticle* Particle = GetParticleAtIndex(i);
@@ -684,6 +722,16 @@ void FParticleEmitterInstance::UpdateParticles(float DeltaTime)
 		{
 			KillParticle(i);
 		}
+		else
+		{
+			AccumulateParticleBounds(*Particle);
+		}
+	}
+
+	// 리본 트레일 링은 렌더 데이터를 빌드하지 않는 프레임(컬링/헤드리스)에도 죽은 항목을 비워야 계속 커지지 않음
+	if (bTrackTrail && FrameKilledCount > 0)
+	{
+		PruneTrailRing();
 	}
 }
 
@@ -712,6 +760,19 @@ void FParticleEmitterInstance::KillParticle(int32 Index)
 void FParticleEmitterInstance::KillAllParticles()
 {
 	ActiveParticles = 0;
+	SortedSlots.Empty();
+	TrailRing.Reset();
+	ResetParticleBounds();
+}
+
+void FParticleEmitterInstance::ResetParticleBounds()
+{
+	bHasParticleBounds = false;
+	MaxParticleSize = 0.0f;
+
+	// 템플릿이 고정 바운드를 쓰면 파티클별 누적 생략 (에디터에서 옵션을 바꿔도 다음 틱부터 반영)
+	const UParticleSystem* SystemTemplate = Component ? Component->Template : nullptr;
+	bComputeParticleBounds = !(SystemTemplate && SystemTemplate->bUseFixedRelativeBoundingBox);
 }
 
 FBaseParticle* FParticleEmitterInstance::GetParticleAtIndex(int32 Index)
@@ -812,11 +873,16 @@ bool FParticleEmitterInstance::BuildSpriteDynamicData(FDynamicSpriteEmitterData*
 		return false;
 	}
 
+	// 정렬하는 이미터는 지난 프레임 그리기 순서로 복사 (렌더 측 정렬이 증분으로 끝남)
+	const bool bSorted = CurrentLODLevel && CurrentLODLevel->RequiredModule && CurrentLODLevel->RequiredModule->SortMode != 0;
+	Data->Source.bCoherentOrder = GatherDrawOrder(Data->Source.ParticleSlots, bSorted);
+	Data->Source.SpawnCounter = ParticleCounter;
+
 	// 컴팩트 복사: 활성 파티클만 연속으로 복사 (sparse array → dense array)
 	uint8* DstData = Data->Source.DataContainer.ParticleData;
 	for (int32 i = 0; i < ActiveParticles; i++)
 	{
-		int32 SrcIndex = ParticleIndices[i];
+		int32 SrcIndex = Data->Source.ParticleSlots[i];
 		const uint8* SrcParticle = ParticleData + SrcIndex * ParticleStride;
 		memcpy(DstData + i * ParticleStride, SrcParticle, ParticleStride);
 
@@ -854,6 +920,96 @@ bool FParticleEmitterInstance::BuildSpriteDynamicData(FDynamicSpriteEmitterData*
 	return true;
 }
 
+bool FParticleEmitterInstance::GatherDrawOrder(TArray<uint16>& OutSlots, bool bReusePreviousOrder)
+{
+	OutSlots.SetNum(ActiveParticles);
+
+	if (!bReusePreviousOrder || SortedSlots.IsEmpty() || ActiveParticles <= 1)
+	{
+		for (int32 i = 0; i < ActiveParticles; i++)
+		{
+			OutSlots[i] = ParticleIndices[i];
+		}
+		return false;
+	}
+
+	// 1. 살아있는 슬롯 표시
+	MarkAliveSlots();
+
+	// 2. 지난 프레임 순서 중 살아있는 슬롯 (추가한 슬롯은 표시를 지워 중복 방지)
+	int32 Count = 0;
+	for (uint16 Slot : SortedSlots)
+	{
+		if (Slot < MaxActiveParticles && SlotStamps[Slot] == SlotStamp)
+		{
+			OutSlots[Count++] = Slot;
+			SlotStamps[Slot] = 0;
+		}
+	}
+
+	// 3. 이번에 새로 생긴 파티클 (ParticleIndices 순서 = 대체로 스폰 순서)
+	for (int32 i = 0; i < ActiveParticles; i++)
+	{
+		const uint16 Slot = ParticleIndices[i];
+		if (SlotStamps[Slot] == SlotStamp)
+		{
+			OutSlots[Count++] = Slot;
+		}
+	}
+
+	return true;
+}
+
+void FParticleEmitterInstance::MarkAliveSlots()
+{
+	if (SlotStamps.Num() < MaxActiveParticles)
+	{
+		SlotStamps.SetNum(MaxActiveParticles);
+	}
+
+	// 스탬프 0은 "표시 없음"으로 사용하므로 래핑 시 전체 초기화
+	if (++SlotStamp == 0)
+	{
+		std::fill(SlotStamps.begin(), SlotStamps.end(), 0u);
+		SlotStamp = 1;
+	}
+
+	for (int32 i = 0; i < ActiveParticles; i++)
+	{
+		SlotStamps[ParticleIndices[i]] = SlotStamp;
+	}
+}
+
+void FParticleEmitterInstance::PruneTrailRing()
+{
+	MarkAliveSlots();
+	TrailRing.RemoveDead([this](const FParticleTrailRing::FEntry& Entry)
+	{
+		if (Entry.Slot >= MaxActiveParticles || SlotStamps[Entry.Slot] != SlotStamp)
+		{
+			return false;
+		}
+		const FBaseParticle* Particle = reinterpret_cast<const FBaseParticle*>(ParticleData + Entry.Slot * ParticleStride);
+		return (static_cast<uint32>(Particle->Flags) & STATE_CounterMask) == (Entry.Counter & STATE_CounterMask);
+	});
+}
+
+void FParticleEmitterInstance::StoreDrawOrder(const FDynamicEmitterReplayDataBase& Source)
+{
+	// 정렬하지 않는 이미터, 또는 슬롯 매핑이 없는 렌더 데이터(메시/빔/리본)는 무시
+	const int32 Num = Source.ActiveParticleCount;
+	if (Source.SortMode == 0 || Source.ParticleSlots.Num() != Num || !Source.DataContainer.ParticleIndices)
+	{
+		return;
+	}
+
+	SortedSlots.SetNum(Num);
+	for (int32 i = 0; i < Num; i++)
+	{
+		SortedSlots[i] = Source.ParticleSlots[Source.DataContainer.ParticleIndices[i]];
+	}
+}
+
 bool FParticleEmitterInstance::BuildMeshDynamicData(FDynamicMeshEmitterData* Data, UParticleModuleTypeDataMesh* MeshType)
 {
 	if (!Data || !MeshType)
@@ -953,7 +1109,7 @@ bool FParticleEmitterInstance::BuildBeamDynamicData(FDynamicBeamEmitterData* Dat
 	else
 	{
 		// bUseTarget = true) 동적 타겟 사용 (파티클 / 액터 추적)
-		EndPos = Component->GetVectorParameter("BeamTarget", StartPos);
+		EndPos = Component->GetVectorParameter(BeamTargetParameter, StartPos);
 	}
 
 	FVector BeamDir = EndPos - StartPos;
@@ -977,10 +1133,14 @@ bool FParticleEmitterInstance::BuildBeamDynamicData(FDynamicBeamEmitterData* Dat
 
 		if (i > 0 && i < SegmentCount && NoiseStrength > KINDA_SMALL_NUMBER)
 		{
+			// 방향 XYZ + 변위 크기를 4-lane 한 번에 생성 (인자 평가 순서와 무관하게 항상 같은 순서)
+			float Noise[4];
+			RandomStream.GetFractions(Noise, 4);
+
 			FVector RandomDir = FVector(
-				RandomStream.GetRangeFloat(-1.0f, 1.0f),
-				RandomStream.GetRangeFloat(-1.0f, 1.0f),
-				RandomStream.GetRangeFloat(-1.0f, 1.0f)
+				2.0f * Noise[0] - 1.0f,
+				2.0f * Noise[1] - 1.0f,
+				2.0f * Noise[2] - 1.0f
 			);
 			RandomDir.Normalize();
 
@@ -996,13 +1156,15 @@ bool FParticleEmitterInstance::BuildBeamDynamicData(FDynamicBeamEmitterData* Dat
 			}
 			DisplacementDir.Normalize();
 
-			float DisplacementMagnitude = RandomStream.GetRangeFloat(0.0f, NoiseStrength);
+			float DisplacementMagnitude = Noise[3] * NoiseStrength;
 			P += DisplacementDir * DisplacementMagnitude;
 		}
 
 		Source.BeamPoints.Add(P);
 	}
 
+	Source.Strip.Build(Source.BeamPoints, Source.Width, false);
+
 	return true;
 }
 
@@ -1020,30 +1182,24 @@ bool FParticleEmitterInstance::BuildRibbonDynamicData(FDynamicRibbonEmitterData*
 		: nullptr;
 	Data->Source.Width = RibbonType->RibbonWidth;
 
-	// 파티클을 나이(RelativeTime)순으로 정렬하기 위해 인덱스 배열을 복사하고 정렬합니다.
-	// 오래된 파티클(RelativeTime이 큰 값)이 트레일의 앞쪽이 됩니다.
-	TArray<uint16> SortedIndices;
-	SortedIndices.Reserve(ActiveParticles);
-	for (int32 i = 0; i < ActiveParticles; ++i)
-	{
-		SortedIndices.Add(ParticleIndices[i]);
-	}
+	// 트레일 순서 = 스폰 순서 (링 버퍼에 스폰 시 추가됨). 오래된 파티클이 트레일의 앞쪽이 됩니다.
+	// 죽은 파티클(또는 재사용된 슬롯)만 걸러내면 되므로 정렬이 필요 없음
+	// (틱에서 이미 정리됐으면 남은 건 틱 밖에서 죽은 항목뿐)
+	PruneTrailRing();
 
-	std::sort(SortedIndices.begin(), SortedIndices.end(), [&](uint16 A, uint16 B) {
-		const FBaseParticle* ParticleA = reinterpret_cast<const FBaseParticle*>(ParticleData + A * ParticleStride);
-		const FBaseParticle* ParticleB = reinterpret_cast<const FBaseParticle*>(ParticleData + B * ParticleStride);
-		return ParticleA->RelativeTime > ParticleB->RelativeTime; // 내림차순 정렬 (오래된 것이 먼저)
-	});
+	const int32 NumPoints = TrailRing.Num();
+	if (NumPoints <= 1)
+		return false;
 
-	// 정렬된 순서대로 RibbonPoints와 RibbonColors 배열 채우기
+	// 트레일 순서대로 RibbonPoints와 RibbonColors 배열 채우기
 	Data->Source.RibbonPoints.Empty();
-	Data->Source.RibbonPoints.Reserve(ActiveParticles);
+	Data->Source.RibbonPoints.Reserve(NumPoints);
 	Data->Source.RibbonColors.Empty();
-	Data->Source.RibbonColors.Reserve(ActiveParticles);
+	Data->Source.RibbonColors.Reserve(NumPoints);
 
-	for (int32 i = 0; i < ActiveParticles; i++)
+	for (int32 i = 0; i < NumPoints; i++)
 	{
-		const FBaseParticle* P = reinterpret_cast<const FBaseParticle*>(ParticleData + SortedIndices[i] * ParticleStride);
+		const FBaseParticle* P = reinterpret_cast<const FBaseParticle*>(ParticleData + TrailRing[i].Slot * ParticleStride);
 
 		// 위치 추가
 		Data->Source.RibbonPoints.Add(P->Location);
@@ -1056,5 +1212,9 @@ bool FParticleEmitterInstance::BuildRibbonDynamicData(FDynamicRibbonEmitterData*
 		Data->Source.RibbonColors.Add(ParticleColor);
 	}
 
+	// 뷰와 무관한 테셀레이션 데이터는 여기서 한 번만 (뷰마다는 카메라 정렬 오프셋만 계산)
+	// 테이퍼링: 끝으로 갈수록 너비 감소 (오래된 파티클 V=0 → 폭 0, 새 파티클 V=1 → 폭 100%)
+	Data->Source.Strip.Build(Data->Source.RibbonPoints, Data->Source.Width, true);
+
 	return true;
 }
\ No newline at end of file
@@ -4,6 +4,10 @@
 #include "ParticleHelper.h"
 #include "ParticleEmitter.h"
 #include "ParticleRandomStream.h"
+#include "ParticleEventTypes.h"
+#include "ParticleParameterHandle.h"
+#include "ParticleSorter.h"
+#include "ParticleCollisionCache.h"
 
 class UParticleSystemComponent;
 class UParticleModuleTypeDataMesh;
@@ -60,6 +64,34 @@ struct FParticleEmitterInstance
 	// 랜덤 스트림 (언리얼 엔진 호환)
 	FParticleRandomStream RandomStream;
 
+	// 이 이미터가 틱 중에 생성한 이벤트 (병렬 틱 안전: 자기 버퍼에만 기록)
+	// 틱 이후 UParticleSystemComponent::GatherEmitterEvents()에서 병합 후 비워짐
+	FParticleEventBuffer EventBuffer;
+
+	// 파티클 위치 바운드 (월드 공간, UpdateParticles / SpawnParticles에서 누적)
+	// 크기 여유분은 타입(스프라이트/메시/리본)마다 달라서 UParticleSystemComponent::UpdateParticleBounds에서 더함
+	FVector ParticleBoundsMin;
+	FVector ParticleBoundsMax;
+	float MaxParticleSize;			// 살아있는 파티클 Size 성분 중 최댓값
+	bool bHasParticleBounds;
+	bool bComputeParticleBounds;	// 템플릿이 고정 바운드를 쓰면 false (누적 생략)
+
+	// 충돌 모듈의 광역 검사 결과 (이미터 단위로 프레임당 한 번 갱신)
+	FParticleCollisionCache CollisionCache;
+
+	// 정렬 일관성: 지난 프레임 그리기 순서 (파티클 데이터 슬롯 기준)
+	// 다음 프레임 컴팩트 복사를 이 순서로 하면 정렬이 삽입 정렬 한 번으로 끝남
+	TArray<uint16> SortedSlots;
+	TArray<uint32> SlotStamps;		// 슬롯별 방문 표시 (매 프레임 초기화 대신 스탬프 값 증가)
+	uint32 SlotStamp;
+
+	// 리본 트레일: 스폰 순서대로 슬롯을 쌓는 링 버퍼 (리본 타입일 때만 SpawnParticles에서 추가)
+	FParticleTrailRing TrailRing;
+	bool bTrackTrail;
+
+	// SetupEmitter()에서 해석한 컴포넌트 인스턴스 파라미터 핸들 (매 프레임 이름 조회 방지)
+	FParticleParameterHandle BeamTargetParameter;
+
 	// 언리얼 엔진 호환: 이미터 타이밍 상태
 	float EmitterTime;               // 이미터가 시작된 이후 경과 시간 (초)
 	float SecondsSinceCreation;      // 이미터 인스턴스 생성 이후 총 경과 시간 (루프에도 리셋 안됨)
@@ -114,6 +146,29 @@ struct FParticleEmitterInstance
 	// 인덱스의 파티클 가져오기
 	FBaseParticle* GetParticleAtIndex(int32 Index);
 
+	// 파티클 바운드 초기화 / 누적
+	void ResetParticleBounds();
+	void AccumulateParticleBounds(const FBaseParticle& Particle)
+	{
+		if (!bComputeParticleBounds)
+		{
+			return;
+		}
+
+		if (bHasParticleBounds)
+		{
+			ParticleBoundsMin = ParticleBoundsMin.ComponentMin(Particle.Location);
+			ParticleBoundsMax = ParticleBoundsMax.ComponentMax(Particle.Location);
+		}
+		else
+		{
+			ParticleBoundsMin = Particle.Location;
+			ParticleBoundsMax = Particle.Location;
+			bHasParticleBounds = true;
+		}
+		MaxParticleSize = FMath::Max(MaxParticleSize, FMath::Max(FMath::Abs(Particle.Size.X), FMath::Max(FMath::Abs(Particle.Size.Y), FMath::Abs(Particle.Size.Z))));
+	}
+
 	// 렌더링을 위한 동적 데이터 생성
 	FDynamicEmitterDataBase* GetDynamicData(bool bSelected);
 
@@ -122,6 +177,19 @@ struct FParticleEmitterInstance
 	bool BuildMeshDynamicData(FDynamicMeshEmitterData* Data, UParticleModuleTypeDataMesh* MeshType);
 	bool BuildBeamDynamicData(FDynamicBeamEmitterData* Data, UParticleModuleTypeDataBeam* BeamType);
 	bool BuildRibbonDynamicData(FDynamicRibbonEmitterData* Data, UParticleModuleTypeDataRibbon* RibbonType);
+
+	// 활성 파티클 슬롯을 그리기 순서로 수집: 지난 프레임 순서(SortedSlots) 중 살아있는 것 → 새 파티클
+	// 반환값: 지난 프레임 순서를 이어받았는지 (true면 증분 정렬 가능)
+	bool GatherDrawOrder(TArray<uint16>& OutSlots, bool bReusePreviousOrder);
+
+	// 렌더 데이터의 정렬 결과를 슬롯 순서로 저장 (UParticleSystemComponent::UpdateRenderData에서 호출)
+	void StoreDrawOrder(const FDynamicEmitterReplayDataBase& Source);
+
+	// 살아있는 슬롯에 이번 스탬프 표시 (SlotStamps[Slot] == SlotStamp이면 살아있음)
+	void MarkAliveSlots();
+
+	// TrailRing에서 죽었거나 재사용된 슬롯 항목 제거 (스폰 순서 유지, UpdateParticles / BuildRibbonDynamicData에서 호출)
+	void PruneTrailRing();
 };
 
 // 언리얼 엔진 호환: 인덱스로 파티클을 가져오는 헬퍼 함수 구현
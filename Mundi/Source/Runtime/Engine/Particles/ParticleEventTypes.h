@@ -27,6 +27,15 @@ enum class EParticleCollisionComplete : uint8
 	Kill             // 파티클 제거
 };
 
+// 파티클 충돌 대상
+UENUM(DisplayName="충돌 대상")
+enum class EParticleCollisionMode : uint8
+{
+	Scene,          // BVH의 ShapeComponent / StaticMeshComponent (이미터 단위 광역 검사 + 파티클 단위 정밀 검사)
+	Plane,          // 해석적 평면만 (BVH 쿼리 없음, 가장 저렴)
+	SceneAndPlane   // 둘 다
+};
+
 // 기본 파티클 이벤트 데이터 (언리얼 엔진 호환)
 struct FParticleEventData
 {
@@ -75,3 +84,30 @@ struct FParticleEvent
 	FParticleEvent(EParticleEventType InType, const FString& InName)
 		: Type(InType), EventName(InName) {}
 };
+
+// 이미터 틱 동안 발생한 이벤트 버퍼 (이미터 인스턴스별 소유)
+// 병렬 틱 중에는 각 이미터가 자기 버퍼에만 기록하고,
+// 틱이 끝난 뒤 컴포넌트가 이미터 순서대로 병합하여 결정적인 순서를 보장
+struct FParticleEventBuffer
+{
+	TArray<FParticleEventCollideData> CollisionEvents;
+	TArray<FParticleEventData> SpawnEvents;
+	TArray<FParticleEventData> DeathEvents;
+
+	void AddCollisionEvent(const FParticleEventCollideData& Event) { CollisionEvents.Add(Event); }
+	void AddSpawnEvent(const FParticleEventData& Event) { SpawnEvents.Add(Event); }
+	void AddDeathEvent(const FParticleEventData& Event) { DeathEvents.Add(Event); }
+
+	bool IsEmpty() const
+	{
+		return CollisionEvents.IsEmpty() && SpawnEvents.IsEmpty() && DeathEvents.IsEmpty();
+	}
+
+	// 용량은 유지한 채 비움 (매 프레임 재할당 방지)
+	void Reset()
+	{
+		CollisionEvents.Empty();
+		SpawnEvents.Empty();
+		DeathEvents.Empty();
+	}
+};
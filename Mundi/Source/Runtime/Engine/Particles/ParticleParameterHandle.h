@@ -0,0 +1,13 @@
+#pragma once
+
+// 파티클 인스턴스 파라미터 핸들
+// UParticleSystemComponent::FindOrAddParameter()로 이름(FName)을 한 번 해석해 두면
+// 이후 Get/Set은 파라미터 배열 인덱싱(O(1))으로 처리됩니다.
+// 컴포넌트의 파라미터 배열은 추가만 되므로, 해석한 컴포넌트에 대해서는 핸들이 계속 유효합니다.
+struct FParticleParameterHandle
+{
+	int32 Index = -1;
+
+	bool IsValid() const { return Index >= 0; }
+	void Invalidate() { Index = -1; }
+};
@@ -1,35 +1,90 @@
 #pragma once
 
 #include "Vector.h"
-#include <random>
+#include <emmintrin.h>
 
 // 언리얼 엔진 호환: 결정론적 랜덤 시스템
 // 파티클 시스템에서 재현 가능한 랜덤 결과를 제공
+//
+// 카운터 기반 생성기 (Philox2x32-10):
+// - 상태는 (Seed, StreamIndex, DrawIndex) 세 값뿐이며, 출력은 Philox(Key = Seed, Counter = {DrawIndex, StreamIndex})
+// - 이전 값에 의존하지 않으므로 임의 접근(GetFractionAt)과 배치 생성(GetFractions, SSE2 4-lane)이 가능
+// - StreamIndex 0은 이미터 단위 랜덤, StreamIndex = ParticleCounter + 1은 파티클 단위 랜덤 (BeginParticle/EndParticle)
+//   파티클별 결과가 스폰 순서/스레드 수와 무관하게 (이미터 시드, 파티클 카운터)만으로 결정됨
 class FParticleRandomStream
 {
 public:
 	FParticleRandomStream()
-		: Generator(0)
-		, Distribution(0.0f, 1.0f)
+		: Seed(0)
 	{
 	}
 
-	explicit FParticleRandomStream(int32 Seed)
-		: Generator(Seed)
-		, Distribution(0.0f, 1.0f)
+	explicit FParticleRandomStream(int32 InSeed)
+		: Seed(static_cast<uint32>(InSeed))
 	{
 	}
 
 	// 시드 설정 (결정론적 시뮬레이션)
-	void Initialize(int32 Seed)
+	void Initialize(int32 InSeed)
 	{
-		Generator.seed(Seed);
+		Seed = static_cast<uint32>(InSeed);
+		StreamIndex = 0;
+		DrawIndex = 0;
+		SavedDrawIndex = 0;
 	}
 
 	// 0.0 ~ 1.0 범위 float 생성
 	float GetFraction()
 	{
-		return Distribution(Generator);
+		return ToFraction(Philox(DrawIndex++, StreamIndex, Seed));
+	}
+
+	// GetFraction()을 Count번 호출한 것과 동일한 값을 한 번에 생성
+	void GetFractions(float* OutValues, int32 Count)
+	{
+		int32 Index = 0;
+
+		// DrawIndex가 4-lane 안에서 래핑되지 않는 구간만 SIMD로 처리
+		const __m128 Scale = _mm_set1_ps(1.0f / 16777216.0f);
+		while (Index + 4 <= Count && DrawIndex <= 0xFFFFFFFCu)
+		{
+			const __m128i Result = Philox4Lanes(DrawIndex, StreamIndex, Seed);
+			_mm_storeu_ps(OutValues + Index, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(Result, 8)), Scale));
+			DrawIndex += 4;
+			Index += 4;
+		}
+
+		for (; Index < Count; ++Index)
+		{
+			OutValues[Index] = GetFraction();
+		}
+	}
+
+	// 임의 접근: 상태를 바꾸지 않고 (InStreamIndex, InDrawIndex) 위치의 값을 반환
+	float GetFractionAt(uint32 InStreamIndex, uint32 InDrawIndex) const
+	{
+		return ToFraction(Philox(InDrawIndex, InStreamIndex, Seed));
+	}
+
+	// 파티클 InParticleCounter가 스폰 시 InDrawIndex번째로 뽑은 값 (BeginParticle 구간과 동일한 값)
+	float GetParticleFraction(uint32 InParticleCounter, uint32 InDrawIndex) const
+	{
+		return GetFractionAt(InParticleCounter + 1, InDrawIndex);
+	}
+
+	// 파티클 단위 스트림으로 전환 (스폰 모듈 실행 전 호출)
+	void BeginParticle(uint32 InParticleCounter)
+	{
+		SavedDrawIndex = DrawIndex;
+		StreamIndex = InParticleCounter + 1;
+		DrawIndex = 0;
+	}
+
+	// 이미터 단위 스트림으로 복귀
+	void EndParticle()
+	{
+		StreamIndex = 0;
+		DrawIndex = SavedDrawIndex;
 	}
 
 	// Min ~ Max 범위 float 생성
@@ -38,14 +93,24 @@ public:
 		return Min + (Max - Min) * GetFraction();
 	}
 
+	// 0.0 ~ 1.0 범위 FVector 생성 (X, Y, Z 순서로 뽑음 - 생성자 인자 평가 순서에 의존하지 않음)
+	// 3개는 SIMD 배치(4개 단위)에 못 미치므로 스칼라로 생성. 4개 이상 필요하면 GetFractions로 한 번에 뽑을 것
+	FVector GetFractionVector()
+	{
+		const float X = GetFraction();
+		const float Y = GetFraction();
+		const float Z = GetFraction();
+		return FVector(X, Y, Z);
+	}
+
 	// FVector 랜덤 생성 (각 축별로 Min ~ Max 범위)
 	FVector GetRangeVector(const FVector& Min, const FVector& Max)
 	{
+		const FVector Fractions = GetFractionVector();
 		return FVector(
-			GetRangeFloat(Min.X, Max.X),
-			GetRangeFloat(Min.Y, Max.Y),
-			GetRangeFloat(Min.Z, Max.Z)
-		);
+			Min.X + (Max.X - Min.X) * Fractions.X,
+			Min.Y + (Max.Y - Min.Y) * Fractions.Y,
+			Min.Z + (Max.Z - Min.Z) * Fractions.Z);
 	}
 
 	// 균등 분포 단위 벡터 생성 (구 표면)
@@ -69,7 +134,62 @@ public:
 		return 2.0f * GetFraction() - 1.0f;
 	}
 
+	uint32 GetSeed() const { return Seed; }
+
 private:
-	std::mt19937 Generator;
-	std::uniform_real_distribution<float> Distribution;
+	static constexpr uint32 PhiloxMultiplier = 0xD256D193u;
+	static constexpr uint32 PhiloxWeyl = 0x9E3779B9u;
+	static constexpr int32 PhiloxRounds = 10;
+
+	// 상위 24비트 → [0, 1) (1.0이 나오지 않음)
+	static float ToFraction(uint32 Bits)
+	{
+		return static_cast<float>(Bits >> 8) * (1.0f / 16777216.0f);
+	}
+
+	// Philox2x32-10, 첫 번째 출력 워드만 사용
+	static uint32 Philox(uint32 Counter0, uint32 Counter1, uint32 Key)
+	{
+		for (int32 Round = 0; Round < PhiloxRounds; ++Round)
+		{
+			const uint64 Product = static_cast<uint64>(PhiloxMultiplier) * Counter0;
+			const uint32 Hi = static_cast<uint32>(Product >> 32);
+			const uint32 Lo = static_cast<uint32>(Product);
+			Counter0 = Hi ^ Key ^ Counter1;
+			Counter1 = Lo;
+			Key += PhiloxWeyl;
+		}
+		return Counter0;
+	}
+
+	// Philox2x32-10 4-lane (Counter0 = BaseCounter0 + {0, 1, 2, 3})
+	static __m128i Philox4Lanes(uint32 BaseCounter0, uint32 Counter1, uint32 Key)
+	{
+		const __m128i Multiplier = _mm_set1_epi32(static_cast<int32>(PhiloxMultiplier));
+		__m128i C0 = _mm_add_epi32(_mm_set1_epi32(static_cast<int32>(BaseCounter0)), _mm_set_epi32(3, 2, 1, 0));
+		__m128i C1 = _mm_set1_epi32(static_cast<int32>(Counter1));
+
+		for (int32 Round = 0; Round < PhiloxRounds; ++Round)
+		{
+			// 32x32 → 64 곱셈: 짝수 lane / 홀수 lane을 따로 계산 후 Hi, Lo를 원래 lane 순서로 재배치
+			const __m128i EvenProduct = _mm_mul_epu32(C0, Multiplier);
+			const __m128i OddProduct = _mm_mul_epu32(_mm_srli_epi64(C0, 32), Multiplier);
+			const __m128i Lo = _mm_unpacklo_epi32(
+				_mm_shuffle_epi32(EvenProduct, _MM_SHUFFLE(0, 0, 2, 0)),
+				_mm_shuffle_epi32(OddProduct, _MM_SHUFFLE(0, 0, 2, 0)));
+			const __m128i Hi = _mm_unpacklo_epi32(
+				_mm_shuffle_epi32(EvenProduct, _MM_SHUFFLE(0, 0, 3, 1)),
+				_mm_shuffle_epi32(OddProduct, _MM_SHUFFLE(0, 0, 3, 1)));
+
+			C0 = _mm_xor_si128(_mm_xor_si128(Hi, _mm_set1_epi32(static_cast<int32>(Key))), C1);
+			C1 = Lo;
+			Key += PhiloxWeyl;
+		}
+		return C0;
+	}
+
+	uint32 Seed = 0;
+	uint32 StreamIndex = 0;		// 0 = 이미터, ParticleCounter + 1 = 파티클
+	uint32 DrawIndex = 0;
+	uint32 SavedDrawIndex = 0;	// BeginParticle 동안 보관한 이미터 스트림 위치
 };
@@ -0,0 +1,151 @@
+#include "pch.h"
+#include "ParticleSorter.h"
+#include "ParticleDefinitions.h"
+
+uint32 FParticleSorter::MakeAgeKey(int32 ParticleFlags, uint32 SpawnCounter)
+{
+	// 가장 최근에 스폰된 파티클과의 카운터 차이 = 스폰 순서 기준 나이 (0 = 가장 새 파티클)
+	const uint32 Counter = static_cast<uint32>(ParticleFlags) & STATE_CounterMask;
+	const uint32 Age = (SpawnCounter - 1u - Counter) & STATE_CounterMask;
+
+	// 오래된 것부터 그리도록 반전
+	return STATE_CounterMask - Age;
+}
+
+uint32* FParticleSorter::GetKeyBuffer(int32 Num)
+{
+	if (KeyBuffer.Num() < Num)
+	{
+		KeyBuffer.SetNum(Num);
+	}
+	return KeyBuffer.GetData();
+}
+
+void FParticleSorter::SortIndices(uint16* Indices, int32 Num, const uint32* Keys, bool bCoherent)
+{
+	bLastSortIncremental = false;
+	LastInsertionMoves = 0;
+
+	if (!Indices || !Keys || Num <= 1)
+	{
+		return;
+	}
+
+	// 1. 증분: 지난 프레임 순서에서 출발하는 삽입 정렬
+	if (bCoherent)
+	{
+		if (InsertionSort(Indices, Num, Keys, Num * CoherentMoveBudget))
+		{
+			bLastSortIncremental = true;
+			return;
+		}
+	}
+
+	// 2. 전체 정렬
+	if (Num >= RadixSortThreshold)
+	{
+		RadixSort(Indices, Num, Keys);
+	}
+	else
+	{
+		// 키가 같으면 입력 순서 유지 (기수 / 삽입 정렬 경로와 같은 결과)
+		std::stable_sort(Indices, Indices + Num, [Keys](uint16 A, uint16 B)
+		{
+			return Keys[A] < Keys[B];
+		});
+	}
+}
+
+bool FParticleSorter::InsertionSort(uint16* Indices, int32 Num, const uint32* Keys, int32 MaxMoves)
+{
+	int32 Moves = 0;
+	for (int32 i = 1; i < Num; ++i)
+	{
+		const uint16 Current = Indices[i];
+		const uint32 CurrentKey = Keys[Current];
+
+		int32 j = i - 1;
+		while (j >= 0 && Keys[Indices[j]] > CurrentKey)
+		{
+			Indices[j + 1] = Indices[j];
+			--j;
+			++Moves;
+		}
+		Indices[j + 1] = Current;
+
+		if (Moves > MaxMoves)
+		{
+			LastInsertionMoves = Moves;
+			return false;
+		}
+	}
+
+	LastInsertionMoves = Moves;
+	return true;
+}
+
+void FParticleSorter::RadixSort(uint16* Indices, int32 Num, const uint32* Keys)
+{
+	constexpr int32 NumPasses = 3;
+	constexpr int32 RadixBits = 11;
+	constexpr int32 NumBuckets = 1 << RadixBits;
+	constexpr uint32 RadixMask = NumBuckets - 1;
+
+	RadixKeys[0].SetNum(Num);
+	RadixKeys[1].SetNum(Num);
+	RadixIndices.SetNum(Num);
+
+	// 키를 인덱스 순서대로 모으면서 세 패스의 히스토그램을 한 번에 계산
+	uint32 Histogram[NumPasses][NumBuckets] = {};
+	uint32* SrcKeys = RadixKeys[0].GetData();
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const uint32 Key = Keys[Indices[i]];
+		SrcKeys[i] = Key;
+		++Histogram[0][Key & RadixMask];
+		++Histogram[1][(Key >> RadixBits) & RadixMask];
+		++Histogram[2][Key >> (RadixBits * 2)];
+	}
+
+	uint32* DstKeys = RadixKeys[1].GetData();
+	uint16* SrcIndices = Indices;
+	uint16* DstIndices = RadixIndices.GetData();
+
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		const int32 Shift = Pass * RadixBits;
+		uint32* Counts = Histogram[Pass];
+
+		// 모든 키가 한 버킷이면 이 자릿수는 순서를 바꾸지 않음
+		if (Counts[(SrcKeys[0] >> Shift) & RadixMask] == static_cast<uint32>(Num))
+		{
+			continue;
+		}
+
+		// 누적 합 → 버킷 시작 위치
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+		{
+			const uint32 Count = Counts[Bucket];
+			Counts[Bucket] = Offset;
+			Offset += Count;
+		}
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const uint32 Key = SrcKeys[i];
+			const uint32 Dst = Counts[(Key >> Shift) & RadixMask]++;
+			DstKeys[Dst] = Key;
+			DstIndices[Dst] = SrcIndices[i];
+		}
+
+		std::swap(SrcKeys, DstKeys);
+		std::swap(SrcIndices, DstIndices);
+	}
+
+	// 결과가 임시 버퍼에 있으면 되돌려 씀
+	if (SrcIndices != Indices)
+	{
+		memcpy(Indices, SrcIndices, Num * sizeof(uint16));
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "UEContainer.h"
+
+/**
+ * FParticleSorter
+ * 스프라이트/리본 파티클 정렬 유틸리티입니다.
+ *
+ * - 정렬 키는 파티클당 한 번만 계산한 uint32 (비교 함수에서 내적/역참조를 반복하지 않음)
+ *   그리기 순서 = 키 오름차순. Depth는 FloatToSortKey(-Depth), Age는 MakeAgeKey()
+ * - 개수가 RadixSortThreshold 이상이면 LSD 기수 정렬 (11/11/10비트 3패스, 한 버킷에 몰린 패스는 생략)
+ * - 증분 모드(bCoherent): 입력 순서가 지난 프레임 정렬 결과를 이어받은 경우 삽입 정렬 한 번으로 마무리
+ *   프레임 간 순서가 거의 바뀌지 않으므로 O(N)에 가깝고, 이동 횟수가 한도를 넘으면(카메라 급회전 등) 기수 정렬로 전환
+ * - 모든 경로가 안정 정렬이므로 키가 같은 파티클의 순서가 프레임마다 뒤바뀌지 않음 (깜빡임 방지)
+ */
+class FParticleSorter
+{
+public:
+	// 이 개수 이상이면 std::stable_sort 대신 기수 정렬
+	static constexpr int32 RadixSortThreshold = 256;
+
+	// 증분 삽입 정렬이 허용하는 최대 이동 횟수 = Num * CoherentMoveBudget
+	static constexpr int32 CoherentMoveBudget = 8;
+
+	// float → 대소 관계가 보존되는 uint32 (음수는 전체 비트 반전, 양수는 부호 비트만 반전)
+	static uint32 FloatToSortKey(float Value)
+	{
+		uint32 Bits;
+		memcpy(&Bits, &Value, sizeof(uint32));
+		return Bits ^ ((Bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u);
+	}
+
+	// 스폰 카운터 기반 Age 키 (오래된 것이 작은 키)
+	// ParticleFlags: FBaseParticle::Flags (하위 비트에 스폰 시점의 ParticleCounter 저장)
+	// SpawnCounter: 이미터의 현재 ParticleCounter (카운터 마스크 범위를 넘어 래핑되어도 순서 유지)
+	static uint32 MakeAgeKey(int32 ParticleFlags, uint32 SpawnCounter);
+
+	// 정렬 키 버퍼 (Num개, 파티클 인덱스로 접근). 호출자가 채운 뒤 SortIndices에 넘김
+	uint32* GetKeyBuffer(int32 Num);
+
+	// Indices[0, Num)을 Keys[Indices[i]] 오름차순으로 안정 정렬
+	void SortIndices(uint16* Indices, int32 Num, const uint32* Keys, bool bCoherent);
+
+	// 통계 (마지막 SortIndices 기준)
+	bool WasLastSortIncremental() const { return bLastSortIncremental; }
+	int32 GetLastInsertionMoves() const { return LastInsertionMoves; }
+
+private:
+	// MaxMoves를 넘으면 중단하고 false 반환 (Indices는 여전히 유효한 순열)
+	bool InsertionSort(uint16* Indices, int32 Num, const uint32* Keys, int32 MaxMoves);
+	void RadixSort(uint16* Indices, int32 Num, const uint32* Keys);
+
+	// 재사용 버퍼 (매 프레임 할당 방지)
+	TArray<uint32> KeyBuffer;
+	TArray<uint32> RadixKeys[2];
+	TArray<uint16> RadixIndices;
+
+	bool bLastSortIncremental = false;
+	int32 LastInsertionMoves = 0;
+};
@@ -5,7 +5,8 @@
 // 파티클 시스템 통계 데이터
 struct FParticleStats
 {
-    int32 ParticleSystemCount = 0;  // 파티클 시스템 수
+    int32 ParticleSystemCount = 0;  // 파티클 시스템 수 (절두체 컬링 통과)
+    int32 CulledSystemCount = 0;    // 바운드가 절두체 밖이라 제외된 파티클 시스템 수
     int32 EmitterCount = 0;          // 이미터 수
 
     // 타입별 파티클 카운트
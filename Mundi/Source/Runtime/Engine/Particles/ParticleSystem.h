@@ -30,6 +30,39 @@ public:
 	UPROPERTY(EditAnywhere, Category = "LOD")
 	TArray<float> LODDistances;
 
+	//=============================================================================
+	// 워밍업 (언리얼 엔진 호환)
+	// 활성화 직후 WarmupTime만큼 고정 스텝으로 미리 시뮬레이션 (연기/폭포처럼 항상 차 있어야 하는 루프 이펙트용)
+	//=============================================================================
+
+	// 미리 시뮬레이션할 시간 (초, 0 = 워밍업 없음)
+	UPROPERTY(EditAnywhere, Category = "Warmup", meta=(ClampMin="0.0", ToolTip="활성화 시 미리 시뮬레이션할 시간 (초)"))
+	float WarmupTime = 0.0f;
+
+	// 워밍업 한 스텝의 시간 (초, 0 = 1/30초). 크게 할수록 빠르고 부정확
+	UPROPERTY(EditAnywhere, Category = "Warmup", meta=(ClampMin="0.0", ToolTip="워밍업 스텝 시간 (0 = 1/30초)"))
+	float WarmupTickRate = 0.0f;
+
+	// 프레임당 최대 워밍업 스텝 수 (남은 스텝은 다음 프레임에 이어서 진행, 프레임 멈춤 방지)
+	UPROPERTY(EditAnywhere, Category = "Warmup", meta=(ClampMin="1", ToolTip="프레임당 최대 워밍업 스텝 수"))
+	int32 MaxWarmupStepsPerFrame = 30;
+
+	//=============================================================================
+	// 바운드 설정 (렌더러 절두체 컬링용)
+	// 기본은 매 틱 파티클 위치로 동적 계산, 고정 바운드를 쓰면 파티클 순회 없이 컴포넌트 트랜스폼만 적용
+	//=============================================================================
+
+	// 고정 바운드 사용 여부 (파티클이 많은 시스템에서 바운드 계산 비용 제거)
+	UPROPERTY(EditAnywhere, Category = "Bounds")
+	bool bUseFixedRelativeBoundingBox = false;
+
+	// 컴포넌트 로컬 공간 기준 고정 바운드
+	UPROPERTY(EditAnywhere, Category = "Bounds")
+	FVector FixedRelativeBoundsMin = FVector(-100.0f, -100.0f, -100.0f);
+
+	UPROPERTY(EditAnywhere, Category = "Bounds")
+	FVector FixedRelativeBoundsMax = FVector(100.0f, 100.0f, 100.0f);
+
 	UParticleSystem() = default;
 	virtual ~UParticleSystem();
 
@@ -0,0 +1,113 @@
+#include "pch.h"
+#include "ParticleTickManager.h"
+#include "ParticleSystemComponent.h"
+#include "ParticleEmitterInstance.h"
+#include "TaskSystem.h"
+
+void FParticleTickManager::BeginCollect()
+{
+	QueuedTicks.Empty();
+	QueuedIndexMap.Empty();
+	bCollecting = true;
+}
+
+void FParticleTickManager::QueueComponent(UParticleSystemComponent* Component, float DeltaTime)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	// 같은 이미터가 한 프레임에 두 번 병렬 틱되면 데이터 레이스이므로 중복 예약 방지
+	if (int32* ExistingIndex = QueuedIndexMap.Find(Component))
+	{
+		QueuedTicks[*ExistingIndex].DeltaTime = DeltaTime;
+		return;
+	}
+
+	FQueuedTick Queued;
+	Queued.Component = Component;
+	Queued.DeltaTime = DeltaTime;
+	QueuedIndexMap.Add(Component, QueuedTicks.Add(Queued));
+}
+
+void FParticleTickManager::RemoveComponent(UParticleSystemComponent* Component)
+{
+	// Flush 순회 중일 수 있으므로 배열에서 지우지 않고 비워둠
+	if (int32* ExistingIndex = QueuedIndexMap.Find(Component))
+	{
+		QueuedTicks[*ExistingIndex].Component = nullptr;
+		QueuedIndexMap.Remove(Component);
+	}
+}
+
+void FParticleTickManager::Flush()
+{
+	bCollecting = false;
+
+	FMemoryTagScope TagScope(EMemoryTag::Particles);
+
+	ParallelJobs.Empty();
+	SerialTickIndices.Empty();
+
+	// 1. 잡 리스트 구성 (예약 순서 유지)
+	for (int32 i = 0; i < QueuedTicks.Num(); ++i)
+	{
+		UParticleSystemComponent* Component = QueuedTicks[i].Component;
+		if (!Component || Component->IsPendingDestroy())
+		{
+			continue;
+		}
+
+		if (!Component->CanTickEmittersInParallel())
+		{
+			SerialTickIndices.Add(i);
+			continue;
+		}
+
+		for (FParticleEmitterInstance* Instance : Component->EmitterInstances)
+		{
+			if (Instance)
+			{
+				FEmitterJob Job;
+				Job.Component = Component;
+				Job.Instance = Instance;
+				Job.DeltaTime = QueuedTicks[i].DeltaTime;
+				ParallelJobs.Add(Job);
+			}
+		}
+	}
+
+	LastParallelEmitterCount = ParallelJobs.Num();
+	LastSerialComponentCount = SerialTickIndices.Num();
+
+	// 2. 병렬 시뮬레이션 (이미터 간 공유 쓰기 없음, 이벤트는 이미터별 버퍼에 기록)
+	FTaskSystem::GetInstance().ParallelFor(ParallelJobs.Num(), [this](int32 Index)
+	{
+		const FEmitterJob& Job = ParallelJobs[Index];
+		Job.Component->TickEmitterInstance(*Job.Instance, Job.DeltaTime);
+	});
+
+	// 3. 병렬 불가 컴포넌트는 게임 스레드에서 이미터 순서대로
+	for (int32 QueuedIndex : SerialTickIndices)
+	{
+		if (UParticleSystemComponent* Component = QueuedTicks[QueuedIndex].Component)
+		{
+			Component->TickEmitters(QueuedTicks[QueuedIndex].DeltaTime);
+		}
+	}
+
+	// 4. 후처리 (예약 순서대로 - 이벤트 병합/디스패치 순서를 결정적으로 유지)
+	// 이벤트 핸들러가 컴포넌트를 파괴할 수 있으므로 매번 포인터를 다시 읽음
+	for (int32 i = 0; i < QueuedTicks.Num(); ++i)
+	{
+		UParticleSystemComponent* Component = QueuedTicks[i].Component;
+		if (Component && !Component->IsPendingDestroy())
+		{
+			Component->FinishEmitterTick();
+		}
+	}
+
+	QueuedTicks.Empty();
+	QueuedIndexMap.Empty();
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "UEContainer.h"
+
+class UParticleSystemComponent;
+struct FParticleEmitterInstance;
+
+/**
+ * FParticleTickManager
+ * 월드 단위로 파티클 이미터 시뮬레이션을 모아서 병렬로 처리하는 매니저입니다.
+ *
+ * 흐름 (UWorld::Tick):
+ * 1. BeginCollect(): 액터 틱 시작 전 호출. 이후 UParticleSystemComponent::TickComponent는
+ *    시뮬레이션을 바로 하지 않고 QueueComponent()로 예약만 합니다.
+ * 2. Flush(): 액터 틱이 끝난 뒤 호출.
+ *    - 예약된 모든 컴포넌트의 이미터를 하나의 잡 리스트로 평탄화하여 FTaskSystem에서 병렬 틱
+ *      (각 이미터는 자기 FParticleEventBuffer에만 이벤트를 기록)
+ *      워밍업 중인 컴포넌트는 이미터 잡 안에서 이번 프레임 몫의 고정 스텝을 반복 (워밍업도 워커 스레드에서 진행)
+ *    - 병렬 틱이 불가능한 모듈(SupportsParallelTick() == false)을 가진 컴포넌트는 게임 스레드에서 순차 틱
+ *    - 예약 순서대로 FinishEmitterTick() 호출 (이벤트 병합 → 렌더 데이터 → 이벤트 디스패치/브로드캐스트)
+ *      병합과 디스패치가 항상 같은 순서로 수행되므로 결과가 스레드 스케줄링과 무관하게 결정적입니다.
+ */
+class FParticleTickManager
+{
+public:
+	FParticleTickManager() = default;
+	~FParticleTickManager() = default;
+
+	// 액터 틱 시작 전: 이후의 파티클 틱을 예약 모드로 전환
+	void BeginCollect();
+
+	// 예약 모드인지 (false면 컴포넌트가 즉시 시뮬레이션)
+	bool IsCollecting() const { return bCollecting; }
+
+	// 컴포넌트 이미터 틱 예약 (같은 프레임에 중복 예약 시 DeltaTime만 갱신)
+	void QueueComponent(UParticleSystemComponent* Component, float DeltaTime);
+
+	// 컴포넌트 등록 해제/파괴 시 예약 취소 (Flush 중에 호출되어도 안전)
+	void RemoveComponent(UParticleSystemComponent* Component);
+
+	// 예약된 모든 이미터를 병렬 시뮬레이션하고 후처리
+	void Flush();
+
+	// 통계 (마지막 Flush 기준)
+	int32 GetLastParallelEmitterCount() const { return LastParallelEmitterCount; }
+	int32 GetLastSerialComponentCount() const { return LastSerialComponentCount; }
+
+private:
+	struct FQueuedTick
+	{
+		UParticleSystemComponent* Component = nullptr;
+		float DeltaTime = 0.0f;
+	};
+
+	struct FEmitterJob
+	{
+		UParticleSystemComponent* Component = nullptr;	// 워밍업 스텝 수 등 이번 프레임 틱 방식을 결정
+		FParticleEmitterInstance* Instance = nullptr;
+		float DeltaTime = 0.0f;
+	};
+
+	TArray<FQueuedTick> QueuedTicks;
+	TMap<UParticleSystemComponent*, int32> QueuedIndexMap;	// 컴포넌트 → QueuedTicks 인덱스
+
+	// 매 프레임 재사용 (할당 방지)
+	TArray<FEmitterJob> ParallelJobs;
+	TArray<int32> SerialTickIndices;
+
+	bool bCollecting = false;
+
+	int32 LastParallelEmitterCount = 0;
+	int32 LastSerialComponentCount = 0;
+};
@@ -0,0 +1,111 @@
+#include "pch.h"
+#include "ParticleTrail.h"
+#include <xmmintrin.h>
+
+void FParticleTrailRing::Push(uint16 Slot, uint32 Counter)
+{
+	// 가득 차면 두 배로 늘리면서 꼬리부터 순서대로 펼침
+	if (Count == Entries.Num())
+	{
+		const int32 NewCapacity = FMath::Max(16, Entries.Num() * 2);
+		TArray<FEntry> NewEntries;
+		NewEntries.SetNum(NewCapacity);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			NewEntries[i] = Entries[(Tail + i) & Mask];
+		}
+
+		Entries = std::move(NewEntries);
+		Tail = 0;
+		Mask = NewCapacity - 1;
+	}
+
+	FEntry& Entry = Entries[(Tail + Count) & Mask];
+	Entry.Slot = Slot;
+	Entry.Counter = Counter;
+	++Count;
+}
+
+void FParticleTrailStrip::Build(const TArray<FVector>& Points, float Width, bool bTaper)
+{
+	const int32 NumPoints = Points.Num();
+	TangentX.SetNum(NumPoints);
+	TangentY.SetNum(NumPoints);
+	TangentZ.SetNum(NumPoints);
+	HalfWidth.SetNum(NumPoints);
+	V.SetNum(NumPoints);
+
+	if (NumPoints < 2)
+	{
+		return;
+	}
+
+	const float InvLastIndex = 1.0f / static_cast<float>(NumPoints - 1);
+	for (int32 i = 0; i < NumPoints; ++i)
+	{
+		// 다음 포인트 방향 (마지막 포인트는 이전 세그먼트 방향)
+		FVector SegmentDir = (i < NumPoints - 1) ? (Points[i + 1] - Points[i]) : (Points[i] - Points[i - 1]);
+		const float Length = SegmentDir.Size();
+		if (Length > KINDA_SMALL_NUMBER)
+		{
+			SegmentDir = SegmentDir * (1.0f / Length);
+		}
+		else
+		{
+			SegmentDir = FVector(0.0f, 0.0f, 0.0f);
+		}
+
+		const float PointV = static_cast<float>(i) * InvLastIndex;
+		TangentX[i] = SegmentDir.X;
+		TangentY[i] = SegmentDir.Y;
+		TangentZ[i] = SegmentDir.Z;
+		V[i] = PointV;
+		HalfWidth[i] = Width * 0.5f * (bTaper ? PointV : 1.0f);
+	}
+}
+
+void FParticleTrailStrip::ComputeOffsets(const FVector& ViewDirection, float* OutX, float* OutY, float* OutZ) const
+{
+	const int32 NumPoints = Num();
+	int32 i = 0;
+
+	// 4개씩: Up = Cross(T, D), Offset = Up / |Up| * HalfWidth (|Up|이 0이면 오프셋 0)
+	const __m128 DX = _mm_set1_ps(ViewDirection.X);
+	const __m128 DY = _mm_set1_ps(ViewDirection.Y);
+	const __m128 DZ = _mm_set1_ps(ViewDirection.Z);
+	const __m128 Epsilon = _mm_set1_ps(KINDA_SMALL_NUMBER * KINDA_SMALL_NUMBER);
+
+	for (; i + 4 <= NumPoints; i += 4)
+	{
+		const __m128 TX = _mm_loadu_ps(TangentX.GetData() + i);
+		const __m128 TY = _mm_loadu_ps(TangentY.GetData() + i);
+		const __m128 TZ = _mm_loadu_ps(TangentZ.GetData() + i);
+
+		const __m128 UX = _mm_sub_ps(_mm_mul_ps(TY, DZ), _mm_mul_ps(TZ, DY));
+		const __m128 UY = _mm_sub_ps(_mm_mul_ps(TZ, DX), _mm_mul_ps(TX, DZ));
+		const __m128 UZ = _mm_sub_ps(_mm_mul_ps(TX, DY), _mm_mul_ps(TY, DX));
+
+		const __m128 LengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(UX, UX), _mm_mul_ps(UY, UY)), _mm_mul_ps(UZ, UZ));
+		const __m128 Valid = _mm_cmpgt_ps(LengthSq, Epsilon);
+		const __m128 Scale = _mm_and_ps(Valid,
+			_mm_div_ps(_mm_loadu_ps(HalfWidth.GetData() + i), _mm_sqrt_ps(_mm_max_ps(LengthSq, Epsilon))));
+
+		_mm_storeu_ps(OutX + i, _mm_mul_ps(UX, Scale));
+		_mm_storeu_ps(OutY + i, _mm_mul_ps(UY, Scale));
+		_mm_storeu_ps(OutZ + i, _mm_mul_ps(UZ, Scale));
+	}
+
+	for (; i < NumPoints; ++i)
+	{
+		const float UX = TangentY[i] * ViewDirection.Z - TangentZ[i] * ViewDirection.Y;
+		const float UY = TangentZ[i] * ViewDirection.X - TangentX[i] * ViewDirection.Z;
+		const float UZ = TangentX[i] * ViewDirection.Y - TangentY[i] * ViewDirection.X;
+
+		const float LengthSq = UX * UX + UY * UY + UZ * UZ;
+		const float Scale = (LengthSq > KINDA_SMALL_NUMBER * KINDA_SMALL_NUMBER) ? HalfWidth[i] / std::sqrt(LengthSq) : 0.0f;
+
+		OutX[i] = UX * Scale;
+		OutY[i] = UY * Scale;
+		OutZ[i] = UZ * Scale;
+	}
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Vector.h"
+
+/**
+ * FParticleTrailRing
+ * 리본 파티클 슬롯을 스폰 순서대로 담는 링 버퍼입니다. (이미터 인스턴스 소유)
+ *
+ * - 스폰 시 머리에 추가하고, 죽은 파티클은 꼬리부터 제거 → 스폰 순서가 구조적으로 유지되어 매 프레임 정렬이 필요 없음
+ * - 꼬리에서 연속으로 죽은 항목은 포인터만 이동, 수명이 파티클마다 달라 중간에 구멍이 생긴 경우에만 압축
+ * - 슬롯은 죽은 뒤 재사용되므로 스폰 시점의 ParticleCounter를 함께 저장해 다른 파티클과 구분
+ */
+class FParticleTrailRing
+{
+public:
+	struct FEntry
+	{
+		uint16 Slot = 0;
+		uint32 Counter = 0;		// 스폰 시점 ParticleCounter
+	};
+
+	void Reset()
+	{
+		Tail = 0;
+		Count = 0;
+	}
+
+	int32 Num() const { return Count; }
+	bool IsEmpty() const { return Count == 0; }
+
+	// 0 = 가장 오래된 항목 (트레일 꼬리)
+	const FEntry& operator[](int32 Index) const { return Entries[(Tail + Index) & Mask]; }
+
+	void Push(uint16 Slot, uint32 Counter);
+
+	// IsAlive(Entry)가 false인 항목 제거 (나머지 순서 유지)
+	template<typename PredicateType>
+	void RemoveDead(PredicateType IsAlive)
+	{
+		// 1. 꼬리의 연속된 죽은 항목 (수명이 같으면 여기서 끝남)
+		while (Count > 0 && !IsAlive(Entries[Tail]))
+		{
+			Tail = (Tail + 1) & Mask;
+			--Count;
+		}
+
+		// 2. 중간 구멍 압축 (구멍이 없으면 쓰기 없음)
+		int32 Write = 0;
+		for (int32 Read = 0; Read < Count; ++Read)
+		{
+			const FEntry Entry = Entries[(Tail + Read) & Mask];
+			if (IsAlive(Entry))
+			{
+				if (Write != Read)
+				{
+					Entries[(Tail + Write) & Mask] = Entry;
+				}
+				++Write;
+			}
+		}
+		Count = Write;
+	}
+
+private:
+	TArray<FEntry> Entries;		// 크기는 항상 2의 거듭제곱
+	int32 Tail = 0;
+	int32 Count = 0;
+	int32 Mask = 0;
+};
+
+/**
+ * FParticleTrailStrip
+ * 카메라를 향하는 리본/빔 스트립의 테셀레이션 입력입니다. (포인트별, SoA)
+ *
+ * - 접선/반폭/V는 뷰와 무관하므로 렌더 데이터 빌드 시 한 번만 계산
+ * - 뷰마다 바뀌는 것은 Up = Cross(Tangent, ViewDirection) 뿐이며, ComputeOffsets()가 4개씩 SSE로 계산
+ *   정점 = Point ± Offset
+ */
+struct FParticleTrailStrip
+{
+	TArray<float> TangentX;
+	TArray<float> TangentY;
+	TArray<float> TangentZ;
+	TArray<float> HalfWidth;
+	TArray<float> V;			// 0 (꼬리) ~ 1 (머리)
+
+	int32 Num() const { return HalfWidth.Num(); }
+
+	// Points로부터 접선/반폭/V 계산. bTaper면 꼬리(V=0)에서 폭 0, 머리(V=1)에서 Width
+	void Build(const TArray<FVector>& Points, float Width, bool bTaper);
+
+	// 포인트별 Up * HalfWidth를 Out 배열(Num()개 이상)에 기록
+	void ComputeOffsets(const FVector& ViewDirection, float* OutX, float* OutY, float* OutZ) const;
+};
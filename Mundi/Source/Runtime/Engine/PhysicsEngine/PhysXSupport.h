@@ -2,15 +2,25 @@
 
 #include "PhysXPublic.h"
 #include "PxPhysicsAPI.h"
+#include "MemoryManager.h"
 
 class UPhysicalMaterial;
 /**
- * @note 현재는 PhysX에서 제공하는 디폴트 할당자를 사용한다.
  * @note PhysX의 메모리 할당자 래퍼
- * @todo 별도의 메모리 할당 로직이 필요할 경우 'allocate()'를 오버라이딩해서 사용한다.
+ * @note FMemoryManager로 할당해 Physics 태그로 집계한다. (PhysX가 요구하는 16바이트 정렬 보장)
  */
-class FPhysXAllocator : public PxDefaultAllocator
+class FPhysXAllocator : public PxAllocatorCallback
 {
+public:
+    virtual void* allocate(size_t size, const char* typeName, const char* filename, int line) override
+    {
+        return FMemoryManager::Allocate(size, 16, EMemoryTag::Physics);
+    }
+
+    virtual void deallocate(void* ptr) override
+    {
+        FMemoryManager::Deallocate(ptr);
+    }
 };
 
 /**
@@ -28,7 +28,8 @@ sol::object MakeCompProxy(sol::state_view SolState, UObject* Instance, UClass* C
 
 FLuaManager::FLuaManager()
 {
-    Lua = new sol::state();
+    // Lua VM 메모리도 엔진 할당기로 집계 (Lua 태그)
+    Lua = new sol::state(sol::default_at_panic, &FMemoryManager::LuaAllocate);
     
     
     // Open essential standard libraries for gameplay scripts
@@ -63,7 +63,7 @@ FBVHierarchy::~FBVHierarchy()
 void FBVHierarchy::Clear()
 {
     // NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
-    StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
+    StaticMeshComponentBounds = TFlatMap<UPrimitiveComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
     Nodes = TArray<FLBVHNode>();
     Bounds = FAABB();
@@ -140,7 +140,7 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
         return;
     }
     //프러스텀과 바운드가 교차
-    TArray<int32> IdxStack;
+    TArray<int32, TInlineAllocator<64>> IdxStack;
     IdxStack.push_back({ 0 });
 
     while (!IdxStack.empty())
@@ -174,6 +174,68 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
     }
 }
 
+void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum, TFrameArray<UPrimitiveComponent*>& OutComponents) const
+{
+    OutComponents.clear();
+    if (Nodes.empty()) return;
+
+    // 같은 깊이의 노드를 프런티어에 모아 8개씩 검사, 보이는 내부 노드는 자식을 다음 프런티어로
+    TFrameArray<int32> Frontier;
+    TFrameArray<int32> NextFrontier;
+    Frontier.push_back(0);
+
+    FAABB Boxes[8];
+    while (!Frontier.empty())
+    {
+        NextFrontier.clear();
+
+        const int32 NumNodes = static_cast<int32>(Frontier.size());
+        for (int32 Base = 0; Base < NumNodes; Base += 8)
+        {
+            // 8개가 안 되면 마지막 노드로 채움 (결과는 Count개만 사용)
+            const int32 Count = std::min(8, NumNodes - Base);
+            for (int32 i = 0; i < 8; ++i)
+            {
+                Boxes[i] = Nodes[Frontier[Base + std::min(i, Count - 1)]].Bounds;
+            }
+
+            const uint8 VisibleMask = AreAABBsVisible_8_AVX(InFrustum, Boxes);
+            if (VisibleMask == 0)
+            {
+                continue;
+            }
+
+            for (int32 i = 0; i < Count; ++i)
+            {
+                if ((VisibleMask & (1u << i)) == 0)
+                {
+                    continue;
+                }
+
+                const FLBVHNode& Node = Nodes[Frontier[Base + i]];
+                if (Node.IsLeaf())
+                {
+                    for (int32 k = 0; k < Node.Count; ++k)
+                    {
+                        // 리빌드 전에 제거된 컴포넌트는 노드에 남아 있으므로 맵으로 확인
+                        UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + k];
+                        if (Component && StaticMeshComponentBounds.Contains(Component))
+                        {
+                            OutComponents.push_back(Component);
+                        }
+                    }
+                    continue;
+                }
+
+                if (Node.Left >= 0) NextFrontier.push_back(Node.Left);
+                if (Node.Right >= 0) NextFrontier.push_back(Node.Right);
+            }
+        }
+
+        std::swap(Frontier, NextFrontier);
+    }
+}
+
 void FBVHierarchy::DebugDraw(URenderer* Renderer) const
 {
     if (!Renderer) return;
@@ -503,17 +565,20 @@ void FBVHierarchy::FlushRebuild()
     }
 }
 
-template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
+template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc, typename AllocatorType>
+void FBVHierarchy::QueryIntersectedComponentsGeneric(
     const BoundType& InBound,
     NodeIntersectFunc NodeIntersects,
-    ComponentIntersectFunc ComponentIntersects) const
+    ComponentIntersectFunc ComponentIntersects,
+    TArray<UPrimitiveComponent*, AllocatorType>& OutComponents) const
 {
-    TSet<UPrimitiveComponent*> IntersectedComponents;
+    OutComponents.Empty();
     if (Nodes.empty())
-        return TArray<UPrimitiveComponent*>();
-    TArray<int32> IdxStack;
-    IdxStack.push_back({ 0 });
+        return;
+
+    // LBVH에서 각 컴포넌트는 정확히 하나의 리프에만 존재하므로 중복 제거용 Set이 필요 없음
+    TArray<int32, TInlineAllocator<64>> IdxStack;
+    IdxStack.push_back(0);
 
     while (!IdxStack.empty())
     {
@@ -527,52 +592,115 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
                 for (int32 i = 0; i < Node.Count; ++i)
                 {
                     UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
-                    if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
+                    if (!Component)
                         continue;
                     const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                    const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-                    if (ComponentIntersects(Box, InBound))
+                    if (Cached && ComponentIntersects(*Cached, InBound))
                     {
-                        IntersectedComponents.insert(Component);
+                        OutComponents.Add(Component);
                     }
                 }
             }
             else
             {
-                if (Node.Left >= 0) IdxStack.push_back({ Node.Left });
-                if (Node.Right >= 0) IdxStack.push_back({ Node.Right });
+                if (Node.Left >= 0) IdxStack.push_back(Node.Left);
+                if (Node.Right >= 0) IdxStack.push_back(Node.Right);
             }
         }
     }
-    return IntersectedComponents.Array();
 }
 
 // FAABB 오버로드
 TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FAABB& InBound) const
 {
-    return QueryIntersectedComponentsGeneric(
+    TArray<UPrimitiveComponent*> Result;
+    QueryIntersectedComponentsGeneric(
         InBound,
         [](const FAABB& nodeBound, const FAABB& inBound) { return nodeBound.Intersects(inBound); },
-        [](const FAABB& compBound, const FAABB& inBound) { return inBound.Intersects(compBound); }
+        [](const FAABB& compBound, const FAABB& inBound) { return inBound.Intersects(compBound); },
+        Result
     );
+    return Result;
+}
+
+// FAABB 읽기 전용 오버로드 (병렬 페이즈용)
+void FBVHierarchy::QueryIntersectedComponents(const FAABB& InBound, TArray<UPrimitiveComponent*>& OutComponents, TArray<FAABB>* OutBounds) const
+{
+    OutComponents.Empty();
+    if (OutBounds)
+        OutBounds->Empty();
+    if (Nodes.empty())
+        return;
+
+    // LBVH에서 각 컴포넌트는 정확히 하나의 리프에만 존재하므로 중복 제거용 Set이 필요 없음
+    TArray<int32, TInlineAllocator<64>> IdxStack;
+    IdxStack.push_back(0);
+
+    while (!IdxStack.empty())
+    {
+        const FLBVHNode& Node = Nodes[IdxStack.back()];
+        IdxStack.pop_back();
+        if (!Node.Bounds.Intersects(InBound))
+            continue;
+
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
+                if (!Component)
+                    continue;
+                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+                if (Cached && InBound.Intersects(*Cached))
+                {
+                    OutComponents.Add(Component);
+                    if (OutBounds)
+                        OutBounds->Add(*Cached);
+                }
+            }
+        }
+        else
+        {
+            // 보통은 인라인 용량 안에서 끝나지만, 트리가 치우쳐도 넘치지 않도록 늘어나는 스택 사용
+            if (Node.Left >= 0) IdxStack.push_back(Node.Left);
+            if (Node.Right >= 0) IdxStack.push_back(Node.Right);
+        }
+    }
 }
 
 // FOBB 오버로드
 TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FOBB& InBound) const
 {
-    return QueryIntersectedComponentsGeneric(
+    TArray<UPrimitiveComponent*> Result;
+    QueryIntersectedComponentsGeneric(
+        InBound,
+        [](const FAABB& nodeBound, const FOBB& inBound) { return Collision::Intersects(nodeBound, inBound); },
+        [](const FAABB& compBound, const FOBB& inBound) { return Collision::Intersects(compBound, inBound); },
+        Result
+    );
+    return Result;
+}
+
+// FOBB 프레임 배열 오버로드
+void FBVHierarchy::QueryIntersectedComponents(const FOBB& InBound, TFrameArray<UPrimitiveComponent*>& OutComponents) const
+{
+    QueryIntersectedComponentsGeneric(
         InBound,
         [](const FAABB& nodeBound, const FOBB& inBound) { return Collision::Intersects(nodeBound, inBound); },
-        [](const FAABB& compBound, const FOBB& inBound) { return Collision::Intersects(compBound, inBound); }
+        [](const FAABB& compBound, const FOBB& inBound) { return Collision::Intersects(compBound, inBound); },
+        OutComponents
     );
 }
 
 // FBoundingSphere 오버로드
 TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FBoundingSphere& InBound) const
 {
-    return QueryIntersectedComponentsGeneric(
+    TArray<UPrimitiveComponent*> Result;
+    QueryIntersectedComponentsGeneric(
         InBound,
         [](const FAABB& nodeBound, const FBoundingSphere& inBound) { return Collision::Intersects(nodeBound, inBound); },
-        [](const FAABB& compBound, const FBoundingSphere& inBound) { return Collision::Intersects(compBound, inBound); }
+        [](const FAABB& compBound, const FBoundingSphere& inBound) { return Collision::Intersects(compBound, inBound); },
+        Result
     );
+    return Result;
 }
@@ -34,10 +34,29 @@ public:
 
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
     void QueryFrustum(const FFrustum& InFrustum);
+
+    // 읽기 전용 절두체 쿼리: 캐시된 바운드 기준으로 보이는 컴포넌트를 OutComponents에 채움 (먼저 비워짐)
+    // 방문할 노드를 8개씩 묶어 AVX로 6평면 검사 (AreAABBsVisible_8_AVX), 결과와 프런티어는 프레임 arena에서 할당
+    void QueryFrustum(const FFrustum& InFrustum, TFrameArray<UPrimitiveComponent*>& OutComponents) const;
+
+    // 캐시된 바운드가 있는지 (없으면 쿼리 결과에 나타나지 않음)
+    bool Contains(UPrimitiveComponent* InComponent) const { return StaticMeshComponentBounds.Contains(InComponent); }
+    // Update/Remove 후 FlushRebuild 전이면 노드가 낡은 상태
+    bool IsPendingRebuild() const { return bPendingRebuild; }
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
 
+    // 프레임 임시 결과용 OBB 쿼리 (데칼 패스): OutComponents는 먼저 비워짐
+    void QueryIntersectedComponents(const FOBB& InBound, TFrameArray<UPrimitiveComponent*>& OutComponents) const;
+
+    // 읽기 전용 AABB 쿼리: 결과를 호출자 배열에 채움 (OutComponents는 먼저 비워짐, 임시 Set 할당 없음)
+    // BVH 갱신(Update/Remove/FlushRebuild)과 겹치지 않는 한 여러 스레드에서 동시에 호출해도 안전
+    // (예: 병렬 파티클 틱 페이즈의 충돌 쿼리)
+    // OutBounds를 넘기면 각 결과의 캐시된 월드 AABB도 같은 순서로 채움
+    // (워커 스레드에서 컴포넌트의 지연 캐싱 트랜스폼 getter를 호출하지 않기 위함)
+    void QueryIntersectedComponents(const FAABB& InBound, TArray<UPrimitiveComponent*>& OutComponents, TArray<FAABB>* OutBounds = nullptr) const;
+
     void DebugDraw(URenderer* Renderer) const;
 
     // Debug/Stats
@@ -64,10 +83,11 @@ private:
     void BuildLBVH();
 
 private:
-    template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
-    TArray<UPrimitiveComponent*> QueryIntersectedComponentsGeneric(const BoundType& InBound
+    template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc, typename AllocatorType>
+    void QueryIntersectedComponentsGeneric(const BoundType& InBound
         , NodeIntersectFunc NodeIntersects
-        , ComponentIntersectFunc ComponentIntersects) const;
+        , ComponentIntersectFunc ComponentIntersects
+        , TArray<UPrimitiveComponent*, AllocatorType>& OutComponents) const;
 
     int BuildRange(int s, int e);
 
@@ -76,7 +96,7 @@ private:
     int MaxObjects;
     FAABB Bounds;
 
-    TMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
+    TFlatMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
     TArray<UPrimitiveComponent*> StaticMeshComponentArray;
 
     // LBVH nodes
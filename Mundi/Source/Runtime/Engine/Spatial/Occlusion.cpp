@@ -1,228 +1,585 @@
 ﻿#include "pch.h"
 #include "Occlusion.h"
-#include "Frustum.h"
+#include "VertexData.h"
+#include "TaskSystem.h"
+#include <algorithm>
 
-// NDC Z가 [-1..1]인 프로젝션이면 아래 변환을 켜세요.
-// static inline float To01(float z_ndc) { return z_ndc * 0.5f + 0.5f; }
-static inline void Clamp01(float& v) { v = std::max(0.0f, std::min(1.0f, v)); }
+namespace
+{
+	// 근평면(Z >= 0) 클리핑 후 다각형 최대 정점 수 (삼각형 1개 → 최대 4개)
+	constexpr int32 MaxClippedVertices = 4;
+
+	// 빈 하나에 들어가는 최소 타일 행 수 (너무 잘게 나누면 삼각형 중복 참조가 늘어남)
+	constexpr int32 MinTileRowsPerBin = 4;
+
+	// 상위 HZB 검사가 실패했을 때 타일 레벨로 재검사할 최대 타일 수
+	constexpr int32 MaxRefineTiles = 64;
 
-// 헬퍼: 뷰공간 Z → [0..1] 선형
-static inline float LinearizeZ01(float zView, float zNear, float zFar) {
-	// LH 기준, 카메라 앞 z가 + 방향일 때
-	float z = (zView - zNear) / (zFar - zNear);
-	return std::max(0.f, std::min(1.f, z));
+	inline FVector4 LerpClip(const FVector4& A, const FVector4& B, float T)
+	{
+		return FVector4(A.X + (B.X - A.X) * T, A.Y + (B.Y - A.Y) * T, A.Z + (B.Z - A.Z) * T, A.W + (B.W - A.W) * T);
+	}
+
+	// 행 하나의 [Start, End] 픽셀 비트 (비트 i = 타일 내 픽셀 열 i)
+	inline uint32 MakeRowMask(int32 Start, int32 End)
+	{
+		Start = std::max(Start, 0);
+		End = std::min(End, FOcclusionCullingManagerCPU::TileWidth - 1);
+		if (Start > End)
+		{
+			return 0u;
+		}
+		return (0xFFFFFFFFu >> (31 - (End - Start))) << Start;
+	}
 }
 
-// FBound(Min/Max) → 8코너
-static inline void MakeAabbCornersMinMax(const FAABB& B, FVector Corners[8])
+FOcclusionCullingManagerCPU::FOcclusionCullingManagerCPU()
 {
-	const FVector& mn = B.Min;
-	const FVector& mx = B.Max;
-	Corners[0] = { mn.X, mn.Y, mn.Z };
-	Corners[1] = { mx.X, mn.Y, mn.Z };
-	Corners[2] = { mn.X, mx.Y, mn.Z };
-	Corners[3] = { mx.X, mx.Y, mn.Z };
-	Corners[4] = { mn.X, mn.Y, mx.Z };
-	Corners[5] = { mx.X, mn.Y, mx.Z };
-	Corners[6] = { mn.X, mx.Y, mx.Z };
-	Corners[7] = { mx.X, mx.Y, mx.Z };
+	Initialize(320, 192);
 }
 
-bool FOcclusionCullingManagerCPU::ComputeRectAndMinZ(
-	const FCandidateDrawable& D, int /*ViewW*/, int /*ViewH*/, FOcclusionRect& OutR)
+void FOcclusionCullingManagerCPU::Initialize(int32 InWidth, int32 InHeight)
 {
-	FVector C[8];
-	MakeAabbCornersMinMax(D.Bound, C);
+	TilesX = std::max(1, (InWidth + TileWidth - 1) / TileWidth);
+	TilesY = std::max(1, (InHeight + TileHeight - 1) / TileHeight);
+	Width = TilesX * TileWidth;
+	Height = TilesY * TileHeight;
+
+	const int32 NumTiles = TilesX * TilesY;
+	TileMasks.SetNum(NumTiles);
+	TileZMax0.SetNum(NumTiles);
+	TileZMax1.SetNum(NumTiles);
+
+	// HZB 레벨 크기 (1x1까지)
+	HZBLevels.Empty();
+	HZBWidths.Empty();
+	HZBHeights.Empty();
+	int32 LevelWidth = TilesX;
+	int32 LevelHeight = TilesY;
+	while (true)
+	{
+		HZBWidths.Add(LevelWidth);
+		HZBHeights.Add(LevelHeight);
+		HZBLevels.Emplace();
+		HZBLevels.Last().SetNum(LevelWidth * LevelHeight);
+		if (LevelWidth == 1 && LevelHeight == 1)
+		{
+			break;
+		}
+		LevelWidth = (LevelWidth + 1) / 2;
+		LevelHeight = (LevelHeight + 1) / 2;
+	}
 
-	float MinX = +1e9f, MinY = +1e9f, MaxX = -1e9f, MaxY = -1e9f;
-	float MinZLin = +1e9f, MaxZLin = -1e9f; // ★ 선형 깊이(0..1)
+	// 빈: 워커 수 정도로 타일 행을 나눔
+	const int32 NumThreads = FTaskSystem::GetInstance().GetNumWorkers() + 1;
+	TileRowsPerBin = std::max(MinTileRowsPerBin, (TilesY + NumThreads - 1) / NumThreads);
+	NumBins = (TilesY + TileRowsPerBin - 1) / TileRowsPerBin;
+	Bins.SetNum(NumBins);
+}
+
+void FOcclusionCullingManagerCPU::BeginView(const FMatrix& InViewProjection)
+{
+	ViewProjection = InViewProjection;
+	Occluders.Empty();
+	NumOccluderTriangles = 0;
+}
 
-	int used = 0;
-	for (int i = 0; i < 8; i++)
+void FOcclusionCullingManagerCPU::AddOccluder(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices, const FMatrix& WorldMatrix, const FAABB& WorldBounds)
+{
+	if (Vertices.IsEmpty() || Indices.Num() < 3)
 	{
-		const float p[4] = { C[i].X, C[i].Y, C[i].Z, 1.0f };
+		return;
+	}
 
-		// 1) 화면 사각형용: WVP → NDC
-		float c[4];
-		MulPointRow(p, D.WorldViewProj, c);
-		if (c[3] <= 0.0f) continue;
+	Occluders.Emplace();
+	FOccluder& Occluder = Occluders.Last();
+	Occluder.Vertices = &Vertices;
+	Occluder.Indices = &Indices;
+	Occluder.WorldViewProjection = WorldMatrix * ViewProjection;
 
-		const float invW = 1.0f / c[3];
-		const float ndcX = c[0] * invW;  // -1..1
-		const float ndcY = c[1] * invW;  // -1..1
-		// const float ndcZ = c[2] * invW; // 깊이는 쓰지 않음
+	// 바운드 중심의 Clip W (원근 투영에서 뷰 깊이)로 앞→뒤 정렬
+	const FVector Center = (WorldBounds.Min + WorldBounds.Max) * 0.5f;
+	Occluder.SortDepth = (FVector4(Center.X, Center.Y, Center.Z, 1.0f) * ViewProjection).W;
+}
 
-		const float u = 0.5f * (ndcX + 1.0f);
-		const float v = 0.5f * (ndcY + 1.0f);
+void FOcclusionCullingManagerCPU::RasterizeOccluders()
+{
+	// 1. 깊이 버퍼 초기화 (기준 레이어 = Far, 작업 레이어 비움)
+	const __m128i Zero = _mm_setzero_si128();
+	for (int32 i = 0; i < TileMasks.Num(); ++i)
+	{
+		TileMasks[i] = Zero;
+		TileZMax0[i] = 1.0f;
+		TileZMax1[i] = 0.0f;
+	}
 
-		MinX = std::min(MinX, u); MinY = std::min(MinY, v);
-		MaxX = std::max(MaxX, u); MaxY = std::max(MaxY, v);
+	const int32 NumOccluders = Occluders.Num();
+	if (NumOccluders == 0)
+	{
+		BuildHZB();
+		return;
+	}
 
-		// 2) 깊이: WorldView로 뷰 공간 z → 선형 0..1
-		float v4[4];
-		MulPointRow(p, D.WorldView, v4);     // p_world * (World*View) == p_world * View (월드좌표니까 View만 와도 OK)
-		const float zView = v4[2];          // LH: +Z 앞
-		const float zLin01 = LinearizeZ01(zView, D.NearClip, D.FarClip);
+	// 2. 가까운 순서
+	OccluderOrder.SetNum(NumOccluders);
+	for (int32 i = 0; i < NumOccluders; ++i)
+	{
+		OccluderOrder[i] = i;
+	}
+	std::sort(OccluderOrder.begin(), OccluderOrder.end(), [this](int32 A, int32 B)
+	{
+		return Occluders[A].SortDepth < Occluders[B].SortDepth || (Occluders[A].SortDepth == Occluders[B].SortDepth && A < B);
+	});
 
-		MinZLin = std::min(MinZLin, zLin01);
-		MaxZLin = std::max(MaxZLin, zLin01);
+	// 3. 오클루더별 변환/클리핑/셋업 (병렬, 슬롯별 출력)
+	if (OccluderWork.Num() < NumOccluders)
+	{
+		OccluderWork.SetNum(NumOccluders);
+	}
+	FTaskSystem::GetInstance().ParallelFor(NumOccluders, [this](int32 Index)
+	{
+		SetupOccluder(Occluders[Index], OccluderWork[Index]);
+	});
 
-		used++;
+	// 4. 빈 목록 (가까운 오클루더부터, 삼각형 순서 유지 → 결과가 스레드 수와 무관)
+	for (TArray<FBinEntry>& Bin : Bins)
+	{
+		Bin.Empty();
 	}
+	for (int32 Order = 0; Order < NumOccluders; ++Order)
+	{
+		const int32 OccluderIndex = OccluderOrder[Order];
+		const TArray<FSetupTriangle>& Triangles = OccluderWork[OccluderIndex].Triangles;
+		NumOccluderTriangles += Triangles.Num();
 
-	if (used == 0) return false;
-	if (MaxX < 0 || MaxY < 0 || MinX > 1 || MinY > 1) return false;
+		for (int32 TriangleIndex = 0; TriangleIndex < Triangles.Num(); ++TriangleIndex)
+		{
+			const FSetupTriangle& Triangle = Triangles[TriangleIndex];
+			const int32 FirstBin = Triangle.MinTileY / TileRowsPerBin;
+			const int32 LastBin = Triangle.MaxTileY / TileRowsPerBin;
+			for (int32 BinIndex = FirstBin; BinIndex <= LastBin; ++BinIndex)
+			{
+				Bins[BinIndex].Add({ OccluderIndex, TriangleIndex });
+			}
+		}
+	}
 
-	Clamp01(MinX); Clamp01(MinY); Clamp01(MaxX); Clamp01(MaxY);
-	Clamp01(MinZLin); Clamp01(MaxZLin);
+	// 5. 빈별 래스터화 (빈끼리 타일이 겹치지 않음)
+	FTaskSystem::GetInstance().ParallelFor(NumBins, [this](int32 BinIndex)
+	{
+		RasterizeBin(BinIndex);
+	});
 
-	OutR.MinX = MinX; OutR.MinY = MinY; OutR.MaxX = MaxX; OutR.MaxY = MaxY;
-	OutR.MinZ = MinZLin;   // ★ 선형 깊이
-	OutR.MaxZ = MaxZLin;
-	OutR.ActorIndex = D.ActorIndex;
-	return true;
+	BuildHZB();
 }
-void FOcclusionCullingManagerCPU::BuildOccluderDepth(
-	const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH)
-{
-	Grid.Clear();
 
-	const int GW = Grid.GetWidth();
-	const int GH = Grid.GetHeight();
+void FOcclusionCullingManagerCPU::SetupOccluder(const FOccluder& Occluder, FOccluderWork& Work) const
+{
+	const TArray<FNormalVertex>& Vertices = *Occluder.Vertices;
+	const TArray<uint32>& Indices = *Occluder.Indices;
 
-	// --- 튜닝 파라미터 ---
-	const float ErodeScale = 0.5f;     // 0.5배 축소
-	const int   Dilate = 1;        // 경계 1px 팽창
-	const int   MinPxEdge = 8;        // 너무 작은 사각형은 erosion 스킵
-	const float MaxCover = 0.6f;     // 화면의 60% 이상 덮으면 erosion 스킵
+	Work.Triangles.Empty();
+	Work.ClipVertices.SetNum(Vertices.Num());
+	for (int32 i = 0; i < Vertices.Num(); ++i)
+	{
+		const FVector& Position = Vertices[i].pos;
+		Work.ClipVertices[i] = FVector4(Position.X, Position.Y, Position.Z, 1.0f) * Occluder.WorldViewProjection;
+	}
 
-	for (const auto& D : Occluders)
+	const int32 NumVertices = Vertices.Num();
+	const int32 NumIndices = Indices.Num() - Indices.Num() % 3;
+	for (int32 i = 0; i < NumIndices; i += 3)
 	{
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
+		const uint32 I0 = Indices[i];
+		const uint32 I1 = Indices[i + 1];
+		const uint32 I2 = Indices[i + 2];
+		if (I0 >= static_cast<uint32>(NumVertices) || I1 >= static_cast<uint32>(NumVertices) || I2 >= static_cast<uint32>(NumVertices))
+		{
 			continue;
+		}
 
-		int minPX = (int)std::floor(R.MinX * GW);
-		int minPY = (int)std::floor(R.MinY * GH);
-		int maxPX = (int)std::ceil(R.MaxX * GW) - 1;
-		int maxPY = (int)std::ceil(R.MaxY * GH) - 1;
-
-		// --- 화면 사각형 erosion(오클루더 영향 완화) ---
-		int w = std::max(0, maxPX - minPX + 1);
-		int h = std::max(0, maxPY - minPY + 1);
-		const bool bigCover =
-			(w >= int(MaxCover * GW)) || (h >= int(MaxCover * GH));
-		if (ErodeScale < 1.0f && w >= MinPxEdge && h >= MinPxEdge && !bigCover)
+		const FVector4& V0 = Work.ClipVertices[I0];
+		const FVector4& V1 = Work.ClipVertices[I1];
+		const FVector4& V2 = Work.ClipVertices[I2];
+
+		// 한 클립 평면 바깥에 세 정점이 모두 있으면 제외
+		if ((V0.X < -V0.W && V1.X < -V1.W && V2.X < -V2.W) ||
+			(V0.X > V0.W && V1.X > V1.W && V2.X > V2.W) ||
+			(V0.Y < -V0.W && V1.Y < -V1.W && V2.Y < -V2.W) ||
+			(V0.Y > V0.W && V1.Y > V1.W && V2.Y > V2.W) ||
+			(V0.Z < 0.0f && V1.Z < 0.0f && V2.Z < 0.0f) ||
+			(V0.Z > V0.W && V1.Z > V1.W && V2.Z > V2.W))
 		{
-			const float cx = 0.5f * float(minPX + maxPX);
-			const float cy = 0.5f * float(minPY + maxPY);
-			const float hw = 0.5f * float(w) * ErodeScale;
-			const float hh = 0.5f * float(h) * ErodeScale;
-
-			minPX = int(std::floor(cx - hw));
-			maxPX = int(std::ceil(cx + hw));
-			minPY = int(std::floor(cy - hh));
-			maxPY = int(std::ceil(cy + hh));
+			continue;
 		}
 
+		// 근평면만 클리핑 (좌우/상하는 래스터화 범위 제한으로 처리)
+		FVector4 Polygon[MaxClippedVertices];
+		int32 NumPolygonVertices = 0;
+		if (V0.Z >= 0.0f && V1.Z >= 0.0f && V2.Z >= 0.0f)
+		{
+			Polygon[0] = V0;
+			Polygon[1] = V1;
+			Polygon[2] = V2;
+			NumPolygonVertices = 3;
+		}
+		else
+		{
+			const FVector4* Input[3] = { &V0, &V1, &V2 };
+			for (int32 Edge = 0; Edge < 3; ++Edge)
+			{
+				const FVector4& A = *Input[Edge];
+				const FVector4& B = *Input[(Edge + 1) % 3];
+				const bool bAInside = A.Z >= 0.0f;
+				const bool bBInside = B.Z >= 0.0f;
+				if (bAInside)
+				{
+					Polygon[NumPolygonVertices++] = A;
+				}
+				if (bAInside != bBInside)
+				{
+					Polygon[NumPolygonVertices++] = LerpClip(A, B, A.Z / (A.Z - B.Z));
+				}
+			}
+		}
 
-		// 화면 경계 클램프
-		minPX = std::max(0, std::min(GW - 1, minPX));
-		minPY = std::max(0, std::min(GH - 1, minPY));
-		maxPX = std::max(0, std::min(GW - 1, maxPX));
-		maxPY = std::max(0, std::min(GH - 1, maxPY));
-		if (minPX > maxPX || minPY > maxPY) continue;
-
-		Grid.RasterizeRectDepthMin(minPX, minPY, maxPX, maxPY, R.MaxZ);
+		AddClippedPolygon(Polygon, NumPolygonVertices, Work.Triangles);
 	}
 }
 
-// 2) 후보 가시성 판정(HZB 샘플)
-void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>& Candidates, int ViewW, int ViewH, TArray<uint8_t>& OutVisibleFlags)
+void FOcclusionCullingManagerCPU::AddClippedPolygon(const FVector4* Polygon, int32 NumVertices, TArray<FSetupTriangle>& OutTriangles) const
 {
-	const float eps = 2e-3f;  // 1차 바이어스
-	const float eps2 = 2 * eps;  // 레벨0 재검증 바이어스(조금 더 큼)
-	// --- 크기 보장 ---
-	uint32_t maxId = 0;
-	for (auto& c : Candidates) maxId = std::max(maxId, c.ActorIndex);
-
-	if (OutVisibleFlags.size() <= maxId) OutVisibleFlags.resize(maxId + 1, 1);
-	if (VisibleStreak.size() <= maxId) VisibleStreak.resize(maxId + 1, 0);
-	if (OccludedStreak.size() <= maxId) OccludedStreak.resize(maxId + 1, 0);
-	if (LastState.size() <= maxId) LastState.resize(maxId + 1, 1); // 초기=보임
-
-	for (const auto& D : Candidates)
-	{
-		uint32_t id = D.ActorIndex;
-
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
-		{
-			// 화면 밖(또는 w<=0 코너만) → 가려짐으로 처리
-			OutVisibleFlags[id] = 0;
-			// streak 업데이트 (선택): occluded 누적
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
-			LastState[id] = 0;
+	// 화면 픽셀 좌표 (Y 아래 방향) + NDC 깊이
+	float SX[MaxClippedVertices], SY[MaxClippedVertices], SZ[MaxClippedVertices];
+	for (int32 i = 0; i < NumVertices; ++i)
+	{
+		const float W = std::max(Polygon[i].W, KINDA_SMALL_NUMBER);
+		const float InvW = 1.0f / W;
+		SX[i] = (Polygon[i].X * InvW * 0.5f + 0.5f) * static_cast<float>(Width);
+		SY[i] = (0.5f - Polygon[i].Y * InvW * 0.5f) * static_cast<float>(Height);
+		SZ[i] = Polygon[i].Z * InvW;
+	}
+
+	// 팬 삼각형
+	for (int32 i = 1; i + 1 < NumVertices; ++i)
+	{
+		int32 Index[3] = { 0, i, i + 1 };
+
+		float Area = (SX[Index[1]] - SX[Index[0]]) * (SY[Index[2]] - SY[Index[0]]) - (SX[Index[2]] - SX[Index[0]]) * (SY[Index[1]] - SY[Index[0]]);
+		if (std::fabs(Area) < KINDA_SMALL_NUMBER)
+		{
 			continue;
 		}
 
-		const float rw = std::max(0.0f, R.MaxX - R.MinX);
-		const float rh = std::max(0.0f, R.MaxY - R.MinY);
-		const float pxW = rw * GetGrid().GetWidth();
-		const float pxH = rh * GetGrid().GetHeight();
+		// 양면: 감김 방향을 통일해 내부가 항상 Edge >= 0이 되도록
+		if (Area < 0.0f)
+		{
+			std::swap(Index[1], Index[2]);
+			Area = -Area;
+		}
+
+		const float X0 = SX[Index[0]], Y0 = SY[Index[0]], Z0 = SZ[Index[0]];
+		const float X1 = SX[Index[1]], Y1 = SY[Index[1]], Z1 = SZ[Index[1]];
+		const float X2 = SX[Index[2]], Y2 = SY[Index[2]], Z2 = SZ[Index[2]];
 
-		// --- 작은 사각형 가드: 한 변이라도 2px 미만이면 컬링하지 않음 ---
-		if (std::min(pxW, pxH) < 2.0f)
+		const float MinX = std::min({ X0, X1, X2 });
+		const float MaxX = std::max({ X0, X1, X2 });
+		const float MinY = std::min({ Y0, Y1, Y2 });
+		const float MaxY = std::max({ Y0, Y1, Y2 });
+		if (MaxX < 0.0f || MaxY < 0.0f || MinX >= static_cast<float>(Width) || MinY >= static_cast<float>(Height))
 		{
-			OutVisibleFlags[id] = 1;
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
-			LastState[id] = 1;
 			continue;
 		}
 
-		// --- 보수적 mip 선택 ---
-		int mip = std::max(0, Grid.ChooseMip(rw, rh) - 1);
-		if (pxW < 48.0f || pxH < 48.0f)
-			mip = std::max(0, mip - 1);
+		FSetupTriangle Triangle;
+		const float PX[3] = { X0, X1, X2 };
+		const float PY[3] = { Y0, Y1, Y2 };
+		for (int32 Edge = 0; Edge < 3; ++Edge)
+		{
+			const int32 Next = (Edge + 1) % 3;
+			Triangle.A[Edge] = PY[Edge] - PY[Next];
+			Triangle.B[Edge] = PX[Next] - PX[Edge];
+			Triangle.C[Edge] = -(Triangle.A[Edge] * PX[Edge] + Triangle.B[Edge] * PY[Edge]);
+		}
 
+		const float InvArea = 1.0f / Area;
+		Triangle.ZA = ((Z1 - Z0) * (Y2 - Y0) - (Z2 - Z0) * (Y1 - Y0)) * InvArea;
+		Triangle.ZB = ((Z2 - Z0) * (X1 - X0) - (Z1 - Z0) * (X2 - X0)) * InvArea;
+		Triangle.ZC = Z0 - Triangle.ZA * X0 - Triangle.ZB * Y0;
+		Triangle.ZMax = std::max({ Z0, Z1, Z2 });
 
-		// --- MAX HZB 적응형 샘플 ---
-		const float hzbMax = Grid.SampleMaxRectAdaptive(R.MinX, R.MinY, R.MaxX, R.MaxY, mip);
+		Triangle.MinTileX = std::max(0, static_cast<int32>(MinX) / TileWidth);
+		Triangle.MaxTileX = std::min(TilesX - 1, static_cast<int32>(MaxX) / TileWidth);
+		Triangle.MinTileY = std::max(0, static_cast<int32>(MinY) / TileHeight);
+		Triangle.MaxTileY = std::min(TilesY - 1, static_cast<int32>(MaxY) / TileHeight);
+
+		OutTriangles.Add(Triangle);
+	}
+}
 
-		bool occluded = ((hzbMax + eps) <= R.MinZ);
+void FOcclusionCullingManagerCPU::RasterizeBin(int32 BinIndex)
+{
+	const int32 BinMinTileY = BinIndex * TileRowsPerBin;
+	const int32 BinMaxTileY = std::min(TilesY - 1, BinMinTileY + TileRowsPerBin - 1);
 
-		// --- 레벨0 정밀 재검증(occluded일 때만) ---
-		if (occluded)
+	for (const FBinEntry& Entry : Bins[BinIndex])
+	{
+		const FSetupTriangle& Triangle = OccluderWork[Entry.Occluder].Triangles[Entry.Triangle];
+		const int32 MinTileY = std::max(Triangle.MinTileY, BinMinTileY);
+		const int32 MaxTileY = std::min(Triangle.MaxTileY, BinMaxTileY);
+		for (int32 TileY = MinTileY; TileY <= MaxTileY; ++TileY)
 		{
-			if (!Grid.FullyOccludedAtLevel0(R.MinX, R.MinY, R.MaxX, R.MaxY, R.MinZ, eps2))
-				occluded = false;
+			for (int32 TileX = Triangle.MinTileX; TileX <= Triangle.MaxTileX; ++TileX)
+			{
+				RasterizeTriangleTile(Triangle, TileX, TileY);
+			}
 		}
+	}
+}
 
-		// --- 양방향 히스테리시스(2~3프레임 연속일 때만 상태 전환) ---
-		const int thresh = 2; // 2~3 추천
+void FOcclusionCullingManagerCPU::RasterizeTriangleTile(const FSetupTriangle& Triangle, int32 TileX, int32 TileY)
+{
+	const int32 TileIndex = TileY * TilesX + TileX;
+	const float TileX0 = static_cast<float>(TileX * TileWidth);
+	const float TileY0 = static_cast<float>(TileY * TileHeight);
+
+	// 1. 타일 안 삼각형 깊이 상한 (평면을 네 모서리에서 평가, 정점 최대 깊이로 제한)
+	const float TileX1 = TileX0 + static_cast<float>(TileWidth);
+	const float TileY1 = TileY0 + static_cast<float>(TileHeight);
+	const float ZRowTop = Triangle.ZB * TileY0 + Triangle.ZC;
+	const float ZRowBottom = Triangle.ZB * TileY1 + Triangle.ZC;
+	const float ZCorners = std::max({
+		Triangle.ZA * TileX0 + ZRowTop, Triangle.ZA * TileX1 + ZRowTop,
+		Triangle.ZA * TileX0 + ZRowBottom, Triangle.ZA * TileX1 + ZRowBottom });
+	const float ZTriangle = std::min(ZCorners, Triangle.ZMax);
+
+	float& ZMax0 = TileZMax0[TileIndex];
+	if (ZTriangle >= ZMax0)
+	{
+		return;
+	}
 
-		if (occluded)
+	// 2. 행 4개 커버리지 (픽셀 중심 샘플링). 각 엣지에서 행별 경계 X를 4행 동시에 계산
+	//    A > 0: X >= 경계 (왼쪽 경계), A < 0: X <= 경계 (오른쪽 경계), A == 0: 행 전체 안/밖
+	const __m128 RowY = _mm_add_ps(_mm_set1_ps(TileY0), _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f));
+	__m128 Left = _mm_set1_ps(-1.0f);
+	__m128 Right = _mm_set1_ps(static_cast<float>(TileWidth) + 1.0f);
+	for (int32 Edge = 0; Edge < 3; ++Edge)
+	{
+		const float A = Triangle.A[Edge];
+		const __m128 RowValue = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Triangle.B[Edge]), RowY), _mm_set1_ps(Triangle.C[Edge]));
+		if (A == 0.0f)
 		{
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
+			// 행 전체가 바깥이면 Left를 큰 값으로
+			const __m128 Outside = _mm_cmplt_ps(RowValue, _mm_setzero_ps());
+			Left = _mm_or_ps(_mm_andnot_ps(Outside, Left), _mm_and_ps(Outside, _mm_set1_ps(static_cast<float>(TileWidth) + 1.0f)));
+			continue;
+		}
 
-			// 직전이 보임이면, thresh 미만 동안은 보임 유지
-			if (LastState[id] == 1 && OccludedStreak[id] < thresh)
-				occluded = false;
+		const __m128 Boundary = _mm_sub_ps(_mm_mul_ps(RowValue, _mm_set1_ps(-1.0f / A)), _mm_set1_ps(TileX0));
+		if (A > 0.0f)
+		{
+			Left = _mm_max_ps(Left, Boundary);
 		}
 		else
 		{
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
+			Right = _mm_min_ps(Right, Boundary);
+		}
+	}
+
+	// [-1, TileWidth + 1]로 제한 후 정수 변환 (Start = ceil(Left - 0.5), End = floor(Right - 0.5))
+	const __m128 ClampMin = _mm_set1_ps(-1.0f);
+	const __m128 ClampMax = _mm_set1_ps(static_cast<float>(TileWidth) + 1.0f);
+	Left = _mm_min_ps(_mm_max_ps(Left, ClampMin), ClampMax);
+	Right = _mm_min_ps(_mm_max_ps(Right, ClampMin), ClampMax);
+
+	const __m128 Bias = _mm_set1_ps(64.0f);
+	alignas(16) int32 Start[4];
+	alignas(16) int32 End[4];
+	_mm_store_si128(reinterpret_cast<__m128i*>(Start),
+		_mm_sub_epi32(_mm_set1_epi32(64), _mm_cvttps_epi32(_mm_sub_ps(Bias, _mm_sub_ps(Left, _mm_set1_ps(0.5f))))));
+	_mm_store_si128(reinterpret_cast<__m128i*>(End),
+		_mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(Bias, _mm_sub_ps(Right, _mm_set1_ps(0.5f)))), _mm_set1_epi32(64)));
+
+	const __m128i Coverage = _mm_setr_epi32(
+		static_cast<int32>(MakeRowMask(Start[0], End[0])),
+		static_cast<int32>(MakeRowMask(Start[1], End[1])),
+		static_cast<int32>(MakeRowMask(Start[2], End[2])),
+		static_cast<int32>(MakeRowMask(Start[3], End[3])));
+
+	const __m128i Zero = _mm_setzero_si128();
+	if (_mm_movemask_epi8(_mm_cmpeq_epi32(Coverage, Zero)) == 0xFFFF)
+	{
+		return;
+	}
+
+	// 3. 작업 레이어 갱신
+	__m128i& Mask = TileMasks[TileIndex];
+	float& ZMax1 = TileZMax1[TileIndex];
+
+	// 새 삼각형이 작업 레이어보다 기준 레이어에 더 가까우면 작업 레이어를 버림 (보수적)
+	if (_mm_movemask_epi8(_mm_cmpeq_epi32(Mask, Zero)) != 0xFFFF &&
+		std::fabs(ZTriangle - ZMax1) > ZMax0 - ZTriangle)
+	{
+		Mask = Zero;
+		ZMax1 = 0.0f;
+	}
+
+	Mask = _mm_or_si128(Mask, Coverage);
+	ZMax1 = std::max(ZMax1, ZTriangle);
+
+	// 타일이 가득 차면 기준 레이어로 합침
+	if (_mm_movemask_epi8(_mm_cmpeq_epi32(Mask, _mm_set1_epi32(-1))) == 0xFFFF)
+	{
+		ZMax0 = std::min(ZMax0, ZMax1);
+		Mask = Zero;
+		ZMax1 = 0.0f;
+	}
+}
+
+void FOcclusionCullingManagerCPU::BuildHZB()
+{
+	HZBLevels[0] = TileZMax0;
+
+	for (int32 Level = 1; Level < HZBLevels.Num(); ++Level)
+	{
+		const TArray<float>& Src = HZBLevels[Level - 1];
+		TArray<float>& Dst = HZBLevels[Level];
+		const int32 SrcWidth = HZBWidths[Level - 1];
+		const int32 SrcHeight = HZBHeights[Level - 1];
+		const int32 DstWidth = HZBWidths[Level];
+		const int32 DstHeight = HZBHeights[Level];
+
+		for (int32 Y = 0; Y < DstHeight; ++Y)
+		{
+			const int32 Y0 = Y * 2;
+			const int32 Y1 = std::min(Y0 + 1, SrcHeight - 1);
+			for (int32 X = 0; X < DstWidth; ++X)
+			{
+				const int32 X0 = X * 2;
+				const int32 X1 = std::min(X0 + 1, SrcWidth - 1);
+				Dst[Y * DstWidth + X] = std::max(
+					std::max(Src[Y0 * SrcWidth + X0], Src[Y0 * SrcWidth + X1]),
+					std::max(Src[Y1 * SrcWidth + X0], Src[Y1 * SrcWidth + X1]));
+			}
+		}
+	}
+}
+
+float FOcclusionCullingManagerCPU::SampleMaxDepth(int32 Level, int32 MinTileX, int32 MinTileY, int32 MaxTileX, int32 MaxTileY) const
+{
+	const TArray<float>& Depths = HZBLevels[Level];
+	const int32 LevelWidth = HZBWidths[Level];
+	const int32 X0 = MinTileX >> Level;
+	const int32 X1 = std::min(MaxTileX >> Level, LevelWidth - 1);
+	const int32 Y0 = MinTileY >> Level;
+	const int32 Y1 = std::min(MaxTileY >> Level, HZBHeights[Level] - 1);
+
+	float MaxDepth = 0.0f;
+	for (int32 Y = Y0; Y <= Y1; ++Y)
+	{
+		for (int32 X = X0; X <= X1; ++X)
+		{
+			MaxDepth = std::max(MaxDepth, Depths[Y * LevelWidth + X]);
+		}
+	}
+	return MaxDepth;
+}
+
+bool FOcclusionCullingManagerCPU::IsOccluded(const FAABB& Bound) const
+{
+	// 1. 8 코너 투영 → 화면 사각형 + 최근접 깊이
+	float MinX = FLT_MAX, MinY = FLT_MAX, MaxX = -FLT_MAX, MaxY = -FLT_MAX;
+	float MinZ = FLT_MAX;
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		const FVector4 Position(
+			(Corner & 1) ? Bound.Max.X : Bound.Min.X,
+			(Corner & 2) ? Bound.Max.Y : Bound.Min.Y,
+			(Corner & 4) ? Bound.Max.Z : Bound.Min.Z,
+			1.0f);
+		const FVector4 Clip = Position * ViewProjection;
+
+		// 근평면 앞/뒤에 걸치면 검사하지 않음 (보이는 것으로 처리)
+		if (Clip.W <= KINDA_SMALL_NUMBER || Clip.Z < 0.0f)
+		{
+			return false;
+		}
+
+		const float InvW = 1.0f / Clip.W;
+		const float NX = Clip.X * InvW;
+		const float NY = Clip.Y * InvW;
+		MinX = std::min(MinX, NX);
+		MaxX = std::max(MaxX, NX);
+		MinY = std::min(MinY, NY);
+		MaxY = std::max(MaxY, NY);
+		MinZ = std::min(MinZ, Clip.Z * InvW);
+	}
 
-			// 직전이 가려짐이면, thresh 미만 동안은 가려짐 유지
-			if (LastState[id] == 0 && VisibleStreak[id] < thresh)
-				occluded = true;
+	// 2. 타일 범위 (화면 밖은 잘라냄, 완전히 밖이면 절두체 컬링 몫이므로 보이는 것으로)
+	const float PixelMinX = (MinX * 0.5f + 0.5f) * static_cast<float>(Width);
+	const float PixelMaxX = (MaxX * 0.5f + 0.5f) * static_cast<float>(Width);
+	const float PixelMinY = (0.5f - MaxY * 0.5f) * static_cast<float>(Height);
+	const float PixelMaxY = (0.5f - MinY * 0.5f) * static_cast<float>(Height);
+	if (PixelMaxX < 0.0f || PixelMaxY < 0.0f || PixelMinX >= static_cast<float>(Width) || PixelMinY >= static_cast<float>(Height))
+	{
+		return false;
+	}
+
+	const int32 MinTileX = std::max(0, static_cast<int32>(std::max(PixelMinX, 0.0f)) / TileWidth);
+	const int32 MaxTileX = std::min(TilesX - 1, static_cast<int32>(std::min(PixelMaxX, static_cast<float>(Width - 1))) / TileWidth);
+	const int32 MinTileY = std::max(0, static_cast<int32>(std::max(PixelMinY, 0.0f)) / TileHeight);
+	const int32 MaxTileY = std::min(TilesY - 1, static_cast<int32>(std::min(PixelMaxY, static_cast<float>(Height - 1))) / TileHeight);
+
+	// 3. 사각형이 4x4 텍셀 이내로 들어오는 HZB 레벨에서 먼저 검사
+	int32 Level = 0;
+	while (Level + 1 < HZBLevels.Num() &&
+		((MaxTileX >> Level) - (MinTileX >> Level) >= 4 || (MaxTileY >> Level) - (MinTileY >> Level) >= 4))
+	{
+		++Level;
+	}
+
+	if (SampleMaxDepth(Level, MinTileX, MinTileY, MaxTileX, MaxTileY) < MinZ)
+	{
+		return true;
+	}
+
+	// 4. 상위 레벨은 주변 타일까지 섞이므로, 타일 수가 적으면 타일 레벨에서 재검사
+	const int32 NumTiles = (MaxTileX - MinTileX + 1) * (MaxTileY - MinTileY + 1);
+	if (Level > 0 && NumTiles <= MaxRefineTiles)
+	{
+		return SampleMaxDepth(0, MinTileX, MinTileY, MaxTileX, MaxTileY) < MinZ;
+	}
+
+	return false;
+}
+
+int32 FOcclusionCullingManagerCPU::TestOccludees(const TFrameArray<FAABB>& Bounds, TFrameArray<uint8>& InOutVisibility)
+{
+	if (Occluders.IsEmpty())
+	{
+		return 0;
+	}
+
+	const int32 Num = std::min(Bounds.Num(), InOutVisibility.Num());
+	int32 NumHiddenBefore = 0;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		NumHiddenBefore += (InOutVisibility[i] == 0) ? 1 : 0;
+	}
+
+	FTaskSystem::GetInstance().ParallelFor(Num, [this, &Bounds, &InOutVisibility](int32 Index)
+	{
+		if (InOutVisibility[Index] && IsOccluded(Bounds[Index]))
+		{
+			InOutVisibility[Index] = 0;
 		}
+	}, 64);
 
-		LastState[id] = occluded ? 0 : 1;
-		OutVisibleFlags[id] = occluded ? 0 : 1;
+	int32 NumHiddenAfter = 0;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		NumHiddenAfter += (InOutVisibility[i] == 0) ? 1 : 0;
 	}
-}
\ No newline at end of file
+	return NumHiddenAfter - NumHiddenBefore;
+}
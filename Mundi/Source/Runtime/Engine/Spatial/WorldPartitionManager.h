@@ -38,6 +38,11 @@ public:
     //void RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates);
     void RayQueryClosest(FRay InRay, OUT AActor*& OutActor, OUT float& OutBestT);
 	void FrustumQuery(FFrustum InFrustum);
+	// 읽기 전용 컴포넌트 단위 절두체 쿼리 (BVH에 캐시된 바운드 기준)
+	void FrustumQuery(const FFrustum& InFrustum, TFrameArray<UPrimitiveComponent*>& OutComponents) const;
+
+	// 갱신 큐에서 대기 중이면 BVH에 캐시된 바운드가 낡았을 수 있음
+	bool IsDirty(UPrimitiveComponent* Smc) const { return ComponentDirtySet.Contains(Smc); }
 
 	/** 옥트리 게터 */
 	FOctree* GetSceneOctree() const { return SceneOctree; }
@@ -55,7 +60,7 @@ private:
 	void ClearBVHierarchy();
 	
 	TQueue<UPrimitiveComponent*> ComponentDirtyQueue; // 추가 혹은 갱신이 필요한 요소의 대기 큐
-	TSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
+	TFlatSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
 	FOctree* SceneOctree = nullptr;
 	FBVHierarchy* BVH = nullptr;
 };
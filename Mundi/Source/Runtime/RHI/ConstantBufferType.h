@@ -251,7 +251,11 @@ struct FTileCullingBufferType
     uint32 bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint32 ViewportStartX;    // 뷰포트 시작 X 좌표
     uint32 ViewportStartY;    // 뷰포트 시작 Y 좌표
-    uint32 Padding[2];
+    uint32 ClusterSliceCount; // 깊이 슬라이스 개수
+    uint32 Padding;
+    float ClusterDepthScale;  // Slice = floor(log(ViewZ) * Scale + Bias)
+    float ClusterDepthBias;
+    float Padding2[2];
 };
 
 struct FPointLightShadowBufferType
@@ -2,6 +2,7 @@
 #include "StatsOverlayD2D.h"
 #include "GameUI/SGameHUD.h"
 #include "Color.h"
+#include <d3d11_4.h>
 
 void D3D11RHI::Initialize(HWND hWindow)
 {
@@ -25,11 +26,148 @@ void D3D11RHI::Initialize(HWND hWindow)
     SGameHUD::Get().Initialize(Device, DeviceContext, SwapChain);
 }
 
+bool D3D11RHI::InitializeHeadless(UINT Width, UINT Height, bool bUseWarp)
+{
+    // 윈도우/스왑체인 없이 초기화 (-headless). 백 버퍼는 오프스크린 텍스처, D2D 오버레이/HUD는 만들지 않음
+    bHeadless = true;
+    HeadlessWidth = FMath::Max(Width, 1u);
+    HeadlessHeight = FMath::Max(Height, 1u);
+
+    if (!CreateHeadlessDevice(bUseWarp))
+    {
+        return false;
+    }
+    CreateFrameBuffer();
+    CreateIdBuffer();
+    CreateDepthOfFieldBuffers();
+    CreateRasterizerState();
+    CreateBlendState();
+    CONSTANT_BUFFER_LIST(CREATE_CONSTANT_BUFFER);
+
+	CreateDepthStencilState();
+	CreateSamplerState();
+    UResourceManager::GetInstance().Initialize(Device,DeviceContext);
+    return true;
+}
+
+bool D3D11RHI::EnableRenderThread(int32 MaxQueuedFrames)
+{
+    if (RenderThread)
+        return true;
+    if (!Device || !DeviceContext)
+        return false;
+
+    // 즉시 컨텍스트를 두 스레드가 씀 (렌더 스레드: 실행/Present, 게임 스레드: 텍스처 로드/D2D) → 호출 단위 잠금
+    if (FAILED(Device->QueryInterface(__uuidof(ID3D11Multithread), reinterpret_cast<void**>(&Multithread))))
+    {
+        UE_LOG("[warning] D3D11RHI: ID3D11Multithread 미지원, 렌더 스레드 없이 실행합니다");
+        Multithread = nullptr;
+        return false;
+    }
+    Multithread->SetMultithreadProtected(TRUE);
+
+    ID3D11DeviceContext* DeferredContext = nullptr;
+    if (FAILED(Device->CreateDeferredContext(0, &DeferredContext)))
+    {
+        UE_LOG("[warning] D3D11RHI: 지연 컨텍스트 생성 실패, 렌더 스레드 없이 실행합니다");
+        Multithread->Release();
+        Multithread = nullptr;
+        return false;
+    }
+
+    // 이후 GetDeviceContext()를 쓰는 모든 렌더링 코드는 지연 컨텍스트에 기록됨
+    ImmediateContext = DeviceContext;
+    DeviceContext = DeferredContext;
+    DeviceContext->RSSetViewports(1, &ViewportInfo);
+
+    MaxQueuedFrames = FMath::Clamp(MaxQueuedFrames, 1, MAX_OVERLAY_SLOTS - 1);
+
+    // 오버레이 합성용 상태/셰이더 (크기와 무관, 한 번만 생성)
+    if (SwapChain)
+    {
+        NumOverlaySlots = MaxQueuedFrames + 1;
+
+        D3D11_BLEND_DESC BlendDesc = {};
+        D3D11_RENDER_TARGET_BLEND_DESC& Rt0 = BlendDesc.RenderTarget[0];
+        Rt0.BlendEnable = TRUE;
+        Rt0.SrcBlend = D3D11_BLEND_ONE;               // D2D 출력은 premultiplied alpha
+        Rt0.DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+        Rt0.BlendOp = D3D11_BLEND_OP_ADD;
+        Rt0.SrcBlendAlpha = D3D11_BLEND_ONE;
+        Rt0.DestBlendAlpha = D3D11_BLEND_INV_SRC_ALPHA;
+        Rt0.BlendOpAlpha = D3D11_BLEND_OP_ADD;
+        Rt0.RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+        Device->CreateBlendState(&BlendDesc, &BlendStatePremultipliedAlpha);
+
+        UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>(UResourceManager::FullScreenVSPath);
+        UShader* BlitPS = UResourceManager::GetInstance().Load<UShader>(UResourceManager::BlitPSPath);
+        if (FullScreenTriangleVS && FullScreenTriangleVS->GetVertexShader() && BlitPS && BlitPS->GetPixelShader())
+        {
+            OverlayVS = FullScreenTriangleVS->GetVertexShader();
+            OverlayVS->AddRef();
+            OverlayPS = BlitPS->GetPixelShader();
+            OverlayPS->AddRef();
+        }
+
+        CreateOverlayBuffers();
+    }
+
+    RenderThread = std::make_unique<FRenderThread>();
+    RenderThread->Start(this, MaxQueuedFrames);
+
+    UE_LOG("[info] D3D11RHI: 렌더 스레드 시작 (큐 깊이 %d)", MaxQueuedFrames);
+    return true;
+}
+
+void D3D11RHI::DisableRenderThread()
+{
+    if (!RenderThread)
+        return;
+
+    // 큐에 남은 프레임을 모두 제출한 뒤 종료
+    RenderThread->Stop();
+    CompletedFrameNumber = RenderThread->GetCompletedFrame();
+    RenderThread.reset();
+
+    // 제출되지 않은 기록은 버리고 즉시 컨텍스트로 복귀
+    ID3D11CommandList* DiscardedCommands = nullptr;
+    if (SUCCEEDED(DeviceContext->FinishCommandList(FALSE, &DiscardedCommands)) && DiscardedCommands)
+    {
+        DiscardedCommands->Release();
+    }
+    DeviceContext->Release();
+    DeviceContext = ImmediateContext;
+    ImmediateContext = nullptr;
+
+    ReleaseOverlayBuffers();
+    NumOverlaySlots = 0;
+    if (BlendStatePremultipliedAlpha) { BlendStatePremultipliedAlpha->Release(); BlendStatePremultipliedAlpha = nullptr; }
+    if (OverlayVS) { OverlayVS->Release(); OverlayVS = nullptr; }
+    if (OverlayPS) { OverlayPS->Release(); OverlayPS = nullptr; }
+
+    if (Multithread)
+    {
+        Multithread->Release();
+        Multithread = nullptr;
+    }
+}
+
+void D3D11RHI::FlushRenderThread()
+{
+    if (RenderThread)
+    {
+        RenderThread->Flush();
+    }
+}
+
 void D3D11RHI::Release()
 {
     // Prevent double Release() calls
     if (bReleased) return;
     bReleased = true;
+
+    // 렌더 스레드가 쓰는 리소스를 해제하기 전에 먼저 종료
+    DisableRenderThread();
     if (DeviceContext)
     {
         // 파이프라인에서 바인딩된 상태/리소스를 명시적으로 해제
@@ -326,6 +464,7 @@ HRESULT D3D11RHI::CreateIndexBuffer(ID3D11Device* Device, const TArray<uint32>&
     D3D11_SUBRESOURCE_DATA InitData = {};
     InitData.pSysMem = Indices.data();
 
+    FRHIStatManager::GetInstance().RecordBufferCreate(IndexBufferDesc.ByteWidth);
     return Device->CreateBuffer(&IndexBufferDesc, &InitData, OutBuffer);
 }
 
@@ -560,16 +699,180 @@ void D3D11RHI::DrawFullScreenQuad()
 
     // 2. 정점 셰이더를 6번 실행하여 큰 삼각형 2개를 그리도록 명령합니다.
     DeviceContext->Draw(6, 0);
+    FRHIStatManager::GetInstance().RecordDraw();
 }
 
 void D3D11RHI::Present()
 {
+    // 렌더 스레드: 이 프레임의 기록을 닫아 넘기고 바로 다음 프레임으로 (실행/Present는 렌더 스레드)
+    if (RenderThread)
+    {
+        // 제출에 실패하면 프레임 번호를 소비하지 않음 (지연 해제 펜스가 오지 않을 프레임을 기다리지 않도록)
+        if (SubmitFrameToRenderThread())
+        {
+            ++FrameNumber;
+        }
+        return;
+    }
+
     // Game HUD 렌더링 (Update는 SViewportWindow에서 처리)
     SGameHUD::Get().Render();
 
-    // Draw any Direct2D overlays before present
+    if (SwapChain)
+    {
+        // Draw any Direct2D overlays before present
+        UStatsOverlayD2D::Get().Draw();
+        SwapChain->Present(0, 0); // vsync on
+    }
+    else
+    {
+        // 헤드리스는 제출할 화면이 없음 (커맨드는 Flush로 드라이버에 넘김)
+        DeviceContext->Flush();
+    }
+
+    CompletedFrameNumber = FrameNumber++;
+}
+
+bool D3D11RHI::SubmitFrameToRenderThread()
+{
+    FRenderFrame Frame;
+    Frame.FrameNumber = FrameNumber;
+
+    if (NumOverlaySlots > 0)
+    {
+        Frame.OverlaySlot = static_cast<int32>(FrameNumber % NumOverlaySlots);
+        DrawOverlays(Frame.OverlaySlot);
+    }
+
+    // TRUE: 지연 컨텍스트 상태를 다음 프레임으로 이어감 (즉시 컨텍스트와 같은 의미 유지)
+    if (FAILED(DeviceContext->FinishCommandList(TRUE, &Frame.CommandList)) || !Frame.CommandList)
+    {
+        UE_LOG("[error] D3D11RHI: FinishCommandList 실패 (프레임 %llu)", FrameNumber);
+        return false;
+    }
+
+    // 큐가 차 있으면 여기서 블록 (게임 스레드는 MaxQueuedFrames 프레임까지만 앞서감)
+    RenderThread->EnqueueFrame(Frame);
+    return true;
+}
+
+void D3D11RHI::DrawOverlays(int32 Slot)
+{
+    // D2D는 즉시 컨텍스트에 상태를 바꿔가며 그리므로 렌더 스레드의 실행/합성과 섞이지 않게 전체를 잠금
+    FScopedImmediateContextLock Lock(Multithread);
+
+    const float Transparent[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    ImmediateContext->ClearRenderTargetView(OverlayRTVs[Slot], Transparent);
+
+    IDXGISurface* Surface = nullptr;
+    if (FAILED(OverlayTextures[Slot]->QueryInterface(__uuidof(IDXGISurface), reinterpret_cast<void**>(&Surface))))
+        return;
+
+    SGameHUD::Get().SetTargetSurface(Surface);
+    UStatsOverlayD2D::Get().SetTargetSurface(Surface);
+
+    SGameHUD::Get().Render();
     UStatsOverlayD2D::Get().Draw();
-    SwapChain->Present(0, 0); // vsync on
+
+    SGameHUD::Get().SetTargetSurface(nullptr);
+    UStatsOverlayD2D::Get().SetTargetSurface(nullptr);
+    Surface->Release();
+}
+
+void D3D11RHI::ExecuteFrame(const FRenderFrame& Frame, FGPUTimer& GPUTimer)
+{
+    {
+        // 실행 → 합성은 즉시 컨텍스트 상태를 이어 쓰므로 한 번에 잠금
+        FScopedImmediateContextLock Lock(Multithread);
+
+        GPUTimer.Begin(ImmediateContext);
+        ImmediateContext->ExecuteCommandList(Frame.CommandList, FALSE);
+        if (Frame.OverlaySlot >= 0)
+        {
+            CompositeOverlay(Frame.OverlaySlot);
+        }
+        GPUTimer.End(ImmediateContext);
+
+        // 백 버퍼 바인딩 해제 (OnResize의 ResizeBuffers 대비)
+        ImmediateContext->ClearState();
+    }
+    Frame.CommandList->Release();
+
+    if (SwapChain)
+    {
+        SwapChain->Present(0, 0);
+    }
+    else
+    {
+        ImmediateContext->Flush();
+    }
+}
+
+void D3D11RHI::CompositeOverlay(int32 Slot)
+{
+    if (!BackBufferOverlayRTV || !OverlaySRVs[Slot] || !OverlayVS || !OverlayPS)
+        return;
+
+    ImmediateContext->OMSetRenderTargets(1, &BackBufferOverlayRTV, nullptr);
+    ImmediateContext->OMSetBlendState(BlendStatePremultipliedAlpha, nullptr, 0xffffffff);
+    ImmediateContext->OMSetDepthStencilState(DepthStencilStateDisable, 0);
+    ImmediateContext->RSSetState(NoCullRasterizerState);
+    ImmediateContext->RSSetViewports(1, &OverlayViewport);
+
+    ImmediateContext->IASetInputLayout(nullptr);
+    ImmediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    ImmediateContext->VSSetShader(OverlayVS, nullptr, 0);
+    ImmediateContext->PSSetShader(OverlayPS, nullptr, 0);
+    ImmediateContext->PSSetShaderResources(0, 1, &OverlaySRVs[Slot]);
+    ImmediateContext->PSSetSamplers(0, 1, &PointClampSamplerState);
+
+    ImmediateContext->Draw(6, 0);
+}
+
+void D3D11RHI::CreateOverlayBuffers()
+{
+    if (NumOverlaySlots == 0 || !FrameBuffer)
+        return;
+
+    UINT Width = 0;
+    UINT Height = 0;
+    GetBackBufferSize(Width, Height);
+
+    // D2D 타겟이 되므로 스왑체인과 같은 B8G8R8A8_UNORM
+    D3D11_TEXTURE2D_DESC Desc = {};
+    Desc.Width = Width;
+    Desc.Height = Height;
+    Desc.MipLevels = 1;
+    Desc.ArraySize = 1;
+    Desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+    Desc.SampleDesc.Count = 1;
+    Desc.Usage = D3D11_USAGE_DEFAULT;
+    Desc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+
+    for (int32 Slot = 0; Slot < NumOverlaySlots; ++Slot)
+    {
+        Device->CreateTexture2D(&Desc, nullptr, &OverlayTextures[Slot]);
+        Device->CreateRenderTargetView(OverlayTextures[Slot], nullptr, &OverlayRTVs[Slot]);
+        Device->CreateShaderResourceView(OverlayTextures[Slot], nullptr, &OverlaySRVs[Slot]);
+    }
+
+    D3D11_RENDER_TARGET_VIEW_DESC OverlayRTVDesc = {};
+    OverlayRTVDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+    OverlayRTVDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2D;
+    Device->CreateRenderTargetView(FrameBuffer, &OverlayRTVDesc, &BackBufferOverlayRTV);
+
+    OverlayViewport = { 0.0f, 0.0f, (float)Width, (float)Height, 0.0f, 1.0f };
+}
+
+void D3D11RHI::ReleaseOverlayBuffers()
+{
+    for (int32 Slot = 0; Slot < MAX_OVERLAY_SLOTS; ++Slot)
+    {
+        if (OverlaySRVs[Slot]) { OverlaySRVs[Slot]->Release(); OverlaySRVs[Slot] = nullptr; }
+        if (OverlayRTVs[Slot]) { OverlayRTVs[Slot]->Release(); OverlayRTVs[Slot] = nullptr; }
+        if (OverlayTextures[Slot]) { OverlayTextures[Slot]->Release(); OverlayTextures[Slot] = nullptr; }
+    }
+    if (BackBufferOverlayRTV) { BackBufferOverlayRTV->Release(); BackBufferOverlayRTV = nullptr; }
 }
 
 void D3D11RHI::CreateDeviceAndSwapChain(HWND hWindow)
@@ -606,13 +909,80 @@ void D3D11RHI::CreateDeviceAndSwapChain(HWND hWindow)
     ViewportInfo = { 0.0f, 0.0f, (float)swapchaindesc.BufferDesc.Width, (float)swapchaindesc.BufferDesc.Height, 0.0f, 1.0f };
 }
 
+bool D3D11RHI::CreateHeadlessDevice(bool bUseWarp)
+{
+    D3D_FEATURE_LEVEL featurelevels[] = { D3D_FEATURE_LEVEL_11_0 };
+    const UINT createDeviceFlags = D3D11_CREATE_DEVICE_BGRA_SUPPORT;
+
+    // NULL 드라이버: 리소스 생성/맵/상태 설정/드로우 호출은 받지만 래스터화하지 않음 → CPU 측 비용만 측정
+    // (D3D SDK 레이어가 설치된 환경에서만 생성 가능하므로 실패하면 WARP 소프트웨어 드라이버로 대체)
+    HRESULT hr = E_FAIL;
+    if (!bUseWarp)
+    {
+        hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_NULL, nullptr, createDeviceFlags,
+            featurelevels, ARRAYSIZE(featurelevels), D3D11_SDK_VERSION, &Device, nullptr, &DeviceContext);
+        DriverType = D3D_DRIVER_TYPE_NULL;
+    }
+    if (FAILED(hr))
+    {
+        if (!bUseWarp)
+        {
+            UE_LOG("[warning] D3D11RHI: NULL 드라이버 생성 실패, WARP로 대체합니다 (GPU 작업이 CPU 시간에 포함됨)");
+        }
+        hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_WARP, nullptr, createDeviceFlags,
+            featurelevels, ARRAYSIZE(featurelevels), D3D11_SDK_VERSION, &Device, nullptr, &DeviceContext);
+        DriverType = D3D_DRIVER_TYPE_WARP;
+    }
+    if (FAILED(hr) || !Device || !DeviceContext)
+    {
+        UE_LOG("[error] D3D11RHI: 헤드리스 디바이스 생성 실패 (hr=0x%08X)", static_cast<uint32>(hr));
+        DriverType = D3D_DRIVER_TYPE_UNKNOWN;
+        return false;
+    }
+
+    ViewportInfo = { 0.0f, 0.0f, (float)HeadlessWidth, (float)HeadlessHeight, 0.0f, 1.0f };
+    return true;
+}
+
+void D3D11RHI::GetBackBufferSize(UINT& OutWidth, UINT& OutHeight) const
+{
+    if (SwapChain)
+    {
+        DXGI_SWAP_CHAIN_DESC SwapDesc;
+        SwapChain->GetDesc(&SwapDesc);
+        OutWidth = SwapDesc.BufferDesc.Width;
+        OutHeight = SwapDesc.BufferDesc.Height;
+        return;
+    }
+
+    OutWidth = HeadlessWidth;
+    OutHeight = HeadlessHeight;
+}
+
 void D3D11RHI::CreateFrameBuffer()
 {
-    DXGI_SWAP_CHAIN_DESC swapDesc;
-    SwapChain->GetDesc(&swapDesc);
+    UINT BackBufferWidth = 0;
+    UINT BackBufferHeight = 0;
+    GetBackBufferSize(BackBufferWidth, BackBufferHeight);
 
-    // 백 버퍼 가져오기
-    SwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void**)&FrameBuffer);
+    // 백 버퍼 가져오기 (헤드리스는 스왑체인 대신 같은 포맷의 오프스크린 텍스처)
+    if (SwapChain)
+    {
+        SwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void**)&FrameBuffer);
+    }
+    else
+    {
+        D3D11_TEXTURE2D_DESC FrameBufferDesc = {};
+        FrameBufferDesc.Width = BackBufferWidth;
+        FrameBufferDesc.Height = BackBufferHeight;
+        FrameBufferDesc.MipLevels = 1;
+        FrameBufferDesc.ArraySize = 1;
+        FrameBufferDesc.Format = DXGI_FORMAT_B8G8R8A8_TYPELESS;
+        FrameBufferDesc.SampleDesc.Count = 1;
+        FrameBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+        FrameBufferDesc.BindFlags = D3D11_BIND_RENDER_TARGET;
+        Device->CreateTexture2D(&FrameBufferDesc, nullptr, &FrameBuffer);
+    }
 
     // 렌더 타겟 뷰 생성
     D3D11_RENDER_TARGET_VIEW_DESC framebufferRTVdesc = {};
@@ -625,8 +995,8 @@ void D3D11RHI::CreateFrameBuffer()
     // 핑퐁(ping-pong) 버퍼 텍스처 생성 (SRV 지원)
     // =====================================
     D3D11_TEXTURE2D_DESC SceneDesc = {};
-    SceneDesc.Width = swapDesc.BufferDesc.Width;
-    SceneDesc.Height = swapDesc.BufferDesc.Height;
+    SceneDesc.Width = BackBufferWidth;
+    SceneDesc.Height = BackBufferHeight;
     SceneDesc.MipLevels = 1;
     SceneDesc.ArraySize = 1;
     SceneDesc.Format = DXGI_FORMAT_B8G8R8A8_TYPELESS;
@@ -676,8 +1046,8 @@ void D3D11RHI::CreateFrameBuffer()
     // =====================================
 
     D3D11_TEXTURE2D_DESC depthDesc = {};
-    depthDesc.Width = swapDesc.BufferDesc.Width;
-    depthDesc.Height = swapDesc.BufferDesc.Height;
+    depthDesc.Width = BackBufferWidth;
+    depthDesc.Height = BackBufferHeight;
     depthDesc.MipLevels = 1;
     depthDesc.ArraySize = 1;
     depthDesc.Format = DXGI_FORMAT_R24G8_TYPELESS; // Typeless 포맷으로 변경
@@ -709,15 +1079,16 @@ void D3D11RHI::CreateFrameBuffer()
 void D3D11RHI::CreateIdBuffer()
 {
 
-    DXGI_SWAP_CHAIN_DESC SwapDesc;
-    SwapChain->GetDesc(&SwapDesc);
+    UINT BackBufferWidth = 0;
+    UINT BackBufferHeight = 0;
+    GetBackBufferSize(BackBufferWidth, BackBufferHeight);
 
     D3D11_TEXTURE2D_DESC TextureDesc{};
     TextureDesc.Format = DXGI_FORMAT_R32_UINT;
     TextureDesc.CPUAccessFlags = 0;
     TextureDesc.Usage = D3D11_USAGE_DEFAULT;
-    TextureDesc.Width = SwapDesc.BufferDesc.Width;
-    TextureDesc.Height = SwapDesc.BufferDesc.Height;
+    TextureDesc.Width = BackBufferWidth;
+    TextureDesc.Height = BackBufferHeight;
     TextureDesc.MipLevels = 1;
     TextureDesc.ArraySize = 1;
     TextureDesc.SampleDesc.Count = 1;
@@ -757,15 +1128,16 @@ void D3D11RHI::CreateIdBuffer()
 
 void D3D11RHI::CreateDepthOfFieldBuffers()
 {
-	DXGI_SWAP_CHAIN_DESC SwapDesc;
-	SwapChain->GetDesc(&SwapDesc);
+	UINT BackBufferWidth = 0;
+	UINT BackBufferHeight = 0;
+	GetBackBufferSize(BackBufferWidth, BackBufferHeight);
 
 	// =====================================
 	// DoF CoC Map (Circle of Confusion)
 	// =====================================
 	D3D11_TEXTURE2D_DESC CoCDesc = {};
-	CoCDesc.Width = SwapDesc.BufferDesc.Width;
-	CoCDesc.Height = SwapDesc.BufferDesc.Height;
+	CoCDesc.Width = BackBufferWidth;
+	CoCDesc.Height = BackBufferHeight;
 	CoCDesc.MipLevels = 1;
 	CoCDesc.ArraySize = 1;
 	CoCDesc.Format = DXGI_FORMAT_R16G16B16A16_FLOAT; // CoC 값 + 원본 색상
@@ -811,8 +1183,8 @@ void D3D11RHI::CreateDepthOfFieldBuffers()
 	// DoF Blur Map
 	// =====================================
 	D3D11_TEXTURE2D_DESC BlurDesc = {};
-	BlurDesc.Width = SwapDesc.BufferDesc.Width;
-	BlurDesc.Height = SwapDesc.BufferDesc.Height;
+	BlurDesc.Width = BackBufferWidth;
+	BlurDesc.Height = BackBufferHeight;
 	BlurDesc.MipLevels = 1;
 	BlurDesc.ArraySize = 1;
 	BlurDesc.Format = DXGI_FORMAT_R16G16B16A16_FLOAT;
@@ -858,8 +1230,8 @@ void D3D11RHI::CreateDepthOfFieldBuffers()
 	// DoF Near Map
 	// =====================================
 	D3D11_TEXTURE2D_DESC NearDesc = {};
-	NearDesc.Width = SwapDesc.BufferDesc.Width;
-	NearDesc.Height = SwapDesc.BufferDesc.Height;
+	NearDesc.Width = BackBufferWidth;
+	NearDesc.Height = BackBufferHeight;
 	NearDesc.MipLevels = 1;
 	NearDesc.ArraySize = 1;
 	NearDesc.Format = DXGI_FORMAT_R16G16B16A16_FLOAT;
@@ -905,8 +1277,8 @@ void D3D11RHI::CreateDepthOfFieldBuffers()
 	// DoF Far Map
 	// =====================================
 	D3D11_TEXTURE2D_DESC FarDesc = {};
-	FarDesc.Width = SwapDesc.BufferDesc.Width;
-	FarDesc.Height = SwapDesc.BufferDesc.Height;
+	FarDesc.Width = BackBufferWidth;
+	FarDesc.Height = BackBufferHeight;
 	FarDesc.MipLevels = 1;
 	FarDesc.ArraySize = 1;
 	FarDesc.Format = DXGI_FORMAT_R16G16B16A16_FLOAT;
@@ -1015,6 +1387,7 @@ void D3D11RHI::CreateConstantBuffer(ID3D11Buffer** ConstantBuffer, uint32 Size)
     BufferDesc.ByteWidth = (Size+15) & ~15;
     BufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
     BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    FRHIStatManager::GetInstance().RecordBufferCreate(BufferDesc.ByteWidth);
     Device->CreateBuffer(&BufferDesc, nullptr, ConstantBuffer);
 }
 
@@ -1029,6 +1402,7 @@ void D3D11RHI::UpdateUVScrollConstantBuffers(const FVector2D& Speed, float TimeS
     {
         memcpy(mapped.pData, &data, sizeof(data));
         DeviceContext->Unmap(UVScrollCB, 0);
+        FRHIStatManager::GetInstance().RecordConstantBufferUpdate(sizeof(data));
         DeviceContext->PSSetConstantBuffers(5, 1, &UVScrollCB);
     }
 }
@@ -1381,10 +1755,11 @@ void D3D11RHI::OnResize(UINT NewWidth, UINT NewHeight)
 
     if (!SwapChain) return;
 
+    // 렌더 스레드가 백 버퍼를 쓰는 프레임을 모두 제출할 때까지 대기
+    FlushRenderThread();
+
     // 렌더링 완료까지 대기 (중요!)
-    if (DeviceContext) {
-        DeviceContext->Flush();
-    }
+    GetImmediateContext()->Flush();
 
     // 현재 렌더 타겟 언바인딩
     if (DeviceContext) {
@@ -1393,6 +1768,7 @@ void D3D11RHI::OnResize(UINT NewWidth, UINT NewHeight)
 
 
     // 기존 리소스 해제
+    ReleaseOverlayBuffers();
     ReleaseFrameBuffer();
     ReleaseIdBuffer();
     ReleaseDepthOfFieldBuffers();
@@ -1416,6 +1792,7 @@ void D3D11RHI::OnResize(UINT NewWidth, UINT NewHeight)
     CreateIdBuffer();
     CreateDepthOfFieldBuffers();
     ResizeRenderTextures();
+    CreateOverlayBuffers();
 
     // 뷰포트 갱신
     ViewportInfo.TopLeftX = 0.0f;
@@ -1587,6 +1964,7 @@ HRESULT D3D11RHI::CreateStructuredBuffer(UINT InElementSize, UINT InElementCount
     bufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
     bufferDesc.StructureByteStride = InElementSize;
 
+    FRHIStatManager::GetInstance().RecordBufferCreate(bufferDesc.ByteWidth);
     if (InInitData)
     {
         D3D11_SUBRESOURCE_DATA initData = {};
@@ -1627,5 +2005,6 @@ void D3D11RHI::UpdateStructuredBuffer(ID3D11Buffer* InBuffer, const void* InData
     {
         memcpy(mappedResource.pData, InData, InDataSize);
         DeviceContext->Unmap(InBuffer, 0);
+        FRHIStatManager::GetInstance().RecordMap(InDataSize);
     }
 }
@@ -4,6 +4,8 @@
 #include "VertexData.h"
 #include "ConstantBufferType.h"
 #include "RenderTexture.h"
+#include "RHIStats.h"
+#include "RenderThread.h"
 
 
 #define DECLARE_CONSTANT_BUFFER(TYPE)\
@@ -55,8 +57,27 @@ public:
 public:
 	void Initialize(HWND hWindow);
 
+	// 윈도우 없이 초기화 (CI/벤치마크용 -headless). 기본은 D3D11 NULL 드라이버, 없거나 bUseWarp면 WARP
+	// 디바이스를 만들지 못하면 false (이후 리소스는 생성하지 않음)
+	bool InitializeHeadless(UINT Width, UINT Height, bool bUseWarp = false);
+	bool IsHeadless() const { return bHeadless; }
+	// 실제로 생성된 드라이버 (NULL 요청이 WARP로 대체되었을 수 있음)
+	D3D_DRIVER_TYPE GetDriverType() const { return DriverType; }
+
 	void Release();
 
+	// 렌더 스레드 (게임 빌드): 켜면 GetDeviceContext()는 지연 컨텍스트를 반환하고, Present()가 기록을 닫아 렌더 스레드로 넘김
+	// MaxQueuedFrames: 게임 스레드가 렌더 스레드보다 앞설 수 있는 프레임 수 (1 ~ MAX_OVERLAY_SLOTS - 1)
+	bool EnableRenderThread(int32 MaxQueuedFrames = 1);
+	void DisableRenderThread();
+	void FlushRenderThread();
+	bool IsRenderThreadEnabled() const { return RenderThread != nullptr; }
+	const FRenderThread* GetRenderThread() const { return RenderThread.get(); }
+
+	// 프레임 펜스: 지금 기록 중인 프레임 번호 / Present까지 끝난 마지막 프레임 번호
+	uint64 GetFrameNumber() const { return FrameNumber; }
+	uint64 GetCompletedFrameNumber() const { return RenderThread ? RenderThread->GetCompletedFrame() : CompletedFrameNumber; }
+
 
 public:
 	// clear
@@ -91,6 +112,7 @@ public:
 		D3D11_SUBRESOURCE_DATA InitData = {};
 		InitData.pSysMem = Vertices.data();
 
+		FRHIStatManager::GetInstance().RecordBufferCreate(BufferDesc.ByteWidth);
 		return Device->CreateBuffer(&BufferDesc, &InitData, OutBuffer);
 	}
 
@@ -118,6 +140,7 @@ public:
 
 		const size_t DataSizeInBytes = Data.size() * sizeof(T);
 		memcpy(MSR.pData, Data.data(), DataSizeInBytes);
+		FRHIStatManager::GetInstance().RecordMap(DataSizeInBytes);
 
 		Context->Unmap(VertexBuffer, 0);
 	}
@@ -132,6 +155,7 @@ public:
 
 		const size_t DataSizeInBytes = Data.size() * sizeof(TVertex);
 		memcpy(MSR.pData, Data.data(), DataSizeInBytes);
+		FRHIStatManager::GetInstance().RecordMap(DataSizeInBytes);
 
 		DeviceContext->Unmap(VertexBuffer, 0);
 	}
@@ -143,6 +167,7 @@ public:
 		DeviceContext->Map(ConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR);
 		memcpy(MSR.pData, &Data, sizeof(T));
 		DeviceContext->Unmap(ConstantBuffer, 0);
+		FRHIStatManager::GetInstance().RecordConstantBufferUpdate(sizeof(T));
 	}
 	template <typename T>
 	void ConstantBufferSetUpdate(ID3D11Buffer* ConstantBuffer, T& Data, const uint32 Slot, const bool bIsVS, const bool bIsPS)
@@ -231,6 +256,13 @@ public:
 	{
 		return DeviceContext;
 	}
+	// 즉시 컨텍스트 (GetData, Map READ 등 지연 컨텍스트에서 불가능한 호출용)
+	// 렌더 스레드가 켜져 있으면 여러 호출을 이어서 할 때 FScopedImmediateContextLock(GetMultithread())으로 감쌀 것
+	inline ID3D11DeviceContext* GetImmediateContext()
+	{
+		return ImmediateContext ? ImmediateContext : DeviceContext;
+	}
+	ID3D11Multithread* GetMultithread() const { return Multithread; }
 	inline IDXGISwapChain* GetSwapChain()
 	{
 		return SwapChain;
@@ -243,6 +275,8 @@ public:
 
 private:
 	void CreateDeviceAndSwapChain(HWND hWindow); // 여기서 디바이스, 디바이스 컨택스트, 스왑체인, 뷰포트를 초기화한다
+	bool CreateHeadlessDevice(bool bUseWarp);
+	void GetBackBufferSize(UINT& OutWidth, UINT& OutHeight) const;
 	void CreateFrameBuffer();
 	void CreateIdBuffer();
 	void CreateDepthOfFieldBuffers();
@@ -260,6 +294,19 @@ private:
 	void ReleaseDepthOfFieldBuffers();
 	void ReleaseDeviceAndSwapChain();
 
+	// 렌더 스레드 전용: 커맨드 리스트 실행 → D2D 오버레이 합성 → Present
+	friend class FRenderThread;
+	void ExecuteFrame(const FRenderFrame& Frame, FGPUTimer& GPUTimer);
+	void CompositeOverlay(int32 Slot);
+
+	// 게임 스레드: 기록을 닫고(FinishCommandList) 렌더 스레드 큐에 넣음 (실패하면 아무것도 넣지 않고 false)
+	bool SubmitFrameToRenderThread();
+	void DrawOverlays(int32 Slot);
+
+	// 오버레이 텍스처/UNORM 백 버퍼 RTV (백 버퍼 크기 의존, 리사이즈 시 재생성)
+	void CreateOverlayBuffers();
+	void ReleaseOverlayBuffers();
+
 	// FSwapGuard 클래스가 D3D11RHI의 private 멤버에 접근할 수 있도록 허용
 	friend class FSwapGuard;
 	// 씬 컬러 버퍼의 읽기/쓰기 역할을 교환합니다. FSwapGuard에서만 호출하기 때문에 private으로 설정
@@ -352,6 +399,32 @@ private:
 	UShader* PreShader = nullptr; // Shaders, Inputlayout
 
 	bool bReleased = false; // Prevent double Release() calls
+
+	// 헤드리스 (스왑체인 없음, 백 버퍼 크기 고정)
+	bool bHeadless = false;
+	UINT HeadlessWidth = 0;
+	UINT HeadlessHeight = 0;
+	D3D_DRIVER_TYPE DriverType = D3D_DRIVER_TYPE_HARDWARE;
+
+	// 렌더 스레드 (EnableRenderThread): DeviceContext는 지연 컨텍스트, ImmediateContext는 원래 즉시 컨텍스트
+	std::unique_ptr<FRenderThread> RenderThread;
+	ID3D11DeviceContext* ImmediateContext = nullptr;
+	ID3D11Multithread* Multithread = nullptr;
+	uint64 FrameNumber = 1;
+	uint64 CompletedFrameNumber = 0;	// 단일 스레드 경로의 펜스 (Present 직후 갱신)
+
+	// D2D 오버레이(HUD/통계)는 즉시 컨텍스트를 쓰므로 게임 스레드가 프레임별 텍스처에 그리고, 렌더 스레드가 Present 전에 합성
+	// 슬롯 수 = 큐 깊이 + 1 → 아직 합성되지 않은 프레임의 텍스처는 덮어쓰지 않음
+	static const int32 MAX_OVERLAY_SLOTS = 3;
+	int32 NumOverlaySlots = 0;
+	ID3D11Texture2D* OverlayTextures[MAX_OVERLAY_SLOTS] = {};
+	ID3D11RenderTargetView* OverlayRTVs[MAX_OVERLAY_SLOTS] = {};
+	ID3D11ShaderResourceView* OverlaySRVs[MAX_OVERLAY_SLOTS] = {};
+	ID3D11RenderTargetView* BackBufferOverlayRTV = nullptr;	// UNORM (D2D가 직접 그릴 때와 같은 공간에서 블렌딩)
+	D3D11_VIEWPORT OverlayViewport{};
+	ID3D11BlendState* BlendStatePremultipliedAlpha = nullptr;
+	ID3D11VertexShader* OverlayVS = nullptr;	// 핫 리로드와 무관하게 렌더 스레드가 쓰도록 AddRef한 복사본
+	ID3D11PixelShader* OverlayPS = nullptr;
 };
 
 
@@ -377,6 +450,7 @@ inline HRESULT D3D11RHI::CreateVertexBufferImpl(ID3D11Device* device, const FMes
 	D3D11_SUBRESOURCE_DATA vinitData = {};
 	vinitData.pSysMem = vertexArray.data();
 
+	FRHIStatManager::GetInstance().RecordBufferCreate(vbd.ByteWidth);
 	return device->CreateBuffer(&vbd, &vinitData, outBuffer);
 }
 
@@ -436,6 +510,7 @@ inline HRESULT D3D11RHI::CreateVertexBufferImpl(ID3D11Device* Device, const std:
 	D3D11_SUBRESOURCE_DATA InitData = {};
 	InitData.pSysMem = VertexArray.data();
 
+	FRHIStatManager::GetInstance().RecordBufferCreate(BufferDesc.ByteWidth);
 	return Device->CreateBuffer(&BufferDesc, &InitData, OutBuffer);
 }
 
@@ -487,5 +562,6 @@ inline HRESULT D3D11RHI::CreateVertexBuffer<FVertexDynamic>(ID3D11Device* Device
 	D3D11_SUBRESOURCE_DATA InitData = {};
 	InitData.pSysMem = VertexArray.data();
 
+	FRHIStatManager::GetInstance().RecordBufferCreate(BufferDesc.ByteWidth);
 	return Device->CreateBuffer(&BufferDesc, &InitData, OutBuffer);
 }
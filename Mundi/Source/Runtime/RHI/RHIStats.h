@@ -0,0 +1,126 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <atomic>
+
+// RHI 호출 통계 (D3D11RHI 래퍼 + 렌더러/컴포넌트의 직접 호출 지점에서 기록)
+// 헤드리스 실행(-headless)에서 CPU 렌더 비용과 함께 드로우/업로드 양을 회귀 측정하는 데 사용
+struct FRHIStats
+{
+	// 버퍼 생성 (정점/인덱스/상수/구조화/인스턴스)
+	uint64 BufferCreates = 0;
+	uint64 BufferCreateBytes = 0;
+
+	// Map(WRITE_DISCARD) 후 CPU가 쓴 업로드 (상수 버퍼 제외)
+	uint64 BufferMaps = 0;
+	uint64 BufferMapBytes = 0;
+
+	// 상수 버퍼 갱신
+	uint64 ConstantBufferUpdates = 0;
+	uint64 ConstantBufferBytes = 0;
+
+	// 드로우 호출 (인스턴스 드로우는 1회)
+	uint64 DrawCalls = 0;
+	uint64 DrawInstances = 0;
+
+	void Reset()
+	{
+		*this = FRHIStats();
+	}
+
+	void Accumulate(const FRHIStats& Other)
+	{
+		BufferCreates += Other.BufferCreates;
+		BufferCreateBytes += Other.BufferCreateBytes;
+		BufferMaps += Other.BufferMaps;
+		BufferMapBytes += Other.BufferMapBytes;
+		ConstantBufferUpdates += Other.ConstantBufferUpdates;
+		ConstantBufferBytes += Other.ConstantBufferBytes;
+		DrawCalls += Other.DrawCalls;
+		DrawInstances += Other.DrawInstances;
+	}
+};
+
+// RHI 통계 전역 매니저 (싱글톤)
+// 기록은 여러 스레드에서 올 수 있으므로(에셋 로드 중 버퍼 생성 등) 카운터는 relaxed atomic
+// URenderer::BeginFrame이 EndFrameStats()로 직전 프레임 값을 확정하고 누적 합계에 더함
+class FRHIStatManager
+{
+public:
+	static FRHIStatManager& GetInstance()
+	{
+		static FRHIStatManager Instance;
+		return Instance;
+	}
+
+	void RecordBufferCreate(uint64 Bytes)
+	{
+		BufferCreates.fetch_add(1, std::memory_order_relaxed);
+		BufferCreateBytes.fetch_add(Bytes, std::memory_order_relaxed);
+	}
+
+	void RecordMap(uint64 Bytes)
+	{
+		BufferMaps.fetch_add(1, std::memory_order_relaxed);
+		BufferMapBytes.fetch_add(Bytes, std::memory_order_relaxed);
+	}
+
+	void RecordConstantBufferUpdate(uint64 Bytes)
+	{
+		ConstantBufferUpdates.fetch_add(1, std::memory_order_relaxed);
+		ConstantBufferBytes.fetch_add(Bytes, std::memory_order_relaxed);
+	}
+
+	void RecordDraw(uint64 NumInstances = 1)
+	{
+		DrawCalls.fetch_add(1, std::memory_order_relaxed);
+		DrawInstances.fetch_add(NumInstances, std::memory_order_relaxed);
+	}
+
+	// 현재까지 기록된 값을 직전 프레임 통계로 확정하고 카운터를 리셋
+	void EndFrameStats()
+	{
+		LastFrameStats.BufferCreates = BufferCreates.exchange(0, std::memory_order_relaxed);
+		LastFrameStats.BufferCreateBytes = BufferCreateBytes.exchange(0, std::memory_order_relaxed);
+		LastFrameStats.BufferMaps = BufferMaps.exchange(0, std::memory_order_relaxed);
+		LastFrameStats.BufferMapBytes = BufferMapBytes.exchange(0, std::memory_order_relaxed);
+		LastFrameStats.ConstantBufferUpdates = ConstantBufferUpdates.exchange(0, std::memory_order_relaxed);
+		LastFrameStats.ConstantBufferBytes = ConstantBufferBytes.exchange(0, std::memory_order_relaxed);
+		LastFrameStats.DrawCalls = DrawCalls.exchange(0, std::memory_order_relaxed);
+		LastFrameStats.DrawInstances = DrawInstances.exchange(0, std::memory_order_relaxed);
+
+		TotalStats.Accumulate(LastFrameStats);
+		++NumFrames;
+	}
+
+	// 직전 프레임 통계
+	const FRHIStats& GetStats() const { return LastFrameStats; }
+
+	// ResetTotals 이후 누적 합계 / 프레임 수
+	const FRHIStats& GetTotalStats() const { return TotalStats; }
+	uint64 GetNumFrames() const { return NumFrames; }
+
+	void ResetTotals()
+	{
+		TotalStats.Reset();
+		NumFrames = 0;
+	}
+
+private:
+	FRHIStatManager() = default;
+	~FRHIStatManager() = default;
+	FRHIStatManager(const FRHIStatManager&) = delete;
+	FRHIStatManager& operator=(const FRHIStatManager&) = delete;
+
+	std::atomic<uint64> BufferCreates{ 0 };
+	std::atomic<uint64> BufferCreateBytes{ 0 };
+	std::atomic<uint64> BufferMaps{ 0 };
+	std::atomic<uint64> BufferMapBytes{ 0 };
+	std::atomic<uint64> ConstantBufferUpdates{ 0 };
+	std::atomic<uint64> ConstantBufferBytes{ 0 };
+	std::atomic<uint64> DrawCalls{ 0 };
+	std::atomic<uint64> DrawInstances{ 0 };
+
+	FRHIStats LastFrameStats;
+	FRHIStats TotalStats;
+	uint64 NumFrames = 0;
+};
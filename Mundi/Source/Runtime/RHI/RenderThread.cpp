@@ -0,0 +1,121 @@
+﻿#include "pch.h"
+#include "RenderThread.h"
+#include <d3d11_4.h>
+#include <chrono>
+
+FRenderThread::~FRenderThread()
+{
+	Stop();
+}
+
+void FRenderThread::Start(D3D11RHI* InRHIDevice, int32 InMaxQueuedFrames)
+{
+	if (IsRunning())
+	{
+		return;
+	}
+
+	RHIDevice = InRHIDevice;
+	MaxQueuedFrames = FMath::Max(InMaxQueuedFrames, 1);
+	bStopRequested = false;
+	GPUTimer.Initialize(RHIDevice->GetDevice());
+
+	Thread = std::thread([this]() { Run(); });
+}
+
+void FRenderThread::Stop()
+{
+	if (!IsRunning())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		bStopRequested = true;
+	}
+	QueueCondition.notify_all();
+	Thread.join();
+
+	GPUTimer.Release();
+}
+
+void FRenderThread::EnqueueFrame(const FRenderFrame& Frame)
+{
+	const auto WaitStart = std::chrono::high_resolution_clock::now();
+	{
+		std::unique_lock<std::mutex> Lock(QueueMutex);
+		DoneCondition.wait(Lock, [this]() { return static_cast<int32>(PendingFrames.size()) < MaxQueuedFrames; });
+		PendingFrames.push_back(Frame);
+	}
+	QueueCondition.notify_one();
+
+	const std::chrono::duration<double, std::milli> Waited = std::chrono::high_resolution_clock::now() - WaitStart;
+	LastEnqueueWaitMS.store(Waited.count(), std::memory_order_relaxed);
+}
+
+void FRenderThread::Flush()
+{
+	std::unique_lock<std::mutex> Lock(QueueMutex);
+	DoneCondition.wait(Lock, [this]() { return PendingFrames.empty(); });
+}
+
+void FRenderThread::Run()
+{
+	// 렌더 스레드의 할당은 모두 렌더링으로 집계
+	FMemoryTagScope TagScope(EMemoryTag::Rendering);
+
+	while (true)
+	{
+		FRenderFrame Frame;
+		{
+			std::unique_lock<std::mutex> Lock(QueueMutex);
+			QueueCondition.wait(Lock, [this]() { return bStopRequested || !PendingFrames.empty(); });
+
+			// 종료 요청이어도 남은 프레임은 모두 제출
+			if (PendingFrames.empty())
+			{
+				break;
+			}
+			Frame = PendingFrames.front();
+		}
+
+		const auto SubmitStart = std::chrono::high_resolution_clock::now();
+
+		// 지난 프레임들의 GPU 시간 (ring buffer, 준비 안 됐으면 -1)
+		const float GPUTimeMS = GPUTimer.GetElapsedTimeMS(RHIDevice->GetImmediateContext());
+		if (GPUTimeMS >= 0.0f)
+		{
+			LastGPUTimeMS.store(static_cast<double>(GPUTimeMS), std::memory_order_relaxed);
+		}
+
+		RHIDevice->ExecuteFrame(Frame, GPUTimer);
+
+		const std::chrono::duration<double, std::milli> Submitted = std::chrono::high_resolution_clock::now() - SubmitStart;
+		LastSubmitTimeMS.store(Submitted.count(), std::memory_order_relaxed);
+
+		{
+			std::lock_guard<std::mutex> Lock(QueueMutex);
+			PendingFrames.pop_front();
+			CompletedFrame.store(Frame.FrameNumber, std::memory_order_release);
+		}
+		DoneCondition.notify_all();
+	}
+}
+
+FScopedImmediateContextLock::FScopedImmediateContextLock(ID3D11Multithread* InMultithread)
+	: Multithread(InMultithread)
+{
+	if (Multithread)
+	{
+		Multithread->Enter();
+	}
+}
+
+FScopedImmediateContextLock::~FScopedImmediateContextLock()
+{
+	if (Multithread)
+	{
+		Multithread->Leave();
+	}
+}
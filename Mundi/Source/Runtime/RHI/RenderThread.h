@@ -0,0 +1,100 @@
+﻿#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include "UEContainer.h"
+#include "GPUTimer.h"
+
+class D3D11RHI;
+struct ID3D11CommandList;
+struct ID3D11Multithread;
+
+// 렌더 스레드로 넘기는 한 프레임 (커맨드 리스트는 렌더 스레드가 실행 후 Release)
+struct FRenderFrame
+{
+	ID3D11CommandList* CommandList = nullptr;
+	int32 OverlaySlot = -1;		// D2D 오버레이 텍스처 슬롯 (-1이면 합성 안 함)
+	uint64 FrameNumber = 0;
+};
+
+/**
+ * FRenderThread
+ * 게임 빌드의 렌더 스레드입니다. (D3D11RHI 소유, EnableRenderThread로 시작)
+ *
+ * - 게임 스레드는 틱 후 씬 렌더를 지연 컨텍스트에 기록하고, FinishCommandList로 얻은 커맨드 리스트를 EnqueueFrame으로 넘김
+ *   커맨드 리스트는 그 프레임의 상태/드로우/동적 버퍼 내용을 모두 담은 불변 스냅샷이라, 렌더 스레드가 N 프레임을
+ *   즉시 컨텍스트에 실행하고 Present하는 동안 게임 스레드는 라이브 컴포넌트로 N+1 프레임을 틱/기록할 수 있음
+ * - 겹치는 것은 "N 실행/Present/GPU" ↔ "N+1 틱/기록"까지. 씬 기록(FSceneRenderer)은 여전히 게임 스레드에서 라이브
+ *   컴포넌트를 순회하므로 틱과 기록은 직렬이며, 둘을 겹치려면 렌더 프록시 스냅샷이 필요함 (미구현)
+ * - 큐 깊이 제한: 완료되지 않은 프레임이 MaxQueuedFrames개면 EnqueueFrame이 블록 (게임 스레드는 그만큼만 앞서감)
+ * - 펜스: GetCompletedFrame()은 렌더 스레드가 Present까지 끝낸 마지막 프레임 번호 (URenderer 지연 해제 기준)
+ */
+class FRenderThread
+{
+public:
+	FRenderThread() = default;
+	~FRenderThread();
+
+	void Start(D3D11RHI* InRHIDevice, int32 InMaxQueuedFrames);
+
+	// 남은 프레임을 모두 제출한 뒤 스레드 종료
+	void Stop();
+
+	// 큐에 자리가 날 때까지 블록 후 추가
+	void EnqueueFrame(const FRenderFrame& Frame);
+
+	// 큐에 들어간 모든 프레임이 Present될 때까지 대기 (리사이즈/종료 전)
+	void Flush();
+
+	bool IsRunning() const { return Thread.joinable(); }
+	int32 GetMaxQueuedFrames() const { return MaxQueuedFrames; }
+	uint64 GetCompletedFrame() const { return CompletedFrame.load(std::memory_order_acquire); }
+
+	// 통계 (ms): 게임 스레드가 큐 자리를 기다린 시간, 렌더 스레드의 실행+Present 시간, GPU 프레임 시간 (N-7 프레임)
+	double GetLastEnqueueWaitMS() const { return LastEnqueueWaitMS.load(std::memory_order_relaxed); }
+	double GetLastSubmitTimeMS() const { return LastSubmitTimeMS.load(std::memory_order_relaxed); }
+	double GetLastGPUTimeMS() const { return LastGPUTimeMS.load(std::memory_order_relaxed); }
+
+private:
+	void Run();
+
+	D3D11RHI* RHIDevice = nullptr;
+	int32 MaxQueuedFrames = 1;
+
+	std::thread Thread;
+	std::mutex QueueMutex;
+	std::condition_variable QueueCondition;		// 렌더 스레드 대기 (새 프레임/종료)
+	std::condition_variable DoneCondition;		// 게임 스레드 대기 (프레임 완료)
+	std::deque<FRenderFrame> PendingFrames;		// 맨 앞은 실행 중인 프레임 (완료 후 제거)
+	bool bStopRequested = false;
+
+	std::atomic<uint64> CompletedFrame{ 0 };
+
+	// 즉시 컨텍스트에서만 GetData 가능하므로 GPU 프레임 시간은 렌더 스레드가 측정
+	FGPUTimer GPUTimer;
+
+	std::atomic<double> LastEnqueueWaitMS{ 0.0 };
+	std::atomic<double> LastSubmitTimeMS{ 0.0 };
+	std::atomic<double> LastGPUTimeMS{ 0.0 };
+};
+
+/**
+ * 즉시 컨텍스트 잠금 (ID3D11Multithread::Enter/Leave)
+ * 렌더 스레드가 켜져 있으면 D2D 오버레이처럼 게임 스레드가 즉시 컨텍스트에 여러 호출을 이어서 하는 구간을 감쌈
+ * (nullptr이면 아무것도 하지 않음)
+ */
+class FScopedImmediateContextLock
+{
+public:
+	explicit FScopedImmediateContextLock(ID3D11Multithread* InMultithread);
+	~FScopedImmediateContextLock();
+
+	FScopedImmediateContextLock(const FScopedImmediateContextLock&) = delete;
+	FScopedImmediateContextLock& operator=(const FScopedImmediateContextLock&) = delete;
+
+private:
+	ID3D11Multithread* Multithread;
+};
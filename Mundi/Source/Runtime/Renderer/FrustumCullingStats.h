@@ -0,0 +1,74 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 씬 절두체 컬링 통계 (FSceneRenderer::PerformFrustumCulling)
+struct FFrustumCullingStats
+{
+	// 스태틱 메시
+	uint32 TestedMeshes = 0;
+	uint32 VisibleMeshes = 0;
+	uint32 CulledMeshes = 0;
+
+	// 데칼
+	uint32 TestedDecals = 0;
+	uint32 VisibleDecals = 0;
+	uint32 CulledDecals = 0;
+
+	// 컬링 대상이 아닌 메시 (바운드가 없는 스키닝 메시 등, 항상 통과)
+	uint32 UnculledMeshes = 0;
+
+	// BVH 쿼리 사용 여부 (false면 평탄 배열 병렬 검사)
+	bool bUsedBVH = false;
+
+	// 소프트웨어 오클루전 컬링 (절두체를 통과한 스태틱 메시 대상, OccludedMeshes는 CulledMeshes에도 포함)
+	uint32 OccluderMeshes = 0;
+	uint32 OccluderTriangles = 0;
+	uint32 OccludedMeshes = 0;
+	double OcclusionTimeMS = 0.0;
+
+	// 성능 메트릭
+	double CullingTimeMS = 0.0;
+
+	void Reset()
+	{
+		*this = FFrustumCullingStats();
+	}
+};
+
+// 절두체 컬링 통계 전역 매니저 (싱글톤)
+// UStatsOverlayD2D에서 접근할 수 있도록 전역 통계 제공
+class FFrustumCullingStatManager
+{
+public:
+	static FFrustumCullingStatManager& GetInstance()
+	{
+		static FFrustumCullingStatManager Instance;
+		return Instance;
+	}
+
+	// 통계 업데이트
+	void UpdateStats(const FFrustumCullingStats& InStats)
+	{
+		CurrentStats = InStats;
+	}
+
+	// 통계 조회
+	const FFrustumCullingStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	// 통계 리셋
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+	}
+
+private:
+	FFrustumCullingStatManager() = default;
+	~FFrustumCullingStatManager() = default;
+	FFrustumCullingStatManager(const FFrustumCullingStatManager&) = delete;
+	FFrustumCullingStatManager& operator=(const FFrustumCullingStatManager&) = delete;
+
+	FFrustumCullingStats CurrentStats;
+};
@@ -6,6 +6,7 @@
 #include "PointLightComponent.h"
 #include "D3D11RHI.h"
 #include "World.h"
+#include "Hash.h"
 
 #define NUM_POINT_LIGHT_MAX 256
 #define NUM_SPOT_LIGHT_MAX 256
@@ -28,6 +29,7 @@ void FLightManager::Initialize(D3D11RHI* RHIDevice, uint32 InShadowAtlasSize2D,
 	// Set shadow atlas sizes from parameters
 	ShadowAtlasSize2D = InShadowAtlasSize2D;
 	AtlasSizeCube = InAtlasSizeCube;
+	InvalidateShadowCache();
 	CubeArrayCount = InCubeArrayCount;
 
 	// --- 1. Structured Buffers (t17, t18) ---
@@ -485,6 +487,9 @@ void FLightManager::ClearAllDepthStencilView(D3D11RHI* RHIDevice)
 	
 	// 비워진 리소스를 다시 할당 시키려고
 	bHaveToUpdate = true;
+
+	// 비워진 섀도우맵은 다시 그려야 함
+	InvalidateShadowCache();
 }
 
 bool FLightManager::GetCachedShadowData(ULightComponent* Light, int32 SubViewIndex, FShadowMapData& OutData) const
@@ -650,6 +655,83 @@ void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutR
 	}
 }
 
+bool FLightManager::UpdateShadowAtlasLayout2D(const TArray<FShadowRenderRequest>& InRequests2D)
+{
+	// 아틀라스 크기 + 요청별 (라이트, 서브 뷰, 영역)
+	uint64 LayoutHash = HashCombine(0, ShadowAtlasSize2D);
+	for (const FShadowRenderRequest& Request : InRequests2D)
+	{
+		LayoutHash = HashCombine(LayoutHash, reinterpret_cast<uint64>(Request.LightOwner));
+		LayoutHash = HashCombine(LayoutHash, static_cast<uint64>(Request.SubViewIndex));
+		LayoutHash = HashCombine(LayoutHash, static_cast<uint64>(Request.Size));
+		LayoutHash = HashCombine(LayoutHash, static_cast<uint64>(Request.AtlasViewportOffset.X));
+		LayoutHash = HashCombine(LayoutHash, static_cast<uint64>(Request.AtlasViewportOffset.Y));
+	}
+
+	if (LayoutHash == ShadowAtlasLayoutHash2D)
+	{
+		return true;
+	}
+
+	ShadowAtlasLayoutHash2D = LayoutHash;
+	ShadowSignatureCache2D.clear();
+	return false;
+}
+
+bool FLightManager::IsShadowViewCached2D(ULightComponent* Light, int32 SubViewIndex, uint64 Signature) const
+{
+	if (Signature == 0 || SubViewIndex < 0)
+	{
+		return false;
+	}
+
+	const TArray<uint64>* Signatures = ShadowSignatureCache2D.Find(Light);
+	return Signatures && SubViewIndex < Signatures->Num() && (*Signatures)[SubViewIndex] == Signature;
+}
+
+void FLightManager::SetShadowViewSignature2D(ULightComponent* Light, int32 SubViewIndex, uint64 Signature)
+{
+	if (!Light || SubViewIndex < 0)
+	{
+		return;
+	}
+
+	TArray<uint64>& Signatures = ShadowSignatureCache2D[Light];
+	if (Signatures.Num() <= SubViewIndex)
+	{
+		Signatures.resize(SubViewIndex + 1, 0);
+	}
+	Signatures[SubViewIndex] = Signature;
+}
+
+bool FLightManager::IsShadowCubeFaceCached(int32 SliceIndex, int32 FaceIndex, uint64 Signature) const
+{
+	const int32 Index = SliceIndex * 6 + FaceIndex;
+	return Signature != 0 && SliceIndex >= 0 && Index < ShadowSignatureCacheCube.Num() && ShadowSignatureCacheCube[Index] == Signature;
+}
+
+void FLightManager::SetShadowCubeFaceSignature(int32 SliceIndex, int32 FaceIndex, uint64 Signature)
+{
+	if (SliceIndex < 0 || FaceIndex < 0 || FaceIndex >= 6)
+	{
+		return;
+	}
+
+	const int32 Index = SliceIndex * 6 + FaceIndex;
+	if (ShadowSignatureCacheCube.Num() <= Index)
+	{
+		ShadowSignatureCacheCube.resize(Index + 1, 0);
+	}
+	ShadowSignatureCacheCube[Index] = Signature;
+}
+
+void FLightManager::InvalidateShadowCache()
+{
+	ShadowSignatureCache2D.clear();
+	ShadowSignatureCacheCube.Empty();
+	ShadowAtlasLayoutHash2D = 0;
+}
+
 void FLightManager::ClearAllLightList()
 {
 	AmbientLightList.clear();
@@ -668,6 +750,7 @@ void FLightManager::ClearAllLightList()
 
 	ShadowDataCache2D.clear();
 	ShadowDataCacheCube.clear();
+	InvalidateShadowCache();
 }
 
 template<typename T>
@@ -752,6 +835,7 @@ void FLightManager::DeRegisterLight<UDirectionalLightComponent>(UDirectionalLigh
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	ShadowSignatureCache2D.Remove(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent* LightComponent)
@@ -783,6 +867,7 @@ void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* Li
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	ShadowSignatureCache2D.Remove(LightComponent);
 }
 
 
@@ -159,6 +159,16 @@ public:
     void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D);
     void AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube);
 
+    // --- 섀도우맵 캐시 (라이트와 캐스터가 그대로인 섀도우 뷰는 다시 그리지 않음) ---
+    // 서명은 FShadowCasterCuller::CullShadowView가 계산 (0 = 캐시 불가)
+    // 2D 아틀라스 배치(모든 요청의 영역)가 지난번과 다르면 2D 캐시를 비우고 false 반환 → 호출자가 전체 클리어
+    bool UpdateShadowAtlasLayout2D(const TArray<FShadowRenderRequest>& InRequests2D);
+    bool IsShadowViewCached2D(ULightComponent* Light, int32 SubViewIndex, uint64 Signature) const;
+    void SetShadowViewSignature2D(ULightComponent* Light, int32 SubViewIndex, uint64 Signature);
+    bool IsShadowCubeFaceCached(int32 SliceIndex, int32 FaceIndex, uint64 Signature) const;
+    void SetShadowCubeFaceSignature(int32 SliceIndex, int32 FaceIndex, uint64 Signature);
+    void InvalidateShadowCache();
+
     TArray<UAmbientLightComponent*> GetAmbientLightList() { return AmbientLightList; }
     TArray<UDirectionalLightComponent*> GetDirectionalLightList() { return DIrectionalLightList; }
     TArray<UPointLightComponent*> GetPointLightList() { return PointLightList; }
@@ -210,6 +220,13 @@ private:
     // Key: 라이트, Value: 할당된 큐브맵 슬라이스 인덱스
     TMap<ULightComponent*, int32> ShadowDataCacheCube;
 
+    // --- 섀도우맵 캐시 서명 ---
+    // Key: 라이트, Value: SubViewIndex별 마지막으로 그린 서명
+    TMap<ULightComponent*, TArray<uint64>> ShadowSignatureCache2D;
+    // 인덱스: Slice * 6 + Face
+    TArray<uint64> ShadowSignatureCacheCube;
+    uint64 ShadowAtlasLayoutHash2D = 0;
+
 
     //structured buffer
     ID3D11Buffer* PointLightBuffer = nullptr;
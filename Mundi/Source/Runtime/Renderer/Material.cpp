@@ -87,6 +87,7 @@ void UMaterial::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 void UMaterial::SetShader(UShader* InShaderResource)
 {
 	Shader = InShaderResource;
+	MarkDrawCommandsDirty();
 }
 
 void UMaterial::SetShaderByName(const FString& InShaderName)
@@ -112,6 +113,7 @@ void UMaterial::SetShaderMacros(const TArray<FShaderMacro>& InShaderMacro)
 	}
 
 	ShaderMacros = InShaderMacro;
+	MarkDrawCommandsDirty();
 }
 
 UTexture* UMaterial::GetTexture(EMaterialTextureSlot Slot) const
@@ -168,8 +170,15 @@ void UMaterial::ResolveTextures()
 
 void UMaterial::SetMaterialInfo(const FMaterialInfo& InMaterialInfo)
 {
+	const bool bWasTranslucent = IsTranslucent();
 	MaterialInfo = InMaterialInfo;
 	ResolveTextures();
+
+	// 반투명 여부가 바뀌면 캐시된 커맨드의 RenderMode도 바뀌어야 함
+	if (IsTranslucent() != bWasTranslucent)
+	{
+		MarkDrawCommandsDirty();
+	}
 }
 
 
@@ -324,12 +333,18 @@ void UMaterialInstanceDynamic::CopyParametersFrom(const UMaterialInstanceDynamic
 		return;
 	}
 
+	const bool bWasTranslucent = IsTranslucent();
+
 	// 부모는 생성 시(Create) 설정되므로, 여기서는 덮어쓴 값만 복사합니다.
 	this->OverriddenTextures = Other->OverriddenTextures;
 	this->OverriddenScalarParameters = Other->OverriddenScalarParameters;
 	this->OverriddenColorParameters = Other->OverriddenColorParameters;
 
 	this->bIsCachedMaterialInfoDirty = true;
+	if (IsTranslucent() != bWasTranslucent)
+	{
+		MarkDrawCommandsDirty();
+	}
 }
 
 UMaterialInstanceDynamic::UMaterialInstanceDynamic(UMaterialInterface* InParentMaterial)
@@ -338,6 +353,13 @@ UMaterialInstanceDynamic::UMaterialInstanceDynamic(UMaterialInterface* InParentM
 	// 생성자에서는 부모 포인터를 저장하는 것 외에 아무것도 하지 않습니다.
 }
 
+uint32 UMaterialInstanceDynamic::GetDrawCommandRevision() const
+{
+	// 두 값 모두 증가만 하므로 합이 바뀌면 어느 쪽이든 변경된 것
+	const uint32 ParentRevision = ParentMaterial ? ParentMaterial->GetDrawCommandRevision() : 0;
+	return UMaterialInterface::GetDrawCommandRevision() + ParentRevision;
+}
+
 UShader* UMaterialInstanceDynamic::GetShader()
 {
 	// 셰이더는 항상 부모의 것을 그대로 사용합니다.
@@ -516,8 +538,17 @@ void UMaterialInstanceDynamic::SetColorParameterValue(const FString& ParameterNa
 
 void UMaterialInstanceDynamic::SetScalarParameterValue(const FString& ParameterName, float Value)
 {
+	// RenderMode를 바꿀 수 있는 건 Transparency뿐 (나머지 스칼라는 드로우 시점에 상수 버퍼로 읽힘)
+	const bool bAffectsRenderMode = (ParameterName == "Transparency");
+	const bool bWasTranslucent = bAffectsRenderMode && IsTranslucent();
+
 	OverriddenScalarParameters.Add(ParameterName, Value);
 	bIsCachedMaterialInfoDirty = true;
+
+	if (bAffectsRenderMode && IsTranslucent() != bWasTranslucent)
+	{
+		MarkDrawCommandsDirty();
+	}
 }
 
 void UMaterialInstanceDynamic::SetOverriddenTextureParameters(const TMap<EMaterialTextureSlot, UTexture*>& InTextures)
@@ -528,8 +559,13 @@ void UMaterialInstanceDynamic::SetOverriddenTextureParameters(const TMap<EMateri
 
 void UMaterialInstanceDynamic::SetOverriddenScalarParameters(const TMap<FString, float>& InScalars)
 {
+	const bool bWasTranslucent = IsTranslucent();
 	OverriddenScalarParameters = InScalars;
 	bIsCachedMaterialInfoDirty = true; // 스칼라 값이 변경되었으므로 캐시를 갱신해야 함
+	if (IsTranslucent() != bWasTranslucent)
+	{
+		MarkDrawCommandsDirty();
+	}
 }
 
 void UMaterialInstanceDynamic::SetOverriddenVectorParameters(const TMap<FString, FLinearColor>& InVectors)
@@ -26,6 +26,19 @@ public:
 	virtual bool HasTexture(EMaterialTextureSlot Slot) const = 0;
 	virtual const FMaterialInfo& GetMaterialInfo() const = 0;
 	virtual const TArray<FShaderMacro> GetShaderMacros() const = 0;
+
+	// Transparency > 0이면 반투명 배치 (CollectMeshBatches의 RenderMode 판정과 동일)
+	bool IsTranslucent() const { return GetMaterialInfo().Transparency > 0.0f; }
+
+	// 캐시된 드로우 커맨드에 영향을 주는 변경(셰이더, 매크로, 반투명 여부)마다 바뀌는 값
+	// 커맨드 빌드 시 기록해 두고 다르면 이 머티리얼을 쓰는 커맨드만 다시 빌드 (FScene::GetDrawCommands)
+	virtual uint32 GetDrawCommandRevision() const { return DrawCommandRevision; }
+
+protected:
+	void MarkDrawCommandsDirty() { ++DrawCommandRevision; }
+
+private:
+	uint32 DrawCommandRevision = 0;
 };
 
 
@@ -94,6 +107,7 @@ public:
 	bool HasTexture(EMaterialTextureSlot Slot) const override;
 	const FMaterialInfo& GetMaterialInfo() const override;
 	UMaterialInterface* GetParentMaterial() const { return ParentMaterial; }
+	uint32 GetDrawCommandRevision() const override;	// 부모 변경도 반영 (셰이더/매크로는 부모 것을 사용)
 	
 	const TArray<FShaderMacro> GetShaderMacros() const override;	// 이 인스턴스에 덮어쓴 매크로가 없다면 부모의 매크로를, 있다면 덮어쓴 매크로를 반환합니다.
 
@@ -0,0 +1,153 @@
+﻿#include "pch.h"
+#include "MeshDrawCommand.h"
+#include "Material.h"
+
+namespace
+{
+	constexpr int32 ShaderIdBits = 16;
+	constexpr int32 MaterialIdBits = 16;
+	constexpr int32 VertexBufferIdBits = 20;
+	constexpr int32 DepthBucketBits = 12;
+
+	constexpr uint32 ShaderIdMask = (1u << ShaderIdBits) - 1;
+	constexpr uint32 MaterialIdMask = (1u << MaterialIdBits) - 1;
+	constexpr uint32 VertexBufferIdMask = (1u << VertexBufferIdBits) - 1;
+	constexpr uint32 DepthBucketMask = (1u << DepthBucketBits) - 1;
+
+	constexpr int32 VertexBufferIdShift = DepthBucketBits;
+	constexpr int32 MaterialIdShift = VertexBufferIdShift + VertexBufferIdBits;
+	constexpr int32 ShaderIdShift = MaterialIdShift + MaterialIdBits;
+
+	// 값 → [1, Mask] ID (0은 null 전용). 같은 값은 항상 같은 ID, 충돌은 정렬 품질에만 영향
+	uint32 MakeStateId(uint64 Value, uint32 Mask)
+	{
+		// 포인터 하위 비트는 정렬 때문에 거의 0이므로 섞은 뒤 접음 (murmur3 finalizer)
+		Value ^= Value >> 33;
+		Value *= 0xff51afd7ed558ccdull;
+		Value ^= Value >> 33;
+		return static_cast<uint32>(Value % Mask) + 1;
+	}
+}
+
+uint64 FMeshDrawCommandCache::MakeStateKey(const FMeshBatchElement& Batch)
+{
+	uint32 ShaderId = 0;
+	if (Batch.VertexShader || Batch.PixelShader)
+	{
+		const uint64 ShaderKey = reinterpret_cast<uint64>(Batch.VertexShader) * 31 ^ reinterpret_cast<uint64>(Batch.PixelShader);
+		ShaderId = MakeStateId(ShaderKey, ShaderIdMask);
+	}
+
+	// 머티리얼은 UUID (파괴 후 주소가 재사용돼도 다른 ID), D3D 리소스는 주소 해시
+	const uint32 MaterialId = Batch.Material ? (Batch.Material->UUID % MaterialIdMask) + 1 : 0;
+	const uint32 VertexBufferId = Batch.VertexBuffer ? MakeStateId(reinterpret_cast<uint64>(Batch.VertexBuffer), VertexBufferIdMask) : 0;
+
+	return (static_cast<uint64>(ShaderId) << ShaderIdShift)
+		| (static_cast<uint64>(MaterialId) << MaterialIdShift)
+		| (static_cast<uint64>(VertexBufferId) << VertexBufferIdShift);
+}
+
+uint64 FMeshDrawCommandCache::MakeSortKey(uint64 StateKey, const FMeshBatchElement& Batch, const FVector& ViewLocation, float MaxDistance)
+{
+	const FVector Origin(Batch.WorldMatrix.M[3][0], Batch.WorldMatrix.M[3][1], Batch.WorldMatrix.M[3][2]);
+	const float Distance = (Origin - ViewLocation).Size();
+
+	uint32 DepthBucket = DepthBucketMask;
+	if (MaxDistance > KINDA_SMALL_NUMBER)
+	{
+		const float Normalized = FMath::Clamp(Distance / MaxDistance, 0.0f, 1.0f);
+		DepthBucket = static_cast<uint32>(Normalized * static_cast<float>(DepthBucketMask));
+	}
+
+	return StateKey | DepthBucket;
+}
+
+void FMeshDrawCommandSorter::Sort(const TFrameArray<uint64>& Keys, TFrameArray<uint32>& OutOrder)
+{
+	const int32 Num = Keys.Num();
+	OutOrder.SetNum(Num);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		OutOrder[i] = static_cast<uint32>(i);
+	}
+
+	if (Num <= 1)
+	{
+		return;
+	}
+
+	// 1. 적으면 비교 정렬 (키가 같으면 인덱스로 비교하여 안정 정렬과 같은 결과)
+	if (Num < RadixSortThreshold)
+	{
+		std::sort(OutOrder.begin(), OutOrder.end(), [&Keys](uint32 A, uint32 B)
+		{
+			return Keys[A] < Keys[B] || (Keys[A] == Keys[B] && A < B);
+		});
+		return;
+	}
+
+	// 2. 8비트 x 8패스 LSD 기수 정렬
+	constexpr int32 NumPasses = 8;
+	constexpr int32 RadixBits = 8;
+	constexpr int32 NumBuckets = 1 << RadixBits;
+	constexpr uint64 RadixMask = NumBuckets - 1;
+
+	RadixKeys[0].SetNum(Num);
+	RadixKeys[1].SetNum(Num);
+	RadixIndices.SetNum(Num);
+
+	// 키를 복사하면서 모든 패스의 히스토그램을 한 번에 계산
+	uint32 Histogram[NumPasses][NumBuckets] = {};
+	uint64* SrcKeys = RadixKeys[0].GetData();
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const uint64 Key = Keys[i];
+		SrcKeys[i] = Key;
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			++Histogram[Pass][(Key >> (Pass * RadixBits)) & RadixMask];
+		}
+	}
+
+	uint64* DstKeys = RadixKeys[1].GetData();
+	uint32* SrcIndices = OutOrder.GetData();
+	uint32* DstIndices = RadixIndices.GetData();
+
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		const int32 Shift = Pass * RadixBits;
+		uint32* Counts = Histogram[Pass];
+
+		// 모든 키가 한 버킷이면 이 자릿수는 순서를 바꾸지 않음 (상위 ID 비트 대부분이 여기서 빠짐)
+		if (Counts[(SrcKeys[0] >> Shift) & RadixMask] == static_cast<uint32>(Num))
+		{
+			continue;
+		}
+
+		// 누적 합 → 버킷 시작 위치
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+		{
+			const uint32 Count = Counts[Bucket];
+			Counts[Bucket] = Offset;
+			Offset += Count;
+		}
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const uint64 Key = SrcKeys[i];
+			const uint32 Dst = Counts[(Key >> Shift) & RadixMask]++;
+			DstKeys[Dst] = Key;
+			DstIndices[Dst] = SrcIndices[i];
+		}
+
+		std::swap(SrcKeys, DstKeys);
+		std::swap(SrcIndices, DstIndices);
+	}
+
+	// 결과가 임시 버퍼에 있으면 되돌려 씀
+	if (SrcIndices != OutOrder.GetData())
+	{
+		memcpy(OutOrder.GetData(), SrcIndices, Num * sizeof(uint32));
+	}
+}
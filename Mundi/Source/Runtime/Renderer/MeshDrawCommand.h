@@ -0,0 +1,69 @@
+﻿#pragma once
+#include "MeshBatchElement.h"
+
+// 캐시된 드로우 커맨드: 배치 + 상태 정렬 키 (깊이 버킷 제외)
+struct FCachedMeshDrawCommand
+{
+	FMeshBatchElement Batch;
+	uint64 StateKey = 0;
+	uint32 MaterialRevision = 0;	// 빌드 시점의 Batch.Material->GetDrawCommandRevision()
+
+	// 자동 인스턴싱용 셰이더 변형 (STATIC_MESH_INSTANCING). 지원하지 않는 셰이더면 null → 병합 대상 아님
+	ID3D11VertexShader* InstancedVertexShader = nullptr;
+	ID3D11PixelShader* InstancedPixelShader = nullptr;
+	ID3D11InputLayout* InstancedInputLayout = nullptr;
+};
+
+// 자동 인스턴싱 인스턴스 데이터 (슬롯 1, UberLit.hlsl의 INSTANCE_* 입력과 같은 배치)
+struct FStaticMeshInstanceData
+{
+	FMatrix WorldMatrix;
+	FVector4 NormalMatrix[3];	// WorldInverseTranspose 상위 3행
+	uint32 ObjectID = 0;
+	uint32 Padding[3] = {};
+};
+static_assert(sizeof(FStaticMeshInstanceData) == 128, "FStaticMeshInstanceData must match the STATIC_MESH_INSTANCING input layout");
+
+/**
+ * FMeshDrawCommandCache
+ * 드로우 커맨드 캐시의 전역 무효화 세대와 64비트 정렬 키 생성 규칙입니다.
+ *
+ * 정렬 키 (상위 → 하위): 셰이더(16) | 머티리얼(16) | 정점 버퍼(20) | 깊이 버킷(12)
+ * - 포인터 대신 작은 ID 사용: 머티리얼은 UUID, 셰이더/정점 버퍼는 주소 해시 (조회 테이블이 없어 쌓이는 상태도 없음)
+ * - 상태가 같으면 가까운 것부터 그려 Early-Z 효율을 높임
+ * - 셰이더 핫 리로드처럼 컴포넌트가 알 수 없는 전역 변경은 InvalidateAll()로 세대를 올림
+ * - 머티리얼 셰이더/매크로/반투명 여부 변경은 머티리얼 리비전으로 그 머티리얼을 쓰는 커맨드만 재빌드
+ */
+class FMeshDrawCommandCache
+{
+public:
+	static void InvalidateAll() { ++Generation; }
+	static uint32 GetGeneration() { return Generation; }
+
+	static uint64 MakeStateKey(const FMeshBatchElement& Batch);
+
+	// StateKey에 ViewLocation ~ 배치 원점 거리(0 ~ MaxDistance)를 12비트로 양자화해 합침
+	static uint64 MakeSortKey(uint64 StateKey, const FMeshBatchElement& Batch, const FVector& ViewLocation, float MaxDistance);
+
+private:
+	static inline uint32 Generation = 1;
+};
+
+/**
+ * FMeshDrawCommandSorter
+ * 64비트 키로 드로우 커맨드 인덱스를 정렬합니다. (FSceneRenderer 소유, 정렬 버퍼는 프레임 arena)
+ *
+ * - 적으면 std::sort, 많으면 8비트 LSD 기수 정렬 (모든 키가 같은 자릿수는 건너뜀)
+ * - 키가 같으면 원래 순서 유지
+ */
+class FMeshDrawCommandSorter
+{
+public:
+	void Sort(const TFrameArray<uint64>& Keys, TFrameArray<uint32>& OutOrder);
+
+private:
+	static constexpr int32 RadixSortThreshold = 256;
+
+	TFrameArray<uint64> RadixKeys[2];
+	TFrameArray<uint32> RadixIndices;
+};
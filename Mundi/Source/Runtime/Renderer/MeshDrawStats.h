@@ -0,0 +1,65 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 불투명 메시 드로우 통계 (FSceneRenderer::RenderOpaquePass, 자동 인스턴싱 병합 기준)
+struct FMeshDrawStats
+{
+	// 정렬 후 병합 전 배치 수
+	uint32 BatchesBeforeMerge = 0;
+
+	// 병합 후 실제 드로우 콜 수
+	uint32 DrawCalls = 0;
+
+	// 인스턴스 드로우 수와 그 드로우로 합쳐진 배치 수
+	uint32 InstancedDraws = 0;
+	uint32 InstancedBatches = 0;
+
+	// 병합 비율 (병합 전 배치 / 드로우 콜, 1.0 = 병합 없음)
+	float GetMergeRatio() const
+	{
+		return DrawCalls > 0 ? static_cast<float>(BatchesBeforeMerge) / static_cast<float>(DrawCalls) : 1.0f;
+	}
+
+	void Reset()
+	{
+		*this = FMeshDrawStats();
+	}
+};
+
+// 메시 드로우 통계 전역 매니저 (싱글톤)
+// UStatsOverlayD2D에서 접근할 수 있도록 전역 통계 제공
+class FMeshDrawStatManager
+{
+public:
+	static FMeshDrawStatManager& GetInstance()
+	{
+		static FMeshDrawStatManager Instance;
+		return Instance;
+	}
+
+	// 통계 업데이트
+	void UpdateStats(const FMeshDrawStats& InStats)
+	{
+		CurrentStats = InStats;
+	}
+
+	// 통계 조회
+	const FMeshDrawStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	// 통계 리셋
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+	}
+
+private:
+	FMeshDrawStatManager() = default;
+	~FMeshDrawStatManager() = default;
+	FMeshDrawStatManager(const FMeshDrawStatManager&) = delete;
+	FMeshDrawStatManager& operator=(const FMeshDrawStatManager&) = delete;
+
+	FMeshDrawStats CurrentStats;
+};
@@ -31,6 +31,8 @@
 #include "DecalStatManager.h"
 #include "SceneRenderer.h"
 #include "SceneView.h"
+#include "MeshDrawCommand.h"
+#include "TileLightCuller.h"
 #include "SkinningStats.h"
 #include "PlatformTime.h"
 
@@ -42,6 +44,13 @@ URenderer::URenderer(D3D11RHI* InDevice) : RHIDevice(InDevice)
 	InitializeTriangleBatch();
 	InitializeDebugPrimitiveBatch();
 
+	// 클러스터 라이트 컬러 (스크래치/GPU 버퍼를 프레임 간 재사용)
+	TileLightCuller = std::make_unique<FTileLightCuller>();
+	TileLightCuller->Initialize(RHIDevice);
+
+	// 소프트웨어 오클루전 컬러 (타일/빈/HZB 버퍼를 프레임 간 재사용)
+	OcclusionCuller = std::make_unique<FOcclusionCullingManagerCPU>();
+
 	// GPU 타이머 초기화 (스키닝 성능 측정용)
 	FSkinningStatManager::GetInstance().InitializeGPUTimer(RHIDevice->GetDevice());
 }
@@ -67,6 +76,12 @@ URenderer::~URenderer()
 		}
 	}
 	DeferredReleaseQueue.Empty();
+
+	if (StaticMeshInstanceBuffer)
+	{
+		StaticMeshInstanceBuffer->Release();
+		StaticMeshInstanceBuffer = nullptr;
+	}
 }
 
 void URenderer::BeginFrame()
@@ -82,7 +97,11 @@ void URenderer::BeginFrame()
 	FDecalStatManager::GetInstance().ResetFrameStats();
 
 	// 이전 프레임의 GPU draw 시간 가져오기 (비동기, N-7 프레임 결과)
-	double LastGPUDrawTimeMS = FSkinningStatManager::GetInstance().GetGPUDrawTimeMS(RHIDevice->GetDeviceContext());
+	// 렌더 스레드 모드: 쿼리는 즉시 컨텍스트에서만 읽을 수 있으므로 렌더 스레드가 잰 값을 사용
+	const FRenderThread* RenderThread = RHIDevice->GetRenderThread();
+	double LastGPUDrawTimeMS = RenderThread
+		? RenderThread->GetLastGPUTimeMS()
+		: FSkinningStatManager::GetInstance().GetGPUDrawTimeMS(RHIDevice->GetDeviceContext());
 
 	// TimeProfile 시스템에 GPU Draw Time 추가 (프로파일링 통합)
 	if (LastGPUDrawTimeMS >= 0.0)
@@ -99,7 +118,10 @@ void URenderer::BeginFrame()
 	FSkinningStatManager::GetInstance().AddDrawTime(LastGPUDrawTimeMS);
 
 	// GPU 타이머 시작 - 전체 프레임의 Draw Time 측정 (모든 뷰어 포함)
-	FSkinningStatManager::GetInstance().BeginGPUTimer(RHIDevice->GetDeviceContext());
+	if (!RenderThread)
+	{
+		FSkinningStatManager::GetInstance().BeginGPUTimer(RHIDevice->GetDeviceContext());
+	}
 
 	RHIDevice->ClearAllBuffer();
 }
@@ -107,13 +129,21 @@ void URenderer::BeginFrame()
 void URenderer::EndFrame()
 {
 	// GPU 타이머 종료 - 전체 프레임의 Draw Time 측정 완료
-	FSkinningStatManager::GetInstance().EndGPUTimer(RHIDevice->GetDeviceContext());
+	if (!RHIDevice->IsRenderThreadEnabled())
+	{
+		FSkinningStatManager::GetInstance().EndGPUTimer(RHIDevice->GetDeviceContext());
+	}
 
 	RHIDevice->Present();
+
+	// RHI 호출 통계 프레임 확정 (업로드/드로우 카운터는 다음 프레임부터 다시 셈)
+	FRHIStatManager::GetInstance().EndFrameStats();
 }
 
 void URenderer::RenderSceneForView(UWorld* World, FSceneView* View, FViewport* Viewport)
 {
+	FMemoryTagScope TagScope(EMemoryTag::Rendering);
+
 	// 씬을 그리는 FSceneRenderer 를 생성합니다.
 	FSceneRenderer SceneRenderer(World, View, this);
 
@@ -127,7 +157,10 @@ UPrimitiveComponent* URenderer::GetPrimitiveCollided(int MouseX, int MouseY) con
    //******비동기 방식으로 무조건 바꿔야함****************
 	uint32 PickedId = 0;
 
-	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+	// Map(READ)은 즉시 컨텍스트에서만 가능 (렌더 스레드가 켜져 있으면 GetDeviceContext()는 지연 컨텍스트)
+	// 복사 → Map → Unmap 사이에 렌더 스레드가 끼어들지 않도록 잠금. ID 버퍼는 마지막으로 실행된 프레임의 내용
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetImmediateContext();
+	FScopedImmediateContextLock Lock(RHIDevice->GetMultithread());
 	//스테이징 버퍼를 가져와야 하는데 이걸 Device 추상 클래스가 Getter로 가지고 있는게 좋은 설계가 아닌 것 같아서 일단 캐스팅함
 
 
@@ -350,6 +383,7 @@ void URenderer::EndLineBatch(const FMatrix& ModelMatrix)
 		// Overlay 스텐실(=1) 영역은 그리지 않도록 스텐실 테스트 설정
 		RHIDevice->OMSetDepthStencilState_StencilRejectOverlay();
 		RHIDevice->GetDeviceContext()->DrawIndexed(DynamicLineMesh->GetCurrentIndexCount(), 0, 0);
+		FRHIStatManager::GetInstance().RecordDraw();
 		// 상태 복구
 		RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
@@ -402,6 +436,7 @@ void URenderer::EndLineBatchAlwaysOnTop(const FMatrix& ModelMatrix)
         RHIDevice->OMSetDepthStencilState(EComparisonFunc::Disable);
         RHIDevice->OMSetBlendState(true);
         RHIDevice->GetDeviceContext()->DrawIndexed(DynamicLineMesh->GetCurrentIndexCount(), 0, 0);
+        FRHIStatManager::GetInstance().RecordDraw();
         // Restore state
         RHIDevice->OMSetBlendState(false);
         RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -431,20 +466,72 @@ void URenderer::DeferredReleaseBuffer(ID3D11Buffer* Buffer)
 
 	// GPU 타이머 링버퍼 크기(8)와 동일하게 8프레임 대기
 	// N-7 프레임의 쿼리 결과를 읽으므로, 8프레임 후면 GPU 작업 완료 보장
-	constexpr int FRAMES_TO_WAIT = 8;
+	// 렌더 스레드 모드에서는 게임 스레드가 앞서가므로 "기록한 프레임"이 아니라 "제출 완료된 프레임" 기준
+	constexpr uint64 FRAMES_TO_WAIT = 8;
 
-	DeferredReleaseQueue.Add(FDeferredRelease(Buffer, FRAMES_TO_WAIT));
+	DeferredReleaseQueue.Add(FDeferredRelease(Buffer, RHIDevice->GetFrameNumber() + FRAMES_TO_WAIT));
+}
+
+ID3D11Buffer* URenderer::UploadStaticMeshInstances(const TFrameArray<FStaticMeshInstanceData>& Instances)
+{
+	const uint32 NumInstances = static_cast<uint32>(Instances.Num());
+	if (NumInstances == 0)
+	{
+		return nullptr;
+	}
+
+	// 버퍼 크기 부족 시 재생성
+	if (!StaticMeshInstanceBuffer || AllocatedStaticMeshInstanceCount < NumInstances)
+	{
+		if (StaticMeshInstanceBuffer)
+		{
+			StaticMeshInstanceBuffer->Release();
+			StaticMeshInstanceBuffer = nullptr;
+			AllocatedStaticMeshInstanceCount = 0;
+		}
+
+		const uint32 NewCount = FMath::Max(NumInstances * 2, 64u);
+		D3D11_BUFFER_DESC Desc = {};
+		Desc.ByteWidth = NewCount * sizeof(FStaticMeshInstanceData);
+		Desc.Usage = D3D11_USAGE_DYNAMIC;
+		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+		FRHIStatManager::GetInstance().RecordBufferCreate(Desc.ByteWidth);
+		if (SUCCEEDED(RHIDevice->GetDevice()->CreateBuffer(&Desc, nullptr, &StaticMeshInstanceBuffer)))
+		{
+			AllocatedStaticMeshInstanceCount = NewCount;
+		}
+	}
+
+	if (!StaticMeshInstanceBuffer)
+	{
+		return nullptr;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE MappedData;
+	if (FAILED(RHIDevice->GetDeviceContext()->Map(StaticMeshInstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedData)))
+	{
+		return nullptr;
+	}
+
+	memcpy(MappedData.pData, Instances.GetData(), NumInstances * sizeof(FStaticMeshInstanceData));
+	RHIDevice->GetDeviceContext()->Unmap(StaticMeshInstanceBuffer, 0);
+	FRHIStatManager::GetInstance().RecordMap(NumInstances * sizeof(FStaticMeshInstanceData));
+
+	return StaticMeshInstanceBuffer;
 }
 
 void URenderer::ProcessDeferredReleases()
 {
+	const uint64 CompletedFrame = RHIDevice->GetCompletedFrameNumber();
+
 	// 역순으로 순회하며 제거 (인덱스 안정성)
 	for (int32 i = DeferredReleaseQueue.Num() - 1; i >= 0; --i)
 	{
 		FDeferredRelease& Entry = DeferredReleaseQueue[i];
-		Entry.FramesToWait--;
 
-		if (Entry.FramesToWait <= 0)
+		if (CompletedFrame >= Entry.ReleaseFrame)
 		{
 			// GPU 작업이 완료되었으므로 안전하게 해제
 			if (Entry.Buffer)
@@ -618,6 +705,7 @@ void URenderer::EndTriangleBatch(const FMatrix& ModelMatrix)
 		// 깊이 테스트는 하지만 쓰지 않음 (반투명 메시 중첩 방지)
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly);
 		RHIDevice->GetDeviceContext()->DrawIndexed(DynamicTriangleMesh->GetCurrentIndexCount(), 0, 0);
+		FRHIStatManager::GetInstance().RecordDraw();
 
 		// Restore state
 		RHIDevice->OMSetBlendState(false);
@@ -676,6 +764,7 @@ void URenderer::EndTriangleBatchAlwaysOnTop(const FMatrix& ModelMatrix)
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::Disable);
 		RHIDevice->OMSetBlendState(true);
 		RHIDevice->GetDeviceContext()->DrawIndexed(DynamicTriangleMesh->GetCurrentIndexCount(), 0, 0);
+		FRHIStatManager::GetInstance().RecordDraw();
 
 		// Restore state
 		RHIDevice->RSSetState(ERasterizerMode::Solid);
@@ -752,6 +841,7 @@ void URenderer::DrawPrimitiveMesh(UStaticMesh* Mesh, const FMatrix& Transform, c
 
 	// Draw
 	RHIDevice->GetDeviceContext()->DrawIndexed(Mesh->GetIndexCount(), 0, 0);
+	FRHIStatManager::GetInstance().RecordDraw();
 }
 
 void URenderer::DrawDebugSphere(const FMatrix& Transform, const FLinearColor& Color, uint32 UUID)
@@ -15,6 +15,9 @@ class FSceneView;
 
 struct FMaterialSlot;
 struct FLinearColor;
+struct FStaticMeshInstanceData;
+class FTileLightCuller;
+class FOcclusionCullingManagerCPU;
 
 class URenderer
 {
@@ -74,6 +77,15 @@ public:
 	// Deferred buffer release system (GPU-safe resource management)
 	void DeferredReleaseBuffer(ID3D11Buffer* Buffer);
 
+	// 스태틱 메시 자동 인스턴싱: 인스턴스 데이터를 공유 동적 버퍼에 업로드 (WRITE_DISCARD, 실패 시 nullptr)
+	ID3D11Buffer* UploadStaticMeshInstances(const TFrameArray<FStaticMeshInstanceData>& Instances);
+
+	// 클러스터 라이트 컬러 (모든 뷰가 공유, 뷰마다 CullLights 후 바로 바인딩)
+	FTileLightCuller* GetTileLightCuller() const { return TileLightCuller.get(); }
+
+	// 소프트웨어 오클루전 컬러 (모든 뷰가 공유, 뷰마다 깊이 버퍼를 다시 빌드)
+	FOcclusionCullingManagerCPU* GetOcclusionCuller() const { return OcclusionCuller.get(); }
+
 	// ===== Highlight System (아이템 하이라이트용) =====
 	/** 오브젝트에 하이라이트 추가 (ObjectID 기반) */
 	void AddHighlight(uint32 ObjectID, const FLinearColor& OutlineColor = FLinearColor(1.0f, 0.8f, 0.2f, 1.0f));
@@ -91,10 +103,10 @@ private:
 	struct FDeferredRelease
 	{
 		ID3D11Buffer* Buffer;
-		int FramesToWait;
+		uint64 ReleaseFrame;	// 이 프레임이 GPU에 제출된 뒤 해제 (RHI 프레임 번호)
 
-		FDeferredRelease(ID3D11Buffer* InBuffer, int InFrames)
-			: Buffer(InBuffer), FramesToWait(InFrames) {}
+		FDeferredRelease(ID3D11Buffer* InBuffer, uint64 InReleaseFrame)
+			: Buffer(InBuffer), ReleaseFrame(InReleaseFrame) {}
 	};
 
 	TArray<FDeferredRelease> DeferredReleaseQueue;
@@ -140,5 +152,12 @@ private:
 
 	// Highlight system (ObjectID -> OutlineColor)
 	TMap<uint32, FLinearColor> HighlightedObjects;
+
+	// 스태틱 메시 자동 인스턴싱 버퍼 (뷰/패스마다 WRITE_DISCARD로 재사용, 부족하면 2배로 재생성)
+	ID3D11Buffer* StaticMeshInstanceBuffer = nullptr;
+	uint32 AllocatedStaticMeshInstanceCount = 0;
+
+	std::unique_ptr<FTileLightCuller> TileLightCuller;
+	std::unique_ptr<FOcclusionCullingManagerCPU> OcclusionCuller;
 };
 
@@ -0,0 +1,311 @@
+﻿#include "pch.h"
+#include "Scene.h"
+#include "SceneComponent.h"
+#include "PrimitiveComponent.h"
+#include "StaticMeshComponent.h"
+#include "SkinnedMeshComponent.h"
+#include "BillboardComponent.h"
+#include "DecalComponent.h"
+#include "ParticleSystemComponent.h"
+#include "LineComponent.h"
+#include "TriangleMeshComponent.h"
+#include "HeightFogComponent.h"
+#include "DOFComponent.h"
+#include "SkyboxComponent.h"
+#include "DirectionalLightComponent.h"
+#include "AmbientLightComponent.h"
+#include "PointLightComponent.h"
+#include "SpotLightComponent.h"
+#include "Grid/GridActor.h"
+#include "Gizmo/GizmoActor.h"
+#include "Material.h"
+#include "Shader.h"
+#include "SceneView.h"
+
+FScene::~FScene()
+{
+	// 아직 등록된 컴포넌트가 이 씬을 가리키지 않도록 역참조 해제
+	for (auto& Pair : ProxyHandles)
+	{
+		Pair.first->RenderScene = nullptr;
+	}
+}
+
+void FScene::AddComponent(USceneComponent* Component)
+{
+	if (!Component || ProxyHandles.Contains(Component))
+	{
+		return;
+	}
+
+	// 에디터 전용 액터는 렌더러가 별도로 수집
+	AActor* Owner = Component->GetOwner();
+	if (!Owner || Cast<AGizmoActor>(Owner) || Cast<AGridActor>(Owner))
+	{
+		return;
+	}
+
+	ESceneProxyType Type;
+	if (!ClassifyComponent(Component, Type))
+	{
+		return;
+	}
+
+	TArray<USceneComponent*>& List = Components[static_cast<int32>(Type)];
+	FProxyHandle Handle;
+	Handle.Type = Type;
+	Handle.Index = List.Add(Component);
+	ProxyHandles.Add(Component, Handle);
+
+	if (Type == ESceneProxyType::StaticMesh)
+	{
+		FStaticMeshSceneProxy Proxy;
+		Proxy.Component = static_cast<UStaticMeshComponent*>(Component);
+		UpdateStaticMeshProxy(Proxy);
+		StaticMeshProxies.Add(Proxy);
+	}
+
+	Component->RenderScene = this;
+}
+
+void FScene::RemoveComponent(USceneComponent* Component)
+{
+	FProxyHandle* Found = ProxyHandles.Find(Component);
+	if (!Found)
+	{
+		return;
+	}
+
+	const FProxyHandle Handle = *Found;
+	ProxyHandles.Remove(Component);
+	Component->RenderScene = nullptr;
+
+	// swap-remove: 마지막 원소를 빈 자리로 옮기고 핸들 갱신
+	TArray<USceneComponent*>& List = Components[static_cast<int32>(Handle.Type)];
+	const int32 LastIndex = List.Num() - 1;
+	if (Handle.Index != LastIndex)
+	{
+		USceneComponent* Moved = List[LastIndex];
+		List[Handle.Index] = Moved;
+		ProxyHandles.Find(Moved)->Index = Handle.Index;
+	}
+	List.pop_back();
+
+	if (Handle.Type == ESceneProxyType::StaticMesh)
+	{
+		if (Handle.Index != LastIndex)
+		{
+			StaticMeshProxies[Handle.Index] = std::move(StaticMeshProxies[LastIndex]);
+
+			// 옮겨진 프록시가 갱신 대기 중이었다면 새 인덱스로 다시 예약 (이전 인덱스 항목은 무효)
+			if (StaticMeshProxies[Handle.Index].bDirty)
+			{
+				DirtyStaticMeshIndices.Add(Handle.Index);
+			}
+		}
+		StaticMeshProxies.pop_back();
+	}
+}
+
+void FScene::MarkProxyDirty(USceneComponent* Component)
+{
+	const FProxyHandle* Found = ProxyHandles.Find(Component);
+	if (!Found || Found->Type != ESceneProxyType::StaticMesh)
+	{
+		return;
+	}
+
+	FStaticMeshSceneProxy& Proxy = StaticMeshProxies[Found->Index];
+	if (!Proxy.bDirty)
+	{
+		Proxy.bDirty = true;
+		DirtyStaticMeshIndices.Add(Found->Index);
+	}
+}
+
+void FScene::MarkRenderStateDirty(USceneComponent* Component)
+{
+	const FProxyHandle* Found = ProxyHandles.Find(Component);
+	if (!Found || Found->Type != ESceneProxyType::StaticMesh)
+	{
+		return;
+	}
+
+	StaticMeshProxies[Found->Index].bDrawCommandsDirty = true;
+	MarkProxyDirty(Component);
+}
+
+void FScene::UpdateDirtyProxies()
+{
+	for (int32 Index : DirtyStaticMeshIndices)
+	{
+		// 제거로 범위를 벗어났거나 이미 갱신된 항목은 건너뜀
+		if (Index < StaticMeshProxies.Num() && StaticMeshProxies[Index].bDirty)
+		{
+			UpdateStaticMeshProxy(StaticMeshProxies[Index]);
+		}
+	}
+	DirtyStaticMeshIndices.Empty();
+}
+
+bool FScene::ClassifyComponent(USceneComponent* Component, ESceneProxyType& OutType)
+{
+	if (UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
+	{
+		if (Cast<UMeshComponent>(PrimitiveComponent))
+		{
+			if (PrimitiveComponent->IsA(UStaticMeshComponent::StaticClass()))
+			{
+				OutType = ESceneProxyType::StaticMesh;
+			}
+			else if (PrimitiveComponent->IsA(USkinnedMeshComponent::StaticClass()))
+			{
+				OutType = ESceneProxyType::SkinnedMesh;
+			}
+			else
+			{
+				OutType = ESceneProxyType::Mesh;
+			}
+		}
+		else if (Cast<UBillboardComponent>(PrimitiveComponent))
+		{
+			OutType = ESceneProxyType::Billboard;
+		}
+		else if (Cast<UDecalComponent>(PrimitiveComponent))
+		{
+			OutType = ESceneProxyType::Decal;
+		}
+		else if (Cast<UParticleSystemComponent>(PrimitiveComponent))
+		{
+			OutType = ESceneProxyType::ParticleSystem;
+		}
+		else if (Cast<ULineComponent>(PrimitiveComponent))
+		{
+			OutType = ESceneProxyType::Line;
+		}
+		else if (Cast<UTriangleMeshComponent>(PrimitiveComponent))
+		{
+			OutType = ESceneProxyType::TriangleMesh;
+		}
+		else
+		{
+			OutType = ESceneProxyType::Primitive;
+		}
+		return true;
+	}
+
+	if (Cast<UHeightFogComponent>(Component))
+	{
+		OutType = ESceneProxyType::HeightFog;
+	}
+	else if (Cast<UDOFComponent>(Component))
+	{
+		OutType = ESceneProxyType::DOF;
+	}
+	else if (Cast<USkyboxComponent>(Component))
+	{
+		OutType = ESceneProxyType::Skybox;
+	}
+	else if (Cast<UDirectionalLightComponent>(Component))
+	{
+		OutType = ESceneProxyType::DirectionalLight;
+	}
+	else if (Cast<UAmbientLightComponent>(Component))
+	{
+		OutType = ESceneProxyType::AmbientLight;
+	}
+	else if (Cast<USpotLightComponent>(Component))
+	{
+		OutType = ESceneProxyType::SpotLight;
+	}
+	else if (Cast<UPointLightComponent>(Component))
+	{
+		OutType = ESceneProxyType::PointLight;
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
+void FScene::UpdateStaticMeshProxy(FStaticMeshSceneProxy& Proxy)
+{
+	Proxy.StaticMesh = Proxy.Component->GetStaticMesh();
+	Proxy.WorldMatrix = Proxy.Component->GetWorldMatrix();
+	Proxy.WorldBounds = Proxy.Component->GetWorldAABB();
+	Proxy.bDirty = false;
+
+	// 트랜스폼만 바뀐 경우 커맨드는 그대로 두고 행렬만 갱신
+	for (FCachedMeshDrawCommand& Command : Proxy.DrawCommands)
+	{
+		Command.Batch.WorldMatrix = Proxy.WorldMatrix;
+	}
+}
+
+const TArray<FCachedMeshDrawCommand>& FScene::GetDrawCommands(int32 ProxyIndex, const FSceneView* View, uint64 ViewMacroKey)
+{
+	FStaticMeshSceneProxy& Proxy = StaticMeshProxies[ProxyIndex];
+	bool bNeedsRebuild = Proxy.bDrawCommandsDirty
+		|| Proxy.DrawCommandViewKey != ViewMacroKey
+		|| Proxy.DrawCommandGeneration != FMeshDrawCommandCache::GetGeneration();
+
+	// 섹션 머티리얼 중 하나라도 셰이더/반투명 여부가 바뀌었으면 이 프록시만 재빌드
+	for (int32 i = 0; !bNeedsRebuild && i < Proxy.DrawCommands.Num(); ++i)
+	{
+		const FCachedMeshDrawCommand& Command = Proxy.DrawCommands[i];
+		bNeedsRebuild = Command.Batch.Material && Command.Batch.Material->GetDrawCommandRevision() != Command.MaterialRevision;
+	}
+
+	if (bNeedsRebuild)
+	{
+		BuildDrawCommands(Proxy, View, ViewMacroKey);
+	}
+	return Proxy.DrawCommands;
+}
+
+void FScene::BuildInstancedVariant(FCachedMeshDrawCommand& Command, const FSceneView* View)
+{
+	// 인스턴스 스트림 입력은 UberLit만 지원 (커스텀 셰이더 머티리얼은 개별 드로우 유지)
+	UMaterialInterface* Material = Command.Batch.Material;
+	UShader* Shader = Material ? Material->GetShader() : nullptr;
+	if (Command.Batch.RenderMode != EBatchRenderMode::Opaque || !Shader || Shader->GetFilePath().find("UberLit") == FString::npos)
+	{
+		return;
+	}
+
+	// CollectMeshBatches와 같은 매크로 조합 + 인스턴싱 매크로
+	TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
+	ShaderMacros.Append(Material->GetShaderMacros());
+	ShaderMacros.Add(FShaderMacro{ "STATIC_MESH_INSTANCING", "1" });
+
+	if (FShaderVariant* Variant = Shader->GetOrCompileShaderVariant(ShaderMacros))
+	{
+		Command.InstancedVertexShader = Variant->VertexShader;
+		Command.InstancedPixelShader = Variant->PixelShader;
+		Command.InstancedInputLayout = Variant->InputLayout;
+	}
+}
+
+void FScene::BuildDrawCommands(FStaticMeshSceneProxy& Proxy, const FSceneView* View, uint64 ViewMacroKey)
+{
+	// 프레임 arena 임시 버퍼 (멤버로 두면 EndFrame 이후 해제된 메모리를 가리키게 됨)
+	TFrameArray<FMeshBatchElement> ScratchBatches;
+	Proxy.Component->CollectMeshBatches(ScratchBatches, View);
+
+	Proxy.DrawCommands.Empty();
+	Proxy.DrawCommands.Reserve(ScratchBatches.Num());
+	for (const FMeshBatchElement& Batch : ScratchBatches)
+	{
+		FCachedMeshDrawCommand Command;
+		Command.Batch = Batch;
+		Command.StateKey = FMeshDrawCommandCache::MakeStateKey(Batch);
+		Command.MaterialRevision = Batch.Material ? Batch.Material->GetDrawCommandRevision() : 0;
+		BuildInstancedVariant(Command, View);
+		Proxy.DrawCommands.Add(Command);
+	}
+
+	Proxy.DrawCommandViewKey = ViewMacroKey;
+	Proxy.DrawCommandGeneration = FMeshDrawCommandCache::GetGeneration();
+	Proxy.bDrawCommandsDirty = false;
+}
@@ -0,0 +1,109 @@
+﻿#pragma once
+#include "AABB.h"
+#include "MeshDrawCommand.h"
+
+class USceneComponent;
+class UStaticMeshComponent;
+class UStaticMesh;
+class FSceneView;
+
+// 씬 프록시 분류 (FSceneRenderer::GatherVisibleProxies의 수집 목록에 대응)
+enum class ESceneProxyType : uint8
+{
+	StaticMesh,
+	SkinnedMesh,
+	Mesh,				// 그 외 UMeshComponent
+	Billboard,
+	Decal,
+	ParticleSystem,
+	Line,
+	TriangleMesh,
+	Primitive,			// 위에 해당하지 않는 프리미티브 (편집 불가면 에디터 프리미티브로 그려짐)
+	HeightFog,
+	DOF,
+	Skybox,
+	DirectionalLight,
+	AmbientLight,
+	PointLight,
+	SpotLight,
+
+	Count
+};
+
+// 스태틱 메시 프록시: 컬링/드로우에 필요한 데이터를 연속 배열에 캐시 (변경 통지 시에만 갱신)
+struct FStaticMeshSceneProxy
+{
+	UStaticMeshComponent* Component = nullptr;
+	UStaticMesh* StaticMesh = nullptr;
+	FMatrix WorldMatrix = FMatrix::Identity();
+	FAABB WorldBounds;
+	bool bDirty = true;
+
+	// 섹션별 드로우 커맨드. 메시/머티리얼 변경, 머티리얼 리비전 변경, 뷰 셰이더 매크로 변경, 전역 무효화 시에만 다시 빌드
+	// (트랜스폼 변경은 WorldMatrix만 덮어씀)
+	TArray<FCachedMeshDrawCommand> DrawCommands;
+	uint64 DrawCommandViewKey = 0;
+	uint32 DrawCommandGeneration = 0;
+	bool bDrawCommandsDirty = true;
+};
+
+/**
+ * FScene
+ * 월드에 등록된 렌더링 대상 컴포넌트의 영속 목록입니다. (UWorld 소유)
+ *
+ * - USceneComponent::OnRegister / OnUnregister에서 추가/제거되므로 렌더러가 매 프레임 액터를 순회하며 Cast할 필요가 없음
+ * - 타입별 연속 배열, 제거는 swap-remove (배열 내 순서는 보장하지 않음)
+ * - 스태틱 메시는 월드 행렬/바운드를 프록시에 캐시하고, MarkProxyDirty로 표시된 것만 UpdateDirtyProxies에서 다시 계산
+ * - 스태틱 메시 드로우 커맨드도 프록시에 캐시 (GetDrawCommands), MarkRenderStateDirty 또는 전역 무효화 시에만 재빌드
+ * - 에디터 전용 액터(그리드, 기즈모)의 컴포넌트는 등록하지 않음 (렌더러가 따로 수집)
+ * - 가시성(액터/컴포넌트 숨김)과 편집 가능 여부는 바뀌는 경로가 많아 수집 시 플래그로 확인
+ */
+class FScene
+{
+public:
+	FScene() = default;
+	~FScene();
+
+	FScene(const FScene&) = delete;
+	FScene& operator=(const FScene&) = delete;
+
+	void AddComponent(USceneComponent* Component);
+	void RemoveComponent(USceneComponent* Component);
+
+	// 트랜스폼 변경 통지 (캐시 데이터가 있는 스태틱 메시만 의미 있음)
+	void MarkProxyDirty(USceneComponent* Component);
+	// 메시/머티리얼 변경 통지: 바운드와 드로우 커맨드 모두 다시 계산
+	void MarkRenderStateDirty(USceneComponent* Component);
+	void UpdateDirtyProxies();
+
+	// 스태틱 메시 프록시의 드로우 커맨드 (필요할 때만 View 기준으로 다시 빌드)
+	// ViewMacroKey = UShader::GenerateShaderKey(View->ViewShaderMacros)
+	const TArray<FCachedMeshDrawCommand>& GetDrawCommands(int32 ProxyIndex, const FSceneView* View, uint64 ViewMacroKey);
+
+	const TArray<USceneComponent*>& GetComponents(ESceneProxyType Type) const { return Components[static_cast<int32>(Type)]; }
+
+	// GetComponents(ESceneProxyType::StaticMesh)와 같은 순서
+	const TArray<FStaticMeshSceneProxy>& GetStaticMeshProxies() const { return StaticMeshProxies; }
+
+	int32 GetNumComponents() const { return ProxyHandles.Num(); }
+
+private:
+	struct FProxyHandle
+	{
+		ESceneProxyType Type = ESceneProxyType::Count;
+		int32 Index = -1;
+	};
+
+	static bool ClassifyComponent(USceneComponent* Component, ESceneProxyType& OutType);
+	static void UpdateStaticMeshProxy(FStaticMeshSceneProxy& Proxy);
+	void BuildDrawCommands(FStaticMeshSceneProxy& Proxy, const FSceneView* View, uint64 ViewMacroKey);
+	// 자동 인스턴싱 셰이더 변형 준비 (UberLit 불투명 배치만)
+	static void BuildInstancedVariant(FCachedMeshDrawCommand& Command, const FSceneView* View);
+
+	TArray<USceneComponent*> Components[static_cast<int32>(ESceneProxyType::Count)];
+	TArray<FStaticMeshSceneProxy> StaticMeshProxies;
+	TArray<int32> DirtyStaticMeshIndices;
+
+	// 컴포넌트 → (타입, 배열 인덱스), 등록/해제 시에만 조회
+	TMap<USceneComponent*, FProxyHandle> ProxyHandles;
+};
@@ -15,6 +15,7 @@
 #include "Gizmo/GizmoActor.h"
 #include "RenderSettings.h"
 #include "Occlusion.h"
+#include "StaticMesh.h"
 #include "Frustum.h"
 #include "WorldPartitionManager.h"
 #include "BVHierarchy.h"
@@ -55,6 +56,12 @@
 #include "SkinnedMeshComponent.h"
 #include "ParticleSystemComponent.h"
 #include "ParticleStats.h"
+#include "FrustumCullingStats.h"
+#include "MeshDrawStats.h"
+#include "ShadowCasterCuller.h"
+#include "Hash.h"
+#include "Scene.h"
+#include "TaskSystem.h"
 #include "ParticleEmitterInstance.h"
 #include "ParticleLODLevel.h"
 #include "Modules/ParticleModuleTypeDataMesh.h"
@@ -70,12 +77,14 @@ FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* I
 	, OwnerRenderer(InOwnerRenderer)
 	, RHIDevice(InOwnerRenderer->GetRHIDevice())
 {
-	//OcclusionCPU = std::make_unique<FOcclusionCullingManagerCPU>();
+	// 클러스터 라이트 컬러 (타일 크기는 렌더 설정을 따름)
+	TileLightCuller = OwnerRenderer->GetTileLightCuller();
+	if (TileLightCuller)
+	{
+		TileLightCuller->SetTileSize(World->GetRenderSettings().GetTileSize());
+	}
 
-	// 타일 라이트 컬러 초기화
-	TileLightCuller = std::make_unique<FTileLightCuller>();
-	uint32 TileSize = World->GetRenderSettings().GetTileSize();
-	TileLightCuller->Initialize(RHIDevice, TileSize);
+	OcclusionCuller = OwnerRenderer->GetOcclusionCuller();
 
 	// 라인 수집 시작
 	OwnerRenderer->BeginLineBatch();
@@ -309,28 +318,42 @@ void FSceneRenderer::RenderShadowMaps()
 	if (!LightManager) return;
 
 	// 2. 그림자 캐스터(Caster) 메시 수집 (반투명 제외 - 깊이만 기록하므로 alpha 정보 표현 불가)
-	TArray<FMeshBatchElement> AllShadowBatches;
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	//    섀도우 뷰별 컬링을 위해 배치마다 소유 컴포넌트의 월드 바운드를 함께 등록 (스키닝 메시는 바운드가 없어 항상 그려짐)
+	FShadowCasterCuller CasterCuller;
+	TFrameArray<FMeshBatchElement> ComponentBatches;
+	for (UMeshComponent* MeshComponent : Proxies.ShadowCasterMeshes)
 	{
 		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
 		{
-			MeshComponent->CollectMeshBatches(AllShadowBatches, View);
-		}
-	}
+			ComponentBatches.Empty();
+			MeshComponent->CollectMeshBatches(ComponentBatches, View);
+			if (ComponentBatches.IsEmpty())
+			{
+				continue;
+			}
 
-	// 불투명 배치만 필터링 (단일 패스 O(n))
-	TArray<FMeshBatchElement> ShadowMeshBatches;
-	ShadowMeshBatches.Reserve(AllShadowBatches.Num());
-	for (const FMeshBatchElement& Batch : AllShadowBatches)
-	{
-		if (Batch.RenderMode == EBatchRenderMode::Opaque)
-		{
-			ShadowMeshBatches.Add(Batch);
+			UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent);
+			const FAABB WorldBounds = StaticMeshComponent ? StaticMeshComponent->GetWorldAABB() : FAABB();
+			for (const FMeshBatchElement& Batch : ComponentBatches)
+			{
+				if (Batch.RenderMode == EBatchRenderMode::Opaque)
+				{
+					CasterCuller.AddCaster(Batch, StaticMeshComponent ? &WorldBounds : nullptr);
+				}
+				else if (Batch.BoneMatricesBuffer)
+				{
+					Batch.BoneMatricesBuffer->Release();
+				}
+			}
 		}
 	}
 
+	// 섀도우 뷰 하나에 그릴 캐스터 (CasterCuller 소유 배치를 가리킴)
+	TFrameArray<const FMeshBatchElement*> ShadowViewBatches;
+	FShadowStats ShadowStats = FShadowStatManager::GetInstance().GetStats();
+
 	// NOTE: 카메라 오버라이드 기능을 항상 활성화 하기 위해서 그림자를 그릴 곳이 없어도 함수 실행
-	//if (ShadowMeshBatches.IsEmpty()) return;
+	//if (CasterCuller.Num() == 0) return;
 
 	// 섀도우 맵을 DSV로 사용하기 전에 SRV 슬롯에서 해제
 	ID3D11ShaderResourceView* nullSRVs[2] = { nullptr, nullptr };
@@ -409,6 +432,16 @@ void FSceneRenderer::RenderShadowMaps()
 	// 2.2. 큐브맵 슬라이스 할당 (Allocate only)
 	LightManager->AllocateAtlasCubeSlices(RequestsCube); // FLightManager가 RequestsCube의 AssignedSliceIndex와 Size 업데이트
 
+	// 캐시 서명에 섀도우 AA 방식 포함 (PCF/VSM 전환 시 다시 그림)
+	const EShadowAATechnique ShadowAATechnique = World->GetRenderSettings().GetShadowAATechnique();
+	auto CullShadowView = [&](const FShadowRenderRequest& Request) -> uint64
+	{
+		const uint64 Signature = CasterCuller.CullShadowView(Request, ShadowViewBatches);
+		++ShadowStats.ShadowViews;
+		ShadowStats.CulledCasterBatches += static_cast<uint32>(CasterCuller.Num() - ShadowViewBatches.Num());
+		return Signature != 0 ? HashCombine(Signature, static_cast<uint64>(ShadowAATechnique)) : 0;
+	};
+
 	// --- 1단계: 2D 아틀라스 렌더링 (Spot + Directional) ---
 	{
 		ID3D11DepthStencilView* AtlasDSV2D = LightManager->GetShadowAtlasDSV2D();
@@ -419,10 +452,12 @@ void FSceneRenderer::RenderShadowMaps()
 		{
 			ID3D11ShaderResourceView* NullSRV[2] = { nullptr, nullptr };
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(9, 2, NullSRV);
+
+			// 아틀라스 배치가 지난번과 같으면 영역별 캐시 유지, 다르면 전체 클리어 후 모두 다시 그림
+			const bool bAtlasLayoutCached = LightManager->UpdateShadowAtlasLayout2D(Requests2D);
 			
 			float ClearColor[] = {1.0f, 1.0f, 0.0f, 0.0f};
-			EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
-			switch (ShadowAAType)
+			switch (ShadowAATechnique)
 			{
 			case EShadowAATechnique::PCF:
 				RHIDevice->OMSetCustomRenderTargets(0, nullptr, AtlasDSV2D);
@@ -430,7 +465,10 @@ void FSceneRenderer::RenderShadowMaps()
 			case EShadowAATechnique::VSM:
 				{
 					RHIDevice->OMSetCustomRenderTargets(1, &VSMAtlasRTV2D, AtlasDSV2D);
-					RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
+					if (!bAtlasLayoutCached)
+					{
+						RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
+					}
 					break;
 				}				
 			default:
@@ -438,19 +476,44 @@ void FSceneRenderer::RenderShadowMaps()
 				break;
 			}
 
-			RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
+			if (!bAtlasLayoutCached)
+			{
+				RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
+			}
 
 			RHIDevice->RSSetState(ERasterizerMode::Shadows);
 			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 
 			for (FShadowRenderRequest& Request : Requests2D)
 			{
-				// 뷰포트 설정
-				D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
-				RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
+				if (Request.Size > 0)
+				{
+					// 뷰포트 설정
+					D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
+					RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
 
-				// 뎁스 패스 렌더링
-				RenderShadowDepthPass(Request, ShadowMeshBatches);
+					// 캐스터 컬링 후, 라이트와 캐스터가 그대로면 지난번 영역을 재사용
+					const uint64 Signature = CullShadowView(Request);
+					if (LightManager->IsShadowViewCached2D(Request.LightOwner, Request.SubViewIndex, Signature))
+					{
+						++ShadowStats.CachedShadowViews;
+					}
+					else
+					{
+						// 전체 클리어하지 않았으면 이 영역만 초기화
+						if (bAtlasLayoutCached)
+						{
+							ClearShadowAtlasRegion();
+						}
+
+						// 뎁스 패스 렌더링
+						RenderShadowDepthPass(Request, ShadowViewBatches);
+						LightManager->SetShadowViewSignature2D(Request.LightOwner, Request.SubViewIndex, Signature);
+
+						++ShadowStats.RenderedShadowViews;
+						ShadowStats.DrawnCasterBatches += static_cast<uint32>(ShadowViewBatches.Num());
+					}
+				}
 
 				FShadowMapData Data;
 				if (Request.Size > 0) // 렌더링 성공
@@ -508,9 +571,21 @@ void FSceneRenderer::RenderShadowMaps()
 				ID3D11DepthStencilView* FaceDSV = LightManager->GetShadowCubeFaceDSV(SliceIndex, FaceIndex);
 				if (FaceDSV)
 				{
+					// 면 단위 캐시: 이 슬라이스/면에 같은 라이트와 캐스터로 그린 적이 있으면 건너뜀
+					const uint64 Signature = CullShadowView(Request);
+					if (LightManager->IsShadowCubeFaceCached(SliceIndex, FaceIndex, Signature))
+					{
+						++ShadowStats.CachedShadowViews;
+						continue;
+					}
+
 					RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
 					RHIDevice->GetDeviceContext()->ClearDepthStencilView(FaceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
-					RenderShadowDepthPass(Request, ShadowMeshBatches);
+					RenderShadowDepthPass(Request, ShadowViewBatches);
+					LightManager->SetShadowCubeFaceSignature(SliceIndex, FaceIndex, Signature);
+
+					++ShadowStats.RenderedShadowViews;
+					ShadowStats.DrawnCasterBatches += static_cast<uint32>(ShadowViewBatches.Num());
 				}
 			}
 		}
@@ -528,16 +603,40 @@ void FSceneRenderer::RenderShadowMaps()
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(OriginViewProjBuffer));
 
 	// Release GPU skinning bone buffers
-	for (const FMeshBatchElement& Batch : ShadowMeshBatches)
+	for (const FMeshBatchElement& Batch : CasterCuller.GetBatches())
 	{
 		if (Batch.BoneMatricesBuffer)
 		{
 			Batch.BoneMatricesBuffer->Release();
 		}
 	}
+
+	FShadowStatManager::GetInstance().UpdateStats(ShadowStats);
+}
+
+void FSceneRenderer::ClearShadowAtlasRegion()
+{
+	// 현재 뷰포트(= 다시 그릴 아틀라스 영역)를 깊이 1.0 / VSM 클리어 색으로 채움
+	UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>(UResourceManager::FullScreenVSPath);
+	UShader* RegionClearPS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/ShadowRegionClear_PS.hlsl");
+	if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader() || !RegionClearPS || !RegionClearPS->GetPixelShader())
+	{
+		return;
+	}
+
+	RHIDevice->PrepareShader(FullScreenTriangleVS, RegionClearPS);
+	RHIDevice->RSSetState(ERasterizerMode::Solid);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::GreaterEqual);
+	RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	RHIDevice->GetDeviceContext()->Draw(6, 0);
+	FRHIStatManager::GetInstance().RecordDraw();
+
+	// 섀도우 뎁스 패스 상태 복구 (셰이더는 RenderShadowDepthPass가 다시 설정)
+	RHIDevice->RSSetState(ERasterizerMode::Shadows);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 }
 
-void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
+void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TFrameArray<const FMeshBatchElement*>& InShadowBatches)
 {
 	// 1. 뎁스 전용 셰이더 로드
 	UShader* DepthVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_VS.hlsl");
@@ -594,8 +693,10 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	RHIDevice->GetDeviceContext()->IASetInputLayout(ShaderVariant->InputLayout);
 	RHIDevice->GetDeviceContext()->VSSetShader(ShaderVariant->VertexShader, nullptr, 0);
 
-	for (const FMeshBatchElement& Batch : InShadowBatches)
+	for (const FMeshBatchElement* BatchPtr : InShadowBatches)
 	{
+		const FMeshBatchElement& Batch = *BatchPtr;
+
 		// 버퍼 유효성 검사 - null 버퍼는 스킵
 		if (!Batch.VertexBuffer || !Batch.IndexBuffer)
 		{
@@ -646,6 +747,7 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 
 		// 드로우 콜
 		RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+		FRHIStatManager::GetInstance().RecordDraw();
 	}
 }
 
@@ -732,10 +834,6 @@ void FSceneRenderer::PrepareView()
 
 void FSceneRenderer::GatherVisibleProxies()
 {
-	// NOTE: 일단 컴포넌트 단위와 데칼 관련 이슈 해결까지 컬링 무시
-	//// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleActors에 저장됨
-	//PerformFrustumCulling();
-
 	const bool bDrawStaticMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
 	const bool bDrawSkeletalMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_SkeletalMeshes);
 	const bool bDrawDecals = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Decals);
@@ -746,142 +844,197 @@ void FSceneRenderer::GatherVisibleProxies()
 	const bool bUseBillboard = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Billboard);
 	const bool bUseIcon = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_EditorIcon);
 
-	// Helper lambda to collect components from an actor
-	auto CollectComponentsFromActor = [&](AActor* Actor, bool bIsEditorActor)
+	// 1. 에디터 액터 (기즈모, 그리드) - 렌더 씬에 등록되지 않으므로 직접 순회
+	for (AActor* EditorActor : World->GetEditorActors())
+	{
+		if (!EditorActor || !EditorActor->IsActorVisible() || !EditorActor->IsActorActive())
+		{
+			continue;
+		}
+
+		for (USceneComponent* Component : EditorActor->GetSceneComponents())
 		{
-			if (!Actor || !Actor->IsActorVisible() || !Actor->IsActorActive())
+			if (!Component || !Component->IsVisible())
 			{
-				return;
+				continue;
 			}
 
-			for (USceneComponent* Component : Actor->GetSceneComponents())
+			if (UGizmoArrowComponent* GizmoComponent = Cast<UGizmoArrowComponent>(Component))
 			{
-				if (!Component || !Component->IsVisible())
-				{
-					continue;
-				}
+				Proxies.OverlayPrimitives.Add(GizmoComponent);
+			}
+			else if (ULineComponent* LineComponent = Cast<ULineComponent>(Component))
+			{
+				Proxies.EditorLines.Add(LineComponent);
+			}
+		}
+	}
 
-				// 엔진 에디터 액터 컴포넌트
-				if (bIsEditorActor)
-				{
-					if (UGizmoArrowComponent* GizmoComponent = Cast<UGizmoArrowComponent>(Component))
-					{
-						Proxies.OverlayPrimitives.Add(GizmoComponent);
-					}
-							else if (ULineComponent* LineComponent = Cast<ULineComponent>(Component))
-					{
-						Proxies.EditorLines.Add(LineComponent);
-					}
+	// 2. 레벨 컴포넌트 - 렌더 씬의 타입별 목록에서 수집 (액터 순회/Cast 없음)
+	FScene* Scene = World->GetScene();
+	Scene->UpdateDirtyProxies();
 
+	auto IsComponentVisible = [](const USceneComponent* Component)
+		{
+			AActor* Owner = Component->GetOwner();
+			return Owner && Owner->IsActorVisible() && Owner->IsActorActive() && Component->IsVisible();
+		};
+
+	// 보이는 프리미티브를 수집. 에디터 보조 컴포넌트(빌보드 등)는 EditorPrimitives로 보냄
+	auto ForEachVisiblePrimitive = [&](ESceneProxyType Type, bool bShowFlag, auto&& Func)
+		{
+			for (USceneComponent* Component : Scene->GetComponents(Type))
+			{
+				if (!IsComponentVisible(Component))
+				{
 					continue;
 				}
 
-				if (UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component); PrimitiveComponent)
+				UPrimitiveComponent* PrimitiveComponent = static_cast<UPrimitiveComponent*>(Component);
+				if (!PrimitiveComponent->IsEditable())
 				{
-					// 에디터 보조 컴포넌트 (빌보드 등)
-					if (!PrimitiveComponent->IsEditable())
-					{
-						if (bUseIcon)
-						{
-							Proxies.EditorPrimitives.Add(PrimitiveComponent);
-						}
-						continue;
-					}
-
-					// 일반 컴포넌트
-					if (UMeshComponent* MeshComponent = Cast<UMeshComponent>(PrimitiveComponent))
-					{
-						bool bShouldAdd = true;
-
-						// 메시 타입이 '스태틱 메시'인 경우에만 ShowFlag를 검사하여 추가 여부를 결정
-						if (MeshComponent->IsA(UStaticMeshComponent::StaticClass()))
-						{
-							bShouldAdd = bDrawStaticMeshes;
-						}
-						else if (MeshComponent->IsA(USkinnedMeshComponent::StaticClass()))
-						{
-						    bShouldAdd = bDrawSkeletalMeshes;
-						}
-
-						if (bShouldAdd)
-						{
-							Proxies.Meshes.Add(MeshComponent);
-						}
-					}
-					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent); BillboardComponent && bUseBillboard)
-					{
-						Proxies.Billboards.Add(BillboardComponent);
-					}
-					else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(PrimitiveComponent); DecalComponent && bDrawDecals)
-					{
-						Proxies.Decals.Add(DecalComponent);
-					}
-					else if (UParticleSystemComponent* ParticleSystemComponent = Cast<UParticleSystemComponent>(PrimitiveComponent))
+					if (bUseIcon)
 					{
-						Proxies.ParticleSystems.Add(ParticleSystemComponent);
-					}
-						else if (ULineComponent* LineComponent = Cast<ULineComponent>(PrimitiveComponent))
-					{
-						Proxies.EditorLines.Add(LineComponent);
-					}
-					else if (UTriangleMeshComponent* MeshComp = Cast<UTriangleMeshComponent>(PrimitiveComponent))
-					{
-						Proxies.EditorMeshes.Add(MeshComp);
+						Proxies.EditorPrimitives.Add(PrimitiveComponent);
 					}
 				}
-				else
+				else if (bShowFlag)
 				{
-					if (UHeightFogComponent* FogComponent = Cast<UHeightFogComponent>(Component); FogComponent && bDrawFog)
-					{
-						SceneGlobals.Fogs.Add(FogComponent);
-					}
+					Func(PrimitiveComponent);
+				}
+			}
+		};
 
-					else if (UDOFComponent* DOFComp = Cast<UDOFComponent>(Component); DOFComp && bDrawDOF)
-					{
-						SceneGlobals.DOFs.Add(DOFComp);
-					}
+	// 2-1. 스태틱 메시는 Meshes 앞쪽에 두고, 캐시된 월드 바운드를 컬링 입력으로 함께 모음
+	CullingBounds.Empty();
+	{
+		const TArray<USceneComponent*>& StaticMeshComponents = Scene->GetComponents(ESceneProxyType::StaticMesh);
+		const TArray<FStaticMeshSceneProxy>& StaticMeshProxies = Scene->GetStaticMeshProxies();
+		for (int32 Index = 0; Index < StaticMeshComponents.Num(); ++Index)
+		{
+			UStaticMeshComponent* MeshComponent = StaticMeshProxies[Index].Component;
+			if (!IsComponentVisible(MeshComponent))
+			{
+				continue;
+			}
 
-					else if (USkyboxComponent* SkyboxComp = Cast<USkyboxComponent>(Component); SkyboxComp && SkyboxComp->bEnabled)
-					{
-						SceneGlobals.Skyboxes.Add(SkyboxComp);
-					}
+			if (!MeshComponent->IsEditable())
+			{
+				if (bUseIcon)
+				{
+					Proxies.EditorPrimitives.Add(MeshComponent);
+				}
+			}
+			else if (bDrawStaticMeshes)
+			{
+				Proxies.Meshes.Add(MeshComponent);
+				Proxies.StaticMeshProxyIndices.Add(Index);
+				CullingBounds.Add(StaticMeshProxies[Index].WorldBounds);
+			}
+		}
+	}
 
-					else if (UDirectionalLightComponent* LightComponent = Cast<UDirectionalLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						SceneGlobals.DirectionalLights.Add(LightComponent);
-					}
+	ForEachVisiblePrimitive(ESceneProxyType::SkinnedMesh, bDrawSkeletalMeshes, [&](UPrimitiveComponent* Component)
+		{
+			Proxies.Meshes.Add(static_cast<UMeshComponent*>(Component));
+		});
+	ForEachVisiblePrimitive(ESceneProxyType::Mesh, true, [&](UPrimitiveComponent* Component)
+		{
+			Proxies.Meshes.Add(static_cast<UMeshComponent*>(Component));
+		});
+	ForEachVisiblePrimitive(ESceneProxyType::Billboard, bUseBillboard, [&](UPrimitiveComponent* Component)
+		{
+			Proxies.Billboards.Add(static_cast<UBillboardComponent*>(Component));
+		});
+	ForEachVisiblePrimitive(ESceneProxyType::Decal, bDrawDecals, [&](UPrimitiveComponent* Component)
+		{
+			Proxies.Decals.Add(static_cast<UDecalComponent*>(Component));
+		});
+	ForEachVisiblePrimitive(ESceneProxyType::ParticleSystem, true, [&](UPrimitiveComponent* Component)
+		{
+			// 바운드가 없으면 그릴 파티클이 없음, 바운드가 절두체 밖이면 컬링
+			UParticleSystemComponent* ParticleSystemComponent = static_cast<UParticleSystemComponent*>(Component);
+			if (!ParticleSystemComponent->HasParticleBounds())
+			{
+				return;
+			}
 
-					else if (UAmbientLightComponent* LightComponent = Cast<UAmbientLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						SceneGlobals.AmbientLights.Add(LightComponent);
-					}
+			if (IsAABBVisible(View->ViewFrustum, ParticleSystemComponent->GetParticleBounds()))
+			{
+				Proxies.ParticleSystems.Add(ParticleSystemComponent);
+			}
+			else
+			{
+				++CulledParticleSystemCount;
+			}
+		});
+	ForEachVisiblePrimitive(ESceneProxyType::Line, true, [&](UPrimitiveComponent* Component)
+		{
+			Proxies.EditorLines.Add(static_cast<ULineComponent*>(Component));
+		});
+	ForEachVisiblePrimitive(ESceneProxyType::TriangleMesh, true, [&](UPrimitiveComponent* Component)
+		{
+			Proxies.EditorMeshes.Add(static_cast<UTriangleMeshComponent*>(Component));
+		});
+	// 그 외 프리미티브(셰이프 등)는 에디터 보조 컴포넌트일 때만 그림
+	ForEachVisiblePrimitive(ESceneProxyType::Primitive, false, [](UPrimitiveComponent*) {});
 
-					else if (UPointLightComponent* LightComponent = Cast<UPointLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						if (USpotLightComponent* SpotLightComponent = Cast<USpotLightComponent>(LightComponent); SpotLightComponent)
-						{
-							SceneLocals.SpotLights.Add(SpotLightComponent);
-						}
-						else
-						{
-							SceneLocals.PointLights.Add(LightComponent);
-						}
-					}
+	// 2-2. 프리미티브가 아닌 컴포넌트 (포그, DOF, 스카이박스, 라이트)
+	auto ForEachVisibleComponent = [&](ESceneProxyType Type, auto&& Func)
+		{
+			for (USceneComponent* Component : Scene->GetComponents(Type))
+			{
+				if (IsComponentVisible(Component))
+				{
+					Func(Component);
 				}
 			}
 		};
 
-	// Collect from Editor Actors (Gizmo, Grid, etc.)
-	for (AActor* EditorActor : World->GetEditorActors())
+	if (bDrawFog)
 	{
-		CollectComponentsFromActor(EditorActor, true);
+		ForEachVisibleComponent(ESceneProxyType::HeightFog, [&](USceneComponent* Component)
+			{
+				SceneGlobals.Fogs.Add(static_cast<UHeightFogComponent*>(Component));
+			});
 	}
-
-	// Collect from Level Actors (including their Gizmo components)
-	for (AActor* Actor : World->GetActors())
+	if (bDrawDOF)
 	{
-		CollectComponentsFromActor(Actor, false);
+		ForEachVisibleComponent(ESceneProxyType::DOF, [&](USceneComponent* Component)
+			{
+				SceneGlobals.DOFs.Add(static_cast<UDOFComponent*>(Component));
+			});
 	}
+	ForEachVisibleComponent(ESceneProxyType::Skybox, [&](USceneComponent* Component)
+		{
+			USkyboxComponent* SkyboxComp = static_cast<USkyboxComponent*>(Component);
+			if (SkyboxComp->bEnabled)
+			{
+				SceneGlobals.Skyboxes.Add(SkyboxComp);
+			}
+		});
+	if (bDrawLight)
+	{
+		ForEachVisibleComponent(ESceneProxyType::DirectionalLight, [&](USceneComponent* Component)
+			{
+				SceneGlobals.DirectionalLights.Add(static_cast<UDirectionalLightComponent*>(Component));
+			});
+		ForEachVisibleComponent(ESceneProxyType::AmbientLight, [&](USceneComponent* Component)
+			{
+				SceneGlobals.AmbientLights.Add(static_cast<UAmbientLightComponent*>(Component));
+			});
+		ForEachVisibleComponent(ESceneProxyType::PointLight, [&](USceneComponent* Component)
+			{
+				SceneLocals.PointLights.Add(static_cast<UPointLightComponent*>(Component));
+			});
+		ForEachVisibleComponent(ESceneProxyType::SpotLight, [&](USceneComponent* Component)
+			{
+				SceneLocals.SpotLights.Add(static_cast<USpotLightComponent*>(Component));
+			});
+	}
+
+	// 절두체 컬링 수행 -> 보이지 않는 메시/데칼을 Proxies에서 제거
+	PerformFrustumCulling();
 
 	// 라이트 통계 업데이트
 	FLightStats LightStats;
@@ -951,7 +1104,7 @@ void FSceneRenderer::PerformTileLightCulling()
 		TArray<FPointLightInfo>& PointLights = World->GetLightManager()->GetPointLightInfoList();
 		TArray<FSpotLightInfo>& SpotLights = World->GetLightManager()->GetSpotLightInfoList();
 
-		// 타일 컬링 수행
+		// 클러스터 컬링 수행
 		TileLightCuller->CullLights(
 			PointLights,
 			SpotLights,
@@ -976,6 +1129,9 @@ void FSceneRenderer::PerformTileLightCulling()
 	TileCullingBuffer.bUseTileCulling = bTileCullingEnabled ? 1 : 0;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartX = View->ViewRect.MinX;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartY = View->ViewRect.MinY;  // ShowFlag에 따라 설정
+	TileCullingBuffer.ClusterSliceCount = FTileLightCuller::NumDepthSlices;
+	TileCullingBuffer.ClusterDepthScale = TileLightCuller->GetDepthSliceScale();
+	TileCullingBuffer.ClusterDepthBias = TileLightCuller->GetDepthSliceBias();
 
 	RHIDevice->SetAndUpdateConstantBuffer(TileCullingBuffer);
 
@@ -990,54 +1146,287 @@ void FSceneRenderer::PerformTileLightCulling()
 	}
 }
 
+namespace
+{
+	// 스태틱 메시 후보가 이 수 이상이면 BVH 쿼리, 미만이면 평탄 배열 병렬 검사
+	constexpr int32 BVHFrustumCullingThreshold = 512;
+
+	// 평탄 배열 병렬 검사의 작업 단위 (8의 배수)
+	constexpr int32 FrustumCullingChunkSize = 256;
+
+	// Bounds[i]가 보이면 OutVisibility[i] = 1 (8개씩 AVX 검사, 청크 단위 병렬)
+	void CullBoundsParallel(const FFrustum& Frustum, const TFrameArray<FAABB>& Bounds, TFrameArray<uint8>& OutVisibility)
+	{
+		const int32 NumBounds = Bounds.Num();
+		OutVisibility.SetNum(NumBounds);
+		if (NumBounds == 0)
+		{
+			return;
+		}
+
+		const int32 NumChunks = (NumBounds + FrustumCullingChunkSize - 1) / FrustumCullingChunkSize;
+		FTaskSystem::GetInstance().ParallelFor(NumChunks, [&Frustum, &Bounds, &OutVisibility, NumBounds](int32 Chunk)
+		{
+			const int32 Begin = Chunk * FrustumCullingChunkSize;
+			const int32 End = FMath::Min(Begin + FrustumCullingChunkSize, NumBounds);
+
+			FAABB Boxes[8];
+			for (int32 Base = Begin; Base < End; Base += 8)
+			{
+				// 8개가 안 되면 마지막 바운드로 채움 (결과는 Count개만 사용)
+				const int32 Count = FMath::Min(8, End - Base);
+				for (int32 i = 0; i < 8; ++i)
+				{
+					Boxes[i] = Bounds[Base + FMath::Min(i, Count - 1)];
+				}
+
+				const uint8 VisibleMask = AreAABBsVisible_8_AVX(Frustum, Boxes);
+				for (int32 i = 0; i < Count; ++i)
+				{
+					OutVisibility[Base + i] = (VisibleMask >> i) & 1;
+				}
+			}
+		});
+	}
+}
+
 void FSceneRenderer::PerformFrustumCulling()
 {
-	PotentiallyVisibleComponents.clear();	// 할 필요 없는데 명목적으로 초기화
+	const auto CullStart = std::chrono::high_resolution_clock::now();
+
+	FFrustumCullingStats Stats;
+	const FFrustum& Frustum = View->ViewFrustum;
+
+	// 그림자 캐스터는 카메라 절두체와 무관하므로 컬링 전 목록을 보관
+	Proxies.ShadowCasterMeshes = Proxies.Meshes;
+
+	// 1. 스태틱 메시 컬링 (스키닝 메시는 아직 월드 바운드가 없으므로 항상 통과)
+	//    GatherVisibleProxies가 스태틱 메시를 Meshes 앞쪽에, 렌더 씬에 캐시된 바운드를 CullingBounds에 같은 순서로 모아둠
+	TArray<UMeshComponent*>& Meshes = Proxies.Meshes;
+	const int32 NumStaticMeshes = CullingBounds.Num();
+	for (int32 Index = 0; Index < NumStaticMeshes; ++Index)
+	{
+		Meshes[Index]->SetCulled(true);
+	}
+
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	Stats.bUsedBVH = BVH && !BVH->IsPendingRebuild() && NumStaticMeshes >= BVHFrustumCullingThreshold;
+
+	if (Stats.bUsedBVH)
+	{
+		// 1-1. BVH가 찾은 컴포넌트만 보임 (캐시된 바운드 기준)
+		Partition->FrustumQuery(Frustum, PotentiallyVisibleComponents);
+		for (UPrimitiveComponent* Component : PotentiallyVisibleComponents)
+		{
+			Component->SetCulled(false);
+		}
+
+		// 1-2. BVH에 없거나 갱신 대기 중인 컴포넌트는 BVH 바운드를 믿을 수 없으므로 렌더 씬 바운드로 재검사
+		for (int32 Index = 0; Index < NumStaticMeshes; ++Index)
+		{
+			UMeshComponent* MeshComponent = Meshes[Index];
+			if (MeshComponent->GetCulled() && (!BVH->Contains(MeshComponent) || Partition->IsDirty(MeshComponent)))
+			{
+				MeshComponent->SetCulled(!IsAABBVisible(Frustum, CullingBounds[Index]));
+			}
+		}
+	}
+	else
+	{
+		// 1-1. 평탄 배열: 렌더 씬 바운드를 병렬 검사
+		CullBoundsParallel(Frustum, CullingBounds, CullingVisibility);
+
+		for (int32 Index = 0; Index < NumStaticMeshes; ++Index)
+		{
+			Meshes[Index]->SetCulled(CullingVisibility[Index] == 0);
+		}
+	}
+
+	// 1-3. 소프트웨어 오클루전 컬링 (절두체를 통과한 스태틱 메시끼리)
+	if (OcclusionCuller && World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_OcclusionCulling))
+	{
+		PerformOcclusionCulling(NumStaticMeshes, Stats);
+	}
+
+	// 1-4. 컬링된 메시 제거 (순서 유지, 스태틱 메시 프록시 인덱스도 함께)
+	TArray<int32>& ProxyIndices = Proxies.StaticMeshProxyIndices;
+	int32 WriteIndex = 0;
+	for (int32 ReadIndex = 0; ReadIndex < Meshes.Num(); ++ReadIndex)
+	{
+		UMeshComponent* MeshComponent = Meshes[ReadIndex];
+		if (!MeshComponent->GetCulled())
+		{
+			if (ReadIndex < NumStaticMeshes)
+			{
+				ProxyIndices[WriteIndex] = ProxyIndices[ReadIndex];
+			}
+			Meshes[WriteIndex++] = MeshComponent;
+		}
+	}
 
-	// Todo: 프로스텀 컬링 수행, 추후 프로스텀 컬링이 컴포넌트 단위로 변경되면 적용
+	Stats.TestedMeshes = NumStaticMeshes;
+	Stats.CulledMeshes = Meshes.Num() - WriteIndex;
+	Stats.VisibleMeshes = Stats.TestedMeshes - Stats.CulledMeshes;
+	Stats.UnculledMeshes = Meshes.Num() - NumStaticMeshes;
+	Meshes.SetNum(WriteIndex);
+	ProxyIndices.SetNum(Stats.VisibleMeshes);
 
-	//World->GetPartitionManager()->FrustumQuery(ViewFrustum)
+	// 2. 데칼 컬링 (이동 시 BVH가 갱신되지 않으므로 항상 현재 바운드로 검사)
+	TArray<UDecalComponent*>& Decals = Proxies.Decals;
+	if (!Decals.IsEmpty())
+	{
+		CullingBounds.Empty();
+		CullingBounds.Reserve(Decals.Num());
+		for (UDecalComponent* Decal : Decals)
+		{
+			CullingBounds.Add(Decal->GetWorldAABB());
+		}
 
-	//for (AActor* Actor : World->GetActors())
-	//{
-	//	if (!Actor || Actor->GetActorHiddenInEditor()) continue;
+		CullBoundsParallel(Frustum, CullingBounds, CullingVisibility);
 
-	//	// 절두체 컬링을 통과한 액터만 목록에 추가
-	//	if (ViewFrustum.Intersects(Actor->GetBounds()))
-	//	{
-	//		PotentiallyVisibleActors.Add(Actor);
-	//	}
-	//}
+		int32 WriteDecal = 0;
+		for (int32 ReadDecal = 0; ReadDecal < Decals.Num(); ++ReadDecal)
+		{
+			if (CullingVisibility[ReadDecal])
+			{
+				Decals[WriteDecal++] = Decals[ReadDecal];
+			}
+		}
+
+		Stats.TestedDecals = Decals.Num();
+		Stats.VisibleDecals = WriteDecal;
+		Stats.CulledDecals = Decals.Num() - WriteDecal;
+		Decals.SetNum(WriteDecal);
+	}
+
+	const auto CullEnd = std::chrono::high_resolution_clock::now();
+	Stats.CullingTimeMS = std::chrono::duration<double, std::milli>(CullEnd - CullStart).count();
+	FFrustumCullingStatManager::GetInstance().UpdateStats(Stats);
+}
+
+void FSceneRenderer::PerformOcclusionCulling(int32 NumStaticMeshes, FFrustumCullingStats& Stats)
+{
+	const auto OcclusionStart = std::chrono::high_resolution_clock::now();
+
+	TArray<UMeshComponent*>& Meshes = Proxies.Meshes;
+	const TArray<int32>& ProxyIndices = Proxies.StaticMeshProxyIndices;
+	const TArray<FStaticMeshSceneProxy>& SceneProxies = World->GetScene()->GetStaticMeshProxies();
+
+	auto GetOccluderMesh = [&](int32 Index) -> const FStaticMesh*
+	{
+		const FStaticMeshSceneProxy& Proxy = SceneProxies[ProxyIndices[Index]];
+		if (!Proxy.Component || !Proxy.Component->bUseAsOccluder || !Proxy.StaticMesh)
+		{
+			return nullptr;
+		}
+		return Proxy.StaticMesh->GetStaticMeshAsset();
+	};
+
+	// 1. 절두체를 통과한 오클루더 지정 메시만 래스터화 (렌더 씬에 캐시된 월드 행렬/바운드 사용)
+	OcclusionCuller->BeginView(View->ViewMatrix * View->ProjectionMatrix);
+	for (int32 Index = 0; Index < NumStaticMeshes; ++Index)
+	{
+		if (Meshes[Index]->GetCulled())
+		{
+			continue;
+		}
+
+		if (const FStaticMesh* MeshAsset = GetOccluderMesh(Index))
+		{
+			const FStaticMeshSceneProxy& Proxy = SceneProxies[ProxyIndices[Index]];
+			OcclusionCuller->AddOccluder(MeshAsset->Vertices, MeshAsset->Indices, Proxy.WorldMatrix, Proxy.WorldBounds);
+		}
+	}
+
+	Stats.OccluderMeshes = OcclusionCuller->GetNumOccluders();
+	if (Stats.OccluderMeshes == 0)
+	{
+		return;
+	}
+
+	OcclusionCuller->RasterizeOccluders();
+	Stats.OccluderTriangles = OcclusionCuller->GetNumOccluderTriangles();
+
+	// 2. 오클루더가 아닌 가시 메시의 바운드 검사
+	CullingVisibility.SetNum(NumStaticMeshes);
+	for (int32 Index = 0; Index < NumStaticMeshes; ++Index)
+	{
+		CullingVisibility[Index] = (!Meshes[Index]->GetCulled() && !GetOccluderMesh(Index)) ? 1 : 0;
+	}
+
+	Stats.OccludedMeshes = OcclusionCuller->TestOccludees(CullingBounds, CullingVisibility);
+	if (Stats.OccludedMeshes > 0)
+	{
+		for (int32 Index = 0; Index < NumStaticMeshes; ++Index)
+		{
+			if (!CullingVisibility[Index] && !Meshes[Index]->GetCulled() && !GetOccluderMesh(Index))
+			{
+				Meshes[Index]->SetCulled(true);
+			}
+		}
+	}
+
+	const auto OcclusionEnd = std::chrono::high_resolution_clock::now();
+	Stats.OcclusionTimeMS = std::chrono::duration<double, std::milli>(OcclusionEnd - OcclusionStart).count();
 }
 
 void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 {
-	// --- 1. 수집 (Collect) ---
-	TArray<FMeshBatchElement> AllBatches;
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	MeshBatchElements.Empty();
+	TranslucentBatchElements.Empty();
+	OpaqueSortKeys.Empty();
+	OpaqueDrawCommands.Empty();
+
+	const FVector ViewLocation = View->ViewLocation;
+	const float MaxSortDistance = View->FarClip;
+
+	// --- 1. 스태틱 메시: 렌더 씬에 캐시된 드로우 커맨드 재사용 (상태 키도 캐시됨) ---
+	FScene* Scene = World->GetScene();
+	const TArray<int32>& ProxyIndices = Proxies.StaticMeshProxyIndices;
+	const uint64 ViewMacroKey = UShader::GenerateShaderKey(View->ViewShaderMacros);
+	for (int32 ProxyIndex : ProxyIndices)
 	{
-		MeshComponent->CollectMeshBatches(AllBatches, View);
+		for (const FCachedMeshDrawCommand& Command : Scene->GetDrawCommands(ProxyIndex, View, ViewMacroKey))
+		{
+			if (Command.Batch.RenderMode == EBatchRenderMode::Opaque)
+			{
+				MeshBatchElements.Add(Command.Batch);
+				OpaqueSortKeys.Add(FMeshDrawCommandCache::MakeSortKey(Command.StateKey, Command.Batch, ViewLocation, MaxSortDistance));
+				OpaqueDrawCommands.Add(&Command);
+			}
+			else
+			{
+				TranslucentBatchElements.Add(Command.Batch);
+			}
+		}
+	}
+
+	// --- 2. 그 외 (스키닝 메시, 빌보드): 매 프레임 수집 ---
+	TFrameArray<FMeshBatchElement> DynamicBatches;
+	for (int32 MeshIndex = ProxyIndices.Num(); MeshIndex < Proxies.Meshes.Num(); ++MeshIndex)
+	{
+		Proxies.Meshes[MeshIndex]->CollectMeshBatches(DynamicBatches, View);
 	}
 
 	for (UBillboardComponent* BillboardComponent : Proxies.Billboards)
 	{
-		BillboardComponent->CollectMeshBatches(AllBatches, View);
+		BillboardComponent->CollectMeshBatches(DynamicBatches, View);
 	}
 
 	for (UTextRenderComponent* TextRenderComponent : Proxies.Texts)
 	{
 		// TODO: UTextRenderComponent도 CollectMeshBatches를 통해 FMeshBatchElement를 생성하도록 구현
-		//TextRenderComponent->CollectMeshBatches(AllBatches, View);
+		//TextRenderComponent->CollectMeshBatches(DynamicBatches, View);
 	}
 
-	// --- 2. RenderMode별로 분리 (Opaque / Translucent) ---
-	MeshBatchElements.Empty();
-	TranslucentBatchElements.Empty();
-	for (const FMeshBatchElement& Batch : AllBatches)
+	for (const FMeshBatchElement& Batch : DynamicBatches)
 	{
 		if (Batch.RenderMode == EBatchRenderMode::Opaque)
 		{
 			MeshBatchElements.Add(Batch);
+			OpaqueSortKeys.Add(FMeshDrawCommandCache::MakeSortKey(FMeshDrawCommandCache::MakeStateKey(Batch), Batch, ViewLocation, MaxSortDistance));
+			OpaqueDrawCommands.Add(nullptr);
 		}
 		else
 		{
@@ -1045,14 +1434,125 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 		}
 	}
 
-	// --- 3. 정렬 (Sort) ---
-	MeshBatchElements.Sort();
+	// --- 3. 정렬 (Sort): 64비트 키 + 인덱스 기수 정렬 후 순서대로 재배치 ---
+	DrawCommandSorter.Sort(OpaqueSortKeys, OpaqueSortOrder);
+
+	SortedBatchElements.Empty();
+	SortedBatchElements.Reserve(MeshBatchElements.Num());
+	SortedDrawCommands.Empty();
+	SortedDrawCommands.Reserve(MeshBatchElements.Num());
+	for (uint32 BatchIndex : OpaqueSortOrder)
+	{
+		SortedBatchElements.Add(MeshBatchElements[BatchIndex]);
+		SortedDrawCommands.Add(OpaqueDrawCommands[BatchIndex]);
+	}
+	MeshBatchElements.swap(SortedBatchElements);
 
-	// --- 4. 그리기 (Draw) ---
+	// --- 4. 자동 인스턴싱: 인접한 동일 배치를 인스턴스 드로우 하나로 병합 ---
+	MergeStaticMeshInstances();
+
+	// --- 5. 그리기 (Draw) ---
 	// GPU 타이머는 Renderer::BeginFrame/EndFrame에서 프레임 레벨로 측정됨
 	DrawMeshBatches(MeshBatchElements, true);
 }
 
+void FSceneRenderer::MergeStaticMeshInstances()
+{
+	FMeshDrawStats Stats;
+	Stats.BatchesBeforeMerge = static_cast<uint32>(MeshBatchElements.Num());
+	Stats.DrawCalls = Stats.BatchesBeforeMerge;
+
+	// 같은 인스턴스 드로우로 합칠 수 있는지 (셰이더가 같으면 인스턴싱 변형도 같음)
+	auto CanMerge = [](const FMeshBatchElement& A, const FMeshBatchElement& B)
+	{
+		return A.VertexShader == B.VertexShader && A.PixelShader == B.PixelShader
+			&& A.Material == B.Material
+			&& A.VertexBuffer == B.VertexBuffer && A.IndexBuffer == B.IndexBuffer
+			&& A.VertexStride == B.VertexStride && A.PrimitiveTopology == B.PrimitiveTopology
+			&& A.StartIndex == B.StartIndex && A.IndexCount == B.IndexCount && A.BaseVertexIndex == B.BaseVertexIndex
+			&& !B.InstanceBuffer && !B.InstanceShaderResourceView && !B.BoneMatricesBuffer
+			&& A.InstanceColor == B.InstanceColor;
+	};
+
+	SortedBatchElements.Empty();
+	SortedBatchElements.Reserve(MeshBatchElements.Num());
+	StaticMeshInstances.Empty();
+	InstancedBatchIndices.Empty();
+
+	const int32 NumBatches = MeshBatchElements.Num();
+	int32 RunStart = 0;
+	while (RunStart < NumBatches)
+	{
+		const FMeshBatchElement& First = MeshBatchElements[RunStart];
+		const FCachedMeshDrawCommand* Command = SortedDrawCommands[RunStart];
+
+		// 캐시된 스태틱 메시 커맨드이고 인스턴싱 변형이 있을 때만 같은 배치를 이어서 찾음
+		int32 RunEnd = RunStart + 1;
+		if (Command && Command->InstancedVertexShader && Command->InstancedPixelShader && !First.InstanceBuffer)
+		{
+			while (RunEnd < NumBatches && SortedDrawCommands[RunEnd] && CanMerge(First, MeshBatchElements[RunEnd]))
+			{
+				++RunEnd;
+			}
+		}
+
+		const int32 RunLength = RunEnd - RunStart;
+		if (RunLength < 2)
+		{
+			SortedBatchElements.Add(First);
+			++RunStart;
+			continue;
+		}
+
+		// 인스턴스 데이터 기록 (노멀 행렬은 배치마다 WorldInverseTranspose 계산과 동일)
+		FMeshBatchElement Merged = First;
+		Merged.VertexShader = Command->InstancedVertexShader;
+		Merged.PixelShader = Command->InstancedPixelShader;
+		Merged.InputLayout = Command->InstancedInputLayout;
+		Merged.InstanceStride = sizeof(FStaticMeshInstanceData);
+		Merged.StartInstanceLocation = static_cast<uint32>(StaticMeshInstances.Num());
+		Merged.NumInstances = static_cast<uint32>(RunLength);
+
+		for (int32 BatchIndex = RunStart; BatchIndex < RunEnd; ++BatchIndex)
+		{
+			const FMeshBatchElement& Batch = MeshBatchElements[BatchIndex];
+			const FMatrix NormalMatrix = Batch.WorldMatrix.InverseAffine().Transpose();
+
+			FStaticMeshInstanceData& Instance = StaticMeshInstances[StaticMeshInstances.Emplace()];
+			Instance.WorldMatrix = Batch.WorldMatrix;
+			for (int32 Row = 0; Row < 3; ++Row)
+			{
+				Instance.NormalMatrix[Row] = FVector4(NormalMatrix.M[Row][0], NormalMatrix.M[Row][1], NormalMatrix.M[Row][2], 0.0f);
+			}
+			Instance.ObjectID = Batch.ObjectID;
+		}
+
+		InstancedBatchIndices.Add(SortedBatchElements.Add(Merged));
+		++Stats.InstancedDraws;
+		Stats.InstancedBatches += static_cast<uint32>(RunLength);
+		RunStart = RunEnd;
+	}
+
+	// 병합할 것이 없거나 업로드 실패 시 원래 배치 그대로 사용
+	ID3D11Buffer* InstanceBuffer = InstancedBatchIndices.IsEmpty() ? nullptr : OwnerRenderer->UploadStaticMeshInstances(StaticMeshInstances);
+	if (InstanceBuffer)
+	{
+		for (int32 MergedIndex : InstancedBatchIndices)
+		{
+			SortedBatchElements[MergedIndex].InstanceBuffer = InstanceBuffer;
+		}
+		MeshBatchElements.swap(SortedBatchElements);
+		Stats.DrawCalls = static_cast<uint32>(MeshBatchElements.Num());
+	}
+	else
+	{
+		Stats.InstancedDraws = 0;
+		Stats.InstancedBatches = 0;
+	}
+
+	FMeshDrawStatManager::GetInstance().UpdateStats(Stats);
+}
+
 void FSceneRenderer::RenderTranslucentPass(EViewMode InRenderViewMode)
 {
 	if (TranslucentBatchElements.IsEmpty())
@@ -1099,7 +1599,7 @@ void FSceneRenderer::RenderDecalPass()
 	if (!BVH)
 		return;
 
-	FDecalStatManager::GetInstance().AddTotalDecalCount(Proxies.Decals.Num());	// TODO: 추후 월드 컴포넌트 추가/삭제 이벤트에서 데칼 컴포넌트의 개수만 추적하도록 수정 필요
+	FDecalStatManager::GetInstance().AddTotalDecalCount(Proxies.Decals.Num() + FFrustumCullingStatManager::GetInstance().GetStats().CulledDecals);	// TODO: 추후 월드 컴포넌트 추가/삭제 이벤트에서 데칼 컴포넌트의 개수만 추적하도록 수정 필요
 	FDecalStatManager::GetInstance().AddVisibleDecalCount(Proxies.Decals.Num());	// 그릴 Decal 개수 수집
 
 	// ViewMode에 따라 조명 모델 매크로 설정
@@ -1127,11 +1627,12 @@ void FSceneRenderer::RenderDecalPass()
 		}
 
 		// Decal이 그려질 Primitives
-		TArray<UPrimitiveComponent*> TargetPrimitives;
+		TFrameArray<UPrimitiveComponent*> TargetPrimitives;
 
 		// 1. Decal의 World AABB와 충돌한 모든 StaticMeshComponent 쿼리
 		const FOBB DecalOBB = Decal->GetWorldOBB();
-		TArray<UPrimitiveComponent*> IntersectedStaticMeshComponents = BVH->QueryIntersectedComponents(DecalOBB);
+		TFrameArray<UPrimitiveComponent*> IntersectedStaticMeshComponents;
+		BVH->QueryIntersectedComponents(DecalOBB, IntersectedStaticMeshComponents);
 
 		// 2. 충돌한 모든 visible Actor의 PrimitiveComponent를 TargetPrimitives에 추가
 		// Actor에 기본으로 붙어있는 TextRenderComponent, BoundingBoxComponent는 decal 적용 안되게 하기 위해,
@@ -1197,6 +1698,7 @@ void FSceneRenderer::RenderParticleSystemPass()
 	// 파티클 통계 수집
 	FParticleStats Stats;
 	Stats.ParticleSystemCount = static_cast<int32>(Proxies.ParticleSystems.size());
+	Stats.CulledSystemCount = CulledParticleSystemCount;
 
 	for (UParticleSystemComponent* ParticleSystem : Proxies.ParticleSystems)
 	{
@@ -1265,7 +1767,7 @@ void FSceneRenderer::RenderParticleSystemPass()
 	const bool bWireframe = View->RenderSettings->GetViewMode() == EViewMode::VMI_Wireframe;
 
 	// 파티클 배치 수집
-	TArray<FMeshBatchElement> AllParticleBatches;
+	TFrameArray<FMeshBatchElement> AllParticleBatches;
 
 	for (UParticleSystemComponent* ParticleSystem : Proxies.ParticleSystems)
 	{
@@ -1279,8 +1781,8 @@ void FSceneRenderer::RenderParticleSystemPass()
 		return;
 
 	// RenderMode별로 파티션
-	TArray<FMeshBatchElement> OpaqueBatches;
-	TArray<FMeshBatchElement> TranslucentBatches;
+	TFrameArray<FMeshBatchElement> OpaqueBatches;
+	TFrameArray<FMeshBatchElement> TranslucentBatches;
 
 	for (const FMeshBatchElement& Batch : AllParticleBatches)
 	{
@@ -1822,7 +2324,7 @@ void FSceneRenderer::RenderFinalOverlayLines()
 }
 
 // 수집한 Batch 그리기
-void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
+void FSceneRenderer::DrawMeshBatches(TFrameArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
 {
 	if (InMeshBatches.IsEmpty()) return;
 
@@ -2014,11 +2516,13 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 				Batch.BaseVertexIndex,
 				Batch.StartInstanceLocation
 			);
+			FRHIStatManager::GetInstance().RecordDraw(Batch.NumInstances);
 		}
 		else
 		{
 			// 일반 드로우 (인스턴스 버퍼 없음)
 			RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+			FRHIStatManager::GetInstance().RecordDraw();
 		}
 	}
 
@@ -2222,6 +2726,7 @@ void FSceneRenderer::RenderSkyboxPass()
 
 		// 해당 면만 그리기 (6개 인덱스씩)
 		RHIDevice->GetDeviceContext()->DrawIndexed(6, i * 6, 0);
+		FRHIStatManager::GetInstance().RecordDraw();
 	}
 
 	// 상태 복원
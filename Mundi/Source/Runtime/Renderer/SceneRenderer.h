@@ -1,5 +1,7 @@
 ﻿#pragma once
 #include "Frustum.h"
+#include "AABB.h"
+#include "MeshDrawCommand.h"
 
 // TODO : Post Processing 떼어내기, 전방선언으로라든지...
 #include "PostProcessing/FadeInOutPass.h"
@@ -30,6 +32,8 @@ class UTextRenderComponent;
 class UGizmoArrowComponent;
 class FSceneView;
 class FTileLightCuller;
+class FOcclusionCullingManagerCPU;
+struct FFrustumCullingStats;
 class ULineComponent;
 class UTriangleMeshComponent;
 class UParticleSystemComponent;
@@ -42,11 +46,16 @@ struct FVisibleRenderProxySet
 {
 	// --- Type 1: Main Scene (PP O, Depth-Test O) ---
 	TArray<UMeshComponent*> Meshes;
+	// Meshes 앞쪽 스태틱 메시의 렌더 씬 프록시 인덱스 (같은 순서, 캐시된 드로우 커맨드 조회용)
+	TArray<int32> StaticMeshProxyIndices;
 	TArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
 	TArray<UDecalComponent*> Decals;
 	TArray<UTextRenderComponent*> Texts;
 	TArray<UParticleSystemComponent*> ParticleSystems;
 
+	// 그림자 캐스터 후보 (카메라 절두체 컬링 전의 Meshes, 화면 밖 메시도 그림자를 드리움)
+	TArray<UMeshComponent*> ShadowCasterMeshes;
+
 	// --- Type 2: In-Scene Editor (PP X, Depth-Test O) ---
 	TArray<ULineComponent*> EditorLines;	// 그리드, 디버그 선
 	TArray<UTriangleMeshComponent*> EditorMeshes;	// 디버그 메시
@@ -93,7 +102,9 @@ private:
 	void RenderSceneDepthPath();
 
 	void RenderShadowMaps();
-	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
+	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TFrameArray<const FMeshBatchElement*>& InShadowBatches);
+	/** @brief 현재 뷰포트의 섀도우 아틀라스 영역만 초기화합니다. (캐시된 나머지 영역은 유지) */
+	void ClearShadowAtlasRegion();
 
 	/** @brief 렌더링에 필요한 포인터들이 유효한지 확인합니다. */
 	bool IsValid() const;
@@ -101,9 +112,18 @@ private:
 	/** @brief 렌더링에 필요한 뷰 행렬, 절두체 등 프레임 데이터를 준비합니다. */
 	void PrepareView();
 
-	/** @brief 월드의 모든 액터를 대상으로 절두체 컬링을 수행합니다. */
+	/**
+	 * @brief 수집된 스태틱 메시/데칼을 뷰 절두체로 컬링해 Proxies에서 제거합니다.
+	 * 후보가 많으면 BVH 쿼리, 적으면 평탄 배열 병렬 검사. 바운드가 없는 컴포넌트는 통과시킵니다.
+	 */
 	void PerformFrustumCulling();
 
+	/**
+	 * @brief 절두체를 통과한 스태틱 메시 중 bUseAsOccluder 메시를 래스터화하고, 나머지를 화면 AABB로 가림 검사합니다.
+	 * 가려진 메시는 SetCulled(true) → PerformFrustumCulling의 압축 단계에서 함께 제거됩니다.
+	 */
+	void PerformOcclusionCulling(int32 NumStaticMeshes, FFrustumCullingStats& Stats);
+
 	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
 	void GatherVisibleProxies();
 
@@ -116,7 +136,10 @@ private:
 	/** @brief 반투명(Translucent) 객체들을 렌더링하는 패스입니다. */
 	void RenderTranslucentPass(EViewMode InRenderViewMode);
 
-	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
+	void DrawMeshBatches(TFrameArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
+
+	/** @brief 정렬된 MeshBatchElements에서 상태와 인덱스 범위가 같은 인접 스태틱 메시 배치를 인스턴스 드로우로 병합합니다. */
+	void MergeStaticMeshInstances();
 
 	/** @brief 스카이박스를 렌더링하는 패스입니다. (배경 대체) */
 	void RenderSkyboxPass();
@@ -163,15 +186,40 @@ private:
 	// 씬 전역 설정
 	FSceneGlobals SceneGlobals;
 
-	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
-	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
+	// GatherVisibleProxies에서 바운드로 컬링된 파티클 시스템 수 (통계용)
+	int32 CulledParticleSystemCount = 0;
 
-	// 각 패스에서 수집된 드로우 콜 정보 리스트
-	TArray<FMeshBatchElement> MeshBatchElements;
-	TArray<FMeshBatchElement> TranslucentBatchElements;
+	// 아래 프레임 배열들은 FFrameArena에서 할당 (FSceneRenderer는 뷰마다 프레임 안에서 생성/소멸하므로 해제 불필요)
 
-	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
-	std::unique_ptr<FTileLightCuller> TileLightCuller;
+	// BVH 절두체 쿼리 결과 (PerformFrustumCulling)
+	TFrameArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
+
+	// 평탄 배열 컬링 입력/결과 (PerformFrustumCulling)
+	// GatherVisibleProxies가 Meshes 앞쪽 스태틱 메시의 렌더 씬 바운드로 채움
+	TFrameArray<FAABB> CullingBounds;
+	TFrameArray<uint8> CullingVisibility;
+
+	// 각 패스에서 수집된 드로우 콜 정보 리스트
+	TFrameArray<FMeshBatchElement> MeshBatchElements;
+	TFrameArray<FMeshBatchElement> TranslucentBatchElements;
+
+	// 불투명 배치 정렬 (RenderOpaquePass): MeshBatchElements와 같은 순서의 키 → 정렬된 인덱스
+	TFrameArray<uint64> OpaqueSortKeys;
+	TFrameArray<uint32> OpaqueSortOrder;
+	TFrameArray<FMeshBatchElement> SortedBatchElements;
+	FMeshDrawCommandSorter DrawCommandSorter;
+
+	// 자동 인스턴싱 (MergeStaticMeshInstances): MeshBatchElements와 같은 순서의 캐시 커맨드 (동적 배치는 nullptr)
+	TFrameArray<const FCachedMeshDrawCommand*> OpaqueDrawCommands;
+	TFrameArray<const FCachedMeshDrawCommand*> SortedDrawCommands;
+	TFrameArray<FStaticMeshInstanceData> StaticMeshInstances;
+	TFrameArray<int32> InstancedBatchIndices;
+
+	// 클러스터 기반 라이트 컬링 시스템 (URenderer 소유, 프레임 간 버퍼 재사용)
+	FTileLightCuller* TileLightCuller = nullptr;
+
+	// 소프트웨어 오클루전 컬러 (URenderer 소유)
+	FOcclusionCullingManagerCPU* OcclusionCuller = nullptr;
 
 	// TODO : 자동으로 등록되게 바꾸기!, bloom 빼고 다 stateless해서 걔네는 static(etc..) 등 하이브리도 구조로 바꾸기
 	// PostProcessing
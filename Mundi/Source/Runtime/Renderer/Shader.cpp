@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "Shader.h"
 #include "Hash.h"
+#include "MeshDrawCommand.h"
 
 IMPLEMENT_CLASS(UShader)
 
@@ -11,7 +12,8 @@ static bool CompileShaderInternal(
 	const char* InTarget,
 	UINT InCompileFlags,
 	const D3D_SHADER_MACRO* InDefines,
-	ID3DBlob** OutBlob
+	ID3DBlob** OutBlob,
+	FString* OutErrors
 )
 {
 	ID3DBlob* ErrorBlob = nullptr;
@@ -36,10 +38,17 @@ static bool CompileShaderInternal(
 			// wstring을 UTF-8로 안전하게 변환 (한글 경로 지원)
 			FString NarrowPath = WideToUTF8(InFilePath);
 
-			UE_LOG("[error] Shader '%s' compile error: %s", NarrowPath.c_str(), Msg);
+			if (OutErrors)
+			{
+				*OutErrors += "[error] Shader '" + NarrowPath + "' compile error: " + Msg;
+			}
+			else
+			{
+				UE_LOG("[error] Shader '%s' compile error: %s", NarrowPath.c_str(), Msg);
+			}
 			ErrorBlob->Release();
 		}
-		if (*OutBlob) { (*OutBlob)->Release(); }
+		if (*OutBlob) { (*OutBlob)->Release(); *OutBlob = nullptr; }
 		return false;
 	}
 
@@ -47,6 +56,35 @@ static bool CompileShaderInternal(
 	return true;
 }
 
+// 디스크 캐시에 있으면 읽고, 없으면 컴파일 후 기록
+static bool CompileShaderCached(
+	const FWideString& InFilePath,
+	const char* InEntryPoint,
+	const char* InTarget,
+	UINT InCompileFlags,
+	const D3D_SHADER_MACRO* InDefines,
+	uint64 InSourceHash,
+	const FShaderMacroStrings& InMacros,
+	ID3DBlob** OutBlob,
+	FString* OutErrors
+)
+{
+	FShaderCache& ShaderCache = FShaderCache::GetInstance();
+	const uint64 CacheKey = FShaderCache::MakeKey(InSourceHash, InMacros, InEntryPoint, InTarget, InCompileFlags);
+	if (ShaderCache.Load(CacheKey, OutBlob))
+	{
+		return true;
+	}
+
+	if (!CompileShaderInternal(InFilePath, InEntryPoint, InTarget, InCompileFlags, InDefines, OutBlob, OutErrors))
+	{
+		return false;
+	}
+
+	ShaderCache.Store(CacheKey, *OutBlob);
+	return true;
+}
+
 UShader::~UShader()
 {
 	ReleaseResources();
@@ -129,6 +167,7 @@ void UShader::Load(const FString& InShaderPath, ID3D11Device* InDevice, const TA
 		}
 		// Include 파일 파싱 (최초 1회)
 		ParseIncludeFiles(FilePath);
+		SourceHash = FShaderCache::HashSourceFiles(FilePath, IncludedFiles);
 	}
 
 	// 2. 실제 컴파일/가져오기 로직은 GetOrCompileShaderVariant에 위임
@@ -176,6 +215,15 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& I
 		// TMap::Add()는 추가된 FShaderVariant의 레퍼런스를 포함하는 TPair를 반환합니다.
 		// .Value의 주소를 가져옵니다.
 		ShaderVariantMap.Add(Key, NewShaderVariant);
+
+		// 다음 실행 때 시작 단계에서 미리 컴파일되도록 기록
+		FShaderMacroStrings MacroStrings;
+		for (const FShaderMacro& Macro : InMacros)
+		{
+			MacroStrings.emplace_back(Macro.Name.ToString(), Macro.Definition.ToString());
+		}
+		FShaderCache::GetInstance().RecordVariant(FilePath, MacroStrings);
+
 		return &ShaderVariantMap[Key];
 	}
 
@@ -199,16 +247,48 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& I
  */
 bool UShader::CompileVariantInternal(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& OutVariant)
 {
-	FWideString WFilePath = UTF8ToWide(InShaderPath);
-
-	// --- 1. D3D_SHADER_MACRO* 형태로 변환 ---
-	TArray<D3D_SHADER_MACRO> Defines;
-	TArray<TPair<FString, FString>> MacroStrings; // 포인터 유효성 유지를 위한 저장소
+	// --- 1. 매크로를 문자열로 변환 ---
+	FShaderMacroStrings MacroStrings;
 	MacroStrings.reserve(InMacros.Num());
 	for (const FShaderMacro& Macro : InMacros)
 	{
 		MacroStrings.emplace_back(Macro.Name.ToString(), Macro.Definition.ToString());
-		Defines.push_back({ MacroStrings.back().first.c_str(), MacroStrings.back().second.c_str() });
+	}
+
+	// --- 2. 바이트코드 (캐시 적중 시 컴파일 생략) ---
+	const bool bCompiled = CompileVariantBytecode(InShaderPath, SourceHash, MacroStrings, &OutVariant.VSBlob, &OutVariant.PSBlob);
+
+	// --- 3. 디바이스 오브젝트 생성 ---
+	HRESULT Hr;
+	if (OutVariant.VSBlob)
+	{
+		Hr = InDevice->CreateVertexShader(OutVariant.VSBlob->GetBufferPointer(), OutVariant.VSBlob->GetBufferSize(), nullptr, &OutVariant.VertexShader);
+		assert(SUCCEEDED(Hr));
+		CreateInputLayout(InDevice, InShaderPath, InMacros, OutVariant); // InMacros 전달
+	}
+	if (OutVariant.PSBlob)
+	{
+		Hr = InDevice->CreatePixelShader(OutVariant.PSBlob->GetBufferPointer(), OutVariant.PSBlob->GetBufferSize(), nullptr, &OutVariant.PixelShader);
+		assert(SUCCEEDED(Hr));
+	}
+
+	// 4. 핫 리로드용 매크로 저장
+	OutVariant.SourceMacros = InMacros;
+
+	// 5. 컴파일 성공 여부 반환 (VS 또는 PS 둘 중 하나라도 성공 시)
+	return bCompiled;
+}
+
+bool UShader::CompileVariantBytecode(const FString& InShaderPath, uint64 InSourceHash, const FShaderMacroStrings& InMacros, ID3DBlob** OutVSBlob, ID3DBlob** OutPSBlob, FString* OutErrors)
+{
+	FWideString WFilePath = UTF8ToWide(InShaderPath);
+
+	// --- 1. D3D_SHADER_MACRO* 형태로 변환 (InMacros가 문자열을 소유) ---
+	TArray<D3D_SHADER_MACRO> Defines;
+	Defines.reserve(InMacros.Num() + 1);
+	for (const TPair<FString, FString>& Macro : InMacros)
+	{
+		Defines.push_back({ Macro.first.c_str(), Macro.second.c_str() });
 	}
 	Defines.push_back({ NULL, NULL }); // 배열의 끝을 알리는 NULL 터미네이터
 
@@ -225,52 +305,21 @@ bool UShader::CompileVariantInternal(ID3D11Device* InDevice, const FString& InSh
 				[](char a, char b) { return static_cast<char>(::tolower(a)) == static_cast<char>(::tolower(b)); });
 		};
 
-	HRESULT Hr;
+	const bool bHasVS = !EndsWith(InShaderPath, "_PS.hlsl");
+	const bool bHasPS = !EndsWith(InShaderPath, "_VS.hlsl");
+
+	// --- 3. 단계별 컴파일 (_VS.hlsl: VS만, _PS.hlsl: PS만, 그 외: VS + PS) ---
 	bool bVsCompiled = false;
 	bool bPsCompiled = false;
-
-	// --- 3. 컴파일 결과를 OutVariant에 저장 ---
-	if (EndsWith(InShaderPath, "_VS.hlsl"))
+	if (bHasVS)
 	{
-		bVsCompiled = CompileShaderInternal(WFilePath, "mainVS", "vs_5_0", CompileFlags, Defines.data(), &OutVariant.VSBlob);
-		if (bVsCompiled)
-		{
-			Hr = InDevice->CreateVertexShader(OutVariant.VSBlob->GetBufferPointer(), OutVariant.VSBlob->GetBufferSize(), nullptr, &OutVariant.VertexShader);
-			assert(SUCCEEDED(Hr));
-			CreateInputLayout(InDevice, InShaderPath, InMacros, OutVariant); // InMacros 전달
-		}
-	}
-	else if (EndsWith(InShaderPath, "_PS.hlsl"))
-	{
-		bPsCompiled = CompileShaderInternal(WFilePath, "mainPS", "ps_5_0", CompileFlags, Defines.data(), &OutVariant.PSBlob);
-		if (bPsCompiled)
-		{
-			Hr = InDevice->CreatePixelShader(OutVariant.PSBlob->GetBufferPointer(), OutVariant.PSBlob->GetBufferSize(), nullptr, &OutVariant.PixelShader);
-			assert(SUCCEEDED(Hr));
-		}
+		bVsCompiled = CompileShaderCached(WFilePath, "mainVS", "vs_5_0", CompileFlags, Defines.data(), InSourceHash, InMacros, OutVSBlob, OutErrors);
 	}
-	else // (VS + PS)
+	if (bHasPS)
 	{
-		bVsCompiled = CompileShaderInternal(WFilePath, "mainVS", "vs_5_0", CompileFlags, Defines.data(), &OutVariant.VSBlob);
-		bPsCompiled = CompileShaderInternal(WFilePath, "mainPS", "ps_5_0", CompileFlags, Defines.data(), &OutVariant.PSBlob);
-
-		if (bVsCompiled)
-		{
-			Hr = InDevice->CreateVertexShader(OutVariant.VSBlob->GetBufferPointer(), OutVariant.VSBlob->GetBufferSize(), nullptr, &OutVariant.VertexShader);
-			assert(SUCCEEDED(Hr));
-			CreateInputLayout(InDevice, InShaderPath, InMacros, OutVariant);
-		}
-		if (bPsCompiled)
-		{
-			Hr = InDevice->CreatePixelShader(OutVariant.PSBlob->GetBufferPointer(), OutVariant.PSBlob->GetBufferSize(), nullptr, &OutVariant.PixelShader);
-			assert(SUCCEEDED(Hr));
-		}
+		bPsCompiled = CompileShaderCached(WFilePath, "mainPS", "ps_5_0", CompileFlags, Defines.data(), InSourceHash, InMacros, OutPSBlob, OutErrors);
 	}
 
-	// 4. 핫 리로드용 매크로 저장
-	OutVariant.SourceMacros = InMacros;
-
-	// 5. 컴파일 성공 여부 반환 (VS 또는 PS 둘 중 하나라도 성공 시)
 	return bVsCompiled || bPsCompiled;
 }
 
@@ -316,12 +365,16 @@ void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPat
 
 	// GPU 스키닝을 사용하는 경우 BoneIndices와 BoneWeights 추가
 	bool bHasGPUSkinning = false;
+	bool bHasStaticMeshInstancing = false;
 	for (const FShaderMacro& Macro : InMacros)
 	{
-		if (Macro.Name.ToString() == "GPU_SKINNING")
+		if (Macro.Name.ToStringView() == "GPU_SKINNING")
 		{
 			bHasGPUSkinning = true;
-			break;
+		}
+		else if (Macro.Name.ToStringView() == "STATIC_MESH_INSTANCING")
+		{
+			bHasStaticMeshInstancing = true;
 		}
 	}
 
@@ -333,6 +386,20 @@ void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPat
 		descArray.Add({ "BLENDWEIGHT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 80, D3D11_INPUT_PER_VERTEX_DATA, 0 });
 	}
 
+	if (bHasStaticMeshInstancing && InShaderPath.find("UberLit") != FString::npos)
+	{
+		// 스태틱 메시 자동 인스턴싱: 슬롯 1 인스턴스 스트림
+		// FStaticMeshInstanceData: WorldMatrix(64) + NormalMatrix(48) + ObjectID(4) + Padding(12)
+		descArray.Add({ "INSTANCE_WORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_WORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_WORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 32, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_WORLD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 48, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_NORMAL", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 64, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_NORMAL", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 80, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_NORMAL", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 96, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		descArray.Add({ "INSTANCE_UUID", 0, DXGI_FORMAT_R32_UINT, 1, 112, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+	}
+
 	const D3D11_INPUT_ELEMENT_DESC* layout = descArray.data();
 	uint32 layoutCount = static_cast<uint32>(descArray.size());
 
@@ -446,6 +513,12 @@ bool UShader::Reload(ID3D11Device* InDevice)
 	}
 
 	UE_LOG("Hot Reloading Shader File: %s (%d variants)", FilePath.c_str(), ShaderVariantMap.Num());
+	FShaderCache::GetInstance().RecordHotReload();
+
+	// 바뀐 내용으로 캐시 키 갱신 (include 목록도 바뀌었을 수 있음)
+	// 타임스탬프는 성공했을 때만 갱신하므로 실패하면 다음 검사에서 다시 시도
+	CollectIncludeFiles(FilePath, IncludedFiles);
+	SourceHash = FShaderCache::HashSourceFiles(FilePath, IncludedFiles);
 
 	// 2. [백업] 현재 맵을 Old 맵으로 이동시킵니다.
 	// (ShaderVariantMap은 이제 비어있습니다)
@@ -501,6 +574,9 @@ bool UShader::Reload(ID3D11Device* InDevice)
 		}
 		OldShaderVariantMap.Empty();
 
+		// 캐시된 드로우 커맨드가 해제된 셰이더를 가리키지 않도록 무효화
+		FMeshDrawCommandCache::InvalidateAll();
+
 		// 갱신된 타임스탬프를 설정합니다.
 		try
 		{
@@ -528,11 +604,20 @@ bool UShader::Reload(ID3D11Device* InDevice)
 	}
 }
 
-// Include 파일 파싱 (재귀적으로 처리)
+// Include 파일 파싱 및 timestamp 기록
 void UShader::ParseIncludeFiles(const FString& ShaderPath)
+{
+	CollectIncludeFiles(ShaderPath, IncludedFiles);
+
+	// Include 파일들의 timestamp 업데이트
+	UpdateIncludeTimestamps();
+}
+
+// Include 파일 수집 (재귀적으로 처리)
+void UShader::CollectIncludeFiles(const FString& ShaderPath, TArray<FString>& OutIncludedFiles)
 {
 	// 이미 파싱된 파일 목록 초기화
-	IncludedFiles.clear();
+	OutIncludedFiles.clear();
 
 	// 파싱할 파일 큐
 	TArray<FString> FilesToParse;
@@ -610,9 +695,9 @@ void UShader::ParseIncludeFiles(const FString& ShaderPath)
 						FString NormalizedPath = WideToUTF8(IncludePath.wstring());
 
 						// 포함된 파일 목록에 추가
-						if (std::find(IncludedFiles.begin(), IncludedFiles.end(), NormalizedPath) == IncludedFiles.end())
+						if (std::find(OutIncludedFiles.begin(), OutIncludedFiles.end(), NormalizedPath) == OutIncludedFiles.end())
 						{
-							IncludedFiles.push_back(NormalizedPath);
+							OutIncludedFiles.push_back(NormalizedPath);
 							// 재귀적으로 파싱하기 위해 큐에 추가
 							FilesToParse.push_back(NormalizedPath);
 						}
@@ -627,9 +712,6 @@ void UShader::ParseIncludeFiles(const FString& ShaderPath)
 
 		File.close();
 	}
-
-	// Include 파일들의 timestamp 업데이트
-	UpdateIncludeTimestamps();
 }
 
 // Include 파일들의 timestamp 업데이트
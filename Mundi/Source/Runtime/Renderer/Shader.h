@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "ResourceBase.h"
+#include "ShaderCache.h"
 #include <filesystem>
 
 struct FShaderMacro
@@ -49,6 +50,14 @@ public:
 
 	FShaderVariant* GetOrCompileShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	bool CompileVariantInternal(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& OutVariant);
+
+	// 바이트코드만 컴파일 (FShaderCache 경유, 디바이스/FName 미사용이라 워커 스레드에서 호출 가능)
+	// 파일 이름 접미사(_VS/_PS)에 따라 필요한 단계만 채움. 하나라도 성공하면 true
+	// OutErrors를 넘기면 컴파일 에러를 UE_LOG 대신 여기에 덧붙임 (콘솔은 스레드 안전하지 않으므로 워커에서는 필수)
+	static bool CompileVariantBytecode(const FString& InShaderPath, uint64 InSourceHash, const FShaderMacroStrings& InMacros, ID3DBlob** OutVSBlob, ID3DBlob** OutPSBlob, FString* OutErrors = nullptr);
+
+	// ShaderPath가 (재귀적으로) #include하는 파일들의 정규화된 경로
+	static void CollectIncludeFiles(const FString& ShaderPath, TArray<FString>& OutIncludedFiles);
 	//FShaderVariant* GetShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11InputLayout* GetInputLayout(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11VertexShader* GetVertexShader(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
@@ -70,6 +79,9 @@ private:
 	TArray<FString> IncludedFiles;
 	TMap<FString, std::filesystem::file_time_type> IncludedFileTimestamps;
 
+	// 소스 + include 내용 해시 (바이트코드 캐시 키). 최초 로드와 핫 리로드 때 갱신
+	uint64 SourceHash = 0;
+
 	void CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& InOutVariant);
 	void ReleaseResources();
 
@@ -0,0 +1,411 @@
+﻿#include "pch.h"
+#include "ShaderCache.h"
+#include "Shader.h"
+#include "ResourceManager.h"
+#include "TaskSystem.h"
+#include <chrono>
+#include <thread>
+
+namespace
+{
+	// 캐시 파일 헤더 (잘린 파일/다른 포맷 감지용)
+	struct FShaderCacheFileHeader
+	{
+		uint32 Magic = 0;
+		uint32 Size = 0;
+	};
+
+	constexpr uint32 ShaderCacheMagic = 0x3143534D;	// "MSC1"
+
+	// FNV-1a 64
+	constexpr uint64 FnvOffsetBasis = 14695981039346656037ULL;
+	constexpr uint64 FnvPrime = 1099511628211ULL;
+
+	uint64 HashBytes(uint64 Hash, const void* Data, size_t Length)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(Data);
+		for (size_t i = 0; i < Length; ++i)
+		{
+			Hash ^= Bytes[i];
+			Hash *= FnvPrime;
+		}
+		return Hash;
+	}
+
+	uint64 HashString(uint64 Hash, const FString& Str)
+	{
+		// 길이도 섞어서 "ab"+"c"와 "a"+"bc"를 구분
+		const uint64 Length = Str.size();
+		Hash = HashBytes(Hash, &Length, sizeof(Length));
+		return HashBytes(Hash, Str.data(), Str.size());
+	}
+
+	uint64 HashFileContents(uint64 Hash, const FString& Path)
+	{
+		std::ifstream File(UTF8ToWide(Path), std::ios::binary);
+		if (!File.is_open())
+		{
+			return HashString(Hash, "<missing>" + Path);
+		}
+
+		char Buffer[16 * 1024];
+		while (File.read(Buffer, sizeof(Buffer)) || File.gcount() > 0)
+		{
+			Hash = HashBytes(Hash, Buffer, static_cast<size_t>(File.gcount()));
+		}
+		return Hash;
+	}
+
+	// 컴파일러 식별 해시: 헤더 버전 + 실제로 로드된 d3dcompiler DLL의 경로 / 크기 / 수정 시각
+	// SDK나 DLL이 바뀌면 키가 달라져 예전 바이트코드를 쓰지 않음 (한 번만 계산)
+	uint64 GetCompilerHash()
+	{
+		static const uint64 CompilerHash = []()
+		{
+			const uint32 HeaderVersion = D3D_COMPILER_VERSION;
+			uint64 Hash = HashBytes(FnvOffsetBasis, &HeaderVersion, sizeof(HeaderVersion));
+
+			wchar_t ModulePath[MAX_PATH] = {};
+			HMODULE CompilerModule = GetModuleHandleW(D3DCOMPILER_DLL_W);
+			if (CompilerModule && GetModuleFileNameW(CompilerModule, ModulePath, MAX_PATH) > 0)
+			{
+				Hash = HashString(Hash, WideToUTF8(ModulePath));
+
+				std::error_code Error;
+				const uint64 FileSize = static_cast<uint64>(std::filesystem::file_size(ModulePath, Error));
+				Hash = HashBytes(Hash, &FileSize, sizeof(FileSize));
+				const auto WriteTime = std::filesystem::last_write_time(ModulePath, Error).time_since_epoch().count();
+				Hash = HashBytes(Hash, &WriteTime, sizeof(WriteTime));
+			}
+			return Hash;
+		}();
+		return CompilerHash;
+	}
+}
+
+uint64 FShaderCache::HashSourceFiles(const FString& ShaderPath, const TArray<FString>& IncludedFiles)
+{
+	uint64 Hash = HashFileContents(FnvOffsetBasis, ShaderPath);
+
+	// include 목록은 파싱 순서에 따라 달라질 수 있으므로 경로 순으로 정렬해서 섞음
+	TArray<FString> SortedIncludes = IncludedFiles;
+	std::sort(SortedIncludes.begin(), SortedIncludes.end());
+	for (const FString& IncludedFile : SortedIncludes)
+	{
+		Hash = HashString(Hash, IncludedFile);
+		Hash = HashFileContents(Hash, IncludedFile);
+	}
+	return Hash;
+}
+
+FString FShaderCache::MakeMacroString(const FShaderMacroStrings& Macros)
+{
+	// FName 인덱스는 실행마다 달라지므로 문자열 기준으로 정렬 (디스크 키는 실행 간에 같아야 함)
+	FShaderMacroStrings SortedMacros = Macros;
+	std::sort(SortedMacros.begin(), SortedMacros.end());
+
+	FString Result;
+	for (int32 Index = 0; Index < SortedMacros.Num(); ++Index)
+	{
+		if (Index > 0)
+		{
+			Result += ";";
+		}
+		Result += SortedMacros[Index].first + "=" + SortedMacros[Index].second;
+	}
+	return Result;
+}
+
+uint64 FShaderCache::MakeKey(uint64 SourceHash, const FShaderMacroStrings& Macros, const char* EntryPoint, const char* Target, uint32 CompileFlags)
+{
+	const uint64 CompilerHash = GetCompilerHash();
+	uint64 Hash = HashBytes(FnvOffsetBasis, &SourceHash, sizeof(SourceHash));
+	Hash = HashBytes(Hash, &CompilerHash, sizeof(CompilerHash));
+	Hash = HashString(Hash, MakeMacroString(Macros));
+	Hash = HashString(Hash, EntryPoint);
+	Hash = HashString(Hash, Target);
+	return HashBytes(Hash, &CompileFlags, sizeof(CompileFlags));
+}
+
+FString FShaderCache::GetCacheDirectory()
+{
+	return GCacheDir + "/ShaderCache";
+}
+
+FString FShaderCache::GetEntryPath(uint64 Key)
+{
+	char FileName[32];
+	sprintf_s(FileName, "%016llx.cso", Key);
+	return GetCacheDirectory() + "/" + FileName;
+}
+
+bool FShaderCache::Load(uint64 Key, ID3DBlob** OutBlob)
+{
+	*OutBlob = nullptr;
+	if (!bEnabled)
+	{
+		return false;
+	}
+
+	std::ifstream File(UTF8ToWide(GetEntryPath(Key)), std::ios::binary);
+	FShaderCacheFileHeader Header;
+	if (!File.is_open() || !File.read(reinterpret_cast<char*>(&Header), sizeof(Header))
+		|| Header.Magic != ShaderCacheMagic || Header.Size == 0)
+	{
+		++Misses;
+		return false;
+	}
+
+	ID3DBlob* Blob = nullptr;
+	if (FAILED(D3DCreateBlob(Header.Size, &Blob)))
+	{
+		++Misses;
+		return false;
+	}
+
+	if (!File.read(static_cast<char*>(Blob->GetBufferPointer()), Header.Size))
+	{
+		Blob->Release();
+		++Misses;
+		return false;
+	}
+
+	++Hits;
+	*OutBlob = Blob;
+	return true;
+}
+
+void FShaderCache::Store(uint64 Key, ID3DBlob* Blob)
+{
+	if (!bEnabled || !Blob)
+	{
+		return;
+	}
+
+	try
+	{
+		std::filesystem::create_directories(UTF8ToWide(GetCacheDirectory()));
+
+		// 임시 파일에 쓴 뒤 교체 → 같은 키를 동시에 쓰거나 도중에 종료돼도 잘린 파일이 남지 않음
+		const FString EntryPath = GetEntryPath(Key);
+		const FString TempPath = EntryPath + ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+		bool bWritten = false;
+		{
+			std::ofstream File(UTF8ToWide(TempPath), std::ios::binary | std::ios::trunc);
+			if (!File.is_open())
+			{
+				return;
+			}
+
+			FShaderCacheFileHeader Header;
+			Header.Magic = ShaderCacheMagic;
+			Header.Size = static_cast<uint32>(Blob->GetBufferSize());
+			File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+			File.write(static_cast<const char*>(Blob->GetBufferPointer()), Header.Size);
+			bWritten = File.good();
+		}
+
+		std::error_code Error;
+		if (bWritten)
+		{
+			std::filesystem::rename(UTF8ToWide(TempPath), UTF8ToWide(EntryPath), Error);
+		}
+		if (!bWritten || Error)
+		{
+			// 쓰기 / 교체 실패 (디스크 부족, 다른 프로세스가 잡고 있는 등) → 임시 파일이 쌓이지 않도록 삭제
+			std::filesystem::remove(UTF8ToWide(TempPath), Error);
+			return;
+		}
+		++Writes;
+	}
+	catch (...)
+	{
+		// 캐시 기록 실패는 무시 (다음 실행에서 다시 컴파일)
+	}
+}
+
+void FShaderCache::RecordVariant(const FString& ShaderPath, const FShaderMacroStrings& Macros)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	const FString Line = ShaderPath + "\t" + MakeMacroString(Macros);
+
+	std::lock_guard<std::mutex> Lock(ManifestMutex);
+	if (ManifestLines.Contains(Line))
+	{
+		return;
+	}
+	ManifestLines.Add(Line);
+
+	// 새 조합만 덧붙임 (비정상 종료해도 그때까지 기록된 항목은 유지)
+	try
+	{
+		std::filesystem::create_directories(UTF8ToWide(GetCacheDirectory()));
+		std::ofstream File(UTF8ToWide(GetCacheDirectory() + "/Manifest.txt"), std::ios::app);
+		if (File.is_open())
+		{
+			File << Line << "\n";
+		}
+	}
+	catch (...)
+	{
+	}
+}
+
+void FShaderCache::LoadManifest(TArray<TPair<FString, FShaderMacroStrings>>& OutEntries)
+{
+	std::ifstream File(UTF8ToWide(GetCacheDirectory() + "/Manifest.txt"));
+	if (!File.is_open())
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(ManifestMutex);
+
+	FString Line;
+	while (std::getline(File, Line))
+	{
+		const size_t Tab = Line.find('\t');
+		if (Tab == FString::npos || ManifestLines.Contains(Line))
+		{
+			continue;
+		}
+		ManifestLines.Add(Line);
+
+		TPair<FString, FShaderMacroStrings> Entry;
+		Entry.first = Line.substr(0, Tab);
+
+		// "A=1;B=2"
+		std::stringstream MacroStream(Line.substr(Tab + 1));
+		FString Macro;
+		while (std::getline(MacroStream, Macro, ';'))
+		{
+			const size_t Equal = Macro.find('=');
+			if (Equal != FString::npos)
+			{
+				Entry.second.emplace_back(Macro.substr(0, Equal), Macro.substr(Equal + 1));
+			}
+		}
+		OutEntries.Add(std::move(Entry));
+	}
+}
+
+void FShaderCache::PrecompileManifest()
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	const auto StartTime = std::chrono::high_resolution_clock::now();
+
+	TArray<TPair<FString, FShaderMacroStrings>> Entries;
+	LoadManifest(Entries);
+
+	// 지워진 셰이더 파일은 건너뜀
+	for (int32 i = Entries.Num() - 1; i >= 0; --i)
+	{
+		if (!std::filesystem::exists(UTF8ToWide(Entries[i].first)))
+		{
+			Entries.erase(Entries.begin() + i);
+		}
+	}
+	if (Entries.IsEmpty())
+	{
+		return;
+	}
+
+	// 1. 파일별 소스 해시 (include 닫힘 포함, 파일 단위 병렬)
+	TArray<FString> UniquePaths;
+	TArray<int32> EntryPathIndices;
+	TMap<FString, int32> PathToIndex;
+	EntryPathIndices.Reserve(Entries.Num());
+	for (const TPair<FString, FShaderMacroStrings>& Entry : Entries)
+	{
+		if (!PathToIndex.Contains(Entry.first))
+		{
+			PathToIndex.Add(Entry.first, UniquePaths.Num());
+			UniquePaths.Add(Entry.first);
+		}
+		EntryPathIndices.Add(PathToIndex[Entry.first]);
+	}
+
+	TArray<uint64> SourceHashes;
+	SourceHashes.SetNum(UniquePaths.Num());
+	FTaskSystem::GetInstance().ParallelFor(UniquePaths.Num(), [&](int32 Index)
+	{
+		TArray<FString> IncludedFiles;
+		UShader::CollectIncludeFiles(UniquePaths[Index], IncludedFiles);
+		SourceHashes[Index] = HashSourceFiles(UniquePaths[Index], IncludedFiles);
+	});
+
+	// 2. 바이트코드 컴파일 (캐시에 있으면 읽기만 함). 결과는 디스크 캐시에 남음
+	// 콘솔 로그는 스레드 안전하지 않으므로 에러 메시지는 항목별 슬롯에 모았다가 호출 스레드에서 출력
+	TArray<FString> CompileErrors;
+	CompileErrors.SetNum(Entries.Num());
+	const uint32 WritesBefore = Writes.load();
+	FTaskSystem::GetInstance().ParallelFor(Entries.Num(), [&](int32 Index)
+	{
+		const TPair<FString, FShaderMacroStrings>& Entry = Entries[Index];
+		ID3DBlob* VSBlob = nullptr;
+		ID3DBlob* PSBlob = nullptr;
+		UShader::CompileVariantBytecode(Entry.first, SourceHashes[EntryPathIndices[Index]], Entry.second, &VSBlob, &PSBlob, &CompileErrors[Index]);
+		if (VSBlob) { VSBlob->Release(); }
+		if (PSBlob) { PSBlob->Release(); }
+	});
+	const uint32 NumCompiled = Writes.load() - WritesBefore;
+
+	for (const FString& Error : CompileErrors)
+	{
+		if (!Error.empty())
+		{
+			UE_LOG("%s", Error.c_str());
+		}
+	}
+
+	// 3. Variant 생성 (디바이스 오브젝트/입력 레이아웃 + 리소스 맵 등록은 호출 스레드에서, 바이트코드는 캐시 적중)
+	for (const TPair<FString, FShaderMacroStrings>& Entry : Entries)
+	{
+		TArray<FShaderMacro> Macros;
+		Macros.Reserve(Entry.second.Num());
+		for (const TPair<FString, FString>& Macro : Entry.second)
+		{
+			Macros.Add({ FName(Macro.first), FName(Macro.second) });
+		}
+		UResourceManager::GetInstance().Load<UShader>(Entry.first, Macros);
+	}
+
+	const std::chrono::duration<double, std::milli> Elapsed = std::chrono::high_resolution_clock::now() - StartTime;
+	PrecompiledVariants = static_cast<uint32>(Entries.Num());
+	PrecompileTimeMS = Elapsed.count();
+
+	UE_LOG("[info] ShaderCache: %d개 Variant 사전 준비 (새로 컴파일 %u, %d 워커) %.1f ms",
+		Entries.Num(), NumCompiled, FTaskSystem::GetInstance().GetNumWorkers(), PrecompileTimeMS);
+
+	const FShaderCacheStats Stats = GetStats();
+	UE_LOG("[info] ShaderCache: 적중 %u / 실패 %u (적중률 %.1f%%), 기록 %u",
+		Stats.Hits, Stats.Misses, Stats.GetHitRate() * 100.0f, Stats.Writes);
+}
+
+FShaderCacheStats FShaderCache::GetStats() const
+{
+	FShaderCacheStats Stats;
+	Stats.Hits = Hits.load();
+	Stats.Misses = Misses.load();
+	Stats.Writes = Writes.load();
+	Stats.HotReloads = HotReloads.load();
+	Stats.PrecompiledVariants = PrecompiledVariants;
+	Stats.PrecompileTimeMS = PrecompileTimeMS;
+	return Stats;
+}
+
+void FShaderCache::ResetStats()
+{
+	Hits = 0;
+	Misses = 0;
+	Writes = 0;
+	HotReloads = 0;
+}
@@ -0,0 +1,102 @@
+﻿#pragma once
+#include <atomic>
+#include <mutex>
+#include "UEContainer.h"
+
+// 컴파일러에 넘기는 매크로 (이름, 값). FName을 거치지 않으므로 워커 스레드에서 써도 안전
+using FShaderMacroStrings = TArray<TPair<FString, FString>>;
+
+// 셰이더 바이트코드 캐시 통계 (누적)
+struct FShaderCacheStats
+{
+	// 디스크 캐시 조회 결과
+	uint32 Hits = 0;
+	uint32 Misses = 0;
+
+	// 새로 컴파일해서 기록한 바이트코드 수
+	uint32 Writes = 0;
+
+	// 핫 리로드된 셰이더 파일 수 (리로드마다 해당 파일의 Variant × 셰이더 스테이지(VS/PS) 수만큼 Misses / Writes가 늘어야 정상)
+	uint32 HotReloads = 0;
+
+	float GetHitRate() const
+	{
+		const uint32 Lookups = Hits + Misses;
+		return Lookups > 0 ? static_cast<float>(Hits) / static_cast<float>(Lookups) : 0.0f;
+	}
+
+	// 시작 시 매니페스트로 미리 만든 Variant 수와 걸린 시간
+	uint32 PrecompiledVariants = 0;
+	double PrecompileTimeMS = 0.0;
+};
+
+/**
+ * FShaderCache
+ * 디스크 셰이더 바이트코드 캐시입니다. (DerivedDataCache/ShaderCache)
+ *
+ * - 키 = (소스 + include 닫힘 전체의 내용 해시, 정렬된 매크로, 엔트리, 타깃, 컴파일 플래그)
+ *   내용 기반이라 핫 리로드로 파일이 바뀌면 자동으로 다른 키가 되고, 되돌리면 예전 항목이 다시 맞음
+ * - 매니페스트: 한 번이라도 컴파일된 (경로, 매크로) 조합을 기록해 두고, 다음 시작 때 PrecompileManifest()가
+ *   FTaskSystem 워커로 병렬 컴파일(또는 캐시 로드)한 뒤 Variant를 미리 생성 → 뷰 모드 첫 전환 시 히치 없음
+ * - Load/Store/HashSourceFiles는 스레드 안전
+ */
+class FShaderCache
+{
+public:
+	static FShaderCache& GetInstance()
+	{
+		static FShaderCache Instance;
+		return Instance;
+	}
+
+	// 셰이더 파일과 include 파일들의 내용 해시
+	static uint64 HashSourceFiles(const FString& ShaderPath, const TArray<FString>& IncludedFiles);
+
+	// 바이트코드 키 (매크로 순서와 무관)
+	static uint64 MakeKey(uint64 SourceHash, const FShaderMacroStrings& Macros, const char* EntryPoint, const char* Target, uint32 CompileFlags);
+
+	// 캐시된 바이트코드 읽기 (없거나 손상되었으면 false)
+	bool Load(uint64 Key, ID3DBlob** OutBlob);
+
+	// 컴파일된 바이트코드 기록
+	void Store(uint64 Key, ID3DBlob* Blob);
+
+	// 컴파일된 (경로, 매크로) 조합을 매니페스트에 추가 (이미 있으면 무시)
+	void RecordVariant(const FString& ShaderPath, const FShaderMacroStrings& Macros);
+
+	// 매니페스트의 모든 Variant를 병렬로 컴파일하고 UResourceManager에 로드 (UResourceManager::Initialize에서 호출)
+	void PrecompileManifest();
+
+	// UShader::Reload가 바뀐 파일을 다시 컴파일할 때 호출
+	void RecordHotReload() { ++HotReloads; }
+
+	// STAT SHADERCACHE 패널 / 콘솔용
+	FShaderCacheStats GetStats() const;
+	void ResetStats();
+
+	// false면 캐시를 읽지도 쓰지도 않음 (디버깅용)
+	bool bEnabled = true;
+
+private:
+	FShaderCache() = default;
+	~FShaderCache() = default;
+	FShaderCache(const FShaderCache&) = delete;
+	FShaderCache& operator=(const FShaderCache&) = delete;
+
+	static FString MakeMacroString(const FShaderMacroStrings& Macros);
+	static FString GetCacheDirectory();
+	static FString GetEntryPath(uint64 Key);
+
+	void LoadManifest(TArray<TPair<FString, FShaderMacroStrings>>& OutEntries);
+
+	std::atomic<uint32> Hits{ 0 };
+	std::atomic<uint32> Misses{ 0 };
+	std::atomic<uint32> Writes{ 0 };
+	std::atomic<uint32> HotReloads{ 0 };
+	uint32 PrecompiledVariants = 0;
+	double PrecompileTimeMS = 0.0;
+
+	// 매니페스트 한 줄 = "경로\t매크로 문자열"
+	std::mutex ManifestMutex;
+	TSet<FString> ManifestLines;
+};
@@ -0,0 +1,176 @@
+﻿#include "pch.h"
+#include "ShadowCasterCuller.h"
+#include "Frustum.h"
+#include "Hash.h"
+#include "LightManager.h"
+#include "DirectionalLightComponent.h"
+#include "PointLightComponent.h"
+#include "SpotLightComponent.h"
+
+namespace
+{
+	uint64 HashMatrix(uint64 Seed, const FMatrix& Matrix)
+	{
+		const uint32* Words = reinterpret_cast<const uint32*>(&Matrix.M[0][0]);
+		for (int32 i = 0; i < 16; ++i)
+		{
+			Seed = HashCombine(Seed, Words[i]);
+		}
+		return Seed;
+	}
+
+	uint64 HashCasterBatch(uint64 Seed, const FMeshBatchElement& Batch)
+	{
+		Seed = HashCombine(Seed, reinterpret_cast<uint64>(Batch.VertexBuffer));
+		Seed = HashCombine(Seed, reinterpret_cast<uint64>(Batch.IndexBuffer));
+		Seed = HashCombine(Seed, (static_cast<uint64>(Batch.StartIndex) << 32) | Batch.IndexCount);
+		return HashMatrix(Seed, Batch.WorldMatrix);
+	}
+
+	bool IntersectsSphere(const FAABB& Bound, const FVector& Center, float Radius)
+	{
+		// 구 중심에서 박스까지 최단 거리
+		float DistanceSq = 0.0f;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float C = Center[Axis];
+			if (C < Bound.Min[Axis])
+			{
+				DistanceSq += (Bound.Min[Axis] - C) * (Bound.Min[Axis] - C);
+			}
+			else if (C > Bound.Max[Axis])
+			{
+				DistanceSq += (C - Bound.Max[Axis]) * (C - Bound.Max[Axis]);
+			}
+		}
+		return DistanceSq <= Radius * Radius;
+	}
+
+	// 원뿔(Apex, Direction, 반각, 길이) vs 박스의 외접구
+	bool IntersectsCone(const FAABB& Bound, const FVector& Apex, const FVector& Direction, float SinAngle, float CosAngle, float Range)
+	{
+		const FVector Center = Bound.GetCenter();
+		const float Radius = Bound.GetHalfExtent().Size();
+
+		const FVector ToCenter = Center - Apex;
+		const float AxisDistance = FVector::Dot(ToCenter, Direction);
+		if (AxisDistance > Range + Radius || AxisDistance < -Radius)
+		{
+			return false;
+		}
+
+		// 구 중심에서 원뿔 옆면까지의 거리
+		const float PerpDistance = std::sqrt(FMath::Max(ToCenter.SizeSquared() - AxisDistance * AxisDistance, 0.0f));
+		const float SideDistance = CosAngle * PerpDistance - SinAngle * AxisDistance;
+		return SideDistance <= Radius;
+	}
+
+	bool IsInShadowFrustum(const FFrustum& Frustum, const FAABB& Bound, bool bTestNear)
+	{
+		const FVector4 Center = FVector4::FromPoint(Bound.GetCenter());
+		const FVector4 Extents = FVector4::FromDirection(Bound.GetHalfExtent());
+		return Intersects(Frustum.LeftFace, Center, Extents) &&
+			Intersects(Frustum.RightFace, Center, Extents) &&
+			Intersects(Frustum.TopFace, Center, Extents) &&
+			Intersects(Frustum.BottomFace, Center, Extents) &&
+			Intersects(Frustum.FarFace, Center, Extents) &&
+			(!bTestNear || Intersects(Frustum.NearFace, Center, Extents));
+	}
+}
+
+void FShadowCasterCuller::AddCaster(const FMeshBatchElement& Batch, const FAABB* WorldBounds)
+{
+	const int32 Index = Batches.Add(Batch);
+	Bounds.Add(WorldBounds ? *WorldBounds : FAABB());
+
+	if (WorldBounds)
+	{
+		BoundedIndices.Add(Index);
+	}
+	else
+	{
+		UnboundedIndices.Add(Index);
+	}
+}
+
+uint64 FShadowCasterCuller::CullShadowView(const FShadowRenderRequest& Request, TFrameArray<const FMeshBatchElement*>& OutBatches)
+{
+	OutBatches.Empty();
+
+	if (Request.LightOwner != CandidateLight)
+	{
+		GatherLightCandidates(Request);
+	}
+
+	const bool bDirectional = Cast<UDirectionalLightComponent>(Request.LightOwner) != nullptr;
+	const FFrustum Frustum = CreateFrustumFromViewProjection(Request.ViewMatrix * Request.ProjectionMatrix);
+
+	uint64 Signature = HashMatrix(0, Request.ViewMatrix);
+	Signature = HashMatrix(Signature, Request.ProjectionMatrix);
+
+	for (int32 BatchIndex : LightCandidates)
+	{
+		if (IsInShadowFrustum(Frustum, Bounds[BatchIndex], !bDirectional))
+		{
+			const FMeshBatchElement& Batch = Batches[BatchIndex];
+			OutBatches.Add(&Batch);
+			Signature = HashCasterBatch(Signature, Batch);
+		}
+	}
+
+	if (!UnboundedIndices.IsEmpty())
+	{
+		for (int32 BatchIndex : UnboundedIndices)
+		{
+			OutBatches.Add(&Batches[BatchIndex]);
+		}
+		return 0;
+	}
+
+	// 0은 캐시 불가 전용
+	return Signature != 0 ? Signature : 1;
+}
+
+void FShadowCasterCuller::GatherLightCandidates(const FShadowRenderRequest& Request)
+{
+	CandidateLight = Request.LightOwner;
+	LightCandidates.Empty();
+
+	// 스포트: 원뿔 (USpotLightComponent가 UPointLightComponent를 상속하므로 먼저 검사)
+	if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(Request.LightOwner))
+	{
+		const FVector Direction = SpotLight->GetDirection();
+		const float HalfAngle = DegreesToRadians(SpotLight->GetOuterConeAngle());
+		const float SinAngle = std::sin(HalfAngle);
+		const float CosAngle = std::cos(HalfAngle);
+		const FVector Apex = SpotLight->GetWorldLocation();
+		const float Range = SpotLight->GetAttenuationRadius();
+
+		for (int32 BatchIndex : BoundedIndices)
+		{
+			if (IntersectsCone(Bounds[BatchIndex], Apex, Direction, SinAngle, CosAngle, Range))
+			{
+				LightCandidates.Add(BatchIndex);
+			}
+		}
+	}
+	// 포인트: 감쇠 반경 구 (큐브 면 요청은 WorldLocation/Radius를 채우지 않으므로 라이트에서 직접 읽음)
+	else if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(Request.LightOwner))
+	{
+		const FVector Center = PointLight->GetWorldLocation();
+		const float Radius = PointLight->GetAttenuationRadius();
+
+		for (int32 BatchIndex : BoundedIndices)
+		{
+			if (IntersectsSphere(Bounds[BatchIndex], Center, Radius))
+			{
+				LightCandidates.Add(BatchIndex);
+			}
+		}
+	}
+	// 디렉셔널: 영향 범위 제한 없음 (캐스케이드 절두체로만 컬링)
+	else
+	{
+		LightCandidates = BoundedIndices;
+	}
+}
@@ -0,0 +1,43 @@
+﻿#pragma once
+#include "MeshBatchElement.h"
+#include "AABB.h"
+
+class ULightComponent;
+struct FShadowRenderRequest;
+
+/**
+ * FShadowCasterCuller
+ * 섀도우 뷰(캐스케이드 / 스포트 / 큐브 면)별 그림자 캐스터 컬링과 섀도우맵 캐시 서명 계산입니다. (FSceneRenderer::RenderShadowMaps)
+ *
+ * - 캐스터 배치마다 소유 컴포넌트의 월드 AABB를 한 번만 계산해 둠
+ * - 라이트 단위로 영향 범위(포인트: 구, 스포트: 원뿔, 디렉셔널: 없음)로 후보를 추린 뒤 섀도우 뷰 절두체로 다시 검사
+ *   (같은 라이트의 캐스케이드 / 큐브 면 요청은 연속으로 들어오므로 후보는 라이트가 바뀔 때만 다시 계산)
+ * - 디렉셔널은 근평면을 검사하지 않음 (섀도우 뷰 앞쪽 캐스터도 그림자를 드리움)
+ * - 바운드가 없는 캐스터(스키닝 메시)는 모든 섀도우 뷰에 포함하고, 그 뷰는 캐시하지 않음
+ * - RenderShadowMaps 안에서만 사용하므로 캐스터/후보 배열은 프레임 arena에서 할당
+ * - 서명 = 섀도우 뷰 행렬 + 통과한 캐스터의 지오메트리 / 월드 행렬. 지난번과 같으면 그 섀도우맵을 그대로 재사용할 수 있음
+ */
+class FShadowCasterCuller
+{
+public:
+	// WorldBounds가 null이면 바운드 없는 캐스터
+	void AddCaster(const FMeshBatchElement& Batch, const FAABB* WorldBounds);
+
+	int32 Num() const { return Batches.Num(); }
+	const TFrameArray<FMeshBatchElement>& GetBatches() const { return Batches; }
+
+	// 섀도우 뷰 하나에 그릴 캐스터를 OutBatches에 채우고 캐시 서명을 반환 (0 = 캐시 불가)
+	uint64 CullShadowView(const FShadowRenderRequest& Request, TFrameArray<const FMeshBatchElement*>& OutBatches);
+
+private:
+	void GatherLightCandidates(const FShadowRenderRequest& Request);
+
+	TFrameArray<FMeshBatchElement> Batches;
+	TFrameArray<FAABB> Bounds;				// Batches와 같은 인덱스 (바운드 없는 캐스터는 사용 안 함)
+	TFrameArray<int32> BoundedIndices;
+	TFrameArray<int32> UnboundedIndices;
+
+	// 마지막 라이트의 영향 범위를 통과한 캐스터
+	const ULightComponent* CandidateLight = nullptr;
+	TFrameArray<int32> LightCandidates;
+};
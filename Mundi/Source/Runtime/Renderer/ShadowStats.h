@@ -21,6 +21,15 @@ struct FShadowStats
 	float ShadowAtlasCubeMemoryMB = 0.0f;
 	float TotalShadowMemoryMB = 0.0f;
 
+	// 섀도우 뷰 (2D 아틀라스 영역 + 큐브맵 면) 렌더링/캐시
+	uint32 ShadowViews = 0;               // 이번 프레임에 평가한 섀도우 뷰 수
+	uint32 RenderedShadowViews = 0;       // 다시 그린 뷰 수
+	uint32 CachedShadowViews = 0;         // 라이트/캐스터가 그대로라 재사용한 뷰 수
+
+	// 섀도우 캐스터 컬링 (뷰 단위 배치 수 합계)
+	uint32 DrawnCasterBatches = 0;
+	uint32 CulledCasterBatches = 0;
+
 	// 모든 통계를 0으로 리셋
 	void Reset()
 	{
@@ -34,6 +43,11 @@ struct FShadowStats
 		ShadowAtlas2DMemoryMB = 0.0f;
 		ShadowAtlasCubeMemoryMB = 0.0f;
 		TotalShadowMemoryMB = 0.0f;
+		ShadowViews = 0;
+		RenderedShadowViews = 0;
+		CachedShadowViews = 0;
+		DrawnCasterBatches = 0;
+		CulledCasterBatches = 0;
 	}
 
 	// 전체 섀도우 캐스팅 라이트 수 계산
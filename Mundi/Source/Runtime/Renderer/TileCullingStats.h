@@ -1,29 +1,35 @@
 ﻿#pragma once
 #include "UEContainer.h"
 
-// 타일 기반 라이트 컬링 통계
+// 클러스터(타일 x 깊이 슬라이스) 기반 라이트 컬링 통계
 // 성능 메트릭과 컬링 효율성을 추적
 struct FTileCullingStats
 {
-	// 타일 그리드 차원
+	// 클러스터 그리드 차원
 	uint32 TileCountX = 0;
 	uint32 TileCountY = 0;
 	uint32 TotalTileCount = 0;
+	uint32 DepthSliceCount = 0;
+	uint32 TotalClusterCount = 0;
 
 	// 라이트 개수
 	uint32 TotalPointLights = 0;
 	uint32 TotalSpotLights = 0;
 	uint32 TotalLights = 0;
 
-	// 타일당 라이트 통계
-	uint32 MinLightsPerTile = 0;
-	uint32 MaxLightsPerTile = 0;
-	float AvgLightsPerTile = 0.0f;
+	// 클러스터당 라이트 통계 (상한 적용 후)
+	uint32 MinLightsPerCluster = 0;
+	uint32 MaxLightsPerCluster = 0;
+	float AvgLightsPerCluster = 0.0f;
 
 	// 컬링 효율성 메트릭
-	float CullingEfficiency = 0.0f; // 컬링된 라이트 비율 (%)
-	uint32 TotalLightTests = 0;     // 전체 라이트-타일 테스트 수
-	uint32 TotalLightsPassed = 0;   // 컬링을 통과한 라이트 수
+	float CullingEfficiency = 0.0f; // 전수 조사(라이트 x 클러스터) 대비 컬링된 비율 (%)
+	uint32 TotalLightTests = 0;     // 실제 수행한 라이트-클러스터 정밀 테스트 수
+	uint32 TotalLightsPassed = 0;   // 컬링을 통과한 라이트-클러스터 쌍 수 (상한 적용 전)
+
+	// 상한 초과 (클러스터당 최대 라이트 수를 넘은 경우, 라이트 순서상 뒤쪽부터 버림)
+	uint32 OverflowClusters = 0;
+	uint32 DroppedLightRefs = 0;
 
 	// 성능 메트릭
 	float ComputeShaderTimeMS = 0.0f;
@@ -47,15 +53,19 @@ struct FTileCullingStats
 		TileCountX = 0;
 		TileCountY = 0;
 		TotalTileCount = 0;
+		DepthSliceCount = 0;
+		TotalClusterCount = 0;
 		TotalPointLights = 0;
 		TotalSpotLights = 0;
 		TotalLights = 0;
-		MinLightsPerTile = 0;
-		MaxLightsPerTile = 0;
-		AvgLightsPerTile = 0.0f;
+		MinLightsPerCluster = 0;
+		MaxLightsPerCluster = 0;
+		AvgLightsPerCluster = 0.0f;
 		CullingEfficiency = 0.0f;
 		TotalLightTests = 0;
 		TotalLightsPassed = 0;
+		OverflowClusters = 0;
+		DroppedLightRefs = 0;
 		ComputeShaderTimeMS = 0.0f;
 		LightIndexBufferSizeBytes = 0;
 	}
@@ -65,16 +75,18 @@ struct FTileCullingStats
 	{
 		TotalLights = TotalPointLights + TotalSpotLights;
 		TotalTileCount = TileCountX * TileCountY;
+		TotalClusterCount = TotalTileCount * DepthSliceCount;
 
-		if (TotalTileCount > 0)
+		if (TotalClusterCount > 0)
 		{
-			AvgLightsPerTile = static_cast<float>(TotalLightsPassed) / static_cast<float>(TotalTileCount);
+			const uint32 AcceptedRefs = TotalLightsPassed - DroppedLightRefs;
+			AvgLightsPerCluster = static_cast<float>(AcceptedRefs) / static_cast<float>(TotalClusterCount);
 		}
 
-		if (TotalLightTests > 0)
+		const float BruteForcePairs = static_cast<float>(TotalLights) * static_cast<float>(TotalClusterCount);
+		if (BruteForcePairs > 0.0f)
 		{
-			uint32 LightsCulled = TotalLightTests - TotalLightsPassed;
-			CullingEfficiency = (static_cast<float>(LightsCulled) / static_cast<float>(TotalLightTests)) * 100.0f;
+			CullingEfficiency = (1.0f - static_cast<float>(TotalLightsPassed) / BruteForcePairs) * 100.0f;
 		}
 	}
 };
@@ -1,6 +1,26 @@
 ﻿#include "pch.h"
 #include "TileLightCuller.h"
+#include "TaskSystem.h"
 #include <algorithm>
+#include <xmmintrin.h>
+
+namespace
+{
+	// 패딩 열은 어떤 구와도 교차하지 않도록 아주 먼 값
+	constexpr float FarAwayBound = 1.0e30f;
+
+	// 좌하단 NDC → 뷰 공간 X/Y (투영 행렬이 행 벡터 기준 v * P이므로 z에 대해 선형)
+	// 원근: w = z, 직교: w = 1
+	inline float NDCToViewX(float NDC, float ViewZ, const FMatrix& P)
+	{
+		return (NDC * (ViewZ * P.M[2][3] + P.M[3][3]) - ViewZ * P.M[2][0] - P.M[3][0]) / P.M[0][0];
+	}
+
+	inline float NDCToViewY(float NDC, float ViewZ, const FMatrix& P)
+	{
+		return (NDC * (ViewZ * P.M[2][3] + P.M[3][3]) - ViewZ * P.M[2][1] - P.M[3][1]) / P.M[1][1];
+	}
+}
 
 FTileLightCuller::FTileLightCuller()
 	: RHI(nullptr)
@@ -8,8 +28,17 @@ FTileLightCuller::FTileLightCuller()
 	, TileCountX(0)
 	, TileCountY(0)
 	, TotalTileCount(0)
+	, TotalClusterCount(0)
+	, ViewWidth(1)
+	, ViewHeight(1)
+	, NearZ(0.1f)
+	, FarZ(1000.0f)
+	, DepthSliceScale(0.0f)
+	, DepthSliceBias(0.0f)
+	, ColumnStride(0)
 	, LightIndexBuffer(nullptr)
 	, LightIndexBufferSRV(nullptr)
+	, LightIndexBufferCapacity(0)
 {
 }
 
@@ -21,9 +50,9 @@ FTileLightCuller::~FTileLightCuller()
 void FTileLightCuller::Initialize(D3D11RHI* InRHI, UINT InTileSize)
 {
 	RHI = InRHI;
-	TileSize = InTileSize;
+	SetTileSize(InTileSize);
 
-	// 초기화는 CullLights에서 뷰포트 크기를 알게 되면 수행
+	// 버퍼는 CullLights에서 필요한 크기를 알게 되면 생성
 }
 
 void FTileLightCuller::CullLights(
@@ -36,364 +65,410 @@ void FTileLightCuller::CullLights(
 	UINT ViewportWidth,
 	UINT ViewportHeight)
 {
-	// 타일 그리드 계산
-	TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
-	TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
-	TotalTileCount = TileCountX * TileCountY;
+	// 1. 클러스터 그리드와 클러스터 AABB 계산
+	BuildClusterBounds(ProjMatrix, NearPlane, FarPlane, ViewportWidth, ViewportHeight);
 
 	// 통계 초기화
 	Stats.Reset();
 	Stats.TileCountX = TileCountX;
 	Stats.TileCountY = TileCountY;
 	Stats.TotalTileCount = TotalTileCount;
+	Stats.DepthSliceCount = NumDepthSlices;
+	Stats.TotalClusterCount = TotalClusterCount;
 	Stats.TotalPointLights = PointLights.Num();
 	Stats.TotalSpotLights = SpotLights.Num();
 	Stats.TotalLights = PointLights.Num() + SpotLights.Num();
 
-	// 타일 라이트 인덱스 버퍼 크기 재조정
-	UINT RequiredSize = TotalTileCount * MaxLightsPerTile;
-	if (TileLightIndices.Num() != RequiredSize)
+	// 2. 라이트를 뷰 공간으로 변환 (셰이더가 하위 16비트로 인덱싱하므로 타입별 65536개까지)
+	const int32 NumPointLights = FMath::Min(PointLights.Num(), 0x10000);
+	const int32 NumSpotLights = FMath::Min(SpotLights.Num(), 0x10000);
+	ClusterLights.SetNum(NumPointLights + NumSpotLights);
+
+	for (int32 i = 0; i < NumPointLights; ++i)
+	{
+		FClusterLight& Light = ClusterLights[i];
+		Light.Center = ViewMatrix.TransformPosition(PointLights[i].Position);
+		Light.Radius = PointLights[i].AttenuationRadius;
+		Light.PackedIndex = static_cast<uint32>(i);
+		Light.bSpot = false;
+	}
+
+	for (int32 i = 0; i < NumSpotLights; ++i)
 	{
-		TileLightIndices.SetNum(RequiredSize);
+		const FSpotLightInfo& Spot = SpotLights[i];
+		FClusterLight& Light = ClusterLights[NumPointLights + i];
+		Light.Center = ViewMatrix.TransformPosition(Spot.Position);
+		Light.Radius = Spot.AttenuationRadius;
+		Light.PackedIndex = (1u << 16) | static_cast<uint32>(i);
+
+		// 반각 90도 이상이면 원뿔 테스트가 의미 없으므로 구로만 처리
+		Light.bSpot = Spot.OuterConeAngle < 89.0f;
+		if (Light.bSpot)
+		{
+			const float HalfAngle = DegreesToRadians(FMath::Max(Spot.OuterConeAngle, 0.0f));
+			Light.Direction = ViewMatrix.TransformVector(Spot.Direction).GetSafeNormal();
+			Light.SinAngle = std::sin(HalfAngle);
+			Light.CosAngle = std::cos(HalfAngle);
+		}
 	}
 
-	// 버퍼 초기화 (모든 타일의 라이트 개수를 0으로)
-	memset(TileLightIndices.GetData(), 0, RequiredSize * sizeof(uint32));
+	// 3. 라이트 중심 패스 (병렬): 라이트마다 닿는 클러스터 목록
+	const int32 NumLights = ClusterLights.Num();
+	if (LightClusterHits.Num() < NumLights)
+	{
+		LightClusterHits.SetNum(NumLights);
+	}
+	LightTestCounts.SetNum(NumLights);
 
-	// Inverse View-Projection 행렬 계산
-	FMatrix InvViewProj = ProjMatrix.InversePerspectiveProjection() * ViewMatrix.InverseAffine();
+	FTaskSystem::GetInstance().ParallelFor(NumLights, [this, &ProjMatrix](int32 LightIndex)
+	{
+		LightTestCounts[LightIndex] = AssignLight(ClusterLights[LightIndex], ProjMatrix, LightClusterHits[LightIndex]);
+	}, 4);
 
-	// 각 타일에 대해 컬링 수행
-	Stats.MinLightsPerTile = UINT_MAX;
-	Stats.MaxLightsPerTile = 0;
-	uint32 TotalLightsAcrossAllTiles = 0;
+	// 4. 병합 (직렬, 라이트 순서): 클러스터별 요청 수 → 상한 적용 → 오프셋 → 인덱스 기록
+	ClusterCounts.SetNum(TotalClusterCount);
+	std::fill(ClusterCounts.begin(), ClusterCounts.end(), 0u);
 
-	for (UINT TileY = 0; TileY < TileCountY; ++TileY)
+	for (int32 LightIndex = 0; LightIndex < NumLights; ++LightIndex)
 	{
-		for (UINT TileX = 0; TileX < TileCountX; ++TileX)
+		Stats.TotalLightTests += LightTestCounts[LightIndex];
+		for (uint32 ClusterIndex : LightClusterHits[LightIndex])
 		{
-			UINT TileIndex = TileY * TileCountX + TileX;
-			UINT TileDataOffset = TileIndex * MaxLightsPerTile;
+			++ClusterCounts[ClusterIndex];
+		}
+	}
 
-			// 타일 프러스텀 생성
-			FFrustum Frustum = CreateTileFrustum(TileX, TileY, InvViewProj, NearPlane, FarPlane);
+	const UINT HeaderSize = TotalClusterCount * 2;
+	uint32 TotalAccepted = 0;
+	Stats.MinLightsPerCluster = UINT_MAX;
+	for (UINT ClusterIndex = 0; ClusterIndex < TotalClusterCount; ++ClusterIndex)
+	{
+		const uint32 Requested = ClusterCounts[ClusterIndex];
+		const uint32 Accepted = FMath::Min(Requested, static_cast<uint32>(MaxLightsPerCluster));
+		if (Requested > Accepted)
+		{
+			++Stats.OverflowClusters;
+			Stats.DroppedLightRefs += Requested - Accepted;
+		}
 
-			uint32 LightCount = 0;
+		Stats.TotalLightsPassed += Requested;
+		Stats.MinLightsPerCluster = FMath::Min(Stats.MinLightsPerCluster, Accepted);
+		Stats.MaxLightsPerCluster = FMath::Max(Stats.MaxLightsPerCluster, Accepted);
+		TotalAccepted += Accepted;
+	}
 
-			// Point Light 테스트
-			for (int32 i = 0; i < PointLights.Num() && LightCount < MaxLightsPerTile - 1; ++i)
-			{
-				Stats.TotalLightTests++;
+	LightIndexData.SetNum(HeaderSize + TotalAccepted);
+	uint32 Offset = HeaderSize;
+	for (UINT ClusterIndex = 0; ClusterIndex < TotalClusterCount; ++ClusterIndex)
+	{
+		const uint32 Accepted = FMath::Min(ClusterCounts[ClusterIndex], static_cast<uint32>(MaxLightsPerCluster));
+		LightIndexData[ClusterIndex * 2] = Offset;
+		LightIndexData[ClusterIndex * 2 + 1] = Accepted;
+		Offset += Accepted;
 
-				if (TestPointLightAgainstFrustum(PointLights[i], Frustum, ViewMatrix))
-				{
-					// 라이트 인덱스 저장 (상위 16비트: 타입(0=Point), 하위 16비트: 인덱스)
-					TileLightIndices[TileDataOffset + 1 + LightCount] = i;
-					LightCount++;
-					Stats.TotalLightsPassed++;
-				}
-			}
+		// 이후 기록 커서로 재사용
+		ClusterCounts[ClusterIndex] = 0;
+	}
 
-			// Spot Light 테스트
-			for (int32 i = 0; i < SpotLights.Num() && LightCount < MaxLightsPerTile - 1; ++i)
+	for (int32 LightIndex = 0; LightIndex < NumLights; ++LightIndex)
+	{
+		const uint32 PackedIndex = ClusterLights[LightIndex].PackedIndex;
+		for (uint32 ClusterIndex : LightClusterHits[LightIndex])
+		{
+			uint32& Written = ClusterCounts[ClusterIndex];
+			if (Written < LightIndexData[ClusterIndex * 2 + 1])
 			{
-				Stats.TotalLightTests++;
-
-				if (TestSpotLightAgainstFrustum(SpotLights[i], Frustum, ViewMatrix))
-				{
-					// 라이트 인덱스 저장 (상위 16비트: 타입(1=Spot), 하위 16비트: 인덱스)
-					TileLightIndices[TileDataOffset + 1 + LightCount] = (1 << 16) | i;
-					LightCount++;
-					Stats.TotalLightsPassed++;
-				}
+				LightIndexData[LightIndexData[ClusterIndex * 2] + Written] = PackedIndex;
+				++Written;
 			}
-
-			// 첫 번째 요소에 라이트 개수 저장
-			TileLightIndices[TileDataOffset] = LightCount;
-
-			// 통계 업데이트
-			Stats.MinLightsPerTile = FMath::Min(Stats.MinLightsPerTile, LightCount);
-			Stats.MaxLightsPerTile = FMath::Max(Stats.MaxLightsPerTile, LightCount);
-			TotalLightsAcrossAllTiles += LightCount;
 		}
 	}
 
-	// 평균 계산
-	if (TotalTileCount > 0)
+	if (TotalClusterCount == 0)
 	{
-		Stats.AvgLightsPerTile = static_cast<float>(TotalLightsAcrossAllTiles) / static_cast<float>(TotalTileCount);
+		Stats.MinLightsPerCluster = 0;
 	}
 
 	// 컬링 효율성 계산
 	Stats.CalculateStats();
 
-	// GPU 버퍼 생성 또는 업데이트
-	if (!LightIndexBuffer)
+	// 5. GPU 버퍼 업로드
+	UploadLightIndexBuffer();
+}
+
+void FTileLightCuller::BuildClusterBounds(const FMatrix& ProjMatrix, float NearPlane, float FarPlane, UINT ViewportWidth, UINT ViewportHeight)
+{
+	ViewWidth = FMath::Max(ViewportWidth, 1u);
+	ViewHeight = FMath::Max(ViewportHeight, 1u);
+
+	// 타일 그리드 계산
+	TileCountX = (ViewWidth + TileSize - 1) / TileSize;
+	TileCountY = (ViewHeight + TileSize - 1) / TileSize;
+	TotalTileCount = TileCountX * TileCountY;
+	TotalClusterCount = TotalTileCount * NumDepthSlices;
+
+	// 로그 분포 깊이 슬라이스: Z_k = Near * (Far / Near)^(k / N)
+	NearZ = FMath::Max(NearPlane, 1.0e-3f);
+	FarZ = FMath::Max(FarPlane, NearZ * 1.01f);
+	const float LogDepthRatio = std::log(FarZ / NearZ);
+	DepthSliceScale = static_cast<float>(NumDepthSlices) / LogDepthRatio;
+	DepthSliceBias = -static_cast<float>(NumDepthSlices) * std::log(NearZ) / LogDepthRatio;
+
+	SliceDepths.SetNum(NumDepthSlices + 1);
+	for (UINT Slice = 0; Slice <= NumDepthSlices; ++Slice)
 	{
-		// 버퍼 생성
-		HRESULT hr = RHI->CreateStructuredBuffer(
-			sizeof(uint32),
-			RequiredSize,
-			TileLightIndices.GetData(),
-			&LightIndexBuffer
-		);
-
-		if (SUCCEEDED(hr))
+		SliceDepths[Slice] = NearZ * std::pow(FarZ / NearZ, static_cast<float>(Slice) / static_cast<float>(NumDepthSlices));
+	}
+
+	// 슬라이스별 열(X)/행(Y) 범위: 타일 경계 NDC를 슬라이스 near/far 깊이에서 뷰 공간으로 되돌린 값의 min/max
+	ColumnStride = (TileCountX + 3) & ~3u;
+	ColumnMinX.SetNum(NumDepthSlices * ColumnStride + 4);
+	ColumnMaxX.SetNum(NumDepthSlices * ColumnStride + 4);
+	RowMinY.SetNum(NumDepthSlices * TileCountY);
+	RowMaxY.SetNum(NumDepthSlices * TileCountY);
+	std::fill(ColumnMinX.begin(), ColumnMinX.end(), FarAwayBound);
+	std::fill(ColumnMaxX.begin(), ColumnMaxX.end(), -FarAwayBound);
+
+	const float InvWidth = 2.0f / static_cast<float>(ViewWidth);
+	const float InvHeight = 2.0f / static_cast<float>(ViewHeight);
+
+	for (UINT Slice = 0; Slice < NumDepthSlices; ++Slice)
+	{
+		const float SliceNear = SliceDepths[Slice];
+		const float SliceFar = SliceDepths[Slice + 1];
+
+		for (UINT TileX = 0; TileX < TileCountX; ++TileX)
 		{
-			// SRV 생성
-			RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
+			const float NDCMin = static_cast<float>(TileX * TileSize) * InvWidth - 1.0f;
+			const float NDCMax = static_cast<float>(FMath::Min((TileX + 1) * TileSize, ViewWidth)) * InvWidth - 1.0f;
+
+			const float X0 = NDCToViewX(NDCMin, SliceNear, ProjMatrix);
+			const float X1 = NDCToViewX(NDCMin, SliceFar, ProjMatrix);
+			const float X2 = NDCToViewX(NDCMax, SliceNear, ProjMatrix);
+			const float X3 = NDCToViewX(NDCMax, SliceFar, ProjMatrix);
+
+			ColumnMinX[Slice * ColumnStride + TileX] = FMath::Min(FMath::Min(X0, X1), FMath::Min(X2, X3));
+			ColumnMaxX[Slice * ColumnStride + TileX] = FMath::Max(FMath::Max(X0, X1), FMath::Max(X2, X3));
 		}
 
-		Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
-	}
-	else
-	{
-		// 기존 버퍼 업데이트
-		RHI->UpdateStructuredBuffer(
-			LightIndexBuffer,
-			TileLightIndices.GetData(),
-			RequiredSize * sizeof(uint32)
-		);
+		// 화면 Y는 아래로 증가, NDC Y는 위로 증가
+		for (UINT TileY = 0; TileY < TileCountY; ++TileY)
+		{
+			const float NDCTop = 1.0f - static_cast<float>(TileY * TileSize) * InvHeight;
+			const float NDCBottom = 1.0f - static_cast<float>(FMath::Min((TileY + 1) * TileSize, ViewHeight)) * InvHeight;
+
+			const float Y0 = NDCToViewY(NDCTop, SliceNear, ProjMatrix);
+			const float Y1 = NDCToViewY(NDCTop, SliceFar, ProjMatrix);
+			const float Y2 = NDCToViewY(NDCBottom, SliceNear, ProjMatrix);
+			const float Y3 = NDCToViewY(NDCBottom, SliceFar, ProjMatrix);
+
+			RowMinY[Slice * TileCountY + TileY] = FMath::Min(FMath::Min(Y0, Y1), FMath::Min(Y2, Y3));
+			RowMaxY[Slice * TileCountY + TileY] = FMath::Max(FMath::Max(Y0, Y1), FMath::Max(Y2, Y3));
+		}
 	}
 }
 
-FFrustum FTileLightCuller::CreateTileFrustum(
-	UINT TileX,
-	UINT TileY,
-	const FMatrix& InvViewProj,
-	float NearPlane,
-	float FarPlane)
+int32 FTileLightCuller::GetDepthSlice(float ViewZ) const
 {
-	FFrustum Frustum;
-
-	// 타일의 NDC 좌표 계산
-	// NDC: [-1, 1] 범위, 왼쪽 아래가 (-1, -1), 오른쪽 위가 (1, 1)
-	// 주의: DirectX는 Y축이 위쪽이 양수
-
-	float TileMinX = static_cast<float>(TileX * TileSize);
-	float TileMaxX = static_cast<float>((TileX + 1) * TileSize);
-	float TileMinY = static_cast<float>(TileY * TileSize);
-	float TileMaxY = static_cast<float>((TileY + 1) * TileSize);
-
-	// 뷰포트 크기
-	float ViewportWidth = static_cast<float>(TileCountX * TileSize);
-	float ViewportHeight = static_cast<float>(TileCountY * TileSize);
-
-	// Screen Space -> NDC
-	float NDC_MinX = (TileMinX / ViewportWidth) * 2.0f - 1.0f;
-	float NDC_MaxX = (TileMaxX / ViewportWidth) * 2.0f - 1.0f;
-	float NDC_MinY = 1.0f - (TileMaxY / ViewportHeight) * 2.0f; // Y축 반전
-	float NDC_MaxY = 1.0f - (TileMinY / ViewportHeight) * 2.0f;
-
-	// 8개의 프러스텀 코너 (NDC 공간)
-	FVector4 FrustumCorners[8];
-
-	// Near plane corners
-	FrustumCorners[0] = FVector4(NDC_MinX, NDC_MinY, 0.0f, 1.0f);
-	FrustumCorners[1] = FVector4(NDC_MaxX, NDC_MinY, 0.0f, 1.0f);
-	FrustumCorners[2] = FVector4(NDC_MaxX, NDC_MaxY, 0.0f, 1.0f);
-	FrustumCorners[3] = FVector4(NDC_MinX, NDC_MaxY, 0.0f, 1.0f);
-
-	// Far plane corners
-	FrustumCorners[4] = FVector4(NDC_MinX, NDC_MinY, 1.0f, 1.0f);
-	FrustumCorners[5] = FVector4(NDC_MaxX, NDC_MinY, 1.0f, 1.0f);
-	FrustumCorners[6] = FVector4(NDC_MaxX, NDC_MaxY, 1.0f, 1.0f);
-	FrustumCorners[7] = FVector4(NDC_MinX, NDC_MaxY, 1.0f, 1.0f);
-
-	// NDC -> World Space 변환
-	FVector WorldCorners[8];
-	for (int i = 0; i < 8; ++i)
+	if (ViewZ <= NearZ)
 	{
-		FVector4 WorldPos = FrustumCorners[i] * InvViewProj;
-		WorldPos /= WorldPos.W; // Perspective divide
-		WorldCorners[i] = FVector(WorldPos.X, WorldPos.Y, WorldPos.Z);
+		return 0;
 	}
 
-	// 프러스텀 평면 생성 (외향 법선)
-	// 평면 방정식: Normal · P + Distance = 0
+	const int32 Slice = static_cast<int32>(std::floor(std::log(ViewZ) * DepthSliceScale + DepthSliceBias));
+	return FMath::Clamp(Slice, 0, static_cast<int32>(NumDepthSlices) - 1);
+}
 
-	// Left plane (점: 0, 3, 7)
-	{
-		FVector Edge1 = WorldCorners[3] - WorldCorners[0];
-		FVector Edge2 = WorldCorners[7] - WorldCorners[0];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.LeftFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.LeftFace.Distance = -FVector::Dot(Normal, WorldCorners[0]);
-	}
+uint32 FTileLightCuller::AssignLight(const FClusterLight& Light, const FMatrix& ProjMatrix, TArray<uint32>& OutClusters) const
+{
+	OutClusters.Empty();
+
+	const FVector& C = Light.Center;
+	const float R = Light.Radius;
 
-	// Right plane (점: 1, 5, 6)
+	// 1. 깊이 범위 → 슬라이스 범위
+	float MinZ = C.Z - R;
+	float MaxZ = C.Z + R;
+	if (R <= 0.0f || MaxZ < NearZ || MinZ > FarZ)
 	{
-		FVector Edge1 = WorldCorners[5] - WorldCorners[1];
-		FVector Edge2 = WorldCorners[6] - WorldCorners[1];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.RightFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.RightFace.Distance = -FVector::Dot(Normal, WorldCorners[1]);
+		return 0;
 	}
-
-	// Bottom plane (점: 0, 1, 5)
+	MinZ = FMath::Max(MinZ, NearZ);
+	MaxZ = FMath::Min(MaxZ, FarZ);
+
+	const int32 SliceBegin = GetDepthSlice(MinZ);
+	const int32 SliceEnd = GetDepthSlice(MaxZ);
+
+	// 2. 화면 범위 → 타일 범위: 구의 뷰 공간 AABB(깊이는 잘린 범위) 꼭짓점을 투영
+	//    w = z * P23 + P33 > 0 (MinZ >= Near)이고 NDC가 x, z 각각에 대해 단조이므로 꼭짓점의 min/max로 충분
+	float NDCMinX = FLT_MAX, NDCMaxX = -FLT_MAX;
+	float NDCMinY = FLT_MAX, NDCMaxY = -FLT_MAX;
+	const float Zs[2] = { MinZ, MaxZ };
+	for (float Z : Zs)
 	{
-		FVector Edge1 = WorldCorners[1] - WorldCorners[0];
-		FVector Edge2 = WorldCorners[5] - WorldCorners[0];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.BottomFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.BottomFace.Distance = -FVector::Dot(Normal, WorldCorners[0]);
+		const float InvW = 1.0f / (Z * ProjMatrix.M[2][3] + ProjMatrix.M[3][3]);
+		const float OffsetX = Z * ProjMatrix.M[2][0] + ProjMatrix.M[3][0];
+		const float OffsetY = Z * ProjMatrix.M[2][1] + ProjMatrix.M[3][1];
+
+		const float NX0 = ((C.X - R) * ProjMatrix.M[0][0] + OffsetX) * InvW;
+		const float NX1 = ((C.X + R) * ProjMatrix.M[0][0] + OffsetX) * InvW;
+		const float NY0 = ((C.Y - R) * ProjMatrix.M[1][1] + OffsetY) * InvW;
+		const float NY1 = ((C.Y + R) * ProjMatrix.M[1][1] + OffsetY) * InvW;
+
+		NDCMinX = FMath::Min(NDCMinX, FMath::Min(NX0, NX1));
+		NDCMaxX = FMath::Max(NDCMaxX, FMath::Max(NX0, NX1));
+		NDCMinY = FMath::Min(NDCMinY, FMath::Min(NY0, NY1));
+		NDCMaxY = FMath::Max(NDCMaxY, FMath::Max(NY0, NY1));
 	}
 
-	// Top plane (점: 2, 3, 7)
+	if (NDCMaxX < -1.0f || NDCMinX > 1.0f || NDCMaxY < -1.0f || NDCMinY > 1.0f)
 	{
-		FVector Edge1 = WorldCorners[3] - WorldCorners[2];
-		FVector Edge2 = WorldCorners[7] - WorldCorners[2];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.TopFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.TopFace.Distance = -FVector::Dot(Normal, WorldCorners[2]);
+		return 0;
 	}
 
-	// Near plane (점: 0, 1, 2)
+	auto ToTile = [](float Pixel, UINT InTileSize, UINT TileCount)
 	{
-		FVector Edge1 = WorldCorners[1] - WorldCorners[0];
-		FVector Edge2 = WorldCorners[2] - WorldCorners[0];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.NearFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.NearFace.Distance = -FVector::Dot(Normal, WorldCorners[0]);
-	}
+		const int32 Tile = static_cast<int32>(std::floor(Pixel / static_cast<float>(InTileSize)));
+		return FMath::Clamp(Tile, 0, static_cast<int32>(TileCount) - 1);
+	};
 
-	// Far plane (점: 4, 6, 5)
+	const int32 TileXBegin = ToTile((NDCMinX + 1.0f) * 0.5f * ViewWidth, TileSize, TileCountX);
+	const int32 TileXEnd = ToTile((NDCMaxX + 1.0f) * 0.5f * ViewWidth, TileSize, TileCountX);
+	const int32 TileYBegin = ToTile((1.0f - NDCMaxY) * 0.5f * ViewHeight, TileSize, TileCountY);
+	const int32 TileYEnd = ToTile((1.0f - NDCMinY) * 0.5f * ViewHeight, TileSize, TileCountY);
+
+	// 3. 범위 안 클러스터 정밀 테스트: 한 행의 클러스터 4개씩 SSE
+	//    Point/Spot 공통: 구(중심, 감쇠 반경) vs 클러스터 AABB
+	//    Spot 추가:      원뿔 vs 클러스터 외접구 (옆면 거리, 앞/뒤 범위)
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 Half = _mm_set1_ps(0.5f);
+	const __m128 CenterX = _mm_set1_ps(C.X);
+	const __m128 RadiusSq = _mm_set1_ps(R * R);
+	const __m128 DirX = _mm_set1_ps(Light.Direction.X);
+	const __m128 SinAngle = _mm_set1_ps(Light.SinAngle);
+	const __m128 CosAngle = _mm_set1_ps(Light.CosAngle);
+	const __m128 Range = _mm_set1_ps(R);
+
+	uint32 TestCount = 0;
+	for (int32 Slice = SliceBegin; Slice <= SliceEnd; ++Slice)
 	{
-		FVector Edge1 = WorldCorners[6] - WorldCorners[4];
-		FVector Edge2 = WorldCorners[5] - WorldCorners[4];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.FarFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.FarFace.Distance = -FVector::Dot(Normal, WorldCorners[4]);
-	}
+		const float SliceNear = SliceDepths[Slice];
+		const float SliceFar = SliceDepths[Slice + 1];
+		const float DZ = FMath::Max(FMath::Max(SliceNear - C.Z, C.Z - SliceFar), 0.0f);
+		const float DZSq = DZ * DZ;
+		if (DZSq > R * R)
+		{
+			continue;
+		}
 
-	return Frustum;
-}
+		const float* MinXRow = ColumnMinX.GetData() + Slice * ColumnStride;
+		const float* MaxXRow = ColumnMaxX.GetData() + Slice * ColumnStride;
+		const float ClusterCenterZ = (SliceNear + SliceFar) * 0.5f;
+		const float ClusterExtentZ = (SliceFar - SliceNear) * 0.5f;
 
-bool FTileLightCuller::TestPointLightAgainstFrustum(
-	const FPointLightInfo& Light,
-	const FFrustum& Frustum,
-	const FMatrix& ViewMatrix)
-{
-	// Point Light는 구체로 근사
-	FVector LightPos = Light.Position;
-	float Radius = Light.AttenuationRadius;
+		for (int32 TileY = TileYBegin; TileY <= TileYEnd; ++TileY)
+		{
+			const float MinY = RowMinY[Slice * TileCountY + TileY];
+			const float MaxY = RowMaxY[Slice * TileCountY + TileY];
+			const float DY = FMath::Max(FMath::Max(MinY - C.Y, C.Y - MaxY), 0.0f);
+			const float DYZSq = DY * DY + DZSq;
+			if (DYZSq > R * R)
+			{
+				continue;
+			}
 
-	return SphereIntersectsFrustum(LightPos, Radius, Frustum);
-}
+			const __m128 DistanceYZSq = _mm_set1_ps(DYZSq);
 
-bool FTileLightCuller::TestSpotLightAgainstFrustum(
-	const FSpotLightInfo& Light,
-	const FFrustum& Frustum,
-	const FMatrix& ViewMatrix)
-{
-	FVector LightPos = Light.Position;
-	float Radius = Light.AttenuationRadius;
+			// 원뿔 테스트의 Y/Z 성분 (행 안에서 고정)
+			const float ClusterCenterY = (MinY + MaxY) * 0.5f;
+			const float ClusterExtentY = (MaxY - MinY) * 0.5f;
+			const float VY = ClusterCenterY - C.Y;
+			const float VZ = ClusterCenterZ - C.Z;
+			const __m128 VYZSq = _mm_set1_ps(VY * VY + VZ * VZ);
+			const __m128 VYZDotDir = _mm_set1_ps(VY * Light.Direction.Y + VZ * Light.Direction.Z);
+			const __m128 ExtentYZSq = _mm_set1_ps(ClusterExtentY * ClusterExtentY + ClusterExtentZ * ClusterExtentZ);
 
-	// Spot Light도 구체로 근사
-	return SphereIntersectsFrustum(LightPos, Radius, Frustum);
-}
+			const uint32 RowBase = Slice * TotalTileCount + TileY * TileCountX;
+			for (int32 TileX = TileXBegin; TileX <= TileXEnd; TileX += 4)
+			{
+				const __m128 MinX = _mm_loadu_ps(MinXRow + TileX);
+				const __m128 MaxX = _mm_loadu_ps(MaxXRow + TileX);
 
-bool FTileLightCuller::SphereIntersectsFrustum(
-	const FVector& Center,
-	float Radius,
-	const FFrustum& Frustum)
-{
-	// 구체가 모든 평면의 앞쪽(양수)에 있으면 프러스텀 내부
-	// 하나라도 뒤쪽(음수)에 있고 거리가 반지름보다 크면 외부
-
-	// 6개 평면 각각에 대해 테스트
-	const FPlane* Planes[6] = {
-		&Frustum.LeftFace,
-		&Frustum.RightFace,
-		&Frustum.TopFace,
-		&Frustum.BottomFace,
-		&Frustum.NearFace,
-		&Frustum.FarFace
-	};
+				// 구 vs AABB: 축별 최단 거리 제곱 합 <= R^2
+				const __m128 DX = _mm_max_ps(_mm_max_ps(_mm_sub_ps(MinX, CenterX), _mm_sub_ps(CenterX, MaxX)), Zero);
+				__m128 Pass = _mm_cmple_ps(_mm_add_ps(_mm_mul_ps(DX, DX), DistanceYZSq), RadiusSq);
 
-	for (int i = 0; i < 6; ++i)
-	{
-		// 평면 방정식: Normal · P + Distance = 0
-		// 점 P에서 평면까지의 부호 있는 거리 = Normal · P + Distance
-		FVector Normal3D(Planes[i]->Normal.X, Planes[i]->Normal.Y, Planes[i]->Normal.Z);
-		float SignedDistance = FVector::Dot(Normal3D, Center) + Planes[i]->Distance;
+				if (Light.bSpot)
+				{
+					const __m128 ClusterCenterX = _mm_mul_ps(_mm_add_ps(MinX, MaxX), Half);
+					const __m128 ClusterExtentX = _mm_mul_ps(_mm_sub_ps(MaxX, MinX), Half);
+					const __m128 SphereRadius = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(ClusterExtentX, ClusterExtentX), ExtentYZSq));
+
+					const __m128 VX = _mm_sub_ps(ClusterCenterX, CenterX);
+					const __m128 VLengthSq = _mm_add_ps(_mm_mul_ps(VX, VX), VYZSq);
+					const __m128 AxisDistance = _mm_add_ps(_mm_mul_ps(VX, DirX), VYZDotDir);
+					const __m128 PerpDistance = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(VLengthSq, _mm_mul_ps(AxisDistance, AxisDistance)), Zero));
+					const __m128 SideDistance = _mm_sub_ps(_mm_mul_ps(CosAngle, PerpDistance), _mm_mul_ps(AxisDistance, SinAngle));
+
+					const __m128 InSide = _mm_cmple_ps(SideDistance, SphereRadius);
+					const __m128 InFront = _mm_cmple_ps(AxisDistance, _mm_add_ps(Range, SphereRadius));
+					const __m128 InBack = _mm_cmpge_ps(AxisDistance, _mm_sub_ps(Zero, SphereRadius));
+					Pass = _mm_and_ps(Pass, _mm_and_ps(InSide, _mm_and_ps(InFront, InBack)));
+				}
 
-		// 구체가 평면 뒤쪽에 완전히 있으면 교차하지 않음
-		if (SignedDistance < -Radius)
-		{
-			return false;
+				const int32 NumLanes = FMath::Min(4, TileXEnd - TileX + 1);
+				const int32 Mask = _mm_movemask_ps(Pass);
+				TestCount += NumLanes;
+
+				for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+				{
+					if (Mask & (1 << Lane))
+					{
+						OutClusters.Add(RowBase + TileX + Lane);
+					}
+				}
+			}
 		}
 	}
 
-	return true;
+	return TestCount;
 }
 
-bool FTileLightCuller::ConeIntersectsFrustum(
-	const FVector& Apex,
-	const FVector& Direction,
-	float Height,
-	float CosHalfAngle,
-	const FFrustum& Frustum)
+void FTileLightCuller::UploadLightIndexBuffer()
 {
-	// 원뿔-프러스텀 교차 테스트
-	float SinHalfAngle = sqrt(1.0f - CosHalfAngle * CosHalfAngle);
-
-	// 원뿔 밑면의 반지름
-	float BaseRadius = Height * SinHalfAngle;
-
-	// 경계 구체의 중심은 원뿔 축을 따라 이동
-	float K = (CosHalfAngle > 0.707f) ? 0.5f : (0.5f + 0.5f * SinHalfAngle);
-	FVector SphereCenter = Apex + Direction * (Height * K);
-
-	// 경계 구체의 반지름 (원뿔의 꼭지점과 밑면 가장자리를 모두 포함)
-	float SphereRadius;
-	if (CosHalfAngle > 0.707f) // 각도가 45도 이하 (좁은 원뿔)
+	if (!RHI)
 	{
-		// 좁은 원뿔: 밑면 중심에서 가장자리까지의 거리
-		SphereRadius = sqrt(BaseRadius * BaseRadius + (Height * 0.5f) * (Height * 0.5f));
+		return;
 	}
-	else // 각도가 45도 이상 (넓은 원뿔)
-	{
-		// 넓은 원뿔: 더 보수적인 반지름 사용
-		SphereRadius = Height * 0.866f; // sqrt(3)/2 ≈ 0.866
-	}
-
-	// 2. 경계 구체가 프러스텀과 교차하는지 먼저 테스트 (빠른 거부)
-	if (!SphereIntersectsFrustum(SphereCenter, SphereRadius, Frustum))
-	{
-		return false;
-	}
-
-	// 3. 추가 정밀 테스트: 원뿔 끝점(밑면 중심)도 체크
-	FVector ConeEnd = Apex + Direction * Height;
-
-	// 6개 평면 각각에 대해 테스트
-	const FPlane* Planes[6] = {
-		&Frustum.LeftFace,
-		&Frustum.RightFace,
-		&Frustum.TopFace,
-		&Frustum.BottomFace,
-		&Frustum.NearFace,
-		&Frustum.FarFace
-	};
 
-	// 원뿔의 꼭지점과 끝점이 모두 같은 평면 뒤쪽에 있는지 확인
-	for (int i = 0; i < 6; ++i)
+	const UINT RequiredCount = static_cast<UINT>(LightIndexData.Num());
+	if (RequiredCount > LightIndexBufferCapacity || !LightIndexBuffer)
 	{
-		FVector Normal3D(Planes[i]->Normal.X, Planes[i]->Normal.Y, Planes[i]->Normal.Z);
-
-		float ApexDistance = FVector::Dot(Normal3D, Apex) + Planes[i]->Distance;
-		float EndDistance = FVector::Dot(Normal3D, ConeEnd) + Planes[i]->Distance;
+		if (LightIndexBufferSRV)
+		{
+			LightIndexBufferSRV->Release();
+			LightIndexBufferSRV = nullptr;
+		}
+		if (LightIndexBuffer)
+		{
+			LightIndexBuffer->Release();
+			LightIndexBuffer = nullptr;
+		}
 
-		// 두 점이 모두 평면 뒤쪽에 있고, 밑면 반지름보다 멀리 있으면 완전히 외부
-		if (ApexDistance < -BaseRadius && EndDistance < -BaseRadius)
+		// 뷰포트 변경/라이트 증가 때마다 재생성하지 않도록 여유를 두고 생성
+		LightIndexBufferCapacity = FMath::Max(RequiredCount + RequiredCount / 2, 4096u);
+		HRESULT hr = RHI->CreateStructuredBuffer(sizeof(uint32), LightIndexBufferCapacity, nullptr, &LightIndexBuffer);
+		if (FAILED(hr))
 		{
-			return false;
+			LightIndexBufferCapacity = 0;
+			return;
 		}
+
+		RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
 	}
 
-	// 모든 테스트를 통과하면 교차한다고 판단
-	return true;
+	RHI->UpdateStructuredBuffer(LightIndexBuffer, LightIndexData.GetData(), RequiredCount * sizeof(uint32));
+	Stats.LightIndexBufferSizeBytes = LightIndexBufferCapacity * sizeof(uint32);
 }
 
 ID3D11ShaderResourceView* FTileLightCuller::GetLightIndexBufferSRV()
@@ -415,5 +490,7 @@ void FTileLightCuller::Release()
 		LightIndexBuffer = nullptr;
 	}
 
-	TileLightIndices.Empty();
+	LightIndexBufferCapacity = 0;
+	LightIndexData.Empty();
+	LightClusterHits.Empty();
 }
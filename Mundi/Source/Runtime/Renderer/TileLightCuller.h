@@ -2,20 +2,33 @@
 #include "LightManager.h"
 #include "TileCullingStats.h"
 #include "D3D11RHI.h"
-#include "Frustum.h"
 
-// 타일 기반 라이트 컬링을 CPU에서 수행하는 클래스
-// Conservative(near, far) frustum 방식으로 각 타일에 영향을 주는 라이트를 계산
+// 클러스터(프록셀) 기반 라이트 컬링을 CPU에서 수행하는 클래스
+// 화면 타일(TileSize 픽셀) x 로그 분포 깊이 슬라이스로 뷰 절두체를 나누고, 클러스터마다 영향을 주는 라이트 목록을 만든다.
+//
+// - 라이트 중심 패스: 라이트마다 뷰 공간 바운드를 투영해 닿는 클러스터 범위(X/Y/슬라이스)를 구한 뒤
+//   그 범위 안의 클러스터만 구-AABB / 원뿔-구 테스트 (한 행의 클러스터 4개씩 SoA + SSE)
+// - 라이트는 FTaskSystem 워커에 나눠 처리하고, 병합은 라이트 순서(Point → Spot, 인덱스 오름차순)로 직렬 수행
+//   → 클러스터당 MaxLightsPerCluster 초과 시 항상 뒤쪽 라이트가 잘림 (결정적, 통계에 기록)
+//
+// GPU 버퍼 레이아웃 (t2, uint):
+//   [ClusterIndex * 2]     = 라이트 인덱스 시작 오프셋 (버퍼 내 절대 위치)
+//   [ClusterIndex * 2 + 1] = 라이트 개수
+//   [Offset ~ Offset + Count) = 라이트 인덱스 (상위 16비트: 타입(0=Point, 1=Spot), 하위 16비트: 인덱스)
+//   ClusterIndex = Slice * TileCountX * TileCountY + TileY * TileCountX + TileX
 class FTileLightCuller
 {
 public:
 	FTileLightCuller();
 	~FTileLightCuller();
 
-	// 초기화 (Structured Buffer 생성)
+	// 초기화 (Structured Buffer는 CullLights에서 필요한 크기로 생성)
 	void Initialize(D3D11RHI* InRHI, UINT InTileSize = 16);
 
-	// 타일 컬링 수행 (매 프레임 호출)
+	// 타일 크기 변경 (렌더 설정에서 매 프레임 전달)
+	void SetTileSize(UINT InTileSize) { TileSize = FMath::Max(InTileSize, 1u); }
+
+	// 클러스터 컬링 수행 (매 프레임 호출)
 	void CullLights(
 		const TArray<FPointLightInfo>& PointLights,
 		const TArray<FSpotLightInfo>& SpotLights,
@@ -27,61 +40,90 @@ public:
 		UINT ViewportHeight
 	);
 
-	// 컬링 결과를 Structured Buffer에 업데이트하고 SRV 반환
+	// 컬링 결과 Structured Buffer의 SRV 반환
 	ID3D11ShaderResourceView* GetLightIndexBufferSRV();
 
+	// 셰이더의 슬라이스 계산용 상수: Slice = floor(log(ViewZ) * DepthScale + DepthBias)
+	float GetDepthSliceScale() const { return DepthSliceScale; }
+	float GetDepthSliceBias() const { return DepthSliceBias; }
+
 	// 통계 정보 반환
 	const FTileCullingStats& GetStats() const { return Stats; }
 
 	// 리소스 해제
 	void Release();
 
-private:
-	// 타일 프러스텀 생성 (Conservative near/far 방식)
-	FFrustum CreateTileFrustum(
-		UINT TileX,
-		UINT TileY,
-		const FMatrix& InvViewProj,
-		float NearPlane,
-		float FarPlane
-	);
-
-	// 라이트가 타일 프러스텀과 교차하는지 테스트
-	bool TestPointLightAgainstFrustum(const FPointLightInfo& Light, const FFrustum& Frustum, const FMatrix& ViewMatrix);
-	bool TestSpotLightAgainstFrustum(const FSpotLightInfo& Light, const FFrustum& Frustum, const FMatrix& ViewMatrix);
+	// 깊이 슬라이스 개수
+	static constexpr UINT NumDepthSlices = 24;
 
-	// 구체와 프러스텀 교차 테스트
-	bool SphereIntersectsFrustum(const FVector& Center, float Radius, const FFrustum& Frustum);
+	// 클러스터당 최대 라이트 개수 (초과분은 라이트 순서상 뒤쪽부터 버림)
+	static constexpr UINT MaxLightsPerCluster = 128;
 
-	// 원뿔과 프러스텀 교차 테스트 (SpotLight용)
-	bool ConeIntersectsFrustum(
-		const FVector& Apex,           // 원뿔 꼭지점 (라이트 위치)
-		const FVector& Direction,      // 원뿔 방향 (정규화됨)
-		float Height,                  // 원뿔 높이 (AttenuationRadius)
-		float CosHalfAngle,            // cos(OuterConeAngle / 2)
-		const FFrustum& Frustum
-	);
+private:
+	// 뷰 공간 라이트 (라이트 중심 패스 입력)
+	struct FClusterLight
+	{
+		FVector Center;
+		float Radius = 0.0f;
+		FVector Direction;			// Spot만 사용 (뷰 공간, 정규화)
+		float SinAngle = 0.0f;
+		float CosAngle = 0.0f;
+		uint32 PackedIndex = 0;		// GPU에 기록할 타입/인덱스
+		bool bSpot = false;
+	};
+
+	// 그리드/슬라이스 경계 및 클러스터 AABB(뷰 공간, SoA) 계산
+	void BuildClusterBounds(const FMatrix& ProjMatrix, float NearPlane, float FarPlane, UINT ViewportWidth, UINT ViewportHeight);
+
+	// 라이트 하나가 닿는 클러스터 인덱스를 OutClusters에 오름차순으로 기록. 테스트한 클러스터 수 반환
+	uint32 AssignLight(const FClusterLight& Light, const FMatrix& ProjMatrix, TArray<uint32>& OutClusters) const;
+
+	// 깊이 → 슬라이스 (클램프됨)
+	int32 GetDepthSlice(float ViewZ) const;
+
+	// 결과를 GPU 버퍼에 업로드 (부족하면 재생성)
+	void UploadLightIndexBuffer();
 
 private:
 	D3D11RHI* RHI;
 
-	// 타일 설정
+	// 클러스터 그리드
 	UINT TileSize;          // 타일 크기 (픽셀, 기본값 16)
 	UINT TileCountX;        // 가로 타일 개수
 	UINT TileCountY;        // 세로 타일 개수
 	UINT TotalTileCount;    // 전체 타일 개수
-
-	// 타일당 최대 라이트 개수 (보수적으로 설정)
-	static constexpr UINT MaxLightsPerTile = 256;
-
-	// 타일별 라이트 인덱스 저장
-	// [TileIndex * MaxLightsPerTile] 위치에 라이트 개수 저장
-	// [TileIndex * MaxLightsPerTile + 1 ~ ...] 위치에 라이트 인덱스 저장
-	TArray<uint32> TileLightIndices;
+	UINT TotalClusterCount; // 타일 x 슬라이스
+	UINT ViewWidth;
+	UINT ViewHeight;
+
+	float NearZ;
+	float FarZ;
+	float DepthSliceScale;
+	float DepthSliceBias;
+
+	// 슬라이스 깊이 경계 [NumDepthSlices + 1]
+	TArray<float> SliceDepths;
+
+	// 슬라이스별 열/행 AABB (뷰 공간). 열은 SIMD 로드를 위해 4의 배수로 패딩한 stride 사용
+	UINT ColumnStride;
+	TArray<float> ColumnMinX;	// [Slice * ColumnStride + TileX]
+	TArray<float> ColumnMaxX;
+	TArray<float> RowMinY;		// [Slice * TileCountY + TileY]
+	TArray<float> RowMaxY;
+
+	// 라이트 중심 패스 결과 (라이트별, 프레임 간 용량 재사용)
+	TArray<FClusterLight> ClusterLights;
+	TArray<TArray<uint32>> LightClusterHits;
+	TArray<uint32> LightTestCounts;
+
+	// 병합 결과
+	TArray<uint32> ClusterCounts;
+	TArray<uint32> LightIndexData;	// GPU 업로드 이미지 (헤더 + 인덱스)
 
 	// GPU 리소스
 	ID3D11Buffer* LightIndexBuffer;
 	ID3D11ShaderResourceView* LightIndexBufferSRV;
+	UINT LightIndexBufferCapacity;	// uint 개수
 
 	// 통계
 	FTileCullingStats Stats;
@@ -208,14 +208,23 @@ bool FD2DRenderer::UpdateRenderTarget()
     if (RenderTarget)
         return true;
 
-    if (!SwapChain)
-        return false;
-
-    // 스왑체인 백버퍼 가져오기
+    // 지정된 표면 우선, 없으면 스왑체인 백버퍼
     IDXGISurface* Surface = nullptr;
-    HRESULT Hr = SwapChain->GetBuffer(0, __uuidof(IDXGISurface), reinterpret_cast<void**>(&Surface));
-    if (FAILED(Hr))
-        return false;
+    HRESULT Hr = S_OK;
+    if (TargetSurface)
+    {
+        Surface = TargetSurface;
+        Surface->AddRef();
+    }
+    else
+    {
+        if (!SwapChain)
+            return false;
+
+        Hr = SwapChain->GetBuffer(0, __uuidof(IDXGISurface), reinterpret_cast<void**>(&Surface));
+        if (FAILED(Hr))
+            return false;
+    }
 
     // 화면 크기 업데이트
     DXGI_SURFACE_DESC SurfaceDesc;
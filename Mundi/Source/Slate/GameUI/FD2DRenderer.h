@@ -57,6 +57,12 @@ public:
     /** 프레임 종료 - EndDraw 호출 */
     void EndFrame();
 
+    /**
+     * 백버퍼 대신 그릴 표면 지정 (nullptr이면 스왑체인 백버퍼)
+     * 렌더 스레드 모드에서 프레임별 오버레이 텍스처에 그릴 때 사용. 소유권은 호출자에게 있음
+     */
+    void SetTargetSurface(IDXGISurface* InSurface) { TargetSurface = InSurface; }
+
     // =====================================================
     // 기본 도형 그리기
     // =====================================================
@@ -171,6 +177,7 @@ private:
 
     ID3D11Device* D3DDevice = nullptr;
     IDXGISwapChain* SwapChain = nullptr;
+    IDXGISurface* TargetSurface = nullptr;
 
     // =====================================================
     // D2D 리소스 (내부 소유)
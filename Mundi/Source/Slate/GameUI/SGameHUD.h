@@ -80,6 +80,9 @@ public:
     /** 렌더링 (매 프레임 호출) */
     void Render();
 
+    /** D2D 타겟 표면 지정 (nullptr이면 스왑체인 백버퍼) */
+    void SetTargetSurface(IDXGISurface* Surface) { if (Renderer) Renderer->SetTargetSurface(Surface); }
+
     // =====================================================
     // 위젯 관리
     // =====================================================
@@ -16,6 +16,9 @@
 #include "SkinningStats.h"
 #include "SkinnedMeshComponent.h"
 #include "ParticleStats.h"
+#include "FrustumCullingStats.h"
+#include "MeshDrawStats.h"
+#include "ShaderCache.h"
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -175,7 +178,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning && !bShowParticles && !bShowCulling && !bShowMeshDraw && !bShowShaderCache) || !SwapChain)
 	{
 		return;
 	}
@@ -186,7 +189,12 @@ void UStatsOverlayD2D::Draw()
 	}
 
 	IDXGISurface* Surface = nullptr;
-	if (FAILED(SwapChain->GetBuffer(0, __uuidof(IDXGISurface), (void**)&Surface)))
+	if (TargetSurface)
+	{
+		Surface = TargetSurface;
+		Surface->AddRef();
+	}
+	else if (FAILED(SwapChain->GetBuffer(0, __uuidof(IDXGISurface), (void**)&Surface)))
 	{
 		return;
 	}
@@ -249,15 +257,35 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		double Mb = static_cast<double>(FMemoryManager::GetTotalAllocationBytes()) / (1024.0 * 1024.0);
+		double PoolMb = static_cast<double>(FMemoryManager::GetPoolReservedBytes()) / (1024.0 * 1024.0);
 
-		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
+		// 프레임 arena: 직전 프레임 사용량 / 최대 사용량 / 확보된 청크
+		const FFrameArenaStats ArenaStats = FFrameArena::GetStats();
+		const double ToKB = 1.0 / 1024.0;
+
+		wchar_t Buf[1024];
+		int32 Len = swprintf_s(Buf, L"Memory: %.1f MB (%llu allocs)\nSmall Pool: %.1f MB\nFrame Arena: %.0f KB (%u allocs)\nArena Peak: %.0f KB / Reserved %.0f KB",
+			Mb, FMemoryManager::GetTotalAllocationCount(), PoolMb,
+			ArenaStats.UsedBytes * ToKB, ArenaStats.Allocations,
+			ArenaStats.HighWaterBytes * ToKB, ArenaStats.ReservedBytes * ToKB);
+
+		// 태그별: 현재 / 최대, 직전 프레임 변화량과 할당 수
+		for (int32 TagIndex = 0; TagIndex < static_cast<int32>(EMemoryTag::Count) && Len > 0; ++TagIndex)
+		{
+			const EMemoryTag Tag = static_cast<EMemoryTag>(TagIndex);
+			const FMemoryTagStats TagStats = FMemoryManager::GetTagStats(Tag);
+			Len += swprintf_s(Buf + Len, _countof(Buf) - Len, L"\n%hs: %.0f / %.0f KB (%+.1f KB, %llu/f)",
+				FMemoryManager::GetTagName(Tag),
+				TagStats.CurrentBytes * ToKB, TagStats.PeakBytes * ToKB,
+				TagStats.FrameDeltaBytes * ToKB, TagStats.FrameAllocations);
+		}
 
-		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		const float MemoryPanelHeight = 250.0f;
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + SkinningPanelWidth, NextY + MemoryPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, Rc, BrushBlack, BrushLightGreen);
 
-		NextY += PanelHeight + Space;
+		NextY += MemoryPanelHeight + Space;
 	}
 
 	if (bShowDecal)
@@ -293,20 +321,24 @@ void UStatsOverlayD2D::Draw()
 		const FTileCullingStats& TileStats = FTileCullingStatManager::GetInstance().GetStats();
 
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Tile Culling Stats]\nTiles: %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%%\nBuffer: %u KB",
+		swprintf_s(Buf, L"[Light Cluster Stats]\nClusters: %u x %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.2f / %u\nTests: %u\nCulling Eff: %.1f%%\nOverflow: %u clusters (%u dropped)\nBuffer: %u KB",
 			TileStats.TileCountX,
 			TileStats.TileCountY,
-			TileStats.TotalTileCount,
+			TileStats.DepthSliceCount,
+			TileStats.TotalClusterCount,
 			TileStats.TotalLights,
 			TileStats.TotalPointLights,
 			TileStats.TotalSpotLights,
-			TileStats.MinLightsPerTile,
-			TileStats.AvgLightsPerTile,
-			TileStats.MaxLightsPerTile,
+			TileStats.MinLightsPerCluster,
+			TileStats.AvgLightsPerCluster,
+			TileStats.MaxLightsPerCluster,
+			TileStats.TotalLightTests,
 			TileStats.CullingEfficiency,
+			TileStats.OverflowClusters,
+			TileStats.DroppedLightRefs,
 			TileStats.LightIndexBufferSizeBytes / 1024);
 
-		const float tilePanelHeight = 160.0f;
+		const float tilePanelHeight = 200.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + tilePanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushCyan);
 
@@ -337,7 +369,7 @@ void UStatsOverlayD2D::Draw()
 		const FShadowStats& ShadowStats = FShadowStatManager::GetInstance().GetStats();
 
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB",
+		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB\n\nShadow Views: %u\n  Rendered: %u\n  Cached: %u\nCaster Batches Drawn: %u\nCaster Batches Culled: %u",
 			ShadowStats.TotalShadowCastingLights,
 			ShadowStats.ShadowCastingPointLights,
 			ShadowStats.ShadowCastingSpotLights,
@@ -349,9 +381,14 @@ void UStatsOverlayD2D::Draw()
 			ShadowStats.ShadowAtlasCubeSize,
 			ShadowStats.ShadowCubeArrayCount,
 			ShadowStats.ShadowAtlasCubeMemoryMB,
-			ShadowStats.TotalShadowMemoryMB);
-
-		const float shadowPanelHeight = 260.0f;
+			ShadowStats.TotalShadowMemoryMB,
+			ShadowStats.ShadowViews,
+			ShadowStats.RenderedShadowViews,
+			ShadowStats.CachedShadowViews,
+			ShadowStats.DrawnCasterBatches,
+			ShadowStats.CulledCasterBatches);
+
+		const float shadowPanelHeight = 360.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + shadowPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushDeepPink);
 
@@ -464,7 +501,7 @@ void UStatsOverlayD2D::Draw()
 		wchar_t ParticleBuf[768];
 		swprintf_s(ParticleBuf,
 			L"[Particles]\n"
-			L"Systems: %d\n"
+			L"Systems: %d (Culled: %d)\n"
 			L"Emitters: %d\n"
 			L"Sprite: %d\n"
 			L"Mesh: %d\n"
@@ -476,6 +513,7 @@ void UStatsOverlayD2D::Draw()
 			L"Spawned/Killed: %d/%d\n"
 			L"Memory: %s",
 			Stats.ParticleSystemCount,
+			Stats.CulledSystemCount,
 			Stats.EmitterCount,
 			Stats.SpriteParticleCount,
 			Stats.MeshParticleCount,
@@ -497,6 +535,73 @@ void UStatsOverlayD2D::Draw()
 		NextY += particlePanelHeight + Space;
 	}
 
+	if (bShowCulling)
+	{
+		const FFrustumCullingStats& CullStats = FFrustumCullingStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Frustum Culling]\nPath: %s\nMeshes: %u / %u (Culled: %u)\nUnculled Meshes: %u\nDecals: %u / %u (Culled: %u)\nOccluders: %u (%u tris)\nOccluded Meshes: %u (%.3f ms)\nTime: %.3f ms",
+			CullStats.bUsedBVH ? L"BVH" : L"Flat",
+			CullStats.VisibleMeshes,
+			CullStats.TestedMeshes,
+			CullStats.CulledMeshes,
+			CullStats.UnculledMeshes,
+			CullStats.VisibleDecals,
+			CullStats.TestedDecals,
+			CullStats.CulledDecals,
+			CullStats.OccluderMeshes,
+			CullStats.OccluderTriangles,
+			CullStats.OccludedMeshes,
+			CullStats.OcclusionTimeMS,
+			CullStats.CullingTimeMS);
+
+		const float cullingPanelHeight = 170.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + cullingPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushLightGreen);
+
+		NextY += cullingPanelHeight + Space;
+	}
+
+	if (bShowMeshDraw)
+	{
+		const FMeshDrawStats& DrawStats = FMeshDrawStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Mesh Draw]\nBatches: %u\nDraw Calls: %u\nInstanced Draws: %u (%u batches)\nMerge Ratio: %.2fx",
+			DrawStats.BatchesBeforeMerge,
+			DrawStats.DrawCalls,
+			DrawStats.InstancedDraws,
+			DrawStats.InstancedBatches,
+			DrawStats.GetMergeRatio());
+
+		const float meshDrawPanelHeight = 100.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + meshDrawPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushLightGreen);
+
+		NextY += meshDrawPanelHeight + Space;
+	}
+
+	if (bShowShaderCache)
+	{
+		const FShaderCacheStats CacheStats = FShaderCache::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Shader Cache]\nHits: %u / Misses: %u (%.1f%%)\nWrites: %u\nHot Reloads: %u\nPrecompiled: %u (%.1f ms)",
+			CacheStats.Hits,
+			CacheStats.Misses,
+			CacheStats.GetHitRate() * 100.0f,
+			CacheStats.Writes,
+			CacheStats.HotReloads,
+			CacheStats.PrecompiledVariants,
+			CacheStats.PrecompileTimeMS);
+
+		const float shaderCachePanelHeight = 100.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + shaderCachePanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushViolet);
+
+		NextY += shaderCachePanelHeight + Space;
+	}
+
 	D2DContext->EndDraw();
 	D2DContext->SetTarget(nullptr);
 
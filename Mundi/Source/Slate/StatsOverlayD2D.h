@@ -11,6 +11,9 @@ public:
 	void Shutdown();
     void Draw();
 
+    // 백버퍼 대신 그릴 표면 지정 (nullptr이면 스왑체인 백버퍼, 소유권은 호출자)
+    void SetTargetSurface(IDXGISurface* Surface) { TargetSurface = Surface; }
+
     void SetShowFPS(bool b) { bShowFPS = b; }
     void SetShowMemory(bool b) { bShowMemory = b; }
     void SetShowPicking(bool b)  { bShowPicking = b; }
@@ -20,6 +23,9 @@ public:
     void SetShowShadow(bool b) { bShowShadow = b; }
     void SetShowSkinning(bool b) { bShowSkinning = b; }
     void SetShowParticles(bool b) { bShowParticles = b; }
+    void SetShowCulling(bool b) { bShowCulling = b; }
+    void SetShowMeshDraw(bool b) { bShowMeshDraw = b; }
+    void SetShowShaderCache(bool b) { bShowShaderCache = b; }
     void ToggleFPS() { bShowFPS = !bShowFPS; }
     void ToggleMemory() { bShowMemory = !bShowMemory; }
     void TogglePicking() { bShowPicking = !bShowPicking; }
@@ -29,6 +35,9 @@ public:
     void ToggleShadow() { bShowShadow = !bShowShadow; }
     void ToggleSkinning() { bShowSkinning = !bShowSkinning; }
     void ToggleParticles() { bShowParticles = !bShowParticles; }
+    void ToggleCulling() { bShowCulling = !bShowCulling; }
+    void ToggleMeshDraw() { bShowMeshDraw = !bShowMeshDraw; }
+    void ToggleShaderCache() { bShowShaderCache = !bShowShaderCache; }
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -38,6 +47,9 @@ public:
     bool IsShadowVisible() const { return bShowShadow; }
     bool IsSkinningVisible() const { return bShowSkinning; }
     bool IsParticlesVisible() const { return bShowParticles; }
+    bool IsCullingVisible() const { return bShowCulling; }
+    bool IsMeshDrawVisible() const { return bShowMeshDraw; }
+    bool IsShaderCacheVisible() const { return bShowShaderCache; }
 
 private:
     UStatsOverlayD2D() = default;
@@ -59,10 +71,14 @@ private:
     bool bShowLights = false;
     bool bShowSkinning = false;
     bool bShowParticles = false;
+    bool bShowCulling = false;
+    bool bShowMeshDraw = false;
+    bool bShowShaderCache = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
     IDXGISwapChain* SwapChain = nullptr;
+    IDXGISurface* TargetSurface = nullptr;
     
     ID2D1Factory1* D2DFactory = nullptr;
     ID2D1Device* D2DDevice = nullptr;
@@ -6,6 +6,8 @@
 #include "SlateManager.h"
 #include "SkinnedMeshComponent.h"
 #include "PlatformCrashHandler.h"
+#include "ContainerBenchmark.h"
+#include "ShaderCache.h"
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
@@ -59,6 +61,11 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
 	HelpCommandList.Add("STAT PARTICLES");
+	HelpCommandList.Add("STAT MESHDRAW");
+	HelpCommandList.Add("STAT SHADERCACHE");
+	HelpCommandList.Add("STAT SHADERCACHE RESET");
+	HelpCommandList.Add("MEMREPORT");
+	HelpCommandList.Add("BENCH CONTAINERS");
 	HelpCommandList.Add("MINIDUMP");
 	HelpCommandList.Add("CAUSECRASH");
 	HelpCommandList.Add("CRASHIN <seconds>");
@@ -368,6 +375,9 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT LIGHT");
 		AddLog("- STAT SHADOW");
 		AddLog("- STAT PARTICLES");
+		AddLog("- STAT CULLING");
+		AddLog("- STAT MESHDRAW");
+		AddLog("- STAT SHADERCACHE");
 		AddLog("- STAT ALL");
 		AddLog("- STAT NONE");
 	}
@@ -406,6 +416,9 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowSkinning(true);
 		UStatsOverlayD2D::Get().SetShowShadow(true);
 		UStatsOverlayD2D::Get().SetShowParticles(true);
+		UStatsOverlayD2D::Get().SetShowCulling(true);
+		UStatsOverlayD2D::Get().SetShowMeshDraw(true);
+		UStatsOverlayD2D::Get().SetShowShaderCache(true);
 		AddLog("STAT: ON");
 	}
 	else if (Stricmp(command_line, "STAT SKINNING") == 0)
@@ -423,6 +436,29 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleParticles();
 		AddLog("STAT PARTICLES TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT CULLING") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleCulling();
+		AddLog("STAT CULLING TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT MESHDRAW") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleMeshDraw();
+		AddLog("STAT MESHDRAW TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT SHADERCACHE") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleShaderCache();
+		const FShaderCacheStats Stats = FShaderCache::GetInstance().GetStats();
+		AddLog("STAT SHADERCACHE TOGGLED (hits %u, misses %u, writes %u, hot reloads %u)",
+			Stats.Hits, Stats.Misses, Stats.Writes, Stats.HotReloads);
+	}
+	else if (Stricmp(command_line, "STAT SHADERCACHE RESET") == 0)
+	{
+		// 핫 리로드 전에 초기화하면 리로드로 생긴 실패 / 기록만 확인 가능
+		FShaderCache::GetInstance().ResetStats();
+		AddLog("STAT SHADERCACHE: counters reset");
+	}
 	else if (Stricmp(command_line, "STAT NONE") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(false);
@@ -433,8 +469,46 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowSkinning(false);
 		UStatsOverlayD2D::Get().SetShowShadow(false);
 		UStatsOverlayD2D::Get().SetShowParticles(false);
+		UStatsOverlayD2D::Get().SetShowCulling(false);
+		UStatsOverlayD2D::Get().SetShowMeshDraw(false);
+		UStatsOverlayD2D::Get().SetShowShaderCache(false);
 		AddLog("STAT: OFF");
 	}
+	else if (Stricmp(command_line, "MEMREPORT") == 0)
+	{
+		// 태그별 현재 / 최대 / 직전 프레임 변화량 (계속 증가하는 태그 = 누수 후보, 프레임당 할당 수 = churn)
+		AddLog("Memory: %.2f MB, %llu allocs, small pool %.2f MB",
+			FMemoryManager::GetTotalAllocationBytes() / (1024.0 * 1024.0),
+			FMemoryManager::GetTotalAllocationCount(),
+			FMemoryManager::GetPoolReservedBytes() / (1024.0 * 1024.0));
+		for (int32 TagIndex = 0; TagIndex < static_cast<int32>(EMemoryTag::Count); ++TagIndex)
+		{
+			const EMemoryTag Tag = static_cast<EMemoryTag>(TagIndex);
+			const FMemoryTagStats Stats = FMemoryManager::GetTagStats(Tag);
+			AddLog("%-10s cur %9.1f KB  peak %9.1f KB  live %7lld  total %9llu  frame %+8.1f KB / %llu allocs",
+				FMemoryManager::GetTagName(Tag),
+				Stats.CurrentBytes / 1024.0, Stats.PeakBytes / 1024.0,
+				Stats.LiveCount, Stats.TotalCount,
+				Stats.FrameDeltaBytes / 1024.0, Stats.FrameAllocations);
+		}
+
+		// 인라인 배열: inline = 힙 할당을 피한 횟수 (이전 구조의 할당 수 = inline + heap)
+		const uint64 InlineAllocs = FInlineAllocatorStats::InlineAllocations.load();
+		const uint64 SpilledAllocs = FInlineAllocatorStats::HeapAllocations.load();
+		AddLog("InlineArray: %llu allocs (heap before), %llu allocs (heap now)",
+			InlineAllocs + SpilledAllocs, SpilledAllocs);
+	}
+	else if (Stricmp(command_line, "BENCH CONTAINERS") == 0)
+	{
+		// TMap/TSet(std) vs TFlatMap/TFlatSet(오픈 어드레싱), 게임 스레드를 수백 ms 멈춤
+		AddLog("Container benchmark (std vs flat):");
+		for (const FContainerBenchmarkResult& Result : FContainerBenchmark::Run())
+		{
+			AddLog("%-16s std %8.2f ms  flat %8.2f ms  x%.2f",
+				Result.Name, Result.StdMs, Result.FlatMs,
+				Result.FlatMs > 0.0 ? Result.StdMs / Result.FlatMs : 0.0);
+		}
+	}
 	else if (Strnicmp(command_line, "SKINNING GPU", 12) == 0)
 	{
 		// 전역 스키닝 모드 변경 (모든 World에 적용)
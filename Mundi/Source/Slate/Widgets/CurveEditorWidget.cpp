@@ -492,6 +492,15 @@ void SCurveEditorWidget::RenderGraphView()
 	// 인터랙션 영역
 	ImGui::InvisibleButton("CurveCanvas", CanvasSize);
 	HandleCurveInteraction(CanvasPos, CanvasSize);
+
+	// 이번 프레임에 수정된 트랙의 LUT 다시 베이크 (키/탄젠트/보간 모드 변경 모두 MarkTrackModified를 거침)
+	for (FCurveTrack& Track : CurveState.Tracks)
+	{
+		if (Track.FloatCurve)
+			Track.FloatCurve->BakeIfDirty();
+		if (Track.VectorCurve)
+			Track.VectorCurve->BakeIfDirty();
+	}
 }
 
 void SCurveEditorWidget::RenderTrackCurve(ImDrawList* DrawList, ImVec2 CanvasPos, ImVec2 CanvasSize, FCurveTrack& Track)
@@ -1652,7 +1661,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 		{
 			// Constant: 단일 값 직접 수정 (Y축만)
 			SelectedTrack->FloatCurve->ConstantValue = NewValue;
-			if (EditorState) EditorState->bIsDirty = true;
+			MarkTrackModified(SelectedTrack);
 		}
 		else if (SelectedTrack->FloatCurve->Type == EDistributionType::Uniform)
 		{
@@ -1665,7 +1674,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 			{
 				SelectedTrack->FloatCurve->MaxValue = NewValue;
 			}
-			if (EditorState) EditorState->bIsDirty = true;
+			MarkTrackModified(SelectedTrack);
 		}
 		else if (SelectedTrack->FloatCurve->Type == EDistributionType::ConstantCurve ||
 				 SelectedTrack->FloatCurve->Type == EDistributionType::UniformCurve)
@@ -1696,7 +1705,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 				// CurveAuto/CurveAutoClamped 모드면 탄젠트 재계산
 				CurvePtr->AutoCalculateTangents();
 
-				if (EditorState) EditorState->bIsDirty = true;
+				MarkTrackModified(SelectedTrack);
 			}
 		}
 	}
@@ -1723,7 +1732,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 			if (AxisIndex == 0) Value.X = NewValue;
 			else if (AxisIndex == 1) Value.Y = NewValue;
 			else Value.Z = NewValue;
-			if (EditorState) EditorState->bIsDirty = true;
+			MarkTrackModified(SelectedTrack);
 		}
 		else if (SelectedTrack->VectorCurve->Type == EDistributionType::Uniform)
 		{
@@ -1734,7 +1743,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 			if (AxisIndex == 0) Value.X = NewValue;
 			else if (AxisIndex == 1) Value.Y = NewValue;
 			else Value.Z = NewValue;
-			if (EditorState) EditorState->bIsDirty = true;
+			MarkTrackModified(SelectedTrack);
 		}
 		else if (SelectedTrack->VectorCurve->Type == EDistributionType::ParticleParameter)
 		{
@@ -1743,7 +1752,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 			if (AxisIndex == 0) Value.X = NewValue;
 			else if (AxisIndex == 1) Value.Y = NewValue;
 			else Value.Z = NewValue;
-			if (EditorState) EditorState->bIsDirty = true;
+			MarkTrackModified(SelectedTrack);
 		}
 		else if (SelectedTrack->VectorCurve->Type == EDistributionType::ConstantCurve ||
 				 SelectedTrack->VectorCurve->Type == EDistributionType::UniformCurve)
@@ -1777,7 +1786,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 				// CurveAuto/CurveAutoClamped 모드면 탄젠트 재계산
 				CurvePtr->AutoCalculateTangents();
 
-				if (EditorState) EditorState->bIsDirty = true;
+				MarkTrackModified(SelectedTrack);
 			}
 		}
 	}
@@ -1838,7 +1847,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 					Point.LeaveTangent += TangentDelta;
 				}
 
-				if (EditorState) EditorState->bIsDirty = true;
+				MarkTrackModified(SelectedTrack);
 			}
 		}
 		// Vector 커브
@@ -1889,7 +1898,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 					else Point.LeaveTangent.Z += TangentDelta;
 				}
 
-				if (EditorState) EditorState->bIsDirty = true;
+				MarkTrackModified(SelectedTrack);
 			}
 		}
 	}
@@ -1947,6 +1956,19 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 	}
 }
 
+void SCurveEditorWidget::MarkTrackModified(FCurveTrack* Track)
+{
+	if (EditorState) EditorState->bIsDirty = true;
+
+	if (Track)
+	{
+		if (Track->FloatCurve)
+			Track->FloatCurve->MarkLUTDirty();
+		if (Track->VectorCurve)
+			Track->VectorCurve->MarkLUTDirty();
+	}
+}
+
 void SCurveEditorWidget::AutoFitCurveView()
 {
 	if (CurveState.Tracks.Num() == 0)
@@ -130,5 +130,6 @@ private:
 
 	// 인터랙션
 	void HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasSize);
+	void MarkTrackModified(FCurveTrack* Track);	// 에셋 dirty + LUT 재베이크 예약
 	void AutoFitCurveView();
 };
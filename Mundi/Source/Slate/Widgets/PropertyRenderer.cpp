@@ -3853,6 +3853,31 @@ bool UPropertyRenderer::RenderInterpCurveVectorUniform(const char* Label, FInter
 	return bChanged;
 }
 
+bool UPropertyRenderer::RenderDistributionBakeOptions(bool& bBakeToLUT, int32& LUTResolution, const FDistributionLookupTable& LUT)
+{
+	bool bChanged = false;
+
+	if (ImGui::Checkbox("LUT 베이크", &bBakeToLUT))
+		bChanged = true;
+
+	if (bBakeToLUT)
+	{
+		if (ImGui::DragInt("LUT 해상도", &LUTResolution, 1.0f, MinDistributionLUTResolution, MaxDistributionLUTResolution))
+		{
+			LUTResolution = FMath::Clamp(LUTResolution, MinDistributionLUTResolution, MaxDistributionLUTResolution);
+			bChanged = true;
+		}
+
+		// 원본 커브 대비 최대 오차 (Constant 보간 키가 있으면 계단 때문에 커짐 → 해상도를 올리거나 베이크 해제)
+		if (LUT.NumSamples > 0)
+			ImGui::Text("최대 오차: %.5f (%d 샘플)", LUT.MaxError, LUT.NumSamples);
+		else
+			ImGui::TextDisabled("베이크할 키가 없습니다");
+	}
+
+	return bChanged;
+}
+
 bool UPropertyRenderer::RenderDistributionFloatProperty(const FProperty& Prop, void* Instance)
 {
 	FDistributionFloat* Dist = Prop.GetValuePtr<FDistributionFloat>(Instance);
@@ -3892,7 +3917,7 @@ bool UPropertyRenderer::RenderDistributionFloatProperty(const FProperty& Prop, v
 				strncpy_s(Buffer, Dist->ParameterName.c_str(), 255);
 				if (ImGui::InputText("파라미터명", Buffer, 256))
 				{
-					Dist->ParameterName = Buffer;
+					Dist->SetParameterName(Buffer);
 					bChanged = true;
 				}
 				if (ImGui::DragFloat("기본값", &Dist->ParameterDefaultValue, 0.01f))
@@ -3901,9 +3926,16 @@ bool UPropertyRenderer::RenderDistributionFloatProperty(const FProperty& Prop, v
 			break;
 		}
 
+		if (Dist->Type == EDistributionType::ConstantCurve || Dist->Type == EDistributionType::UniformCurve)
+			bChanged |= RenderDistributionBakeOptions(Dist->bBakeToLUT, Dist->LUTResolution, Dist->LUT);
+
 		ImGui::TreePop();
 	}
 
+	// 커브/모드가 바뀌었으면 LUT 다시 베이크
+	if (bChanged)
+		Dist->Bake();
+
 	return bChanged;
 }
 
@@ -3946,7 +3978,7 @@ bool UPropertyRenderer::RenderDistributionVectorProperty(const FProperty& Prop,
 				strncpy_s(Buffer, Dist->ParameterName.c_str(), 255);
 				if (ImGui::InputText("파라미터명", Buffer, 256))
 				{
-					Dist->ParameterName = Buffer;
+					Dist->SetParameterName(Buffer);
 					bChanged = true;
 				}
 				if (ImGui::DragFloat3("기본값", &Dist->ParameterDefaultValue.X, 0.01f))
@@ -3955,9 +3987,16 @@ bool UPropertyRenderer::RenderDistributionVectorProperty(const FProperty& Prop,
 			break;
 		}
 
+		if (Dist->Type == EDistributionType::ConstantCurve || Dist->Type == EDistributionType::UniformCurve)
+			bChanged |= RenderDistributionBakeOptions(Dist->bBakeToLUT, Dist->LUTResolution, Dist->LUT);
+
 		ImGui::TreePop();
 	}
 
+	// 커브/모드가 바뀌었으면 LUT 다시 베이크
+	if (bChanged)
+		Dist->Bake();
+
 	return bChanged;
 }
 
@@ -4020,12 +4059,16 @@ bool UPropertyRenderer::RenderDistributionColorProperty(const FProperty& Prop, v
 					strncpy_s(Buffer, Dist->RGB.ParameterName.c_str(), 255);
 					if (ImGui::InputText("파라미터명##RGB", Buffer, 256))
 					{
-						Dist->RGB.ParameterName = Buffer;
+						Dist->RGB.SetParameterName(Buffer);
 						bChanged = true;
 					}
 				}
 				break;
 			}
+
+			if (Dist->RGB.Type == EDistributionType::ConstantCurve || Dist->RGB.Type == EDistributionType::UniformCurve)
+				bChanged |= RenderDistributionBakeOptions(Dist->RGB.bBakeToLUT, Dist->RGB.LUTResolution, Dist->RGB.LUT);
+
 			ImGui::TreePop();
 		}
 
@@ -4063,17 +4106,25 @@ bool UPropertyRenderer::RenderDistributionColorProperty(const FProperty& Prop, v
 					strncpy_s(Buffer, Dist->Alpha.ParameterName.c_str(), 255);
 					if (ImGui::InputText("파라미터명##Alpha", Buffer, 256))
 					{
-						Dist->Alpha.ParameterName = Buffer;
+						Dist->Alpha.SetParameterName(Buffer);
 						bChanged = true;
 					}
 				}
 				break;
 			}
+
+			if (Dist->Alpha.Type == EDistributionType::ConstantCurve || Dist->Alpha.Type == EDistributionType::UniformCurve)
+				bChanged |= RenderDistributionBakeOptions(Dist->Alpha.bBakeToLUT, Dist->Alpha.LUTResolution, Dist->Alpha.LUT);
+
 			ImGui::TreePop();
 		}
 
 		ImGui::TreePop();
 	}
 
+	// 커브/모드가 바뀌었으면 LUT 다시 베이크
+	if (bChanged)
+		Dist->Bake();
+
 	return bChanged;
 }
@@ -75,6 +75,7 @@ private:
 	static bool RenderInterpCurveVector(const char* Label, struct FInterpCurveVector& Curve);
 	static bool RenderInterpCurveFloatUniform(const char* Label, struct FInterpCurveFloat& MinCurve, struct FInterpCurveFloat& MaxCurve);
 	static bool RenderInterpCurveVectorUniform(const char* Label, struct FInterpCurveVector& MinCurve, struct FInterpCurveVector& MaxCurve);
+	static bool RenderDistributionBakeOptions(bool& bBakeToLUT, int32& LUTResolution, const struct FDistributionLookupTable& LUT);
 
 	static void CacheResources();	// 필요할 때 리소스 목록을 멤버 변수에 캐시합니다.
 
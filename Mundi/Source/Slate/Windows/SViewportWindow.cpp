@@ -1438,6 +1438,8 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				UStatsOverlayD2D::Get().SetShowShadow(false);
 				UStatsOverlayD2D::Get().SetShowSkinning(false);
 				UStatsOverlayD2D::Get().SetShowParticles(false);
+				UStatsOverlayD2D::Get().SetShowCulling(false);
+				UStatsOverlayD2D::Get().SetShowMeshDraw(false);
 			}
 
 			if (ImGui::IsItemHovered())
@@ -1547,6 +1549,26 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				ImGui::SetTooltip("파티클 시스템 통계를 표시합니다. (시스템 수, 이미터 수, 파티클 수, 메모리 사용량)");
 			}
 
+			bool bCullingStats = UStatsOverlayD2D::Get().IsCullingVisible();
+			if (ImGui::Checkbox(" CULLING", &bCullingStats))
+			{
+				UStatsOverlayD2D::Get().ToggleCulling();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("절두체 컬링 통계를 표시합니다. (보이는/컬링된 메시와 데칼 수, 소요 시간)");
+			}
+
+			bool bMeshDrawStats = UStatsOverlayD2D::Get().IsMeshDrawVisible();
+			if (ImGui::Checkbox(" MESH DRAW", &bMeshDrawStats))
+			{
+				UStatsOverlayD2D::Get().ToggleMeshDraw();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("불투명 메시 드로우 통계를 표시합니다. (병합 전 배치 수, 드로우 콜 수, 자동 인스턴싱 병합 비율)");
+			}
+
 			ImGui::EndMenu();
 		}
 
@@ -1987,7 +2009,7 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				if (tempTileSize >= 4 && tempTileSize <= 64)
 				{
 					RenderSettings.SetTileSize(tempTileSize);
-					// TileLightCuller는 매 프레임 생성되므로 다음 프레임에 자동 적용됨
+					// SceneRenderer가 매 프레임 TileLightCuller에 전달하므로 다음 프레임에 자동 적용됨
 				}
 			}
 			if (ImGui::IsItemHovered())
@@ -2005,6 +2027,17 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			ImGui::SetTooltip("타일 기반 라이트 컬링 설정");
 		}
 
+		// ===== 소프트웨어 오클루전 컬링 =====
+		bool bOcclusionCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_OcclusionCulling);
+		if (ImGui::Checkbox(" 오클루전 컬링", &bOcclusionCulling))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_OcclusionCulling);
+		}
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("오클루더로 지정한(bUseAsOccluder) 스태틱 메시에 가려진 메시를 CPU에서 컬링합니다.");
+		}
+
 		// ===== 그림자 안티 에일리어싱 =====
 		bool bShadowAA = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_ShadowAntiAliasing);
 		if (ImGui::Checkbox("##ShadowAA", &bShadowAA))
@@ -46,6 +46,21 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 
     try
     {
+#ifdef _GAME
+        // -headless: 윈도우 없이 고정 프레임 수만큼 실행하고 통계 파일을 남긴 뒤 종료
+        const FHeadlessOptions HeadlessOptions = FHeadlessOptions::Parse(lpCmdLine);
+        if (HeadlessOptions.bEnabled)
+        {
+            if (!GEngine.StartupHeadless(HeadlessOptions))
+                return -1;
+
+            GEngine.RunHeadless();
+            GEngine.Shutdown();
+            CoUninitialize();
+            return 0;
+        }
+#endif
+
         if (!GEngine.Startup(hInstance))
             return -1;
 
@@ -52,6 +52,8 @@
 #include "ResourceData.h"
 #include "VertexData.h"
 #include "UEContainer.h"
+#include "FrameArena.h"
+#include "FlatMap.h"
 #include "Name.h"
 #include "PathUtils.h"
 #include "Object.h"